@@ -0,0 +1,61 @@
+/*
+** Output:
+**
+**  $ ./contexts
+**  context 0: rax = 0x1
+**  context 1: rax = 0x2
+**  context 2: rax = 0x3
+**  context 3: rax = 0x4
+*/
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <triton/api.hpp>
+#include <triton/x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+using namespace triton::arch::x86;
+
+
+/* inc rax */
+static unsigned char opcodes[] = "\x48\xff\xc0";
+
+
+static void emulate(API* ctx, unsigned int steps) {
+  /* Each method of ctx makes the engines of this thread work on ctx */
+  for (unsigned int i = 0; i < steps; i++) {
+    Instruction inst;
+    inst.setOpcodes(opcodes, 3);
+    inst.setAddress(0x400000);
+    ctx->processing(inst);
+  }
+}
+
+
+int main(int ac, const char **av) {
+  std::vector<API*> contexts;
+  std::vector<std::thread> threads;
+
+  /* The architecture of each context must be set before starting the threads */
+  for (unsigned int i = 0; i < 4; i++) {
+    contexts.push_back(new API());
+    contexts[i]->setArchitecture(ARCH_X86_64);
+  }
+
+  /* One independent emulation per thread */
+  for (unsigned int i = 0; i < 4; i++)
+    threads.push_back(std::thread(emulate, contexts[i], i + 1));
+
+  for (unsigned int i = 0; i < 4; i++)
+    threads[i].join();
+
+  for (unsigned int i = 0; i < 4; i++) {
+    std::cout << "context " << i << ": rax = 0x" << std::hex << contexts[i]->getConcreteRegisterValue(TRITON_X86_REG_RAX) << std::endl;
+    delete contexts[i];
+  }
+
+  return 0;
+}
@@ -0,0 +1,83 @@
+/*
+** Explores the check function of the crackme_xor sample (see code_coverage_crackme_xor.py)
+** with 4 worker threads. Each new input is printed as the 5 bytes of the serial.
+*/
+
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <triton/explorationEngine.hpp>
+#include <triton/x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+using namespace triton::arch::x86;
+using namespace triton::engines::exploration;
+
+
+/* <check> function */
+static const std::vector<triton::uint8> function = {
+  0x55,                                      /* push    rbp                           */
+  0x48, 0x89, 0xe5,                          /* mov     rbp,rsp                       */
+  0x48, 0x89, 0x7d, 0xe8,                    /* mov     QWORD PTR [rbp-0x18],rdi      */
+  0xc7, 0x45, 0xfc, 0x00, 0x00, 0x00, 0x00,  /* mov     DWORD PTR [rbp-0x4],0x0       */
+  0xeb, 0x3f,                                /* jmp     4005bd <check+0x50>           */
+  0x8b, 0x45, 0xfc,                          /* mov     eax,DWORD PTR [rbp-0x4]       */
+  0x48, 0x63, 0xd0,                          /* movsxd  rdx,eax                       */
+  0x48, 0x8b, 0x45, 0xe8,                    /* mov     rax,QWORD PTR [rbp-0x18]      */
+  0x48, 0x01, 0xd0,                          /* add     rax,rdx                       */
+  0x0f, 0xb6, 0x00,                          /* movzx   eax,BYTE PTR [rax]            */
+  0x0f, 0xbe, 0xc0,                          /* movsx   eax,al                        */
+  0x83, 0xe8, 0x01,                          /* sub     eax,0x1                       */
+  0x83, 0xf0, 0x55,                          /* xor     eax,0x55                      */
+  0x89, 0xc1,                                /* mov     ecx,eax                       */
+  0x48, 0x8b, 0x15, 0xa0, 0x0a, 0x20, 0x00,  /* mov     rdx,QWORD PTR [rip+0x200aa0]  */
+  0x8b, 0x45, 0xfc,                          /* mov     eax,DWORD PTR [rbp-0x4]       */
+  0x48, 0x98,                                /* cdqe                                  */
+  0x48, 0x01, 0xd0,                          /* add     rax,rdx                       */
+  0x0f, 0xb6, 0x00,                          /* movzx   eax,BYTE PTR [rax]            */
+  0x0f, 0xbe, 0xc0,                          /* movsx   eax,al                        */
+  0x39, 0xc1,                                /* cmp     ecx,eax                       */
+  0x74, 0x07,                                /* je      4005b9 <check+0x4c>           */
+  0xb8, 0x01, 0x00, 0x00, 0x00,              /* mov     eax,0x1                       */
+  0xeb, 0x0f,                                /* jmp     4005c8 <check+0x5b>           */
+  0x83, 0x45, 0xfc, 0x01,                    /* add     DWORD PTR [rbp-0x4],0x1       */
+  0x83, 0x7d, 0xfc, 0x04,                    /* cmp     DWORD PTR [rbp-0x4],0x4       */
+  0x7e, 0xbb,                                /* jle     40057e <check+0x11>           */
+  0xb8, 0x00, 0x00, 0x00, 0x00,              /* mov     eax,0x0                       */
+  0x5d,                                      /* pop     rbp                           */
+  0xc3,                                      /* ret                                   */
+};
+
+
+int main(int ac, const char **av) {
+  ExplorationEngine engine(ARCH_X86_64, 4);
+
+  /* The function and its data */
+  engine.addMemoryArea(0x40056d, function);
+  engine.addMemoryArea(0x601040, {0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00});
+  engine.addMemoryArea(0x900000, {0x31, 0x3e, 0x3d, 0x26, 0x31});
+  engine.setEntryPoint(0x40056d);
+
+  /* The serial to find is pointed by RDI */
+  engine.setConcreteRegisterValue(ID_REG_RDI, 0x1000);
+  engine.setConcreteRegisterValue(ID_REG_RSP, 0x7fffffff);
+  engine.setConcreteRegisterValue(ID_REG_RBP, 0x7fffffff);
+  engine.addSymbolicInput(0x1000, 5);
+
+  engine.setInputCallback([](const ExplorationEngine::Input& input) {
+    std::cout << "new input:";
+    for (triton::uint64 addr = 0x1000; addr < 0x1005; addr++) {
+      auto it = input.find(addr);
+      std::cout << " " << std::hex << std::setw(2) << std::setfill('0') << (it != input.end() ? static_cast<triton::uint32>(it->second) : 0);
+    }
+    std::cout << std::endl;
+  });
+
+  engine.explore(ExplorationEngine::Input());
+
+  std::cout << std::dec << engine.getNumberOfRuns() << " runs, " << engine.getCoverage().size() << " basic blocks" << std::endl;
+
+  return 0;
+}
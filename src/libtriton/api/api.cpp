@@ -7,8 +7,12 @@
 
 #include <map>
 #include <list>
+#include <sstream>
+#include <unordered_set>
 
 #include <api.hpp>
+#include <astBatchEvaluator.hpp>
+#include <astPythonWriter.hpp>
 #include <exceptions.hpp>
 
 
@@ -171,7 +175,27 @@ $ make
 namespace triton {
 
   /* External access to the API */
-  API api = API();
+  API api;
+
+  /* The context of each thread */
+  thread_local API* context = &api;
+
+
+  API* setContext(API* api) {
+    API* previous = triton::context;
+    triton::context = (api != nullptr) ? api : &triton::api;
+    return previous;
+  }
+
+
+  ContextScope::ContextScope(const API& api) {
+    this->previous = triton::setContext(const_cast<API*>(&api));
+  }
+
+
+  ContextScope::~ContextScope() {
+    triton::setContext(this->previous);
+  }
 
 
   API::API() {
@@ -187,6 +211,7 @@ namespace triton {
 
 
   API::~API() {
+    triton::ContextScope scope(*this);
     this->removeEngines();
   }
 
@@ -211,6 +236,7 @@ namespace triton {
 
 
   triton::arch::CpuInterface* API::getCpu(void) {
+    triton::ContextScope scope(*this);
     if (!this->isArchitectureValid())
       throw triton::exceptions::API("API::checkArchitecture(): You must define an architecture.");
     return this->arch.getCpu();
@@ -218,6 +244,8 @@ namespace triton {
 
 
   void API::setArchitecture(triton::uint32 arch) {
+    triton::ContextScope scope(*this);
+
     /* Setup and init the targeted architecture */
     this->arch.setArchitecture(arch);
 
@@ -228,125 +256,156 @@ namespace triton {
 
 
   void API::clearArchitecture(void) {
+    triton::ContextScope scope(*this);
     this->checkArchitecture();
     this->arch.clearArchitecture();
   }
 
 
   bool API::isCpuFlag(triton::uint32 regId) const {
+    triton::ContextScope scope(*this);
     return this->arch.isFlag(regId);
   }
 
 
   bool API::isCpuRegister(triton::uint32 regId) const {
+    triton::ContextScope scope(*this);
     return this->arch.isRegister(regId);
   }
 
 
   bool API::isCpuRegisterValid(triton::uint32 regId) const {
+    triton::ContextScope scope(*this);
     return this->arch.isRegisterValid(regId);
   }
 
 
   triton::uint32 API::cpuRegisterSize(void) const {
+    triton::ContextScope scope(*this);
     return this->arch.registerSize();
   }
 
 
   triton::uint32 API::cpuRegisterBitSize(void) const {
+    triton::ContextScope scope(*this);
     return this->arch.registerBitSize();
   }
 
 
   triton::uint32 API::cpuInvalidRegister(void) const {
+    triton::ContextScope scope(*this);
     return this->arch.invalidRegister();
   }
 
 
   triton::uint32 API::cpuNumberOfRegisters(void) const {
+    triton::ContextScope scope(*this);
     return this->arch.numberOfRegisters();
   }
 
 
   std::tuple<std::string, triton::uint32, triton::uint32, triton::uint32> API::getCpuRegInformation(triton::uint32 reg) const {
+    triton::ContextScope scope(*this);
     return this->arch.getRegisterInformation(reg);
   }
 
 
   std::set<triton::arch::Register*> API::getAllRegisters(void) const {
+    triton::ContextScope scope(*this);
     this->checkArchitecture();
     return this->arch.getAllRegisters();
   }
 
 
   std::set<triton::arch::Register*> API::getParentRegisters(void) const {
+    triton::ContextScope scope(*this);
     this->checkArchitecture();
     return this->arch.getParentRegisters();
   }
 
 
   triton::uint8 API::getConcreteMemoryValue(triton::uint64 addr) const {
+    triton::ContextScope scope(*this);
     return this->arch.getConcreteMemoryValue(addr);
   }
 
 
   triton::uint512 API::getConcreteMemoryValue(const triton::arch::MemoryAccess& mem) const {
+    triton::ContextScope scope(*this);
     return this->arch.getConcreteMemoryValue(mem);
   }
 
 
   std::vector<triton::uint8> API::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size) const {
+    triton::ContextScope scope(*this);
     return this->arch.getConcreteMemoryAreaValue(baseAddr, size);
   }
 
 
   triton::uint512 API::getConcreteRegisterValue(const triton::arch::Register& reg) const {
+    triton::ContextScope scope(*this);
     return this->arch.getConcreteRegisterValue(reg);
   }
 
 
   void API::setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value) {
+    triton::ContextScope scope(*this);
     this->arch.setConcreteMemoryValue(addr, value);
   }
 
 
   void API::setConcreteMemoryValue(const triton::arch::MemoryAccess& mem) {
+    triton::ContextScope scope(*this);
     this->arch.setConcreteMemoryValue(mem);
   }
 
 
   void API::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values) {
+    triton::ContextScope scope(*this);
     this->arch.setConcreteMemoryAreaValue(baseAddr, values);
   }
 
 
   void API::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) {
+    triton::ContextScope scope(*this);
     this->arch.setConcreteMemoryAreaValue(baseAddr, area, size);
   }
 
 
   void API::setConcreteRegisterValue(const triton::arch::Register& reg) {
+    triton::ContextScope scope(*this);
     this->arch.setConcreteRegisterValue(reg);
   }
 
 
   bool API::isMemoryMapped(triton::uint64 baseAddr, triton::usize size) {
+    triton::ContextScope scope(*this);
     return this->arch.isMemoryMapped(baseAddr, size);
   }
 
 
   void API::unmapMemory(triton::uint64 baseAddr, triton::usize size) {
+    triton::ContextScope scope(*this);
     this->arch.unmapMemory(baseAddr, size);
   }
 
 
   void API::disassembly(triton::arch::Instruction& inst) const {
+    triton::ContextScope scope(*this);
     this->checkArchitecture();
     this->arch.disassembly(inst);
   }
 
 
+  std::map<std::string, triton::usize> API::getDisassemblyCacheStats(void) const {
+    triton::ContextScope scope(*this);
+    this->checkArchitecture();
+    return this->arch.getDisassemblyCacheStats();
+  }
+
+
   void API::buildSemantics(triton::arch::Instruction& inst) {
+    triton::ContextScope scope(*this);
     this->checkArchitecture();
 
     /* Stage 1 - Update the context memory */
@@ -362,14 +421,32 @@ namespace triton {
     }
 
     /* Stage 3 - Initialize the target address of memory operands */
+    bool taintOnly = !this->isSymbolicEngineEnabled() && this->isSymbolicOptimizationEnabled(triton::engines::symbolic::TAINT_ONLY_SEMANTICS);
     std::vector<triton::arch::OperandWrapper>::iterator it3;
     for (it3 = inst.operands.begin(); it3 != inst.operands.end(); it3++) {
       if (it3->getType() == triton::arch::OP_MEM) {
-        it3->getMemory().initAddress();
+        if (taintOnly)
+          it3->getMemory().initConcreteAddress();
+        else
+          it3->getMemory().initAddress();
       }
     }
 
-    this->arch.buildSemantics(inst);
+    /* Stage 4 - Record the taint labels read by the instruction */
+    if (this->taint)
+      this->taint->recordInstructionLabels(true);
+
+    try {
+      this->arch.buildSemantics(inst);
+    }
+    catch (...) {
+      if (this->taint)
+        this->taint->recordInstructionLabels(false);
+      throw;
+    }
+
+    if (this->taint)
+      this->taint->recordInstructionLabels(false);
   }
 
 
@@ -411,7 +488,6 @@ namespace triton {
 
   void API::removeEngines(void) {
     if(this->isArchitectureValid()) {
-      delete this->astGarbageCollector;
       delete this->astRepresentation;
       delete this->callbacks;
       delete this->solver;
@@ -419,6 +495,9 @@ namespace triton {
       delete this->symbolicBackup;
       delete this->taint;
 
+      /* Must be the last one, it owns the storage of AST nodes freed by the other engines */
+      delete this->astGarbageCollector;
+
       this->astGarbageCollector = nullptr;
       this->astRepresentation   = nullptr;
       this->callbacks           = nullptr;
@@ -431,6 +510,8 @@ namespace triton {
 
 
   void API::resetEngines(void) {
+    triton::ContextScope scope(*this);
+
     if(this->isArchitectureValid()) {
       this->removeEngines();
       this->initEngines();
@@ -440,9 +521,16 @@ namespace triton {
 
 
   void API::processing(triton::arch::Instruction& inst) {
+    /* The engines work on the context of the thread */
+    triton::ContextScope scope(*this);
+
     this->checkArchitecture();
     this->disassembly(inst);
     this->buildSemantics(inst);
+
+    /* Remove the dead expressions each time the number of expressions has doubled */
+    if (this->isSymbolicOptimizationEnabled(triton::engines::symbolic::RECLAIM_EXPRESSIONS) && this->symbolic->isReclaimNeeded())
+      this->reclaimSymbolicExpressions(inst);
   }
 
 
@@ -455,61 +543,94 @@ namespace triton {
   }
 
 
+  void* API::allocateAstNode(triton::usize size) {
+    this->checkAstGarbageCollector();
+    return this->astGarbageCollector->allocateAstNode(size);
+  }
+
+
+  void API::deallocateAstNode(void* node) {
+    this->checkAstGarbageCollector();
+    this->astGarbageCollector->deallocateAstNode(node);
+  }
+
+
   void API::freeAllAstNodes(void) {
+    triton::ContextScope scope(*this);
     this->checkAstGarbageCollector();
+    if (this->solver)
+      this->solver->removeSolverSession();
     this->astGarbageCollector->freeAllAstNodes();
   }
 
 
   void API::freeAstNodes(std::set<triton::ast::AbstractNode*>& nodes) {
+    triton::ContextScope scope(*this);
     this->checkAstGarbageCollector();
+    if (this->solver)
+      this->solver->removeTranslatedNodes(nodes);
     this->astGarbageCollector->freeAstNodes(nodes);
   }
 
 
   void API::extractUniqueAstNodes(std::set<triton::ast::AbstractNode*>& uniqueNodes, triton::ast::AbstractNode* root) const {
+    triton::ContextScope scope(*this);
     this->checkAstGarbageCollector();
     this->astGarbageCollector->extractUniqueAstNodes(uniqueNodes, root);
   }
 
 
   triton::ast::AbstractNode* API::recordAstNode(triton::ast::AbstractNode* node) {
+    triton::ContextScope scope(*this);
     this->checkAstGarbageCollector();
     return this->astGarbageCollector->recordAstNode(node);
   }
 
 
   void API::recordVariableAstNode(const std::string& name, triton::ast::AbstractNode* node) {
+    triton::ContextScope scope(*this);
     this->checkAstGarbageCollector();
     this->astGarbageCollector->recordVariableAstNode(name, node);
   }
 
 
-  const std::set<triton::ast::AbstractNode*>& API::getAllocatedAstNodes(void) const {
+  std::set<triton::ast::AbstractNode*> API::getAllocatedAstNodes(void) const {
+    triton::ContextScope scope(*this);
     this->checkAstGarbageCollector();
     return this->astGarbageCollector->getAllocatedAstNodes();
   }
 
 
+  std::map<std::string, triton::usize> API::getAstArenaStats(void) const {
+    triton::ContextScope scope(*this);
+    this->checkAstGarbageCollector();
+    return this->astGarbageCollector->getAstArenaStats();
+  }
+
+
   const std::map<std::string, triton::ast::AbstractNode*>& API::getAstVariableNodes(void) const {
+    triton::ContextScope scope(*this);
     this->checkAstGarbageCollector();
     return this->astGarbageCollector->getAstVariableNodes();
   }
 
 
   triton::ast::AbstractNode* API::getAstVariableNode(const std::string& name) const {
+    triton::ContextScope scope(*this);
     this->checkAstGarbageCollector();
     return this->astGarbageCollector->getAstVariableNode(name);
   }
 
 
   void API::setAllocatedAstNodes(const std::set<triton::ast::AbstractNode*>& nodes) {
+    triton::ContextScope scope(*this);
     this->checkAstGarbageCollector();
     this->astGarbageCollector->setAllocatedAstNodes(nodes);
   }
 
 
   void API::setAstVariableNodes(const std::map<std::string, triton::ast::AbstractNode*>& nodes) {
+    triton::ContextScope scope(*this);
     this->checkAstGarbageCollector();
     this->astGarbageCollector->setAstVariableNodes(nodes);
   }
@@ -525,23 +646,42 @@ namespace triton {
 
 
   std::ostream& API::printAstRepresentation(std::ostream& stream, triton::ast::AbstractNode* node) {
+    triton::ContextScope scope(*this);
     this->checkAstRepresentation();
     return this->astRepresentation->print(stream, node);
   }
 
 
   triton::uint32 API::getAstRepresentationMode(void) const {
+    triton::ContextScope scope(*this);
     this->checkAstRepresentation();
     return this->astRepresentation->getMode();
   }
 
 
   void API::setAstRepresentationMode(triton::uint32 mode) {
+    triton::ContextScope scope(*this);
     this->checkAstRepresentation();
     this->astRepresentation->setMode(mode);
   }
 
 
+  std::string API::getPythonCode(triton::ast::AbstractNode* node) {
+    triton::ContextScope scope(*this);
+    std::ostringstream code;
+    this->writePythonCode(code, node);
+    return code.str();
+  }
+
+
+  void API::writePythonCode(std::ostream& stream, triton::ast::AbstractNode* node) {
+    triton::ContextScope scope(*this);
+    this->checkSymbolic();
+    triton::ast::representations::AstPythonWriter writer(stream);
+    writer.write(node);
+  }
+
+
 
   /* Callbacks API ================================================================================= */
 
@@ -552,12 +692,14 @@ namespace triton {
 
 
   void API::addCallback(triton::callbacks::memoryHitCallback cb) {
+    triton::ContextScope scope(*this);
     this->checkCallbacks();
     this->callbacks->addCallback(cb);
   }
 
 
   void API::addCallback(triton::callbacks::symbolicSimplificationCallback cb) {
+    triton::ContextScope scope(*this);
     this->checkCallbacks();
     this->callbacks->addCallback(cb);
   }
@@ -565,6 +707,7 @@ namespace triton {
 
   #ifdef TRITON_PYTHON_BINDINGS
   void API::addCallback(PyObject* function, triton::callbacks::callback_e kind) {
+    triton::ContextScope scope(*this);
     this->checkCallbacks();
     this->callbacks->addCallback(function, kind);
   }
@@ -572,12 +715,14 @@ namespace triton {
 
 
   void API::removeCallback(triton::callbacks::memoryHitCallback cb) {
+    triton::ContextScope scope(*this);
     this->checkCallbacks();
     this->callbacks->removeCallback(cb);
   }
 
 
   void API::removeCallback(triton::callbacks::symbolicSimplificationCallback cb) {
+    triton::ContextScope scope(*this);
     this->checkCallbacks();
     this->callbacks->removeCallback(cb);
   }
@@ -585,6 +730,7 @@ namespace triton {
 
   #ifdef TRITON_PYTHON_BINDINGS
   void API::removeCallback(PyObject* function, triton::callbacks::callback_e kind) {
+    triton::ContextScope scope(*this);
     this->checkCallbacks();
     this->callbacks->removeCallback(function, kind);
   }
@@ -592,6 +738,7 @@ namespace triton {
 
 
   triton::ast::AbstractNode* API::processCallbacks(triton::callbacks::callback_e kind, triton::ast::AbstractNode* node) const {
+    triton::ContextScope scope(*this);
     this->checkCallbacks();
     if (this->callbacks->isDefined)
       return this->callbacks->processCallbacks(kind, node);
@@ -600,6 +747,7 @@ namespace triton {
 
 
   void API::processCallbacks(triton::callbacks::callback_e kind, triton::uint64 address) const {
+    triton::ContextScope scope(*this);
     this->checkCallbacks();
     if (this->callbacks->isDefined)
       this->callbacks->processCallbacks(kind, address);
@@ -616,40 +764,47 @@ namespace triton {
 
 
   void API::backupSymbolicEngine(void) {
+    triton::ContextScope scope(*this);
     *this->symbolicBackup = *this->symbolic;
   }
 
 
   void API::restoreSymbolicEngine(void) {
+    triton::ContextScope scope(*this);
     *this->symbolic = *this->symbolicBackup;
   }
 
 
   triton::engines::symbolic::SymbolicEngine* API::getSymbolicEngine(void) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic;
   }
 
 
   triton::engines::symbolic::SymbolicVariable* API::convertExpressionToSymbolicVariable(triton::usize exprId, triton::uint32 symVarSize, const std::string& symVarComment) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->convertExpressionToSymbolicVariable(exprId, symVarSize, symVarComment);
   }
 
 
   triton::engines::symbolic::SymbolicVariable* API::convertMemoryToSymbolicVariable(const triton::arch::MemoryAccess& mem, const std::string& symVarComment) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->convertMemoryToSymbolicVariable(mem, symVarComment);
   }
 
 
   triton::engines::symbolic::SymbolicVariable* API::convertRegisterToSymbolicVariable(const triton::arch::Register& reg, const std::string& symVarComment) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->convertRegisterToSymbolicVariable(reg, symVarComment);
   }
 
 
   triton::ast::AbstractNode* API::buildSymbolicOperand(triton::arch::OperandWrapper& op) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     switch (op.getType()) {
       case triton::arch::OP_IMM: return this->buildSymbolicImmediate(op.getImmediate());
@@ -662,6 +817,7 @@ namespace triton {
 
 
   triton::ast::AbstractNode* API::buildSymbolicOperand(triton::arch::Instruction& inst, triton::arch::OperandWrapper& op) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     switch (op.getType()) {
       case triton::arch::OP_IMM: return this->buildSymbolicImmediate(inst, op.getImmediate());
@@ -674,60 +830,186 @@ namespace triton {
 
 
   triton::ast::AbstractNode* API::buildSymbolicImmediate(const triton::arch::Immediate& imm) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->buildSymbolicImmediate(imm);
   }
 
 
   triton::ast::AbstractNode* API::buildSymbolicImmediate(triton::arch::Instruction& inst, triton::arch::Immediate& imm) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->buildSymbolicImmediate(inst, imm);
   }
 
 
   triton::ast::AbstractNode* API::buildSymbolicMemory(const triton::arch::MemoryAccess& mem) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->buildSymbolicMemory(mem);
   }
 
 
   triton::ast::AbstractNode* API::buildSymbolicMemory(triton::arch::Instruction& inst, triton::arch::MemoryAccess& mem) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->buildSymbolicMemory(inst, mem);
   }
 
 
   triton::ast::AbstractNode* API::buildSymbolicRegister(const triton::arch::Register& reg) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->buildSymbolicRegister(reg);
   }
 
 
-  triton::ast::AbstractNode* API::buildSymbolicRegister(triton::arch::Instruction& inst, triton::arch::Register& reg) {
+  triton::ast::AbstractNode* API::buildSymbolicRegister(triton::arch::Instruction& inst, const triton::arch::Register& reg) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->buildSymbolicRegister(inst, reg);
   }
 
 
   triton::engines::symbolic::SymbolicExpression* API::newSymbolicExpression(triton::ast::AbstractNode* node, const std::string& comment) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->newSymbolicExpression(node, triton::engines::symbolic::UNDEF, comment);
   }
 
 
   triton::engines::symbolic::SymbolicVariable* API::newSymbolicVariable(triton::uint32 varSize, const std::string& comment) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->newSymbolicVariable(triton::engines::symbolic::UNDEF, 0, varSize, comment);
   }
 
 
   void API::removeSymbolicExpression(triton::usize symExprId) {
+    triton::ContextScope scope(*this);
+    this->checkSymbolic();
+    this->symbolic->removeSymbolicExpression(symExprId);
+    /* The backup must not keep a pointer on the deleted expression */
+    this->symbolicBackup->forgetSymbolicExpressions(std::set<triton::usize>{symExprId});
+  }
+
+
+  void API::pinSymbolicExpression(triton::usize symExprId, bool flag) {
+    triton::ContextScope scope(*this);
+    this->checkSymbolic();
+    this->symbolic->pinSymbolicExpression(symExprId, flag);
+  }
+
+
+  triton::usize API::reclaimSymbolicExpressions(void) {
+    triton::ContextScope scope(*this);
+    std::set<triton::usize> exprs;
+    std::vector<triton::ast::AbstractNode*> nodes;
+    return this->reclaimSymbolicExpressions(exprs, nodes);
+  }
+
+
+  triton::usize API::reclaimSymbolicExpressions(const triton::arch::Instruction& inst) {
+    triton::ContextScope scope(*this);
+    std::set<triton::usize> exprs;
+    std::vector<triton::ast::AbstractNode*> nodes;
+
+    /* The expressions and the nodes of the instruction are kept */
+    for (auto it = inst.symbolicExpressions.begin(); it != inst.symbolicExpressions.end(); it++)
+      exprs.insert((*it)->getId());
+
+    for (auto it = inst.getLoadAccess().begin(); it != inst.getLoadAccess().end(); it++)
+      nodes.push_back(it->second);
+
+    for (auto it = inst.getStoreAccess().begin(); it != inst.getStoreAccess().end(); it++)
+      nodes.push_back(it->second);
+
+    for (auto it = inst.getReadRegisters().begin(); it != inst.getReadRegisters().end(); it++)
+      nodes.push_back(it->second);
+
+    for (auto it = inst.getWrittenRegisters().begin(); it != inst.getWrittenRegisters().end(); it++)
+      nodes.push_back(it->second);
+
+    for (auto it = inst.getReadImmediates().begin(); it != inst.getReadImmediates().end(); it++)
+      nodes.push_back(it->second);
+
+    for (auto it = inst.operands.begin(); it != inst.operands.end(); it++) {
+      if (it->getType() == triton::arch::OP_MEM)
+        nodes.push_back(it->getConstMemory().getLeaAst());
+    }
+
+    return this->reclaimSymbolicExpressions(exprs, nodes);
+  }
+
+
+  triton::usize API::reclaimSymbolicExpressions(std::set<triton::usize>& exprs, std::vector<triton::ast::AbstractNode*>& nodes) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
-    return this->symbolic->removeSymbolicExpression(symExprId);
+
+    /* The semantics of the lazy flags hold nodes, the flags are built first */
+    this->symbolic->materializeLazyFlags();
+
+    /* The backup shares its expressions with the engine, its roots are kept too */
+    bool collected = this->symbolic->collectSymbolicRoots(exprs, nodes);
+    collected &= this->symbolicBackup->collectSymbolicRoots(exprs, nodes);
+
+    std::vector<triton::ast::AbstractNode*> asts;
+    std::set<triton::usize> removed = this->symbolic->reclaimSymbolicExpressions(exprs, nodes, asts);
+    this->symbolicBackup->forgetSymbolicExpressions(removed);
+
+    /* AST nodes are owned by the dictionaries if AST_DICTIONARIES is enabled */
+    if (collected && !this->isSymbolicOptimizationEnabled(triton::engines::symbolic::AST_DICTIONARIES)) {
+      std::unordered_set<triton::ast::AbstractNode*> marked;
+      std::set<triton::ast::AbstractNode*> dead;
+
+      for (auto it = this->symbolic->getSymbolicExpressions().begin(); it != this->symbolic->getSymbolicExpressions().end(); it++)
+        nodes.push_back(it->second->getAst());
+
+      for (auto it = this->symbolicBackup->getSymbolicExpressions().begin(); it != this->symbolicBackup->getSymbolicExpressions().end(); it++)
+        nodes.push_back(it->second->getAst());
+
+      for (auto it = this->getAstVariableNodes().begin(); it != this->getAstVariableNodes().end(); it++)
+        nodes.push_back(it->second);
+
+      /* Mark the live nodes */
+      while (!nodes.empty()) {
+        triton::ast::AbstractNode* node = nodes.back();
+        nodes.pop_back();
+        if (node == nullptr || !marked.insert(node).second)
+          continue;
+        nodes.insert(nodes.end(), node->getChilds().begin(), node->getChilds().end());
+      }
+
+      /*
+       * Only the nodes of the removed expressions are freed. The other nodes which are
+       * not reachable (e.g: a constraint built but not asserted yet) belong to the caller.
+       */
+      while (!asts.empty()) {
+        triton::ast::AbstractNode* node = asts.back();
+        asts.pop_back();
+        if (node == nullptr || marked.find(node) != marked.end() || !dead.insert(node).second)
+          continue;
+        asts.insert(asts.end(), node->getChilds().begin(), node->getChilds().end());
+      }
+
+      /* Live nodes must not be updated through their freed parents */
+      for (auto it = dead.begin(); it != dead.end(); it++) {
+        std::vector<triton::ast::AbstractNode*>& childs = (*it)->getChilds();
+        for (auto child = childs.begin(); child != childs.end(); child++) {
+          if (marked.find(*child) != marked.end())
+            (*child)->removeParent(*it);
+        }
+      }
+
+      this->freeAstNodes(dead);
+    }
+
+    return removed.size();
   }
 
 
   triton::engines::symbolic::SymbolicExpression* API::createSymbolicExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::OperandWrapper& dst, const std::string& comment) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     switch (dst.getType()) {
       case triton::arch::OP_MEM: return this->createSymbolicMemoryExpression(inst, node, dst.getMemory(), comment);
@@ -740,229 +1022,275 @@ namespace triton {
 
 
   triton::engines::symbolic::SymbolicExpression* API::createSymbolicMemoryExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::MemoryAccess& mem, const std::string& comment) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->createSymbolicMemoryExpression(inst, node, mem, comment);
   }
 
 
-  triton::engines::symbolic::SymbolicExpression* API::createSymbolicRegisterExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::Register& reg, const std::string& comment) {
+  triton::engines::symbolic::SymbolicExpression* API::createSymbolicRegisterExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, const triton::arch::Register& reg, const std::string& comment) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->createSymbolicRegisterExpression(inst, node, reg, comment);
   }
 
 
-  triton::engines::symbolic::SymbolicExpression* API::createSymbolicFlagExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::Register& flag, const std::string& comment) {
+  triton::engines::symbolic::SymbolicExpression* API::createSymbolicFlagExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, const triton::arch::Register& flag, const std::string& comment) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->createSymbolicFlagExpression(inst, node, flag, comment);
   }
 
 
+  void API::createLazySymbolicFlagExpression(triton::arch::Instruction& inst, const triton::arch::Register& flag, const triton::uint512& value, triton::usize parent, bool isTainted, const std::function<triton::ast::AbstractNode*(void)>& semantics, const std::string& comment) {
+    triton::ContextScope scope(*this);
+    this->checkSymbolic();
+    this->symbolic->createLazySymbolicFlagExpression(inst, flag, value, parent, isTainted, semantics, comment);
+  }
+
+
   triton::engines::symbolic::SymbolicExpression* API::createSymbolicVolatileExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, const std::string& comment) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->createSymbolicVolatileExpression(inst, node, comment);
   }
 
 
   void API::assignSymbolicExpressionToMemory(triton::engines::symbolic::SymbolicExpression* se, const triton::arch::MemoryAccess& mem) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     this->symbolic->assignSymbolicExpressionToMemory(se, mem);
   }
 
 
   void API::assignSymbolicExpressionToRegister(triton::engines::symbolic::SymbolicExpression* se, const triton::arch::Register& reg) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     this->symbolic->assignSymbolicExpressionToRegister(se, reg);
   }
 
 
   triton::usize API::getSymbolicMemoryId(triton::uint64 addr) const {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicMemoryId(addr);
   }
 
 
   std::map<triton::arch::Register, triton::engines::symbolic::SymbolicExpression*> API::getSymbolicRegisters(void) const {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicRegisters();
   }
 
 
   std::map<triton::uint64, triton::engines::symbolic::SymbolicExpression*> API::getSymbolicMemory(void) const {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicMemory();
   }
 
 
   triton::usize API::getSymbolicRegisterId(const triton::arch::Register& reg) const {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicRegisterId(reg);
   }
 
 
   triton::uint8 API::getSymbolicMemoryValue(triton::uint64 address) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicMemoryValue(address);
   }
 
 
   triton::uint512 API::getSymbolicMemoryValue(const triton::arch::MemoryAccess& mem) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicMemoryValue(mem);
   }
 
 
   std::vector<triton::uint8> API::getSymbolicMemoryAreaValue(triton::uint64 baseAddr, triton::usize size) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicMemoryAreaValue(baseAddr, size);
   }
 
 
   triton::uint512 API::getSymbolicRegisterValue(const triton::arch::Register& reg) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicRegisterValue(reg);
   }
 
 
   triton::ast::AbstractNode* API::browseAstDictionaries(triton::ast::AbstractNode* node) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->browseAstDictionaries(node);
   }
 
 
   std::map<std::string, triton::usize> API::getAstDictionariesStats(void) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getAstDictionariesStats();
   }
 
 
   triton::ast::AbstractNode* API::processSimplification(triton::ast::AbstractNode* node, bool z3) const {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->processSimplification(node, z3);
   }
 
 
   triton::engines::symbolic::SymbolicExpression* API::getSymbolicExpressionFromId(triton::usize symExprId) const {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicExpressionFromId(symExprId);
   }
 
 
   triton::engines::symbolic::SymbolicVariable* API::getSymbolicVariableFromId(triton::usize symVarId) const {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicVariableFromId(symVarId);
   }
 
 
   triton::engines::symbolic::SymbolicVariable* API::getSymbolicVariableFromName(const std::string& symVarName) const {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicVariableFromName(symVarName);
   }
 
 
   const std::vector<triton::engines::symbolic::PathConstraint>& API::getPathConstraints(void) const {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getPathConstraints();
   }
 
 
   triton::ast::AbstractNode* API::getPathConstraintsAst(void) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getPathConstraintsAst();
   }
 
 
   void API::addPathConstraint(const triton::arch::Instruction& inst, triton::engines::symbolic::SymbolicExpression* expr) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     this->symbolic->addPathConstraint(inst, expr);
   }
 
 
   void API::clearPathConstraints(void) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     this->symbolic->clearPathConstraints();
+    if (this->solver)
+      this->solver->resetSolverSession();
   }
 
 
   void API::enableSymbolicEngine(bool flag) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     this->symbolic->enable(flag);
   }
 
 
   void API::enableSymbolicZ3Simplification(bool flag) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     this->symbolic->enableZ3Simplification(flag);
   }
 
 
   void API::enableSymbolicOptimization(enum triton::engines::symbolic::optimization_e opti, bool flag) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     this->symbolic->enableOptimization(opti, flag);
   }
 
 
   bool API::isSymbolicEngineEnabled(void) const {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->isEnabled();
   }
 
 
   bool API::isSymbolicZ3SimplificationEnabled(void) const {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->isZ3SimplificationEnabled();
   }
 
 
   bool API::isSymbolicExpressionIdExists(triton::usize symExprId) const {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->isSymbolicExpressionIdExists(symExprId);
   }
 
 
   bool API::isSymbolicOptimizationEnabled(enum triton::engines::symbolic::optimization_e opti) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->isOptimizationEnabled(opti);
   }
 
 
   void API::concretizeAllMemory(void) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     this->symbolic->concretizeAllMemory();
   }
 
 
   void API::concretizeAllRegister(void) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     this->symbolic->concretizeAllRegister();
   }
 
 
   void API::concretizeMemory(const triton::arch::MemoryAccess& mem) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     this->symbolic->concretizeMemory(mem);
   }
 
 
   void API::concretizeMemory(triton::uint64 addr) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     this->symbolic->concretizeMemory(addr);
   }
 
 
   void API::concretizeRegister(const triton::arch::Register& reg) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     this->symbolic->concretizeRegister(reg);
   }
 
 
   triton::ast::AbstractNode* API::getFullAst(triton::ast::AbstractNode* node) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
-    std::set<triton::usize> processed;
-    return this->symbolic->getFullAst(node, processed);
+    return this->symbolic->getFullAst(node);
   }
 
 
   triton::ast::AbstractNode* API::getAstFromId(triton::usize symExprId) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     triton::engines::symbolic::SymbolicExpression* symExpr = this->getSymbolicExpressionFromId(symExprId);
     return symExpr->getAst();
@@ -970,31 +1298,58 @@ namespace triton {
 
 
   triton::ast::AbstractNode* API::getFullAstFromId(triton::usize symExprId) {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     triton::ast::AbstractNode* partialAst = this->getAstFromId(symExprId);
     return this->getFullAst(partialAst);
   }
 
 
+  std::vector<triton::uint512> API::evaluateAstBatch(triton::ast::AbstractNode* node, const std::map<triton::usize, std::vector<triton::uint512>>& inputs) {
+    triton::ContextScope scope(*this);
+    this->checkSymbolic();
+    triton::ast::AstBatchEvaluator evaluator(node);
+    return evaluator.evaluate(inputs);
+  }
+
+
+  triton::engines::symbolic::SymbolicSlice API::sliceAst(triton::ast::AbstractNode* node) const {
+    triton::ContextScope scope(*this);
+    this->checkSymbolic();
+    return this->symbolic->sliceAst(node);
+  }
+
+
+  triton::engines::symbolic::SymbolicSlice API::sliceExpression(triton::usize symExprId) const {
+    triton::ContextScope scope(*this);
+    this->checkSymbolic();
+    return this->symbolic->sliceExpression(symExprId);
+  }
+
+
   std::list<triton::engines::symbolic::SymbolicExpression*> API::getTaintedSymbolicExpressions(void) const {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getTaintedSymbolicExpressions();
   }
 
 
   const std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*>& API::getSymbolicExpressions(void) const {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicExpressions();
   }
 
 
   const std::map<triton::usize, triton::engines::symbolic::SymbolicVariable*>& API::getSymbolicVariables(void) const {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicVariables();
   }
 
 
   std::string API::getVariablesDeclaration(void) const {
+    triton::ContextScope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getVariablesDeclaration();
   }
@@ -1010,23 +1365,90 @@ namespace triton {
 
 
   std::map<triton::uint32, triton::engines::solver::SolverModel> API::getModel(triton::ast::AbstractNode *node) const {
+    triton::ContextScope scope(*this);
     this->checkSolver();
     return this->solver->getModel(node);
   }
 
 
   std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> API::getModels(triton::ast::AbstractNode *node, triton::uint32 limit) const {
+    triton::ContextScope scope(*this);
     this->checkSolver();
     return this->solver->getModels(node, limit);
   }
 
 
   triton::uint512 API::evaluateAstViaZ3(triton::ast::AbstractNode *node) const {
+    triton::ContextScope scope(*this);
     this->checkSolver();
     return this->solver->evaluateAstViaZ3(node);
   }
 
 
+  std::string API::getSmtFormula(triton::ast::AbstractNode *node) const {
+    triton::ContextScope scope(*this);
+    this->checkSolver();
+    return this->solver->getSmtFormula(node);
+  }
+
+
+  void API::writeSmtFormula(std::ostream& stream, triton::ast::AbstractNode *node) const {
+    triton::ContextScope scope(*this);
+    this->checkSolver();
+    this->solver->writeSmtFormula(stream, node);
+  }
+
+
+  triton::engines::solver::SolverSession& API::getSolverSession(void) {
+    triton::ContextScope scope(*this);
+    this->checkSolver();
+    return this->solver->getSolverSession();
+  }
+
+
+  void API::addSolverSessionConstraint(triton::ast::AbstractNode *node) {
+    triton::ContextScope scope(*this);
+    this->getSolverSession().addConstraint(node);
+  }
+
+
+  void API::pushSolverSession(void) {
+    triton::ContextScope scope(*this);
+    this->getSolverSession().push();
+  }
+
+
+  void API::popSolverSession(void) {
+    triton::ContextScope scope(*this);
+    this->getSolverSession().pop();
+  }
+
+
+  void API::resetSolverSession(void) {
+    triton::ContextScope scope(*this);
+    this->checkSolver();
+    this->solver->resetSolverSession();
+  }
+
+
+  void API::clearTranslatedNodes(void) {
+    triton::ContextScope scope(*this);
+    /* Nothing is translated until the solver exists */
+    if (this->solver)
+      this->solver->clearTranslatedNodes();
+  }
+
+
+  std::map<triton::uint32, triton::engines::solver::SolverModel> API::checkWithAssumption(triton::ast::AbstractNode *node) {
+    return this->getSolverSession().checkWithAssumption(node);
+  }
+
+
+  std::map<triton::uint32, triton::engines::solver::SolverModel> API::checkWithAssumption(triton::ast::AbstractNode *node, triton::usize pathConstraints) {
+    return this->getSolverSession().checkWithAssumption(node, pathConstraints);
+  }
+
+
 
   /* Taint engine API ============================================================================== */
 
@@ -1037,24 +1459,28 @@ namespace triton {
 
 
   triton::engines::taint::TaintEngine* API::getTaintEngine(void) {
+    triton::ContextScope scope(*this);
     this->checkTaint();
     return this->taint;
   }
 
 
   void API::enableTaintEngine(bool flag) {
+    triton::ContextScope scope(*this);
     this->checkTaint();
     this->taint->enable(flag);
   }
 
 
   bool API::isTaintEngineEnabled(void) const {
+    triton::ContextScope scope(*this);
     this->checkTaint();
     return this->taint->isEnabled();
   }
 
 
   bool API::isTainted(const triton::arch::OperandWrapper& op) const {
+    triton::ContextScope scope(*this);
     this->checkTaint();
     switch (op.getType()) {
       case triton::arch::OP_IMM: return triton::engines::taint::UNTAINTED;
@@ -1067,24 +1493,28 @@ namespace triton {
 
 
   bool API::isMemoryTainted(triton::uint64 addr, uint32 size) const {
+    triton::ContextScope scope(*this);
     this->checkTaint();
     return this->taint->isMemoryTainted(addr, size);
   }
 
 
   bool API::isMemoryTainted(const triton::arch::MemoryAccess& mem) const {
+    triton::ContextScope scope(*this);
     this->checkTaint();
     return this->taint->isMemoryTainted(mem);
   }
 
 
   bool API::isRegisterTainted(const triton::arch::Register& reg) const {
+    triton::ContextScope scope(*this);
     this->checkTaint();
     return this->taint->isRegisterTainted(reg);
   }
 
 
   bool API::setTaint(const triton::arch::OperandWrapper& op, bool flag) {
+    triton::ContextScope scope(*this);
     this->checkTaint();
     switch (op.getType()) {
       case triton::arch::OP_IMM: return triton::engines::taint::UNTAINTED;
@@ -1097,6 +1527,7 @@ namespace triton {
 
 
   bool API::setTaintMemory(const triton::arch::MemoryAccess& mem, bool flag) {
+    triton::ContextScope scope(*this);
     this->checkTaint();
     this->taint->setTaintMemory(mem, flag);
     return flag;
@@ -1104,6 +1535,7 @@ namespace triton {
 
 
   bool API::setTaintRegister(const triton::arch::Register& reg, bool flag) {
+    triton::ContextScope scope(*this);
     this->checkTaint();
     this->taint->setTaintRegister(reg, flag);
     return flag;
@@ -1111,42 +1543,104 @@ namespace triton {
 
 
   bool API::taintMemory(triton::uint64 addr) {
+    triton::ContextScope scope(*this);
     this->checkTaint();
     return this->taint->taintMemory(addr);
   }
 
 
   bool API::taintMemory(const triton::arch::MemoryAccess& mem) {
+    triton::ContextScope scope(*this);
     this->checkTaint();
     return this->taint->taintMemory(mem);
   }
 
 
+  bool API::taintMemoryArea(triton::uint64 addr, triton::usize size) {
+    triton::ContextScope scope(*this);
+    this->checkTaint();
+    return this->taint->taintMemoryArea(addr, size);
+  }
+
+
   bool API::taintRegister(const triton::arch::Register& reg) {
+    triton::ContextScope scope(*this);
     this->checkTaint();
     return this->taint->taintRegister(reg);
   }
 
 
   bool API::untaintMemory(triton::uint64 addr) {
+    triton::ContextScope scope(*this);
     this->checkTaint();
     return this->taint->untaintMemory(addr);
   }
 
 
   bool API::untaintMemory(const triton::arch::MemoryAccess& mem) {
+    triton::ContextScope scope(*this);
     this->checkTaint();
     return this->taint->untaintMemory(mem);
   }
 
 
+  bool API::untaintMemoryArea(triton::uint64 addr, triton::usize size) {
+    triton::ContextScope scope(*this);
+    this->checkTaint();
+    return this->taint->untaintMemoryArea(addr, size);
+  }
+
+
   bool API::untaintRegister(const triton::arch::Register& reg) {
+    triton::ContextScope scope(*this);
     this->checkTaint();
     return this->taint->untaintRegister(reg);
   }
 
 
+  bool API::taintMemoryWithLabel(const triton::arch::MemoryAccess& mem, triton::uint32 label) {
+    triton::ContextScope scope(*this);
+    this->checkTaint();
+    return this->taint->taintMemoryWithLabel(mem, label);
+  }
+
+
+  bool API::taintRegisterWithLabel(const triton::arch::Register& reg, triton::uint32 label) {
+    triton::ContextScope scope(*this);
+    this->checkTaint();
+    return this->taint->taintRegisterWithLabel(reg, label);
+  }
+
+
+  std::set<triton::uint32> API::getTaintLabels(const triton::arch::OperandWrapper& op) const {
+    triton::ContextScope scope(*this);
+    this->checkTaint();
+    switch (op.getType()) {
+      case triton::arch::OP_IMM: return std::set<triton::uint32>();
+      case triton::arch::OP_MEM: return this->getMemoryTaintLabels(op.getConstMemory());
+      case triton::arch::OP_REG: return this->getRegisterTaintLabels(op.getConstRegister());
+      default:
+        throw triton::exceptions::API("API::getTaintLabels(): Invalid operand.");
+    }
+  }
+
+
+  std::set<triton::uint32> API::getMemoryTaintLabels(const triton::arch::MemoryAccess& mem) const {
+    triton::ContextScope scope(*this);
+    this->checkTaint();
+    return this->taint->getMemoryTaintLabels(mem);
+  }
+
+
+  std::set<triton::uint32> API::getRegisterTaintLabels(const triton::arch::Register& reg) const {
+    triton::ContextScope scope(*this);
+    this->checkTaint();
+    return this->taint->getRegisterTaintLabels(reg);
+  }
+
+
   bool API::taintUnion(const triton::arch::OperandWrapper& op1, const triton::arch::OperandWrapper& op2) {
+    triton::ContextScope scope(*this);
     triton::uint32 t1 = op1.getType();
     triton::uint32 t2 = op2.getType();
 
@@ -1173,6 +1667,7 @@ namespace triton {
 
 
   bool API::taintAssignment(const triton::arch::OperandWrapper& op1, const triton::arch::OperandWrapper& op2) {
+    triton::ContextScope scope(*this);
     triton::uint32 t1 = op1.getType();
     triton::uint32 t2 = op2.getType();
 
@@ -1199,6 +1694,7 @@ namespace triton {
 
 
   bool API::taintUnionMemoryImmediate(const triton::arch::MemoryAccess& memDst) {
+    triton::ContextScope scope(*this);
     this->checkTaint();
 
     bool flag = triton::engines::taint::UNTAINTED;
@@ -1221,6 +1717,7 @@ namespace triton {
 
 
   bool API::taintUnionMemoryMemory(const triton::arch::MemoryAccess& memDst, const triton::arch::MemoryAccess& memSrc) {
+    triton::ContextScope scope(*this);
     this->checkTaint();
 
     bool flag = triton::engines::taint::UNTAINTED;
@@ -1230,13 +1727,15 @@ namespace triton {
 
     flag = this->taint->unionMemoryMemory(memDst, memSrc);
 
-    /* Taint each byte of reference expression */
+    /* Taint the reference expressions, an expression is tainted if one of its bytes is tainted */
+    std::set<triton::usize> updated;
     for (triton::uint32 i = 0; i != writeSize; i++) {
       triton::usize byteId = this->getSymbolicMemoryId(memAddrDst + i);
       if (byteId == triton::engines::symbolic::UNSET)
         continue;
-      triton::engines::symbolic::SymbolicExpression* byte = this->getSymbolicExpressionFromId(byteId);
-      byte->isTainted = this->isMemoryTainted(memAddrDst + i) | this->isMemoryTainted(memAddrSrc + i);
+      triton::engines::symbolic::SymbolicExpression* expr = this->getSymbolicExpressionFromId(byteId);
+      bool tainted = this->isMemoryTainted(memAddrDst + i) | this->isMemoryTainted(memAddrSrc + i);
+      expr->isTainted = updated.insert(byteId).second ? tainted : (expr->isTainted | tainted);
     }
 
     return flag;
@@ -1244,6 +1743,7 @@ namespace triton {
 
 
   bool API::taintUnionMemoryRegister(const triton::arch::MemoryAccess& memDst, const triton::arch::Register& regSrc) {
+    triton::ContextScope scope(*this);
     this->checkTaint();
 
     bool flag = triton::engines::taint::UNTAINTED;
@@ -1266,24 +1766,28 @@ namespace triton {
 
 
   bool API::taintUnionRegisterImmediate(const triton::arch::Register& regDst) {
+    triton::ContextScope scope(*this);
     this->checkTaint();
     return this->taint->unionRegisterImmediate(regDst);
   }
 
 
   bool API::taintUnionRegisterMemory(const triton::arch::Register& regDst, const triton::arch::MemoryAccess& memSrc) {
+    triton::ContextScope scope(*this);
     this->checkTaint();
     return this->taint->unionRegisterMemory(regDst, memSrc);
   }
 
 
   bool API::taintUnionRegisterRegister(const triton::arch::Register& regDst, const triton::arch::Register& regSrc) {
+    triton::ContextScope scope(*this);
     this->checkTaint();
     return this->taint->unionRegisterRegister(regDst, regSrc);
   }
 
 
   bool API::taintAssignmentMemoryImmediate(const triton::arch::MemoryAccess& memDst) {
+    triton::ContextScope scope(*this);
     this->checkTaint();
 
     bool flag = triton::engines::taint::UNTAINTED;
@@ -1306,6 +1810,7 @@ namespace triton {
 
 
   bool API::taintAssignmentMemoryMemory(const triton::arch::MemoryAccess& memDst, const triton::arch::MemoryAccess& memSrc) {
+    triton::ContextScope scope(*this);
     this->checkTaint();
 
     bool flag = triton::engines::taint::UNTAINTED;
@@ -1315,13 +1820,15 @@ namespace triton {
 
     flag = this->taint->assignmentMemoryMemory(memDst, memSrc);
 
-    /* Taint each byte of reference expression */
+    /* Taint the reference expressions, an expression is tainted if one of its bytes is tainted */
+    std::set<triton::usize> updated;
     for (triton::uint32 i = 0; i != writeSize; i++) {
       triton::usize byteId = this->getSymbolicMemoryId(memAddrDst + i);
       if (byteId == triton::engines::symbolic::UNSET)
         continue;
-      triton::engines::symbolic::SymbolicExpression* byte = this->getSymbolicExpressionFromId(byteId);
-      byte->isTainted = this->isMemoryTainted(memAddrSrc + i);
+      triton::engines::symbolic::SymbolicExpression* expr = this->getSymbolicExpressionFromId(byteId);
+      bool tainted = this->isMemoryTainted(memAddrSrc + i);
+      expr->isTainted = updated.insert(byteId).second ? tainted : (expr->isTainted | tainted);
     }
 
     return flag;
@@ -1329,6 +1836,7 @@ namespace triton {
 
 
   bool API::taintAssignmentMemoryRegister(const triton::arch::MemoryAccess& memDst, const triton::arch::Register& regSrc) {
+    triton::ContextScope scope(*this);
     this->checkTaint();
 
     bool flag = triton::engines::taint::UNTAINTED;
@@ -1351,18 +1859,21 @@ namespace triton {
 
 
   bool API::taintAssignmentRegisterImmediate(const triton::arch::Register& regDst) {
+    triton::ContextScope scope(*this);
     this->checkTaint();
     return this->taint->assignmentRegisterImmediate(regDst);
   }
 
 
   bool API::taintAssignmentRegisterMemory(const triton::arch::Register& regDst, const triton::arch::MemoryAccess& memSrc) {
+    triton::ContextScope scope(*this);
     this->checkTaint();
     return this->taint->assignmentRegisterMemory(regDst, memSrc);
   }
 
 
   bool API::taintAssignmentRegisterRegister(const triton::arch::Register& regDst, const triton::arch::Register& regSrc) {
+    triton::ContextScope scope(*this);
     this->checkTaint();
     return this->taint->assignmentRegisterRegister(regDst, regSrc);
   }
@@ -171,6 +171,13 @@ namespace triton {
     }
 
 
+    std::map<std::string, triton::usize> Architecture::getDisassemblyCacheStats(void) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::getDisassemblyCacheStats(): You must define an architecture.");
+      return this->cpu->getDisassemblyCacheStats();
+    }
+
+
     void Architecture::buildSemantics(triton::arch::Instruction& inst) const {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::buildSemantics(): You must define an architecture.");
@@ -179,12 +186,29 @@ namespace triton {
       inst.preIRInit();
 
       /* If the symbolic and taint engine are disable we skip the processing */
-      if (!triton::api.isSymbolicEngineEnabled() && !triton::api.isTaintEngineEnabled())
+      if (!triton::getContext().isSymbolicEngineEnabled() && !triton::getContext().isTaintEngineEnabled())
         return;
 
+      /*
+       * If only the taint is available and the TAINT_ONLY_SEMANTICS optimization
+       * is enabled, the taint is spread without building any symbolic expression.
+       * Instructions which are not handled fall back on the symbolic semantics.
+       */
+      if (!triton::getContext().isSymbolicEngineEnabled() && triton::getContext().isSymbolicOptimizationEnabled(triton::engines::symbolic::TAINT_ONLY_SEMANTICS)) {
+        if (this->cpu->buildTaintSemantics(inst)) {
+          inst.postIRInit();
+          return;
+        }
+        /* The symbolic semantics need the AST of the memory operands */
+        for (auto it = inst.operands.begin(); it != inst.operands.end(); it++) {
+          if (it->getType() == triton::arch::OP_MEM)
+            it->getMemory().initAddress();
+        }
+      }
+
       /* Backup the symbolic engine in the case where only taint is available. */
-      if (!triton::api.isSymbolicEngineEnabled())
-        triton::api.backupSymbolicEngine();
+      if (!triton::getContext().isSymbolicEngineEnabled())
+        triton::getContext().backupSymbolicEngine();
 
       /* Processing */
       this->cpu->buildSemantics(inst);
@@ -197,21 +221,21 @@ namespace triton {
        * expressions and AST nodes. Note that if the taint engine
        * is enable we must compute semanitcs to spread the taint.
        */
-      if (!triton::api.isSymbolicEngineEnabled()) {
+      if (!triton::getContext().isSymbolicEngineEnabled()) {
         std::set<triton::ast::AbstractNode*> uniqueNodes;
         std::vector<triton::engines::symbolic::SymbolicExpression*>::iterator it;
         for (it = inst.symbolicExpressions.begin(); it != inst.symbolicExpressions.end(); it++) {
-          triton::api.extractUniqueAstNodes(uniqueNodes, (*it)->getAst());
-          triton::api.removeSymbolicExpression((*it)->getId());
+          triton::getContext().extractUniqueAstNodes(uniqueNodes, (*it)->getAst());
+          triton::getContext().removeSymbolicExpression((*it)->getId());
         }
 
-        if (!triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::AST_DICTIONARIES)) {
+        if (!triton::getContext().isSymbolicOptimizationEnabled(triton::engines::symbolic::AST_DICTIONARIES)) {
           /* Remove node only if AST_DICTIONARIES is disabled */
-          triton::api.freeAstNodes(uniqueNodes);
+          triton::getContext().freeAstNodes(uniqueNodes);
         }
 
         inst.symbolicExpressions.clear();
-        triton::api.restoreSymbolicEngine();
+        triton::getContext().restoreSymbolicEngine();
       }
 
       /*
@@ -219,17 +243,17 @@ namespace triton {
        * execution only on tainted instructions, we delete all
        * expressions untainted and their AST nodes.
        */
-      if (triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::ONLY_ON_TAINTED) && !inst.isTainted()) {
+      if (triton::getContext().isSymbolicOptimizationEnabled(triton::engines::symbolic::ONLY_ON_TAINTED) && !inst.isTainted()) {
         std::set<triton::ast::AbstractNode*> uniqueNodes;
         std::vector<triton::engines::symbolic::SymbolicExpression*>::iterator it;
         for (it = inst.symbolicExpressions.begin(); it != inst.symbolicExpressions.end(); it++) {
-          triton::api.extractUniqueAstNodes(uniqueNodes, (*it)->getAst());
-          triton::api.removeSymbolicExpression((*it)->getId());
+          triton::getContext().extractUniqueAstNodes(uniqueNodes, (*it)->getAst());
+          triton::getContext().removeSymbolicExpression((*it)->getId());
         }
 
-        if (!triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::AST_DICTIONARIES)) {
+        if (!triton::getContext().isSymbolicOptimizationEnabled(triton::engines::symbolic::AST_DICTIONARIES)) {
           /* Remove node only if AST_DICTIONARIES is disabled */
-          triton::api.freeAstNodes(uniqueNodes);
+          triton::getContext().freeAstNodes(uniqueNodes);
         }
 
         inst.symbolicExpressions.clear();
@@ -240,22 +264,22 @@ namespace triton {
        * execution only on symbolized expressions, we delete all
        * concrete expressions and their AST nodes.
        */
-      if (triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::ONLY_ON_SYMBOLIZED)) {
+      if (triton::getContext().isSymbolicOptimizationEnabled(triton::engines::symbolic::ONLY_ON_SYMBOLIZED)) {
         std::set<triton::ast::AbstractNode*> uniqueNodes;
         std::vector<triton::engines::symbolic::SymbolicExpression*> newVector;
         std::vector<triton::engines::symbolic::SymbolicExpression*>::iterator it;
         for (it = inst.symbolicExpressions.begin(); it != inst.symbolicExpressions.end(); it++) {
           if ((*it)->getAst()->isSymbolized() == false) {
-            triton::api.extractUniqueAstNodes(uniqueNodes, (*it)->getAst());
-            triton::api.removeSymbolicExpression((*it)->getId());
+            triton::getContext().extractUniqueAstNodes(uniqueNodes, (*it)->getAst());
+            triton::getContext().removeSymbolicExpression((*it)->getId());
           }
           else
             newVector.push_back(*it);
         }
 
-        if (!triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::AST_DICTIONARIES)) {
+        if (!triton::getContext().isSymbolicOptimizationEnabled(triton::engines::symbolic::AST_DICTIONARIES)) {
           /* Remove node only if AST_DICTIONARIES is disabled */
-          triton::api.freeAstNodes(uniqueNodes);
+          triton::getContext().freeAstNodes(uniqueNodes);
         }
 
         inst.symbolicExpressions = newVector;
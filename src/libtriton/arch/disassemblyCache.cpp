@@ -0,0 +1,140 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cpuSize.hpp>
+#include <disassemblyCache.hpp>
+#include <memoryAccess.hpp>
+#include <operandWrapper.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    DisassemblyCache::DisassemblyCache() {
+      this->hits   = 0;
+      this->misses = 0;
+    }
+
+
+    void DisassemblyCache::clear(void) {
+      this->entries.clear();
+      this->hits   = 0;
+      this->misses = 0;
+    }
+
+
+    std::string DisassemblyCache::getKey(const triton::arch::Instruction& inst) const {
+      triton::uint64 address = inst.getAddress();
+      std::string key;
+
+      key.reserve(sizeof(address) + inst.getSize());
+      key.append(reinterpret_cast<const char*>(&address), sizeof(address));
+      key.append(reinterpret_cast<const char*>(inst.getOpcodes()), inst.getSize());
+
+      return key;
+    }
+
+
+    const triton::arch::DecodedInstruction* DisassemblyCache::find(const triton::arch::Instruction& inst) {
+      auto it = this->entries.find(this->getKey(inst));
+
+      if (it == this->entries.end()) {
+        this->misses++;
+        return nullptr;
+      }
+
+      this->hits++;
+      return &it->second;
+    }
+
+
+    void DisassemblyCache::record(const triton::arch::Instruction& inst, const triton::arch::DecodedInstruction& decoded) {
+      /* Self-modifying codes may grow the cache indefinitely, so we flush it when it is full */
+      if (this->entries.size() >= DISASSEMBLY_CACHE_MAX_ENTRIES)
+        this->entries.clear();
+      this->entries[this->getKey(inst)] = decoded;
+    }
+
+
+    void DisassemblyCache::bind(const triton::arch::DecodedInstruction& decoded, triton::arch::Instruction& inst) const {
+      /* Init the disassembly */
+      inst.setDisassembly(decoded.disassembly);
+
+      /* Refine the size */
+      inst.setSize(decoded.size);
+
+      /* Init the instruction's type */
+      inst.setType(decoded.type);
+
+      /* Init the instruction's prefix */
+      inst.setPrefix(decoded.prefix);
+
+      /* Init operands with the concrete values recorded into the instruction */
+      for (auto op = decoded.operands.begin(); op != decoded.operands.end(); op++) {
+        switch (op->type) {
+
+          case triton::arch::OP_IMM:
+            inst.operands.push_back(triton::arch::OperandWrapper(op->imm));
+            break;
+
+          case triton::arch::OP_MEM: {
+            triton::arch::MemoryAccess mem     = inst.popMemoryAccess();
+            triton::arch::Register     segment = op->segment;
+            triton::arch::Register     base    = op->base;
+            triton::arch::Register     index   = op->index;
+            triton::arch::Immediate    disp    = op->disp;
+            triton::arch::Immediate    scale   = op->scale;
+
+            /* Set the size if the memory is not valid */
+            if (!mem.isValid())
+              mem.setPair(std::make_pair(((op->memSize * BYTE_SIZE_BIT) - 1), 0));
+
+            /* Specify that LEA contains a PC relative */
+            if (op->pcRelative)
+              mem.setPcRelative(inst.getNextAddress());
+
+            mem.setSegmentRegister(segment);
+            mem.setBaseRegister(base);
+            mem.setIndexRegister(index);
+            mem.setDisplacement(disp);
+            mem.setScale(scale);
+
+            inst.operands.push_back(triton::arch::OperandWrapper(mem));
+            break;
+          }
+
+          case triton::arch::OP_REG:
+            inst.operands.push_back(triton::arch::OperandWrapper(inst.getRegisterState(op->reg)));
+            break;
+
+          default:
+            break;
+        }
+      }
+
+      /* Set branch */
+      if (decoded.branch)
+        inst.setBranch(true);
+
+      if (decoded.controlFlow)
+        inst.setControlFlow(true);
+    }
+
+
+    std::map<std::string, triton::usize> DisassemblyCache::getStats(void) const {
+      std::map<std::string, triton::usize> stats;
+
+      stats["hits"]    = this->hits;
+      stats["misses"]  = this->misses;
+      stats["entries"] = this->entries.size();
+
+      return stats;
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
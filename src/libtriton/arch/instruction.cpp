@@ -166,7 +166,7 @@ namespace triton {
       /* If there is a memory access recorded, we use it */
       if (this->memoryAccess.size() > 0) {
         mem = this->memoryAccess.front();
-        triton::api.setConcreteMemoryValue(mem);
+        triton::getContext().setConcreteMemoryValue(mem);
         this->memoryAccess.pop_front();
       }
 
@@ -78,7 +78,7 @@ namespace triton {
         return this->pcRelative;
 
       else if (this->baseReg.isValid())
-        return triton::api.getConcreteRegisterValue(this->baseReg).convert_to<triton::uint64>();
+        return triton::getContext().getConcreteRegisterValue(this->baseReg).convert_to<triton::uint64>();
 
       return 0;
     }
@@ -86,14 +86,14 @@ namespace triton {
 
     triton::uint64 MemoryAccess::getIndexValue(void) {
       if (this->indexReg.isValid())
-        return triton::api.getConcreteRegisterValue(this->indexReg).convert_to<triton::uint64>();
+        return triton::getContext().getConcreteRegisterValue(this->indexReg).convert_to<triton::uint64>();
       return 0;
     }
 
 
     triton::uint64 MemoryAccess::getSegmentValue(void) {
       if (this->segmentReg.isValid())
-        return triton::api.getConcreteRegisterValue(this->segmentReg).convert_to<triton::uint64>();
+        return triton::getContext().getConcreteRegisterValue(this->segmentReg).convert_to<triton::uint64>();
       return 0;
     }
 
@@ -110,7 +110,7 @@ namespace triton {
 
     triton::uint64 MemoryAccess::getAccessMask(void) {
       triton::uint64 mask = -1;
-      return (mask >> (QWORD_SIZE_BIT - triton::api.cpuRegisterBitSize()));
+      return (mask >> (QWORD_SIZE_BIT - triton::getContext().cpuRegisterBitSize()));
     }
 
 
@@ -124,13 +124,13 @@ namespace triton {
       else if (this->displacement.getBitSize())
         return this->displacement.getBitSize();
 
-      return triton::api.cpuRegisterBitSize();
+      return triton::getContext().cpuRegisterBitSize();
     }
 
 
     void MemoryAccess::initAddress(void) {
       /* Otherwise, try to compute the address */
-      if (triton::api.isArchitectureValid() && this->getBitSize() >= BYTE_SIZE_BIT) {
+      if (triton::getContext().isArchitectureValid() && this->getBitSize() >= BYTE_SIZE_BIT) {
         triton::arch::Register& base  = this->baseReg;
         triton::arch::Register& index = this->indexReg;
         triton::uint64 segmentValue   = this->getSegmentValue();
@@ -140,10 +140,10 @@ namespace triton {
 
         /* Initialize the AST of the memory access (LEA) */
         this->ast = triton::ast::bvadd(
-                      (this->pcRelative ? triton::ast::bv(this->pcRelative, bitSize) : (base.isValid() ? triton::api.buildSymbolicRegister(base) : triton::ast::bv(0, bitSize))),
+                      (this->pcRelative ? triton::ast::bv(this->pcRelative, bitSize) : (base.isValid() ? triton::getContext().buildSymbolicRegister(base) : triton::ast::bv(0, bitSize))),
                       triton::ast::bvadd(
                         triton::ast::bvmul(
-                          (index.isValid() ? triton::api.buildSymbolicRegister(index) : triton::ast::bv(0, bitSize)),
+                          (index.isValid() ? triton::getContext().buildSymbolicRegister(index) : triton::ast::bv(0, bitSize)),
                           triton::ast::bv(scaleValue, bitSize)
                         ),
                         triton::ast::bv(dispValue, bitSize)
@@ -165,6 +165,52 @@ namespace triton {
     }
 
 
+    /* Returns the `bitSize` low bits of a value */
+    static inline triton::uint64 maskValue(triton::uint64 value, triton::uint32 bitSize) {
+      if (bitSize >= QWORD_SIZE_BIT)
+        return value;
+      return value & ((static_cast<triton::uint64>(1) << bitSize) - 1);
+    }
+
+
+    void MemoryAccess::initConcreteAddress(void) {
+      /* Same computation as initAddress() but on the concrete values */
+      if (triton::getContext().isArchitectureValid() && this->getBitSize() >= BYTE_SIZE_BIT) {
+        triton::arch::Register& base  = this->baseReg;
+        triton::arch::Register& index = this->indexReg;
+        triton::uint64 segmentValue   = this->getSegmentValue();
+        triton::uint64 scaleValue     = this->getScaleValue();
+        triton::uint64 dispValue      = this->getDisplacementValue();
+        triton::uint32 bitSize        = this->getAccessSize();
+        triton::uint64 baseValue      = 0;
+        triton::uint64 indexValue     = 0;
+        triton::uint64 address        = 0;
+
+        if (this->pcRelative)
+          baseValue = this->pcRelative;
+        else if (base.isValid())
+          baseValue = triton::getContext().getConcreteRegisterValue(base).convert_to<triton::uint64>();
+
+        if (index.isValid())
+          indexValue = triton::getContext().getConcreteRegisterValue(index).convert_to<triton::uint64>();
+
+        address = maskValue(baseValue + (indexValue * scaleValue) + dispValue, bitSize);
+
+        /* Use segments as base address instead of selector into the GDT. */
+        if (segmentValue) {
+          triton::uint32 segmentSize = this->segmentReg.getBitSize();
+          if (bitSize < segmentSize && bitSize < QWORD_SIZE_BIT && ((address >> (bitSize - 1)) & 1))
+            address |= ~maskValue(static_cast<triton::uint64>(-1), bitSize);
+          address = maskValue(segmentValue + address, segmentSize);
+        }
+
+        /* Initialize the address only if it is not already defined */
+        if (!this->address)
+          this->address = address;
+      }
+    }
+
+
     triton::uint32 MemoryAccess::getBitSize(void) const {
       return this->getVectorSize();
     }
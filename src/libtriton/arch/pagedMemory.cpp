@@ -0,0 +1,180 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <bitset>
+#include <cstring>
+
+#include <pagedMemory.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    /* Returns the mask of bits [low:low+size[ of a bitmap word (size in [1:64]) */
+    static inline triton::uint64 bitmapMask(triton::uint32 low, triton::uint32 size) {
+      if (size >= 64)
+        return 0xffffffffffffffff;
+      return ((static_cast<triton::uint64>(1) << size) - 1) << low;
+    }
+
+
+    /* Applies a callback on each bitmap word covered by the range [offset:offset+size[ of a page */
+    template <typename T>
+    static inline void forEachBitmapWord(triton::uint32 offset, triton::uint32 size, T callback) {
+      while (size > 0) {
+        triton::uint32 low   = offset % 64;
+        triton::uint32 chunk = std::min<triton::uint32>(size, 64 - low);
+        callback(offset / 64, bitmapMask(low, chunk));
+        offset += chunk;
+        size   -= chunk;
+      }
+    }
+
+
+    PagedMemory::PagedMemory() {
+    }
+
+
+    PagedMemory::PagedMemory(const PagedMemory& other) : pages(other.pages) {
+    }
+
+
+    PagedMemory::~PagedMemory() {
+      this->clear();
+    }
+
+
+    void PagedMemory::operator=(const PagedMemory& other) {
+      this->pages = other.pages;
+    }
+
+
+    void PagedMemory::clear(void) {
+      this->pages.clear();
+    }
+
+
+    triton::usize PagedMemory::getNumberOfPages(void) const {
+      return this->pages.getNumberOfPages();
+    }
+
+
+    triton::uint8 PagedMemory::read(triton::uint64 addr) const {
+      const Page* page = this->pages.findPage(addr >> MEMORY_PAGE_BITS);
+
+      if (page == nullptr)
+        return 0x00;
+
+      /* Unmapped bytes of a page are always zeroed */
+      return page->data[addr & MEMORY_PAGE_MASK];
+    }
+
+
+    void PagedMemory::read(triton::uint64 addr, triton::uint8* buffer, triton::usize size) const {
+      while (size > 0) {
+        triton::uint32 offset = static_cast<triton::uint32>(addr & MEMORY_PAGE_MASK);
+        triton::usize  chunk  = std::min<triton::usize>(size, MEMORY_PAGE_SIZE - offset);
+        const Page*    page   = this->pages.findPage(addr >> MEMORY_PAGE_BITS);
+
+        if (page == nullptr)
+          std::memset(buffer, 0x00, chunk);
+        else
+          std::memcpy(buffer, page->data + offset, chunk);
+
+        addr   += chunk;
+        buffer += chunk;
+        size   -= chunk;
+      }
+    }
+
+
+    void PagedMemory::write(triton::uint64 addr, triton::uint8 value) {
+      Page* page            = this->pages.getOrCreatePage(addr >> MEMORY_PAGE_BITS);
+      triton::uint32 offset = static_cast<triton::uint32>(addr & MEMORY_PAGE_MASK);
+      triton::uint64 bit    = static_cast<triton::uint64>(1) << (offset % 64);
+
+      if ((page->mapped[offset / 64] & bit) == 0) {
+        page->mapped[offset / 64] |= bit;
+        page->count++;
+      }
+
+      page->data[offset] = value;
+    }
+
+
+    void PagedMemory::write(triton::uint64 addr, const triton::uint8* buffer, triton::usize size) {
+      while (size > 0) {
+        triton::uint32 offset = static_cast<triton::uint32>(addr & MEMORY_PAGE_MASK);
+        triton::uint32 chunk  = static_cast<triton::uint32>(std::min<triton::usize>(size, MEMORY_PAGE_SIZE - offset));
+        Page*          page   = this->pages.getOrCreatePage(addr >> MEMORY_PAGE_BITS);
+
+        std::memcpy(page->data + offset, buffer, chunk);
+        forEachBitmapWord(offset, chunk, [page](triton::uint32 index, triton::uint64 mask) {
+          page->count += static_cast<triton::uint32>(std::bitset<64>(mask & ~page->mapped[index]).count());
+          page->mapped[index] |= mask;
+        });
+
+        addr   += chunk;
+        buffer += chunk;
+        size   -= chunk;
+      }
+    }
+
+
+    bool PagedMemory::isMapped(triton::uint64 addr, triton::usize size) const {
+      while (size > 0) {
+        triton::uint32 offset = static_cast<triton::uint32>(addr & MEMORY_PAGE_MASK);
+        triton::uint32 chunk  = static_cast<triton::uint32>(std::min<triton::usize>(size, MEMORY_PAGE_SIZE - offset));
+        const Page*    page   = this->pages.findPage(addr >> MEMORY_PAGE_BITS);
+        bool           mapped = true;
+
+        if (page == nullptr)
+          return false;
+
+        if (page->count != MEMORY_PAGE_SIZE) {
+          forEachBitmapWord(offset, chunk, [page, &mapped](triton::uint32 index, triton::uint64 mask) {
+            if ((page->mapped[index] & mask) != mask)
+              mapped = false;
+          });
+          if (!mapped)
+            return false;
+        }
+
+        addr += chunk;
+        size -= chunk;
+      }
+      return true;
+    }
+
+
+    void PagedMemory::unmap(triton::uint64 addr, triton::usize size) {
+      while (size > 0) {
+        triton::uint64 pageNumber = addr >> MEMORY_PAGE_BITS;
+        triton::uint32 offset     = static_cast<triton::uint32>(addr & MEMORY_PAGE_MASK);
+        triton::uint32 chunk      = static_cast<triton::uint32>(std::min<triton::usize>(size, MEMORY_PAGE_SIZE - offset));
+        Page*          page       = this->pages.findWritablePage(pageNumber);
+
+        if (page != nullptr) {
+          /* Unmapped bytes must be read as 0x00 */
+          std::memset(page->data + offset, 0x00, chunk);
+          forEachBitmapWord(offset, chunk, [page](triton::uint32 index, triton::uint64 mask) {
+            page->count -= static_cast<triton::uint32>(std::bitset<64>(mask & page->mapped[index]).count());
+            page->mapped[index] &= ~mask;
+          });
+          if (page->count == 0)
+            this->pages.releasePage(pageNumber);
+        }
+
+        addr += chunk;
+        size -= chunk;
+      }
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
@@ -20,7 +20,7 @@ namespace triton {
 
 
     Register::Register(triton::uint32 reg, triton::uint512 concreteValue) {
-      if (!triton::api.isArchitectureValid()) {
+      if (!triton::getContext().isArchitectureValid()) {
         this->clear();
         return;
       }
@@ -30,9 +30,9 @@ namespace triton {
 
     void Register::clear(void) {
       this->concreteValue = 0;
-      this->id            = triton::api.cpuInvalidRegister();
+      this->id            = triton::getContext().cpuInvalidRegister();
       this->name          = "unknown";
-      this->parent        = triton::api.cpuInvalidRegister();
+      this->parent        = triton::getContext().cpuInvalidRegister();
       this->trusted       = false;
     }
 
@@ -43,12 +43,12 @@ namespace triton {
       this->id        = reg;
       this->trusted   = true;
 
-      if (!triton::api.isCpuRegisterValid(reg)) {
-        this->id      = triton::api.cpuInvalidRegister();
+      if (!triton::getContext().isCpuRegisterValid(reg)) {
+        this->id      = triton::getContext().cpuInvalidRegister();
         this->trusted = false;
       }
 
-      regInfo      = triton::api.getCpuRegInformation(this->id);
+      regInfo      = triton::getContext().getCpuRegInformation(this->id);
 
       this->name   = std::get<0>(regInfo);
       this->parent = std::get<3>(regInfo);
@@ -146,17 +146,17 @@ namespace triton {
 
 
     bool Register::isValid(void) const {
-      return triton::api.isCpuRegisterValid(this->id);
+      return triton::getContext().isCpuRegisterValid(this->id);
     }
 
 
     bool Register::isRegister(void) const {
-      return triton::api.isCpuRegister(this->id);
+      return triton::getContext().isCpuRegister(this->id);
     }
 
 
     bool Register::isFlag(void) const {
-      return triton::api.isCpuFlag(this->id);
+      return triton::getContext().isCpuFlag(this->id);
     }
 
 
@@ -29,17 +29,21 @@ namespace triton {
     namespace x86 {
 
       x86Cpu::x86Cpu() {
+        this->handle = 0;
         this->clear();
       }
 
 
       x86Cpu::x86Cpu(const x86Cpu& other) {
+        this->handle = 0;
         this->copy(other);
       }
 
 
       x86Cpu::~x86Cpu() {
         this->memory.clear();
+        if (this->handle)
+          triton::extlibs::capstone::cs_close(&this->handle);
       }
 
 
@@ -345,6 +349,9 @@ namespace triton {
         /* Clear memory */
         this->memory.clear();
 
+        /* Clear the decoded instructions */
+        this->disassemblyCache.clear();
+
         /* Clear registers */
         memset(this->eax,     0x00, sizeof(this->eax));
         memset(this->ebx,     0x00, sizeof(this->ebx));
@@ -527,24 +534,45 @@ namespace triton {
 
 
       void x86Cpu::disassembly(triton::arch::Instruction& inst) const {
-        triton::extlibs::capstone::csh       handle;
-        triton::extlibs::capstone::cs_insn*  insn;
-        triton::usize                        count = 0;
+        const triton::arch::DecodedInstruction* decoded = nullptr;
 
         /* Check if the opcodes and opcodes' size are defined */
         if (inst.getOpcodes() == nullptr || inst.getSize() == 0)
           throw triton::exceptions::Disassembly("x86Cpu::disassembly(): Opcodes and opcodesSize must be definied.");
 
-        /* Open capstone */
-        if (triton::extlibs::capstone::cs_open(triton::extlibs::capstone::CS_ARCH_X86, triton::extlibs::capstone::CS_MODE_32, &handle) != triton::extlibs::capstone::CS_ERR_OK)
-          throw triton::exceptions::Disassembly("x86Cpu::disassembly(): Cannot open capstone.");
+        /* If the instruction has already been decoded, we only bind the concrete values */
+        decoded = this->disassemblyCache.find(inst);
+        if (decoded != nullptr) {
+          this->disassemblyCache.bind(*decoded, inst);
+          return;
+        }
+
+        /* Otherwise, we decode it via capstone and we record its layout */
+        triton::arch::DecodedInstruction layout;
+        this->decode(inst, layout);
+        this->disassemblyCache.record(inst, layout);
+        this->disassemblyCache.bind(layout, inst);
+      }
+
+
+      void x86Cpu::decode(const triton::arch::Instruction& inst, triton::arch::DecodedInstruction& decoded) const {
+        triton::extlibs::capstone::cs_insn*  insn;
+        triton::usize                        count = 0;
+
+        /* Open capstone once for the CPU's lifetime */
+        if (this->handle == 0) {
+          if (triton::extlibs::capstone::cs_open(triton::extlibs::capstone::CS_ARCH_X86, triton::extlibs::capstone::CS_MODE_32, &this->handle) != triton::extlibs::capstone::CS_ERR_OK) {
+            this->handle = 0;
+            throw triton::exceptions::Disassembly("x86Cpu::decode(): Cannot open capstone.");
+          }
 
-        /* Init capstone's options */
-        triton::extlibs::capstone::cs_option(handle, triton::extlibs::capstone::CS_OPT_DETAIL, triton::extlibs::capstone::CS_OPT_ON);
-        triton::extlibs::capstone::cs_option(handle, triton::extlibs::capstone::CS_OPT_SYNTAX, triton::extlibs::capstone::CS_OPT_SYNTAX_INTEL);
+          /* Init capstone's options */
+          triton::extlibs::capstone::cs_option(this->handle, triton::extlibs::capstone::CS_OPT_DETAIL, triton::extlibs::capstone::CS_OPT_ON);
+          triton::extlibs::capstone::cs_option(this->handle, triton::extlibs::capstone::CS_OPT_SYNTAX, triton::extlibs::capstone::CS_OPT_SYNTAX_INTEL);
+        }
 
         /* Let's disass and build our operands */
-        count = triton::extlibs::capstone::cs_disasm(handle, inst.getOpcodes(), inst.getSize(), inst.getAddress(), 0, &insn);
+        count = triton::extlibs::capstone::cs_disasm(this->handle, inst.getOpcodes(), inst.getSize(), inst.getAddress(), 0, &insn);
         if (count > 0) {
           triton::extlibs::capstone::cs_detail* detail = insn->detail;
           for (triton::uint32 j = 0; j < 1; j++) {
@@ -552,33 +580,30 @@ namespace triton {
             /* Init the disassembly */
             std::stringstream str;
             str << insn[j].mnemonic << " " <<  insn[j].op_str;
-            inst.setDisassembly(str.str());
+            decoded.disassembly = str.str();
 
             /* Refine the size */
-            inst.setSize(insn[j].size);
+            decoded.size = insn[j].size;
 
             /* Init the instruction's type */
-            inst.setType(triton::arch::x86::capstoneInstructionToTritonInstruction(insn[j].id));
+            decoded.type = triton::arch::x86::capstoneInstructionToTritonInstruction(insn[j].id);
 
             /* Init the instruction's prefix */
-            inst.setPrefix(triton::arch::x86::capstonePrefixToTritonPrefix(detail->x86.prefix[0]));
+            decoded.prefix = triton::arch::x86::capstonePrefixToTritonPrefix(detail->x86.prefix[0]);
 
             /* Init operands */
             for (triton::uint32 n = 0; n < detail->x86.op_count; n++) {
               triton::extlibs::capstone::cs_x86_op* op = &(detail->x86.operands[n]);
+              triton::arch::DecodedOperand operand;
+
               switch(op->type) {
 
                 case triton::extlibs::capstone::X86_OP_IMM:
-                  inst.operands.push_back(triton::arch::OperandWrapper(triton::arch::Immediate(op->imm, op->size)));
+                  operand.type = triton::arch::OP_IMM;
+                  operand.imm  = triton::arch::Immediate(op->imm, op->size);
                   break;
 
                 case triton::extlibs::capstone::X86_OP_MEM: {
-                  triton::arch::MemoryAccess mem = inst.popMemoryAccess();
-
-                  /* Set the size if the memory is not valid */
-                  if (!mem.isValid())
-                    mem.setPair(std::make_pair(((op->size * BYTE_SIZE_BIT) - 1), 0));
-
                   /* LEA if exists */
                   triton::arch::Register segment(triton::arch::x86::capstoneRegisterToTritonRegister(op->mem.segment));
                   triton::arch::Register base(triton::arch::x86::capstoneRegisterToTritonRegister(op->mem.base));
@@ -586,27 +611,27 @@ namespace triton {
                   triton::arch::Immediate disp(op->mem.disp, base.isValid() ? base.getSize() : index.isValid() ? index.getSize() : op->size);
                   triton::arch::Immediate scale(op->mem.scale, base.isValid() ? base.getSize() : index.isValid() ? index.getSize() : op->size);
 
-                  /* Specify that LEA contains a PC relative */
-                  if (base.getId() == TRITON_X86_REG_PC.getId())
-                    mem.setPcRelative(inst.getNextAddress());
-
-                  mem.setSegmentRegister(segment);
-                  mem.setBaseRegister(base);
-                  mem.setIndexRegister(index);
-                  mem.setDisplacement(disp);
-                  mem.setScale(scale);
-
-                  inst.operands.push_back(triton::arch::OperandWrapper(mem));
+                  operand.type       = triton::arch::OP_MEM;
+                  operand.memSize    = op->size;
+                  operand.segment    = segment;
+                  operand.base       = base;
+                  operand.index      = index;
+                  operand.disp       = disp;
+                  operand.scale      = scale;
+                  operand.pcRelative = (base.getId() == TRITON_X86_REG_PC.getId());
                   break;
                 }
 
                 case triton::extlibs::capstone::X86_OP_REG:
-                  inst.operands.push_back(triton::arch::OperandWrapper(inst.getRegisterState(triton::arch::x86::capstoneRegisterToTritonRegister(op->reg))));
+                  operand.type = triton::arch::OP_REG;
+                  operand.reg  = triton::arch::x86::capstoneRegisterToTritonRegister(op->reg);
                   break;
 
                 default:
                   break;
               }
+
+              decoded.operands.push_back(operand);
             }
 
           }
@@ -614,20 +639,23 @@ namespace triton {
           if (detail->groups_count > 0) {
             for (triton::uint32 n = 0; n < detail->groups_count; n++) {
               if (detail->groups[n] == triton::extlibs::capstone::X86_GRP_JUMP)
-                inst.setBranch(true);
+                decoded.branch = true;
               if (detail->groups[n] == triton::extlibs::capstone::X86_GRP_JUMP ||
                   detail->groups[n] == triton::extlibs::capstone::X86_GRP_CALL ||
                   detail->groups[n] == triton::extlibs::capstone::X86_GRP_RET)
-                inst.setControlFlow(true);
+                decoded.controlFlow = true;
             }
           }
+          /* Free capstone stuffs */
           triton::extlibs::capstone::cs_free(insn, count);
         }
         else
-          throw triton::exceptions::Disassembly("x86Cpu::disassembly(): Failed to disassemble the given code.");
+          throw triton::exceptions::Disassembly("x86Cpu::decode(): Failed to disassemble the given code.");
+      }
 
-        triton::extlibs::capstone::cs_close(&handle);
-        return;
+
+      std::map<std::string, triton::usize> x86Cpu::getDisassemblyCacheStats(void) const {
+        return this->disassemblyCache.getStats();
       }
 
 
@@ -638,13 +666,17 @@ namespace triton {
       }
 
 
-      triton::uint8 x86Cpu::getConcreteMemoryValue(triton::uint64 addr) const {
-        triton::api.processCallbacks(triton::callbacks::MEMORY_HIT, addr);
+      bool x86Cpu::buildTaintSemantics(triton::arch::Instruction& inst) const {
+        if (!inst.getType())
+          throw triton::exceptions::Cpu("x86Cpu::buildTaintSemantics(): You must disassemble the instruction before.");
+        return triton::arch::x86::semantics::buildTaint(inst);
+      }
+
 
-        if (this->memory.find(addr) == this->memory.end())
-          return 0x00;
+      triton::uint8 x86Cpu::getConcreteMemoryValue(triton::uint64 addr) const {
+        triton::getContext().processCallbacks(triton::callbacks::MEMORY_HIT, addr);
 
-        return this->memory.at(addr);
+        return this->memory.read(addr);
       }
 
 
@@ -656,18 +688,36 @@ namespace triton {
         if (size == 0 || size > DQQWORD_SIZE)
           throw triton::exceptions::Cpu("x86Cpu::getConcreteMemoryValue(): Invalid size memory.");
 
+        triton::uint8 area[DQQWORD_SIZE];
+        triton::uint64 qword = 0;
+
         for (triton::sint32 i = size-1; i >= 0; i--)
-          ret = ((ret << BYTE_SIZE_BIT) | this->getConcreteMemoryValue(addr+i));
+          triton::getContext().processCallbacks(triton::callbacks::MEMORY_HIT, addr+i);
+
+        this->memory.read(addr, area, size);
+
+        /* Fast path for accesses which fit into a native word */
+        if (size <= QWORD_SIZE) {
+          for (triton::sint32 i = size-1; i >= 0; i--)
+            qword = ((qword << BYTE_SIZE_BIT) | area[i]);
+          return qword;
+        }
+
+        for (triton::sint32 i = size-1; i >= 0; i--)
+          ret = ((ret << BYTE_SIZE_BIT) | area[i]);
 
         return ret;
       }
 
 
       std::vector<triton::uint8> x86Cpu::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size) const {
-        std::vector<triton::uint8> area;
+        std::vector<triton::uint8> area(size);
 
         for (triton::usize index = 0; index < size; index++)
-          area.push_back(this->getConcreteMemoryValue(baseAddr+index));
+          triton::getContext().processCallbacks(triton::callbacks::MEMORY_HIT, baseAddr+index);
+
+        if (size)
+          this->memory.read(baseAddr, area.data(), size);
 
         return area;
       }
@@ -806,7 +856,7 @@ namespace triton {
 
 
       void x86Cpu::setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value) {
-        this->memory[addr] = value;
+        this->memory.write(addr, value);
       }
 
 
@@ -818,24 +868,24 @@ namespace triton {
         if (size == 0 || size > DQQWORD_SIZE)
           throw triton::exceptions::Cpu("x86Cpu::setConcreteMemoryValue(): Invalid size memory.");
 
+        triton::uint8 area[DQQWORD_SIZE];
+
         for (triton::uint32 i = 0; i < size; i++) {
-          this->memory[addr+i] = (cv & 0xff).convert_to<triton::uint8>();
+          area[i] = (cv & 0xff).convert_to<triton::uint8>();
           cv >>= 8;
         }
+
+        this->memory.write(addr, area, size);
       }
 
 
       void x86Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values) {
-        for (triton::usize index = 0; index < values.size(); index++) {
-          this->memory[baseAddr+index] = values[index];
-        }
+        this->memory.write(baseAddr, values.data(), values.size());
       }
 
 
       void x86Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          this->memory[baseAddr+index] = area[index];
-        }
+        this->memory.write(baseAddr, area, size);
       }
 
 
@@ -1071,19 +1121,12 @@ namespace triton {
 
 
       bool x86Cpu::isMemoryMapped(triton::uint64 baseAddr, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          if (this->memory.find(baseAddr + index) == this->memory.end())
-            return false;
-        }
-        return true;
+        return this->memory.isMapped(baseAddr, size);
       }
 
 
       void x86Cpu::unmapMemory(triton::uint64 baseAddr, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          if (this->memory.find(baseAddr + index) != this->memory.end())
-            this->memory.erase(baseAddr + index);
-        }
+        this->memory.unmap(baseAddr, size);
       }
 
     }; /* x86 namespace */
@@ -565,17 +565,17 @@ namespace triton {
           auto dst = triton::arch::OperandWrapper(TRITON_X86_REG_SP.getParent());
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
           auto op2 = triton::ast::bv(delta, dst.getBitSize());
 
           /* Create the semantics */
           auto node = triton::ast::bvadd(op1, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "Stack alignment");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "Stack alignment");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, dst);
+          expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Return the new stack value */
           return node->evaluate().convert_to<triton::uint64>();
@@ -586,32 +586,59 @@ namespace triton {
           auto dst = triton::arch::OperandWrapper(TRITON_X86_REG_SP.getParent());
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
           auto op2 = triton::ast::bv(delta, dst.getBitSize());
 
           /* Create the semantics */
           auto node = triton::ast::bvsub(op1, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "Stack alignment");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "Stack alignment");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, dst);
+          expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Return the new stack value */
           return node->evaluate().convert_to<triton::uint64>();
         }
 
 
+        /* Returns the bits [high:low] of a concrete value */
+        static inline triton::uint512 extractValue(const triton::uint512& value, triton::uint32 high, triton::uint32 low) {
+          return ((value >> low) & ((triton::uint512(1) << ((high - low) + 1)) - 1));
+        }
+
+
+        /*
+         * Creates the symbolic expression of a flag and spreads the taint from the parent.
+         * If `lazy` is true and the LAZY_FLAGS optimization is enabled, only the concrete
+         * value of the flag is computed. Its AST is built when the flag is read.
+         */
+        template <typename V, typename S>
+        static void flag_s(triton::arch::Instruction& inst, triton::engines::symbolic::SymbolicExpression* parent, triton::arch::Register& flag, bool lazy, V value, S semantics, const std::string& comment) {
+          /* Spread the taint from the parent to the child */
+          bool isTainted = triton::getContext().setTaintRegister(flag, parent->isTainted);
+
+          if (lazy && triton::getContext().isSymbolicOptimizationEnabled(triton::engines::symbolic::LAZY_FLAGS)) {
+            triton::getContext().createLazySymbolicFlagExpression(inst, flag, value(), parent->getId(), isTainted, semantics, comment);
+            return;
+          }
+
+          /* Create the symbolic expression */
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, semantics(), flag, comment);
+          expr->isTainted = isTainted;
+        }
+
+
         void clearFlag_s(triton::arch::Instruction& inst, triton::arch::Register& flag, std::string comment) {
           /* Create the semantics */
           auto node = triton::ast::bv(0, 1);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, flag, comment);
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node, flag, comment);
 
           /* Spread taint */
-          expr->isTainted = triton::api.setTaintRegister(flag, triton::engines::taint::UNTAINTED);
+          expr->isTainted = triton::getContext().setTaintRegister(flag, triton::engines::taint::UNTAINTED);
         }
 
 
@@ -620,10 +647,10 @@ namespace triton {
           auto node = triton::ast::bv(1, 1);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, flag, comment);
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node, flag, comment);
 
           /* Spread taint */
-          expr->isTainted = triton::api.setTaintRegister(flag, triton::engines::taint::UNTAINTED);
+          expr->isTainted = triton::getContext().setTaintRegister(flag, triton::engines::taint::UNTAINTED);
         }
 
 
@@ -636,7 +663,7 @@ namespace triton {
 
             case triton::arch::x86::ID_PREFIX_REP: {
               /* Create symbolic operands */
-              auto op1 = triton::api.buildSymbolicOperand(inst, counter);
+              auto op1 = triton::getContext().buildSymbolicOperand(inst, counter);
 
               /* Create the semantics for Counter */
               auto node1 = triton::ast::bvsub(op1, triton::ast::bv(1, counter.getBitSize()));
@@ -649,19 +676,19 @@ namespace triton {
                      );
 
               /* Create symbolic expression */
-              auto expr1 = triton::api.createSymbolicExpression(inst, node1, counter, "Counter operation");
-              auto expr2 = triton::api.createSymbolicExpression(inst, node2, pc, "Program Counter");
+              auto expr1 = triton::getContext().createSymbolicExpression(inst, node1, counter, "Counter operation");
+              auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, pc, "Program Counter");
 
               /* Spread taint for PC */
-              expr1->isTainted = triton::api.taintUnion(counter, counter);
-              expr2->isTainted = triton::api.taintAssignment(pc, counter);
+              expr1->isTainted = triton::getContext().taintUnion(counter, counter);
+              expr2->isTainted = triton::getContext().taintAssignment(pc, counter);
               break;
             }
 
             case triton::arch::x86::ID_PREFIX_REPE: {
               /* Create symbolic operands */
-              auto op1 = triton::api.buildSymbolicOperand(inst, counter);
-              auto op2 = triton::api.buildSymbolicOperand(inst, zf);
+              auto op1 = triton::getContext().buildSymbolicOperand(inst, counter);
+              auto op2 = triton::getContext().buildSymbolicOperand(inst, zf);
 
               /* Create the semantics for Counter */
               auto node1 = triton::ast::bvsub(op1, triton::ast::bv(1, counter.getBitSize()));
@@ -677,19 +704,19 @@ namespace triton {
                      );
 
               /* Create symbolic expression */
-              auto expr1 = triton::api.createSymbolicExpression(inst, node1, counter, "Counter operation");
-              auto expr2 = triton::api.createSymbolicExpression(inst, node2, pc, "Program Counter");
+              auto expr1 = triton::getContext().createSymbolicExpression(inst, node1, counter, "Counter operation");
+              auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, pc, "Program Counter");
 
               /* Spread taint */
-              expr1->isTainted = triton::api.taintUnion(counter, counter);
-              expr2->isTainted = triton::api.taintAssignment(pc, counter);
+              expr1->isTainted = triton::getContext().taintUnion(counter, counter);
+              expr2->isTainted = triton::getContext().taintAssignment(pc, counter);
               break;
             }
 
             case triton::arch::x86::ID_PREFIX_REPNE: {
               /* Create symbolic operands */
-              auto op1 = triton::api.buildSymbolicOperand(inst, counter);
-              auto op2 = triton::api.buildSymbolicOperand(inst, zf);
+              auto op1 = triton::getContext().buildSymbolicOperand(inst, counter);
+              auto op2 = triton::getContext().buildSymbolicOperand(inst, zf);
 
               /* Create the semantics for Counter */
               auto node1 = triton::ast::bvsub(op1, triton::ast::bv(1, counter.getBitSize()));
@@ -705,12 +732,12 @@ namespace triton {
                      );
 
               /* Create symbolic expression */
-              auto expr1 = triton::api.createSymbolicExpression(inst, node1, counter, "Counter operation");
-              auto expr2 = triton::api.createSymbolicExpression(inst, node2, pc, "Program Counter");
+              auto expr1 = triton::getContext().createSymbolicExpression(inst, node1, counter, "Counter operation");
+              auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, pc, "Program Counter");
 
               /* Spread taint */
-              expr1->isTainted = triton::api.taintUnion(counter, counter);
-              expr2->isTainted = triton::api.taintAssignment(pc, counter);
+              expr1->isTainted = triton::getContext().taintUnion(counter, counter);
+              expr2->isTainted = triton::getContext().taintAssignment(pc, counter);
               break;
             }
 
@@ -719,10 +746,10 @@ namespace triton {
               auto node = triton::ast::bv(inst.getNextAddress(), pc.getBitSize());
 
               /* Create symbolic expression */
-              auto expr = triton::api.createSymbolicRegisterExpression(inst, node, TRITON_X86_REG_PC, "Program Counter");
+              auto expr = triton::getContext().createSymbolicRegisterExpression(inst, node, TRITON_X86_REG_PC, "Program Counter");
 
               /* Spread taint */
-              expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_PC, triton::engines::taint::UNTAINTED);
+              expr->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_PC, triton::engines::taint::UNTAINTED);
               break;
             }
 
@@ -731,34 +758,39 @@ namespace triton {
 
 
         void af_s(triton::arch::Instruction& inst, triton::engines::symbolic::SymbolicExpression* parent, triton::arch::OperandWrapper& dst, triton::ast::AbstractNode* op1, triton::ast::AbstractNode* op2, bool vol) {
-          auto bvSize = dst.getBitSize();
-          auto low    = vol ? 0 : dst.getAbstractLow();
-          auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
+          auto bvSize   = dst.getBitSize();
+          auto low      = vol ? 0 : dst.getAbstractLow();
+          auto high     = vol ? bvSize-1 : dst.getAbstractHigh();
+          auto parentId = parent->getId();
+
+          /* The concrete value of the flag */
+          auto value = [=]() -> triton::uint512 {
+            auto res = extractValue(parent->getAst()->evaluate(), high, low);
+            return (((res ^ (op1->evaluate() ^ op2->evaluate())) & 0x10) == 0x10) ? 1 : 0;
+          };
 
           /*
            * Create the semantic.
            * af = 0x10 == (0x10 & (regDst ^ op1 ^ op2))
            */
-          auto node = triton::ast::ite(
-                        triton::ast::equal(
-                          triton::ast::bv(0x10, bvSize),
-                          triton::ast::bvand(
-                            triton::ast::bv(0x10, bvSize),
-                            triton::ast::bvxor(
-                              triton::ast::extract(high, low, triton::ast::reference(parent->getId())),
-                              triton::ast::bvxor(op1, op2)
-                            )
-                          )
-                        ),
-                        triton::ast::bv(1, 1),
-                        triton::ast::bv(0, 1)
-                      );
-
-          /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_AF, "Adjust flag");
+          auto semantics = [=]() -> triton::ast::AbstractNode* {
+            return triton::ast::ite(
+                     triton::ast::equal(
+                       triton::ast::bv(0x10, bvSize),
+                       triton::ast::bvand(
+                         triton::ast::bv(0x10, bvSize),
+                         triton::ast::bvxor(
+                           triton::ast::extract(high, low, triton::ast::reference(parentId)),
+                           triton::ast::bvxor(op1, op2)
+                         )
+                       )
+                     ),
+                     triton::ast::bv(1, 1),
+                     triton::ast::bv(0, 1)
+                   );
+          };
 
-          /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_AF, parent->isTainted);
+          triton::arch::x86::semantics::flag_s(inst, parent, TRITON_X86_REG_AF, true, value, semantics, "Adjust flag");
         }
 
 
@@ -787,39 +819,46 @@ namespace triton {
                       );
 
           /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_AF, "Adjust flag");
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node, TRITON_X86_REG_AF, "Adjust flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_AF, parent->isTainted);
+          expr->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_AF, parent->isTainted);
         }
 
 
         void cfAdd_s(triton::arch::Instruction& inst, triton::engines::symbolic::SymbolicExpression* parent, triton::arch::OperandWrapper& dst, triton::ast::AbstractNode* op1, triton::ast::AbstractNode* op2, bool vol) {
-          auto bvSize = dst.getBitSize();
-          auto low    = vol ? 0 : dst.getAbstractLow();
-          auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
+          auto bvSize   = dst.getBitSize();
+          auto low      = vol ? 0 : dst.getAbstractLow();
+          auto high     = vol ? bvSize-1 : dst.getAbstractHigh();
+          auto parentId = parent->getId();
+
+          /* The concrete value of the flag */
+          auto value = [=]() -> triton::uint512 {
+            auto res = extractValue(parent->getAst()->evaluate(), high, low);
+            auto v1  = op1->evaluate();
+            auto v2  = op2->evaluate();
+            return extractValue((v1 & v2) ^ (((v1 ^ v2) ^ res) & (v1 ^ v2)), high, high);
+          };
 
           /*
            * Create the semantic.
            * cf = MSB((op0 & op1) ^ ((op0 ^ op1 ^ parent) & (op0 ^ op1)));
            */
-          auto node = triton::ast::extract(high, high,
-                        triton::ast::bvxor(
-                          triton::ast::bvand(op1, op2),
-                          triton::ast::bvand(
-                            triton::ast::bvxor(
-                              triton::ast::bvxor(op1, op2),
-                              triton::ast::extract(high, low, triton::ast::reference(parent->getId()))
-                            ),
-                          triton::ast::bvxor(op1, op2))
-                        )
-                      );
-
-          /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+          auto semantics = [=]() -> triton::ast::AbstractNode* {
+            return triton::ast::extract(high, high,
+                     triton::ast::bvxor(
+                       triton::ast::bvand(op1, op2),
+                       triton::ast::bvand(
+                         triton::ast::bvxor(
+                           triton::ast::bvxor(op1, op2),
+                           triton::ast::extract(high, low, triton::ast::reference(parentId))
+                         ),
+                       triton::ast::bvxor(op1, op2))
+                     )
+                   );
+          };
 
-          /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+          triton::arch::x86::semantics::flag_s(inst, parent, TRITON_X86_REG_CF, (low == 0), value, semantics, "Carry flag");
         }
 
 
@@ -838,10 +877,10 @@ namespace triton {
                       );
 
           /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+          expr->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
         }
 
 
@@ -862,10 +901,10 @@ namespace triton {
                       );
 
           /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+          expr->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
         }
 
 
@@ -886,10 +925,10 @@ namespace triton {
                       );
 
           /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+          expr->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
         }
 
 
@@ -912,10 +951,10 @@ namespace triton {
                       );
 
           /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+          expr->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
         }
 
 
@@ -937,13 +976,13 @@ namespace triton {
           if (reinterpret_cast<triton::ast::DecimalNode*>(op2)->getValue() != 0)
             node = triton::ast::extract(high, high, result);
           else
-            node = triton::api.buildSymbolicOperand(inst, cf);
+            node = triton::getContext().buildSymbolicOperand(inst, cf);
 
           /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+          expr->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
         }
 
 
@@ -967,14 +1006,14 @@ namespace triton {
             node = triton::ast::extract(high, high, result);
           }
           else {
-            node = triton::api.buildSymbolicOperand(inst, cf);
+            node = triton::getContext().buildSymbolicOperand(inst, cf);
           }
 
           /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+          expr->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
         }
 
 
@@ -996,13 +1035,13 @@ namespace triton {
           if (reinterpret_cast<triton::ast::DecimalNode*>(op2)->getValue() != 0)
             node = triton::ast::extract(low, low, triton::ast::reference(parent->getId()));
           else
-            node = triton::api.buildSymbolicOperand(inst, cf);
+            node = triton::getContext().buildSymbolicOperand(inst, cf);
 
           /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+          expr->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
         }
 
 
@@ -1025,13 +1064,13 @@ namespace triton {
           if (reinterpret_cast<triton::ast::DecimalNode*>(op2)->getValue() != 0)
             node = triton::ast::extract(high, high, triton::ast::reference(parent->getId()));
           else
-            node = triton::api.buildSymbolicOperand(inst, cf);
+            node = triton::getContext().buildSymbolicOperand(inst, cf);
 
           /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+          expr->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
         }
 
 
@@ -1049,7 +1088,7 @@ namespace triton {
            */
           auto node = triton::ast::ite(
                         triton::ast::equal(op2, triton::ast::bv(0, bvSize)),
-                        triton::api.buildSymbolicOperand(inst, cf),
+                        triton::getContext().buildSymbolicOperand(inst, cf),
                         triton::ast::ite(
                           triton::ast::bvugt(op2, triton::ast::bv(bvSize, bvSize)),
                           triton::ast::extract(0, 0, triton::ast::bvlshr(op1, triton::ast::bvsub(triton::ast::bv(bvSize, bvSize), triton::ast::bv(1, bvSize)))),
@@ -1058,10 +1097,10 @@ namespace triton {
                       );
 
           /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+          expr->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
         }
 
 
@@ -1075,7 +1114,7 @@ namespace triton {
            */
           auto node = triton::ast::ite(
                         triton::ast::equal(op2, triton::ast::bv(0, bvSize)),
-                        triton::api.buildSymbolicOperand(inst, cf),
+                        triton::getContext().buildSymbolicOperand(inst, cf),
                         triton::ast::extract(0, 0,
                           triton::ast::bvlshr(
                             op1,
@@ -1088,10 +1127,10 @@ namespace triton {
                       );
 
           /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+          expr->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
         }
 
 
@@ -1105,7 +1144,7 @@ namespace triton {
            */
           auto node = triton::ast::ite(
                         triton::ast::equal(op2, triton::ast::bv(0, bvSize)),
-                        triton::api.buildSymbolicOperand(inst, cf),
+                        triton::getContext().buildSymbolicOperand(inst, cf),
                         triton::ast::extract(0, 0,
                           triton::ast::bvlshr(
                             op1,
@@ -1117,61 +1156,75 @@ namespace triton {
                       );
 
           /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+          expr->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
         }
 
 
         void cfSub_s(triton::arch::Instruction& inst, triton::engines::symbolic::SymbolicExpression* parent, triton::arch::OperandWrapper& dst, triton::ast::AbstractNode* op1, triton::ast::AbstractNode* op2, bool vol) {
-          auto bvSize = dst.getBitSize();
-          auto low    = vol ? 0 : dst.getAbstractLow();
-          auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
+          auto bvSize   = dst.getBitSize();
+          auto low      = vol ? 0 : dst.getAbstractLow();
+          auto high     = vol ? bvSize-1 : dst.getAbstractHigh();
+          auto parentId = parent->getId();
+
+          /* The concrete value of the flag */
+          auto value = [=]() -> triton::uint512 {
+            auto res = extractValue(parent->getAst()->evaluate(), high, low);
+            auto v1  = op1->evaluate();
+            auto v2  = op2->evaluate();
+            return extractValue((v1 ^ (v2 ^ res)) ^ ((v1 ^ res) & (v1 ^ v2)), high, high);
+          };
 
           /*
            * Create the semantic.
            * cf = extract(bvSize, bvSize (((op1 ^ op2 ^ res) ^ ((op1 ^ res) & (op1 ^ op2)))))
            */
-          auto node = triton::ast::extract(high, high,
-                        triton::ast::bvxor(
-                          triton::ast::bvxor(op1, triton::ast::bvxor(op2, triton::ast::extract(high, low, triton::ast::reference(parent->getId())))),
-                          triton::ast::bvand(
-                            triton::ast::bvxor(op1, triton::ast::extract(high, low, triton::ast::reference(parent->getId()))),
-                            triton::ast::bvxor(op1, op2)
-                          )
-                        )
-                      );
-
-          /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+          auto semantics = [=]() -> triton::ast::AbstractNode* {
+            return triton::ast::extract(high, high,
+                     triton::ast::bvxor(
+                       triton::ast::bvxor(op1, triton::ast::bvxor(op2, triton::ast::extract(high, low, triton::ast::reference(parentId)))),
+                       triton::ast::bvand(
+                         triton::ast::bvxor(op1, triton::ast::extract(high, low, triton::ast::reference(parentId))),
+                         triton::ast::bvxor(op1, op2)
+                       )
+                     )
+                   );
+          };
 
-          /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+          triton::arch::x86::semantics::flag_s(inst, parent, TRITON_X86_REG_CF, (low == 0), value, semantics, "Carry flag");
         }
 
 
         void ofAdd_s(triton::arch::Instruction& inst, triton::engines::symbolic::SymbolicExpression* parent, triton::arch::OperandWrapper& dst, triton::ast::AbstractNode* op1, triton::ast::AbstractNode* op2, bool vol) {
-          auto bvSize = dst.getBitSize();
-          auto low    = vol ? 0 : dst.getAbstractLow();
-          auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
+          auto bvSize   = dst.getBitSize();
+          auto low      = vol ? 0 : dst.getAbstractLow();
+          auto high     = vol ? bvSize-1 : dst.getAbstractHigh();
+          auto parentId = parent->getId();
+
+          /* The concrete value of the flag */
+          auto value = [=]() -> triton::uint512 {
+            auto res = extractValue(parent->getAst()->evaluate(), high, low);
+            auto v1  = op1->evaluate();
+            auto v2  = op2->evaluate();
+            return extractValue((v1 ^ ~v2) & (v1 ^ res), high, high);
+          };
 
           /*
            * Create the semantic.
            * of = MSB((op1 ^ ~op2) & (op1 ^ regDst))
            */
-          auto node = triton::ast::extract(high, high,
-                        triton::ast::bvand(
-                          triton::ast::bvxor(op1, triton::ast::bvnot(op2)),
-                          triton::ast::bvxor(op1, triton::ast::extract(high, low, triton::ast::reference(parent->getId())))
-                        )
-                      );
-
-          /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
+          auto semantics = [=]() -> triton::ast::AbstractNode* {
+            return triton::ast::extract(high, high,
+                     triton::ast::bvand(
+                       triton::ast::bvxor(op1, triton::ast::bvnot(op2)),
+                       triton::ast::bvxor(op1, triton::ast::extract(high, low, triton::ast::reference(parentId)))
+                     )
+                   );
+          };
 
-          /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+          triton::arch::x86::semantics::flag_s(inst, parent, TRITON_X86_REG_OF, (low == 0), value, semantics, "Overflow flag");
         }
 
 
@@ -1190,10 +1243,10 @@ namespace triton {
                       );
 
           /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+          expr->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
         }
 
 
@@ -1214,10 +1267,10 @@ namespace triton {
                       );
 
           /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+          expr->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
         }
 
 
@@ -1238,10 +1291,10 @@ namespace triton {
                       );
 
           /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+          expr->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
         }
 
 
@@ -1265,18 +1318,18 @@ namespace triton {
           if (reinterpret_cast<triton::ast::DecimalNode*>(op2)->getValue() == 1) {
             node = triton::ast::bvxor(
                      triton::ast::extract(high, high, triton::ast::reference(parent->getId())),
-                     triton::api.buildSymbolicOperand(inst, cf)
+                     triton::getContext().buildSymbolicOperand(inst, cf)
                    );
           }
           else {
-            node = triton::api.buildSymbolicOperand(inst, of);
+            node = triton::getContext().buildSymbolicOperand(inst, of);
           }
 
           /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+          expr->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
         }
 
 
@@ -1303,14 +1356,14 @@ namespace triton {
                    );
           }
           else {
-            node = triton::api.buildSymbolicOperand(inst, of);
+            node = triton::getContext().buildSymbolicOperand(inst, of);
           }
 
           /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+          expr->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
         }
 
 
@@ -1333,18 +1386,18 @@ namespace triton {
           if (reinterpret_cast<triton::ast::DecimalNode *>(op2)->getValue() == 1) {
             node = triton::ast::bvxor(
                      triton::ast::extract(high, high, op1),
-                     triton::api.buildSymbolicOperand(inst, cf)
+                     triton::getContext().buildSymbolicOperand(inst, cf)
                    );
           }
           else {
-            node = triton::api.buildSymbolicOperand(inst, of);
+            node = triton::getContext().buildSymbolicOperand(inst, of);
           }
 
           /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+          expr->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
         }
 
 
@@ -1361,14 +1414,14 @@ namespace triton {
                           op2,
                           triton::ast::bv(1, bvSize)),
                         triton::ast::bv(0, 1),
-                        triton::api.buildSymbolicOperand(inst, of)
+                        triton::getContext().buildSymbolicOperand(inst, of)
                       );
 
           /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+          expr->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
         }
 
 
@@ -1390,14 +1443,14 @@ namespace triton {
                             triton::ast::bvlshr(op1, triton::ast::bvsub(triton::ast::bv(bvSize, bvSize), triton::ast::bv(2, bvSize)))
                           )
                         ),
-                        triton::api.buildSymbolicOperand(inst, of)
+                        triton::getContext().buildSymbolicOperand(inst, of)
                       );
 
           /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+          expr->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
         }
 
 
@@ -1414,44 +1467,61 @@ namespace triton {
                           op2,
                           triton::ast::bv(1, bvSize)),
                         triton::ast::extract(0, 0, triton::ast::bvlshr(op1, triton::ast::bvsub(triton::ast::bv(bvSize, bvSize), triton::ast::bv(1, bvSize)))),
-                        triton::api.buildSymbolicOperand(inst, of)
+                        triton::getContext().buildSymbolicOperand(inst, of)
                       );
 
           /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+          expr->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
         }
 
 
         void ofSub_s(triton::arch::Instruction& inst, triton::engines::symbolic::SymbolicExpression* parent, triton::arch::OperandWrapper& dst, triton::ast::AbstractNode* op1, triton::ast::AbstractNode* op2, bool vol) {
-          auto bvSize = dst.getBitSize();
-          auto low    = vol ? 0 : dst.getAbstractLow();
-          auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
+          auto bvSize   = dst.getBitSize();
+          auto low      = vol ? 0 : dst.getAbstractLow();
+          auto high     = vol ? bvSize-1 : dst.getAbstractHigh();
+          auto parentId = parent->getId();
+
+          /* The concrete value of the flag */
+          auto value = [=]() -> triton::uint512 {
+            auto res = extractValue(parent->getAst()->evaluate(), high, low);
+            auto v1  = op1->evaluate();
+            auto v2  = op2->evaluate();
+            return extractValue((v1 ^ v2) & (v1 ^ res), high, high);
+          };
 
           /*
            * Create the semantic.
            * of = high:bool((op1 ^ op2) & (op1 ^ regDst))
            */
-          auto node = triton::ast::extract(high, high,
-                        triton::ast::bvand(
-                          triton::ast::bvxor(op1, op2),
-                          triton::ast::bvxor(op1, triton::ast::extract(high, low, triton::ast::reference(parent->getId())))
-                        )
-                      );
-
-          /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
+          auto semantics = [=]() -> triton::ast::AbstractNode* {
+            return triton::ast::extract(high, high,
+                     triton::ast::bvand(
+                       triton::ast::bvxor(op1, op2),
+                       triton::ast::bvxor(op1, triton::ast::extract(high, low, triton::ast::reference(parentId)))
+                     )
+                   );
+          };
 
-          /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+          triton::arch::x86::semantics::flag_s(inst, parent, TRITON_X86_REG_OF, (low == 0), value, semantics, "Overflow flag");
         }
 
 
         void pf_s(triton::arch::Instruction& inst, triton::engines::symbolic::SymbolicExpression* parent, triton::arch::OperandWrapper& dst, bool vol) {
-          auto low    = vol ? 0 : dst.getAbstractLow();
-          auto high   = vol ? BYTE_SIZE_BIT-1 : !low ? BYTE_SIZE_BIT-1 : WORD_SIZE_BIT-1;
+          auto low      = vol ? 0 : dst.getAbstractLow();
+          auto high     = vol ? BYTE_SIZE_BIT-1 : !low ? BYTE_SIZE_BIT-1 : WORD_SIZE_BIT-1;
+          auto parentId = parent->getId();
+
+          /* The concrete value of the flag */
+          auto value = [=]() -> triton::uint512 {
+            auto res    = extractValue(parent->getAst()->evaluate(), high, low);
+            auto parity = triton::uint512(1);
+            for (triton::uint32 counter = 0; counter <= BYTE_SIZE_BIT-1; counter++)
+              parity ^= ((res >> counter) & 1);
+            return parity;
+          };
 
           /*
            * Create the semantics.
@@ -1459,24 +1529,23 @@ namespace triton {
            * pf is set to one if there is an even number of bit set to 1 in the least
            * significant byte of the result.
            */
-          auto node = triton::ast::bv(1, 1);
-          for (triton::uint32 counter = 0; counter <= BYTE_SIZE_BIT-1; counter++) {
-            node = triton::ast::bvxor(
-                     node,
-                     triton::ast::extract(0, 0,
-                       triton::ast::bvlshr(
-                         triton::ast::extract(high, low, triton::ast::reference(parent->getId())),
-                         triton::ast::bv(counter, BYTE_SIZE_BIT)
-                       )
-                    )
-                  );
-          }
-
-          /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_PF, "Parity flag");
+          auto semantics = [=]() -> triton::ast::AbstractNode* {
+            auto node = triton::ast::bv(1, 1);
+            for (triton::uint32 counter = 0; counter <= BYTE_SIZE_BIT-1; counter++) {
+              node = triton::ast::bvxor(
+                       node,
+                       triton::ast::extract(0, 0,
+                         triton::ast::bvlshr(
+                           triton::ast::extract(high, low, triton::ast::reference(parentId)),
+                           triton::ast::bv(counter, BYTE_SIZE_BIT)
+                         )
+                      )
+                    );
+            }
+            return node;
+          };
 
-          /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_PF, parent->isTainted);
+          triton::arch::x86::semantics::flag_s(inst, parent, TRITON_X86_REG_PF, true, value, semantics, "Parity flag");
         }
 
 
@@ -1505,33 +1574,37 @@ namespace triton {
 
           auto node2 = triton::ast::ite(
                          triton::ast::equal(op2, triton::ast::bv(0, bvSize)),
-                         triton::api.buildSymbolicOperand(inst, pf),
+                         triton::getContext().buildSymbolicOperand(inst, pf),
                          node1
                        );
 
           /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node2, TRITON_X86_REG_PF, "Parity flag");
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node2, TRITON_X86_REG_PF, "Parity flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_PF, parent->isTainted);
+          expr->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_PF, parent->isTainted);
         }
 
 
         void sf_s(triton::arch::Instruction& inst, triton::engines::symbolic::SymbolicExpression* parent, triton::arch::OperandWrapper& dst, bool vol) {
-          auto bvSize = dst.getBitSize();
-          auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
+          auto bvSize   = dst.getBitSize();
+          auto high     = vol ? bvSize-1 : dst.getAbstractHigh();
+          auto parentId = parent->getId();
+
+          /* The concrete value of the flag */
+          auto value = [=]() -> triton::uint512 {
+            return extractValue(parent->getAst()->evaluate(), high, high);
+          };
 
           /*
            * Create the semantic.
            * sf = high:bool(regDst)
            */
-          auto node = triton::ast::extract(high, high, triton::ast::reference(parent->getId()));
-
-          /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_SF, "Sign flag");
+          auto semantics = [=]() -> triton::ast::AbstractNode* {
+            return triton::ast::extract(high, high, triton::ast::reference(parentId));
+          };
 
-          /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_SF, parent->isTainted);
+          triton::arch::x86::semantics::flag_s(inst, parent, TRITON_X86_REG_SF, true, value, semantics, "Sign flag");
         }
 
 
@@ -1546,41 +1619,45 @@ namespace triton {
            */
           auto node = triton::ast::ite(
                         triton::ast::equal(op2, triton::ast::bv(0, bvSize)),
-                        triton::api.buildSymbolicOperand(inst, sf),
+                        triton::getContext().buildSymbolicOperand(inst, sf),
                         triton::ast::extract(high, high, triton::ast::reference(parent->getId()))
                       );
 
           /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_SF, "Sign flag");
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node, TRITON_X86_REG_SF, "Sign flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_SF, parent->isTainted);
+          expr->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_SF, parent->isTainted);
         }
 
 
         void zf_s(triton::arch::Instruction& inst, triton::engines::symbolic::SymbolicExpression* parent, triton::arch::OperandWrapper& dst, bool vol) {
-          auto bvSize = dst.getBitSize();
-          auto low    = vol ? 0 : dst.getAbstractLow();
-          auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
+          auto bvSize   = dst.getBitSize();
+          auto low      = vol ? 0 : dst.getAbstractLow();
+          auto high     = vol ? bvSize-1 : dst.getAbstractHigh();
+          auto parentId = parent->getId();
+
+          /* The concrete value of the flag */
+          auto value = [=]() -> triton::uint512 {
+            return (extractValue(parent->getAst()->evaluate(), high, low) == 0) ? 1 : 0;
+          };
 
           /*
            * Create the semantic.
            * zf = 0 == regDst
            */
-          auto node = triton::ast::ite(
-                        triton::ast::equal(
-                          triton::ast::extract(high, low, triton::ast::reference(parent->getId())),
-                          triton::ast::bv(0, bvSize)
-                        ),
-                        triton::ast::bv(1, 1),
-                        triton::ast::bv(0, 1)
-                      );
-
-          /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_ZF, "Zero flag");
+          auto semantics = [=]() -> triton::ast::AbstractNode* {
+            return triton::ast::ite(
+                     triton::ast::equal(
+                       triton::ast::extract(high, low, triton::ast::reference(parentId)),
+                       triton::ast::bv(0, bvSize)
+                     ),
+                     triton::ast::bv(1, 1),
+                     triton::ast::bv(0, 1)
+                   );
+          };
 
-          /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_ZF, parent->isTainted);
+          triton::arch::x86::semantics::flag_s(inst, parent, TRITON_X86_REG_ZF, true, value, semantics, "Zero flag");
         }
 
 
@@ -1598,10 +1675,10 @@ namespace triton {
                       );
 
           /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_ZF, "Zero flag");
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node, TRITON_X86_REG_ZF, "Zero flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_ZF, parent->isTainted);
+          expr->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_ZF, parent->isTainted);
         }
 
 
@@ -1617,7 +1694,7 @@ namespace triton {
            */
           auto node = triton::ast::ite(
                         triton::ast::equal(op2, triton::ast::bv(0, bvSize)),
-                        triton::api.buildSymbolicOperand(inst, zf),
+                        triton::getContext().buildSymbolicOperand(inst, zf),
                         triton::ast::ite(
                           triton::ast::equal(
                             triton::ast::extract(high, low, triton::ast::reference(parent->getId())),
@@ -1629,10 +1706,10 @@ namespace triton {
                       );
 
           /* Create the symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_ZF, "Zero flag");
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node, TRITON_X86_REG_ZF, "Zero flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_ZF, parent->isTainted);
+          expr->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_ZF, parent->isTainted);
         }
 
 
@@ -1642,19 +1719,19 @@ namespace triton {
           auto  cf  = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, cf);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, cf);
 
           /* Create the semantics */
           auto node = triton::ast::bvadd(triton::ast::bvadd(op1, op2), triton::ast::zx(dst.getBitSize()-1, op3));
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "ADC operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "ADC operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
-          expr->isTainted = triton::api.taintUnion(dst, cf);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, cf);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::af_s(inst, expr, dst, op1, op2);
@@ -1674,17 +1751,17 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::bvadd(op1, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "ADD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "ADD operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::af_s(inst, expr, dst, op1, op2);
@@ -1704,17 +1781,17 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::bvand(op1, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "AND operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "AND operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::clearFlag_s(inst, TRITON_X86_REG_CF, "Clears carry flag");
@@ -1733,17 +1810,17 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::bvand(triton::ast::bvnot(op1), op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "ANDNPD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "ANDNPD operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -1755,17 +1832,17 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::bvand(triton::ast::bvnot(op1), op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "ANDNPS operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "ANDNPS operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -1777,17 +1854,17 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::bvand(op1, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "ANDPD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "ANDPD operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -1799,17 +1876,17 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::bvand(op1, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "ANDPS operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "ANDPS operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -1823,8 +1900,8 @@ namespace triton {
           auto  bvSize2 = src.getBitSize();
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           triton::ast::AbstractNode* node = nullptr;
@@ -1986,10 +2063,10 @@ namespace triton {
           }
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "BSF operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "BSF operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::zfBsf_s(inst, expr, src, op2);
@@ -2006,8 +2083,8 @@ namespace triton {
           auto  bvSize2 = src.getBitSize();
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           triton::ast::AbstractNode* node = nullptr;
@@ -2169,10 +2246,10 @@ namespace triton {
           }
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "BSR operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "BSR operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::zfBsf_s(inst, expr, src, op2); /* same as bsf */
@@ -2186,7 +2263,7 @@ namespace triton {
           auto& src = inst.operands[0];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> bytes;
@@ -2210,10 +2287,10 @@ namespace triton {
           auto node = triton::ast::concat(bytes);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, src, "BSWAP operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, src, "BSWAP operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(src, src);
+          expr->isTainted = triton::getContext().taintAssignment(src, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -2226,8 +2303,8 @@ namespace triton {
           auto& src2 = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src1);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src2);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src1);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src2);
 
           /* Create the semantics */
           auto node = triton::ast::extract(0, 0,
@@ -2241,11 +2318,11 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "BT operation");
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "BT operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src1);
-          expr->isTainted = triton::api.taintUnion(dst, src2);
+          expr->isTainted = triton::getContext().taintUnion(dst, src1);
+          expr->isTainted = triton::getContext().taintUnion(dst, src2);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -2258,8 +2335,8 @@ namespace triton {
           auto& src1 = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst2);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src1);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst2);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src1);
 
           /* Create the semantics */
           auto node1 = triton::ast::extract(0, 0,
@@ -2301,13 +2378,13 @@ namespace triton {
                        );
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicFlagExpression(inst, node1, TRITON_X86_REG_CF, "BTC carry operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, dst2, "BTC complement operation");
+          auto expr1 = triton::getContext().createSymbolicFlagExpression(inst, node1, TRITON_X86_REG_CF, "BTC carry operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, dst2, "BTC complement operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.taintUnion(dst1, dst2);
-          expr1->isTainted = triton::api.taintUnion(dst1, src1);
-          expr2->isTainted = triton::api.taintUnion(dst2, dst1);
+          expr1->isTainted = triton::getContext().taintUnion(dst1, dst2);
+          expr1->isTainted = triton::getContext().taintUnion(dst1, src1);
+          expr2->isTainted = triton::getContext().taintUnion(dst2, dst1);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -2320,8 +2397,8 @@ namespace triton {
           auto& src1 = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst2);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src1);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst2);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src1);
 
           /* Create the semantics */
           auto node1 = triton::ast::extract(0, 0,
@@ -2352,13 +2429,13 @@ namespace triton {
                        );
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicFlagExpression(inst, node1, TRITON_X86_REG_CF, "BTR carry operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, dst2, "BTR reset operation");
+          auto expr1 = triton::getContext().createSymbolicFlagExpression(inst, node1, TRITON_X86_REG_CF, "BTR carry operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, dst2, "BTR reset operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.taintUnion(dst1, dst2);
-          expr1->isTainted = triton::api.taintUnion(dst1, src1);
-          expr2->isTainted = triton::api.taintUnion(dst2, dst1);
+          expr1->isTainted = triton::getContext().taintUnion(dst1, dst2);
+          expr1->isTainted = triton::getContext().taintUnion(dst1, src1);
+          expr2->isTainted = triton::getContext().taintUnion(dst2, dst1);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -2371,8 +2448,8 @@ namespace triton {
           auto& src1 = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst2);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src1);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst2);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src1);
 
           /* Create the semantics */
           auto node1 = triton::ast::extract(0, 0,
@@ -2396,13 +2473,13 @@ namespace triton {
                        );
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicFlagExpression(inst, node1, TRITON_X86_REG_CF, "BTS carry operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, dst2, "BTS set operation");
+          auto expr1 = triton::getContext().createSymbolicFlagExpression(inst, node1, TRITON_X86_REG_CF, "BTS carry operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, dst2, "BTS set operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.taintUnion(dst1, dst2);
-          expr1->isTainted = triton::api.taintUnion(dst1, src1);
-          expr2->isTainted = triton::api.taintUnion(dst2, dst1);
+          expr1->isTainted = triton::getContext().taintUnion(dst1, dst2);
+          expr1->isTainted = triton::getContext().taintUnion(dst1, src1);
+          expr2->isTainted = triton::getContext().taintUnion(dst2, dst1);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -2419,7 +2496,7 @@ namespace triton {
           auto& src        = inst.operands[0];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics - side effect */
           auto node1 = triton::ast::bv(inst.getNextAddress(), pc.getBitSize());
@@ -2428,17 +2505,17 @@ namespace triton {
           auto node2 = op1;
 
           /* Create the symbolic expression */
-          auto expr1 = triton::api.createSymbolicExpression(inst, node1, sp, "Saved Program Counter");
+          auto expr1 = triton::getContext().createSymbolicExpression(inst, node1, sp, "Saved Program Counter");
 
           /* Create symbolic expression */
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, pc, "Program Counter");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, pc, "Program Counter");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.taintAssignmentMemoryImmediate(sp.getMemory());
-          expr2->isTainted = triton::api.taintAssignment(pc, src);
+          expr1->isTainted = triton::getContext().taintAssignmentMemoryImmediate(sp.getMemory());
+          expr2->isTainted = triton::getContext().taintAssignment(pc, src);
 
           /* Create the path constraint */
-          triton::api.addPathConstraint(inst, expr2);
+          triton::getContext().addPathConstraint(inst, expr2);
         }
 
 
@@ -2446,16 +2523,16 @@ namespace triton {
           auto dst = triton::arch::OperandWrapper(TRITON_X86_REG_AX);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
 
           /* Create the semantics */
           auto node = triton::ast::sx(BYTE_SIZE_BIT, triton::ast::extract(BYTE_SIZE_BIT-1, 0, op1));
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "CBW operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "CBW operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, dst);
+          expr->isTainted = triton::getContext().taintAssignment(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -2467,34 +2544,34 @@ namespace triton {
           auto src = triton::arch::OperandWrapper(TRITON_X86_REG_EAX);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics - TMP = 64 bitvec (EDX:EAX) */
           auto node1 = triton::ast::sx(DWORD_SIZE_BIT, op1);
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicVolatileExpression(inst, node1, "Temporary variable");
+          auto expr1 = triton::getContext().createSymbolicVolatileExpression(inst, node1, "Temporary variable");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.isRegisterTainted(TRITON_X86_REG_EDX) | triton::api.isRegisterTainted(TRITON_X86_REG_EAX);
+          expr1->isTainted = triton::getContext().isRegisterTainted(TRITON_X86_REG_EDX) | triton::getContext().isRegisterTainted(TRITON_X86_REG_EAX);
 
           /* Create the semantics - EAX = TMP[31...0] */
           auto node2 = triton::ast::extract(DWORD_SIZE_BIT-1, 0, triton::ast::reference(expr1->getId()));
 
           /* Create symbolic expression */
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, src, "CDQ EAX operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, src, "CDQ EAX operation");
 
           /* Spread taint */
-          expr2->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_EAX, expr1->isTainted);
+          expr2->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_EAX, expr1->isTainted);
 
           /* Create the semantics - EDX = TMP[63...32] */
           auto node3 = triton::ast::extract(QWORD_SIZE_BIT-1, DWORD_SIZE_BIT, triton::ast::reference(expr1->getId()));
 
           /* Create symbolic expression */
-          auto expr3 = triton::api.createSymbolicExpression(inst, node3, dst, "CDQ EDX operation");
+          auto expr3 = triton::getContext().createSymbolicExpression(inst, node3, dst, "CDQ EDX operation");
 
           /* Spread taint */
-          expr3->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_EDX, expr1->isTainted);
+          expr3->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_EDX, expr1->isTainted);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -2505,16 +2582,16 @@ namespace triton {
           auto dst = triton::arch::OperandWrapper(TRITON_X86_REG_RAX);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
 
           /* Create the semantics */
           auto node = triton::ast::sx(DWORD_SIZE_BIT, triton::ast::extract(DWORD_SIZE_BIT-1, 0, op1));
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "CDQE operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "CDQE operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, dst);
+          expr->isTainted = triton::getContext().taintAssignment(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -2539,7 +2616,7 @@ namespace triton {
           auto dst = triton::arch::OperandWrapper(TRITON_X86_REG_CR0);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
 
           /* Create the semantics */
           triton::ast::AbstractNode* node = nullptr;
@@ -2556,10 +2633,10 @@ namespace triton {
           }
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "CLTS operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "CLTS operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, dst);
+          expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -2570,16 +2647,16 @@ namespace triton {
           auto dst = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
 
           /* Create the semantics */
           auto node = triton::ast::bvnot(op1);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicFlagExpression(inst, node, dst.getRegister(), "CMC operation");
+          auto expr = triton::getContext().createSymbolicFlagExpression(inst, node, dst.getRegister(), "CMC operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, dst);
+          expr->isTainted = triton::getContext().taintAssignment(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -2593,24 +2670,24 @@ namespace triton {
           auto  zf  = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, cf);
-          auto op4 = triton::api.buildSymbolicOperand(inst, zf);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, cf);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, zf);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(triton::ast::bvand(triton::ast::bvnot(op3), triton::ast::bvnot(op4)), triton::ast::bvtrue()), op2, op1);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "CMOVA operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "CMOVA operation");
 
           /* Spread taint and condition flag */
           if ((!op3->evaluate().convert_to<bool>() & !op4->evaluate().convert_to<bool>()) == true) {
-            expr->isTainted = triton::api.taintAssignment(dst, src);
+            expr->isTainted = triton::getContext().taintAssignment(dst, src);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -2623,23 +2700,23 @@ namespace triton {
           auto  cf  = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, cf);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, cf);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(op3, triton::ast::bvfalse()), op2, op1);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "CMOVAE operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "CMOVAE operation");
 
           /* Spread taint and condition flag */
           if (!op3->evaluate().convert_to<bool>()) {
-            expr->isTainted = triton::api.taintAssignment(dst, src);
+            expr->isTainted = triton::getContext().taintAssignment(dst, src);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -2652,23 +2729,23 @@ namespace triton {
           auto  cf  = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, cf);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, cf);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(op3, triton::ast::bvtrue()), op2, op1);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "CMOVB operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "CMOVB operation");
 
           /* Spread taint and condition flag */
           if (op3->evaluate().convert_to<bool>()) {
-            expr->isTainted = triton::api.taintAssignment(dst, src);
+            expr->isTainted = triton::getContext().taintAssignment(dst, src);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -2682,24 +2759,24 @@ namespace triton {
           auto  zf  = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, cf);
-          auto op4 = triton::api.buildSymbolicOperand(inst, zf);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, cf);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, zf);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(triton::ast::bvor(op3, op4), triton::ast::bvtrue()), op2, op1);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "CMOVBE operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "CMOVBE operation");
 
           /* Spread taint and condition flag */
           if (op3->evaluate().convert_to<bool>() | op4->evaluate().convert_to<bool>()) {
-            expr->isTainted = triton::api.taintAssignment(dst, src);
+            expr->isTainted = triton::getContext().taintAssignment(dst, src);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -2712,23 +2789,23 @@ namespace triton {
           auto  zf  = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, zf);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, zf);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(op3, triton::ast::bvtrue()), op2, op1);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "CMOVE operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "CMOVE operation");
 
           /* Spread taint and condition flag */
           if (op3->evaluate().convert_to<bool>()) {
-            expr->isTainted = triton::api.taintAssignment(dst, src);
+            expr->isTainted = triton::getContext().taintAssignment(dst, src);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -2743,25 +2820,25 @@ namespace triton {
           auto  zf  = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, sf);
-          auto op4 = triton::api.buildSymbolicOperand(inst, of);
-          auto op5 = triton::api.buildSymbolicOperand(inst, zf);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, sf);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, of);
+          auto op5 = triton::getContext().buildSymbolicOperand(inst, zf);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(triton::ast::bvor(triton::ast::bvxor(op3, op4), op5), triton::ast::bvfalse()), op2, op1);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "CMOVG operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "CMOVG operation");
 
           /* Spread taint and condition flag */
           if (((op3->evaluate().convert_to<bool>() ^ op4->evaluate().convert_to<bool>()) | op5->evaluate().convert_to<bool>()) == false) {
-            expr->isTainted = triton::api.taintAssignment(dst, src);
+            expr->isTainted = triton::getContext().taintAssignment(dst, src);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -2775,24 +2852,24 @@ namespace triton {
           auto  of  = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, sf);
-          auto op4 = triton::api.buildSymbolicOperand(inst, of);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, sf);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, of);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(op3, op4), op2, op1);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "CMOVGE operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "CMOVGE operation");
 
           /* Spread taint and condition flag */
           if (op3->evaluate().convert_to<bool>() == op4->evaluate().convert_to<bool>()) {
-            expr->isTainted = triton::api.taintAssignment(dst, src);
+            expr->isTainted = triton::getContext().taintAssignment(dst, src);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -2806,24 +2883,24 @@ namespace triton {
           auto  of  = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, sf);
-          auto op4 = triton::api.buildSymbolicOperand(inst, of);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, sf);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, of);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(triton::ast::bvxor(op3, op4), triton::ast::bvtrue()), op2, op1);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "CMOVL operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "CMOVL operation");
 
           /* Spread taint and condition flag */
           if (op3->evaluate().convert_to<bool>() ^ op4->evaluate().convert_to<bool>()) {
-            expr->isTainted = triton::api.taintAssignment(dst, src);
+            expr->isTainted = triton::getContext().taintAssignment(dst, src);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -2838,25 +2915,25 @@ namespace triton {
           auto  zf  = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, sf);
-          auto op4 = triton::api.buildSymbolicOperand(inst, of);
-          auto op5 = triton::api.buildSymbolicOperand(inst, zf);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, sf);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, of);
+          auto op5 = triton::getContext().buildSymbolicOperand(inst, zf);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(triton::ast::bvor(triton::ast::bvxor(op3, op4), op5), triton::ast::bvtrue()), op2, op1);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "CMOVBE operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "CMOVBE operation");
 
           /* Spread taint and condition flag */
           if (((op3->evaluate().convert_to<bool>() ^ op4->evaluate().convert_to<bool>()) | op5->evaluate().convert_to<bool>()) == true) {
-            expr->isTainted = triton::api.taintAssignment(dst, src);
+            expr->isTainted = triton::getContext().taintAssignment(dst, src);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -2869,23 +2946,23 @@ namespace triton {
           auto  zf  = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, zf);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, zf);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(op3, triton::ast::bvfalse()), op2, op1);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "CMOVNE operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "CMOVNE operation");
 
           /* Spread taint and condition flag */
           if (!op3->evaluate().convert_to<bool>()) {
-            expr->isTainted = triton::api.taintAssignment(dst, src);
+            expr->isTainted = triton::getContext().taintAssignment(dst, src);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -2898,23 +2975,23 @@ namespace triton {
           auto  of  = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, of);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, of);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(op3, triton::ast::bvfalse()), op2, op1);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "CMOVNO operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "CMOVNO operation");
 
           /* Spread taint and condition flag */
           if (!op3->evaluate().convert_to<bool>()) {
-            expr->isTainted = triton::api.taintAssignment(dst, src);
+            expr->isTainted = triton::getContext().taintAssignment(dst, src);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -2927,23 +3004,23 @@ namespace triton {
           auto  pf  = triton::arch::OperandWrapper(TRITON_X86_REG_PF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, pf);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, pf);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(op3, triton::ast::bvfalse()), op2, op1);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "CMOVNP operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "CMOVNP operation");
 
           /* Spread taint and condition flag */
           if (!op3->evaluate().convert_to<bool>()) {
-            expr->isTainted = triton::api.taintAssignment(dst, src);
+            expr->isTainted = triton::getContext().taintAssignment(dst, src);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -2956,23 +3033,23 @@ namespace triton {
           auto  sf  = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, sf);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, sf);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(op3, triton::ast::bvfalse()), op2, op1);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "CMOVNS operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "CMOVNS operation");
 
           /* Spread taint and condition flag */
           if (!op3->evaluate().convert_to<bool>()) {
-            expr->isTainted = triton::api.taintAssignment(dst, src);
+            expr->isTainted = triton::getContext().taintAssignment(dst, src);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -2985,23 +3062,23 @@ namespace triton {
           auto  of  = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, of);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, of);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(op3, triton::ast::bvtrue()), op2, op1);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "CMOVO operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "CMOVO operation");
 
           /* Spread taint and condition flag */
           if (op3->evaluate().convert_to<bool>()) {
-            expr->isTainted = triton::api.taintAssignment(dst, src);
+            expr->isTainted = triton::getContext().taintAssignment(dst, src);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -3014,23 +3091,23 @@ namespace triton {
           auto  pf  = triton::arch::OperandWrapper(TRITON_X86_REG_PF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, pf);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, pf);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(op3, triton::ast::bvtrue()), op2, op1);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "CMOVP operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "CMOVP operation");
 
           /* Spread taint and condition flag */
           if (op3->evaluate().convert_to<bool>()) {
-            expr->isTainted = triton::api.taintAssignment(dst, src);
+            expr->isTainted = triton::getContext().taintAssignment(dst, src);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -3043,23 +3120,23 @@ namespace triton {
           auto  sf  = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, sf);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, sf);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(op3, triton::ast::bvtrue()), op2, op1);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "CMOVS operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "CMOVS operation");
 
           /* Spread taint and condition flag */
           if (op3->evaluate().convert_to<bool>()) {
-            expr->isTainted = triton::api.taintAssignment(dst, src);
+            expr->isTainted = triton::getContext().taintAssignment(dst, src);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -3071,17 +3148,17 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::ast::sx(dst.getBitSize() - src.getBitSize(), triton::api.buildSymbolicOperand(inst, src));
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::ast::sx(dst.getBitSize() - src.getBitSize(), triton::getContext().buildSymbolicOperand(inst, src));
 
           /* Create the semantics */
           auto node = triton::ast::bvsub(op1, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicVolatileExpression(inst, node, "CMP operation");
+          auto expr = triton::getContext().createSymbolicVolatileExpression(inst, node, "CMP operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.isTainted(dst) | triton::api.isTainted(src);
+          expr->isTainted = triton::getContext().isTainted(dst) | triton::getContext().isTainted(src);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::af_s(inst, expr, dst, op1, op2, true);
@@ -3108,11 +3185,11 @@ namespace triton {
             inst.setPrefix(triton::arch::x86::ID_PREFIX_REPE);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, index1);
-          auto op4 = triton::api.buildSymbolicOperand(inst, index2);
-          auto op5 = triton::api.buildSymbolicOperand(inst, df);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, index1);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, index2);
+          auto op5 = triton::getContext().buildSymbolicOperand(inst, df);
 
           /* Create the semantics */
           auto node1 = triton::ast::bvsub(op1, op2);
@@ -3128,14 +3205,14 @@ namespace triton {
                        );
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicVolatileExpression(inst, node1, "CMPSB operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, index1, "Index (SI) operation");
-          auto expr3 = triton::api.createSymbolicExpression(inst, node3, index2, "Index (DI) operation");
+          auto expr1 = triton::getContext().createSymbolicVolatileExpression(inst, node1, "CMPSB operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, index1, "Index (SI) operation");
+          auto expr3 = triton::getContext().createSymbolicExpression(inst, node3, index2, "Index (DI) operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.isTainted(dst) | triton::api.isTainted(src);
-          expr2->isTainted = triton::api.taintUnion(index1, index1);
-          expr3->isTainted = triton::api.taintUnion(index2, index2);
+          expr1->isTainted = triton::getContext().isTainted(dst) | triton::getContext().isTainted(src);
+          expr2->isTainted = triton::getContext().taintUnion(index1, index1);
+          expr3->isTainted = triton::getContext().taintUnion(index2, index2);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::af_s(inst, expr1, dst, op1, op2, true);
@@ -3162,11 +3239,11 @@ namespace triton {
             inst.setPrefix(triton::arch::x86::ID_PREFIX_REPE);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, index1);
-          auto op4 = triton::api.buildSymbolicOperand(inst, index2);
-          auto op5 = triton::api.buildSymbolicOperand(inst, df);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, index1);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, index2);
+          auto op5 = triton::getContext().buildSymbolicOperand(inst, df);
 
           /* Create the semantics */
           auto node1 = triton::ast::bvsub(op1, op2);
@@ -3182,14 +3259,14 @@ namespace triton {
                        );
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicVolatileExpression(inst, node1, "CMPSD operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, index1, "Index (SI) operation");
-          auto expr3 = triton::api.createSymbolicExpression(inst, node3, index2, "Index (DI) operation");
+          auto expr1 = triton::getContext().createSymbolicVolatileExpression(inst, node1, "CMPSD operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, index1, "Index (SI) operation");
+          auto expr3 = triton::getContext().createSymbolicExpression(inst, node3, index2, "Index (DI) operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.isTainted(dst) | triton::api.isTainted(src);
-          expr2->isTainted = triton::api.taintUnion(index1, index1);
-          expr3->isTainted = triton::api.taintUnion(index2, index2);
+          expr1->isTainted = triton::getContext().isTainted(dst) | triton::getContext().isTainted(src);
+          expr2->isTainted = triton::getContext().taintUnion(index1, index1);
+          expr3->isTainted = triton::getContext().taintUnion(index2, index2);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::af_s(inst, expr1, dst, op1, op2, true);
@@ -3216,11 +3293,11 @@ namespace triton {
             inst.setPrefix(triton::arch::x86::ID_PREFIX_REPE);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, index1);
-          auto op4 = triton::api.buildSymbolicOperand(inst, index2);
-          auto op5 = triton::api.buildSymbolicOperand(inst, df);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, index1);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, index2);
+          auto op5 = triton::getContext().buildSymbolicOperand(inst, df);
 
           /* Create the semantics */
           auto node1 = triton::ast::bvsub(op1, op2);
@@ -3236,14 +3313,14 @@ namespace triton {
                        );
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicVolatileExpression(inst, node1, "CMPSQ operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, index1, "Index (SI) operation");
-          auto expr3 = triton::api.createSymbolicExpression(inst, node3, index2, "Index (DI) operation");
+          auto expr1 = triton::getContext().createSymbolicVolatileExpression(inst, node1, "CMPSQ operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, index1, "Index (SI) operation");
+          auto expr3 = triton::getContext().createSymbolicExpression(inst, node3, index2, "Index (DI) operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.isTainted(dst) | triton::api.isTainted(src);
-          expr2->isTainted = triton::api.taintUnion(index1, index1);
-          expr3->isTainted = triton::api.taintUnion(index2, index2);
+          expr1->isTainted = triton::getContext().isTainted(dst) | triton::getContext().isTainted(src);
+          expr2->isTainted = triton::getContext().taintUnion(index1, index1);
+          expr3->isTainted = triton::getContext().taintUnion(index2, index2);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::af_s(inst, expr1, dst, op1, op2, true);
@@ -3270,11 +3347,11 @@ namespace triton {
             inst.setPrefix(triton::arch::x86::ID_PREFIX_REPE);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, index1);
-          auto op4 = triton::api.buildSymbolicOperand(inst, index2);
-          auto op5 = triton::api.buildSymbolicOperand(inst, df);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, index1);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, index2);
+          auto op5 = triton::getContext().buildSymbolicOperand(inst, df);
 
           /* Create the semantics */
           auto node1 = triton::ast::bvsub(op1, op2);
@@ -3290,14 +3367,14 @@ namespace triton {
                        );
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicVolatileExpression(inst, node1, "CMPSW operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, index1, "Index (SI) operation");
-          auto expr3 = triton::api.createSymbolicExpression(inst, node3, index2, "Index (DI) operation");
+          auto expr1 = triton::getContext().createSymbolicVolatileExpression(inst, node1, "CMPSW operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, index1, "Index (SI) operation");
+          auto expr3 = triton::getContext().createSymbolicExpression(inst, node3, index2, "Index (DI) operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.isTainted(dst) | triton::api.isTainted(src);
-          expr2->isTainted = triton::api.taintUnion(index1, index1);
-          expr3->isTainted = triton::api.taintUnion(index2, index2);
+          expr1->isTainted = triton::getContext().isTainted(dst) | triton::getContext().isTainted(src);
+          expr2->isTainted = triton::getContext().taintUnion(index1, index1);
+          expr3->isTainted = triton::getContext().taintUnion(index2, index2);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::af_s(inst, expr1, dst, op1, op2, true);
@@ -3335,12 +3412,12 @@ namespace triton {
           }
 
           /* Create symbolic operands */
-          auto op1  = triton::api.buildSymbolicOperand(inst, accumulator);
-          auto op2  = triton::api.buildSymbolicOperand(inst, src1);
-          auto op3  = triton::api.buildSymbolicOperand(inst, src2);
-          auto op1p = triton::api.buildSymbolicOperand(accumulatorp);
-          auto op2p = triton::api.buildSymbolicRegister((src1.getType() == triton::arch::OP_REG ? src1.getRegister().getParent() : accumulatorp.getRegister()));
-          auto op3p = triton::api.buildSymbolicRegister((src1.getType() == triton::arch::OP_REG ? src2.getRegister().getParent() : accumulatorp.getRegister()));
+          auto op1  = triton::getContext().buildSymbolicOperand(inst, accumulator);
+          auto op2  = triton::getContext().buildSymbolicOperand(inst, src1);
+          auto op3  = triton::getContext().buildSymbolicOperand(inst, src2);
+          auto op1p = triton::getContext().buildSymbolicOperand(accumulatorp);
+          auto op2p = triton::getContext().buildSymbolicRegister((src1.getType() == triton::arch::OP_REG ? src1.getRegister().getParent() : accumulatorp.getRegister()));
+          auto op3p = triton::getContext().buildSymbolicRegister((src1.getType() == triton::arch::OP_REG ? src2.getRegister().getParent() : accumulatorp.getRegister()));
 
           /* Create the semantics */
           auto nodeq  = triton::ast::equal(op1, op2);
@@ -3351,27 +3428,27 @@ namespace triton {
           auto node3p = triton::ast::ite(nodeq, op1p, op2p);
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicVolatileExpression(inst, node1, "CMP operation");
+          auto expr1 = triton::getContext().createSymbolicVolatileExpression(inst, node1, "CMP operation");
 
           triton::engines::symbolic::SymbolicExpression* expr2 = nullptr;
           triton::engines::symbolic::SymbolicExpression* expr3 = nullptr;
 
           /* Destination */
           if (nodeq->evaluate() == false && src1.getType() == triton::arch::OP_REG)
-            expr2 = triton::api.createSymbolicRegisterExpression(inst, node2p, src1p, "XCHG operation");
+            expr2 = triton::getContext().createSymbolicRegisterExpression(inst, node2p, src1p, "XCHG operation");
           else
-            expr2 = triton::api.createSymbolicExpression(inst, node2, src1, "XCHG operation");
+            expr2 = triton::getContext().createSymbolicExpression(inst, node2, src1, "XCHG operation");
 
           /* Accumulator */
           if (nodeq->evaluate() == true)
-            expr3 = triton::api.createSymbolicExpression(inst, node3p, accumulatorp, "XCHG operation");
+            expr3 = triton::getContext().createSymbolicExpression(inst, node3p, accumulatorp, "XCHG operation");
           else
-            expr3 = triton::api.createSymbolicExpression(inst, node3, accumulator, "XCHG operation");
+            expr3 = triton::getContext().createSymbolicExpression(inst, node3, accumulator, "XCHG operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.isTainted(accumulator) | triton::api.isTainted(src1);
-          expr2->isTainted = triton::api.taintAssignment(src1, src2);
-          expr3->isTainted = triton::api.taintAssignment(accumulator, src1);
+          expr1->isTainted = triton::getContext().isTainted(accumulator) | triton::getContext().isTainted(src1);
+          expr2->isTainted = triton::getContext().taintAssignment(src1, src2);
+          expr3->isTainted = triton::getContext().taintAssignment(accumulator, src1);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::af_s(inst, expr1, accumulator, op1, op2, true);
@@ -3394,11 +3471,11 @@ namespace triton {
           auto  src5 = triton::arch::OperandWrapper(TRITON_X86_REG_RBX);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src1);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src2);
-          auto op3 = triton::api.buildSymbolicOperand(inst, src3);
-          auto op4 = triton::api.buildSymbolicOperand(inst, src4);
-          auto op5 = triton::api.buildSymbolicOperand(inst, src5);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src1);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src2);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, src3);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, src4);
+          auto op5 = triton::getContext().buildSymbolicOperand(inst, src5);
 
           /* Create the semantics */
           /* CMP8B */
@@ -3409,16 +3486,16 @@ namespace triton {
           auto node3 = triton::ast::ite(triton::ast::equal(node1, triton::ast::bv(0, DQWORD_SIZE_BIT)), triton::ast::concat(op2, op3), op1);
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicVolatileExpression(inst, node1, "CMP operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, src1, "XCHG16B memory operation");
-          auto expr3 = triton::api.createSymbolicExpression(inst, triton::ast::extract(127, 64, node3), src2, "XCHG16B RDX operation");
-          auto expr4 = triton::api.createSymbolicExpression(inst, triton::ast::extract(63, 0, node3), src3, "XCHG16B RAX operation");
+          auto expr1 = triton::getContext().createSymbolicVolatileExpression(inst, node1, "CMP operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, src1, "XCHG16B memory operation");
+          auto expr3 = triton::getContext().createSymbolicExpression(inst, triton::ast::extract(127, 64, node3), src2, "XCHG16B RDX operation");
+          auto expr4 = triton::getContext().createSymbolicExpression(inst, triton::ast::extract(63, 0, node3), src3, "XCHG16B RAX operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.isTainted(src1) | triton::api.isTainted(src2) | triton::api.isTainted(src3);
-          expr2->isTainted = triton::api.setTaint(src1, triton::api.isTainted(src2) | triton::api.isTainted(src3));
-          expr3->isTainted = triton::api.taintAssignment(src2, src1);
-          expr4->isTainted = triton::api.taintAssignment(src3, src1);
+          expr1->isTainted = triton::getContext().isTainted(src1) | triton::getContext().isTainted(src2) | triton::getContext().isTainted(src3);
+          expr2->isTainted = triton::getContext().setTaint(src1, triton::getContext().isTainted(src2) | triton::getContext().isTainted(src3));
+          expr3->isTainted = triton::getContext().taintAssignment(src2, src1);
+          expr4->isTainted = triton::getContext().taintAssignment(src3, src1);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::zf_s(inst, expr1, src1, true);
@@ -3438,13 +3515,13 @@ namespace triton {
           auto  src3p = triton::arch::OperandWrapper(TRITON_X86_REG_EAX.getParent());
 
           /* Create symbolic operands */
-          auto op1  = triton::api.buildSymbolicOperand(inst, src1);
-          auto op2  = triton::api.buildSymbolicOperand(inst, src2);
-          auto op3  = triton::api.buildSymbolicOperand(inst, src3);
-          auto op4  = triton::api.buildSymbolicOperand(inst, src4);
-          auto op5  = triton::api.buildSymbolicOperand(inst, src5);
-          auto op2p = triton::api.buildSymbolicOperand(inst, src2p);
-          auto op3p = triton::api.buildSymbolicOperand(inst, src3p);
+          auto op1  = triton::getContext().buildSymbolicOperand(inst, src1);
+          auto op2  = triton::getContext().buildSymbolicOperand(inst, src2);
+          auto op3  = triton::getContext().buildSymbolicOperand(inst, src3);
+          auto op4  = triton::getContext().buildSymbolicOperand(inst, src4);
+          auto op5  = triton::getContext().buildSymbolicOperand(inst, src5);
+          auto op2p = triton::getContext().buildSymbolicOperand(inst, src2p);
+          auto op3p = triton::getContext().buildSymbolicOperand(inst, src3p);
 
           /* Create the semantics */
           /* CMP8B */
@@ -3462,29 +3539,29 @@ namespace triton {
                         );
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicVolatileExpression(inst, node1, "CMP operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, src1, "XCHG8B memory operation");
+          auto expr1 = triton::getContext().createSymbolicVolatileExpression(inst, node1, "CMP operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, src1, "XCHG8B memory operation");
 
           triton::engines::symbolic::SymbolicExpression* expr3 = nullptr;
           triton::engines::symbolic::SymbolicExpression* expr4 = nullptr;
 
           /* EDX */
           if (node1->evaluate() == 0)
-            expr3 = triton::api.createSymbolicExpression(inst, triton::ast::extract((src2p.getBitSize() * 2 - 1), src2p.getBitSize(), node3p), src2p, "XCHG8B EDX operation");
+            expr3 = triton::getContext().createSymbolicExpression(inst, triton::ast::extract((src2p.getBitSize() * 2 - 1), src2p.getBitSize(), node3p), src2p, "XCHG8B EDX operation");
           else
-            expr3 = triton::api.createSymbolicExpression(inst, triton::ast::extract(63, 32, node3), src2, "XCHG8B EDX operation");
+            expr3 = triton::getContext().createSymbolicExpression(inst, triton::ast::extract(63, 32, node3), src2, "XCHG8B EDX operation");
 
           /* EAX */
           if (node1->evaluate() == 0)
-            expr4 = triton::api.createSymbolicExpression(inst, triton::ast::extract(src2p.getBitSize() - 1, 0, node3p), src3p, "XCHG8B EAX operation");
+            expr4 = triton::getContext().createSymbolicExpression(inst, triton::ast::extract(src2p.getBitSize() - 1, 0, node3p), src3p, "XCHG8B EAX operation");
           else
-            expr4 = triton::api.createSymbolicExpression(inst, triton::ast::extract(31, 0, node3), src3, "XCHG8B EAX operation");
+            expr4 = triton::getContext().createSymbolicExpression(inst, triton::ast::extract(31, 0, node3), src3, "XCHG8B EAX operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.isTainted(src1) | triton::api.isTainted(src2) | triton::api.isTainted(src3);
-          expr2->isTainted = triton::api.setTaint(src1, triton::api.isTainted(src2) | triton::api.isTainted(src3));
-          expr3->isTainted = triton::api.taintAssignment(src2, src1);
-          expr4->isTainted = triton::api.taintAssignment(src3, src1);
+          expr1->isTainted = triton::getContext().isTainted(src1) | triton::getContext().isTainted(src2) | triton::getContext().isTainted(src3);
+          expr2->isTainted = triton::getContext().setTaint(src1, triton::getContext().isTainted(src2) | triton::getContext().isTainted(src3));
+          expr3->isTainted = triton::getContext().taintAssignment(src2, src1);
+          expr4->isTainted = triton::getContext().taintAssignment(src3, src1);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::zf_s(inst, expr1, src1, true);
@@ -3502,7 +3579,7 @@ namespace triton {
           auto dst4 = triton::arch::OperandWrapper(TRITON_X86_REG_DX.getParent());
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           triton::ast::AbstractNode* node1 = nullptr;
@@ -3611,16 +3688,16 @@ namespace triton {
           }
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicExpression(inst, node1, dst1, "CPUID AX operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, dst2, "CPUID BX operation");
-          auto expr3 = triton::api.createSymbolicExpression(inst, node3, dst3, "CPUID CX operation");
-          auto expr4 = triton::api.createSymbolicExpression(inst, node4, dst4, "CPUID DX operation");
+          auto expr1 = triton::getContext().createSymbolicExpression(inst, node1, dst1, "CPUID AX operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, dst2, "CPUID BX operation");
+          auto expr3 = triton::getContext().createSymbolicExpression(inst, node3, dst3, "CPUID CX operation");
+          auto expr4 = triton::getContext().createSymbolicExpression(inst, node4, dst4, "CPUID DX operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_AX.getParent(), false);
-          expr2->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_BX.getParent(), false);
-          expr3->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CX.getParent(), false);
-          expr4->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_DX.getParent(), false);
+          expr1->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_AX.getParent(), false);
+          expr2->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_BX.getParent(), false);
+          expr3->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_CX.getParent(), false);
+          expr4->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_DX.getParent(), false);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -3632,34 +3709,34 @@ namespace triton {
           auto src = triton::arch::OperandWrapper(TRITON_X86_REG_RAX);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics - TMP = 128 bitvec (RDX:RAX) */
           auto node1 = triton::ast::sx(QWORD_SIZE_BIT, op1);
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicVolatileExpression(inst, node1, "Temporary variable");
+          auto expr1 = triton::getContext().createSymbolicVolatileExpression(inst, node1, "Temporary variable");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.isRegisterTainted(TRITON_X86_REG_RDX) | triton::api.isRegisterTainted(TRITON_X86_REG_RAX);
+          expr1->isTainted = triton::getContext().isRegisterTainted(TRITON_X86_REG_RDX) | triton::getContext().isRegisterTainted(TRITON_X86_REG_RAX);
 
           /* Create the semantics - RAX = TMP[63...0] */
           auto node2 = triton::ast::extract(QWORD_SIZE_BIT-1, 0, triton::ast::reference(expr1->getId()));
 
           /* Create symbolic expression */
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, src, "CQO RAX operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, src, "CQO RAX operation");
 
           /* Spread taint */
-          expr2->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_RAX, expr1->isTainted);
+          expr2->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_RAX, expr1->isTainted);
 
           /* Create the semantics - RDX = TMP[127...64] */
           auto node3 = triton::ast::extract(DQWORD_SIZE_BIT-1, QWORD_SIZE_BIT, triton::ast::reference(expr1->getId()));
 
           /* Create symbolic expression */
-          auto expr3 = triton::api.createSymbolicExpression(inst, node3, dst, "CQO RDX operation");
+          auto expr3 = triton::getContext().createSymbolicExpression(inst, node3, dst, "CQO RDX operation");
 
           /* Spread taint */
-          expr3->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_RDX, expr1->isTainted);
+          expr3->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_RDX, expr1->isTainted);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -3671,34 +3748,34 @@ namespace triton {
           auto src = triton::arch::OperandWrapper(TRITON_X86_REG_AX);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics - TMP = 32 bitvec (DX:AX) */
           auto node1 = triton::ast::sx(WORD_SIZE_BIT, op1);
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicVolatileExpression(inst, node1, "Temporary variable");
+          auto expr1 = triton::getContext().createSymbolicVolatileExpression(inst, node1, "Temporary variable");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.isRegisterTainted(TRITON_X86_REG_DX) | triton::api.isRegisterTainted(TRITON_X86_REG_AX);
+          expr1->isTainted = triton::getContext().isRegisterTainted(TRITON_X86_REG_DX) | triton::getContext().isRegisterTainted(TRITON_X86_REG_AX);
 
           /* Create the semantics - AX = TMP[15...0] */
           auto node2 = triton::ast::extract(WORD_SIZE_BIT-1, 0, triton::ast::reference(expr1->getId()));
 
           /* Create symbolic expression */
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, src, "CWD AX operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, src, "CWD AX operation");
 
           /* Spread taint */
-          expr2->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_AX, expr1->isTainted);
+          expr2->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_AX, expr1->isTainted);
 
           /* Create the semantics - DX = TMP[31...16] */
           auto node3 = triton::ast::extract(DWORD_SIZE_BIT-1, WORD_SIZE_BIT, triton::ast::reference(expr1->getId()));
 
           /* Create symbolic expression */
-          auto expr3 = triton::api.createSymbolicExpression(inst, node3, dst, "CWD DX operation");
+          auto expr3 = triton::getContext().createSymbolicExpression(inst, node3, dst, "CWD DX operation");
 
           /* Spread taint */
-          expr3->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_DX, expr1->isTainted);
+          expr3->isTainted = triton::getContext().setTaintRegister(TRITON_X86_REG_DX, expr1->isTainted);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -3709,16 +3786,16 @@ namespace triton {
           auto dst = triton::arch::OperandWrapper(TRITON_X86_REG_EAX);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
 
           /* Create the semantics */
           auto node = triton::ast::sx(WORD_SIZE_BIT, triton::ast::extract(WORD_SIZE_BIT-1, 0, op1));
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "CWDE operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "CWDE operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, dst);
+          expr->isTainted = triton::getContext().taintAssignment(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -3729,17 +3806,17 @@ namespace triton {
           auto& dst = inst.operands[0];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
           auto op2 = triton::ast::bv(1, dst.getBitSize());
 
           /* Create the semantics */
           auto node = triton::ast::bvsub(op1, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "DEC operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "DEC operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, dst);
+          expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::af_s(inst, expr, dst, op1, op2);
@@ -3757,7 +3834,7 @@ namespace triton {
           auto& src = inst.operands[0];
 
           /* Create symbolic operands */
-          auto divisor = triton::api.buildSymbolicOperand(inst, src);
+          auto divisor = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create symbolic expression */
           switch (src.getSize()) {
@@ -3765,7 +3842,7 @@ namespace triton {
             case BYTE_SIZE: {
               /* AX */
               auto ax = triton::arch::OperandWrapper(TRITON_X86_REG_AX);
-              auto dividend = triton::api.buildSymbolicOperand(inst, ax);
+              auto dividend = triton::getContext().buildSymbolicOperand(inst, ax);
               /* res = AX / Source */
               auto result = triton::ast::bvudiv(dividend, triton::ast::zx(BYTE_SIZE_BIT, divisor));
               /* mod = AX % Source */
@@ -3777,9 +3854,9 @@ namespace triton {
                             triton::ast::extract((BYTE_SIZE_BIT - 1), 0, result) /* AL = res */
                           );
               /* Create symbolic expression */
-              auto expr = triton::api.createSymbolicExpression(inst, node, ax, "DIV operation");
+              auto expr = triton::getContext().createSymbolicExpression(inst, node, ax, "DIV operation");
               /* Apply the taint */
-              expr->isTainted = triton::api.taintUnion(ax, src);
+              expr->isTainted = triton::getContext().taintUnion(ax, src);
               break;
             }
 
@@ -3787,19 +3864,19 @@ namespace triton {
               /* DX:AX */
               auto dx = triton::arch::OperandWrapper(TRITON_X86_REG_DX);
               auto ax = triton::arch::OperandWrapper(TRITON_X86_REG_AX);
-              auto dividend = triton::ast::concat(triton::api.buildSymbolicOperand(inst, dx), triton::api.buildSymbolicOperand(inst, ax));
+              auto dividend = triton::ast::concat(triton::getContext().buildSymbolicOperand(inst, dx), triton::getContext().buildSymbolicOperand(inst, ax));
               /* res = DX:AX / Source */
               auto result = triton::ast::extract((WORD_SIZE_BIT - 1), 0, triton::ast::bvudiv(dividend, triton::ast::zx(WORD_SIZE_BIT, divisor)));
               /* mod = DX:AX % Source */
               auto mod = triton::ast::extract((WORD_SIZE_BIT - 1), 0, triton::ast::bvurem(dividend, triton::ast::zx(WORD_SIZE_BIT, divisor)));
               /* Create the symbolic expression for AX */
-              auto expr1 = triton::api.createSymbolicExpression(inst, result, ax, "DIV operation");
+              auto expr1 = triton::getContext().createSymbolicExpression(inst, result, ax, "DIV operation");
               /* Apply the taint for AX */
-              expr1->isTainted = triton::api.taintUnion(ax, src);
+              expr1->isTainted = triton::getContext().taintUnion(ax, src);
               /* Create the symbolic expression for DX */
-              auto expr2 = triton::api.createSymbolicExpression(inst, mod, dx, "DIV operation");
+              auto expr2 = triton::getContext().createSymbolicExpression(inst, mod, dx, "DIV operation");
               /* Apply the taint for DX */
-              expr2->isTainted = triton::api.taintUnion(dx, src);
+              expr2->isTainted = triton::getContext().taintUnion(dx, src);
               break;
             }
 
@@ -3807,19 +3884,19 @@ namespace triton {
               /* EDX:EAX */
               auto edx = triton::arch::OperandWrapper(TRITON_X86_REG_EDX);
               auto eax = triton::arch::OperandWrapper(TRITON_X86_REG_EAX);
-              auto dividend = triton::ast::concat(triton::api.buildSymbolicOperand(inst, edx), triton::api.buildSymbolicOperand(inst, eax));
+              auto dividend = triton::ast::concat(triton::getContext().buildSymbolicOperand(inst, edx), triton::getContext().buildSymbolicOperand(inst, eax));
               /* res = EDX:EAX / Source */
               auto result = triton::ast::extract((DWORD_SIZE_BIT - 1), 0, triton::ast::bvudiv(dividend, triton::ast::zx(DWORD_SIZE_BIT, divisor)));
               /* mod = EDX:EAX % Source */
               auto mod = triton::ast::extract((DWORD_SIZE_BIT - 1), 0, triton::ast::bvurem(dividend, triton::ast::zx(DWORD_SIZE_BIT, divisor)));
               /* Create the symbolic expression for EAX */
-              auto expr1 = triton::api.createSymbolicExpression(inst, result, eax, "DIV operation");
+              auto expr1 = triton::getContext().createSymbolicExpression(inst, result, eax, "DIV operation");
               /* Apply the taint for EAX */
-              expr1->isTainted = triton::api.taintUnion(eax, src);
+              expr1->isTainted = triton::getContext().taintUnion(eax, src);
               /* Create the symbolic expression for EDX */
-              auto expr2 = triton::api.createSymbolicExpression(inst, mod, edx, "DIV operation");
+              auto expr2 = triton::getContext().createSymbolicExpression(inst, mod, edx, "DIV operation");
               /* Apply the taint for EDX */
-              expr2->isTainted = triton::api.taintUnion(edx, src);
+              expr2->isTainted = triton::getContext().taintUnion(edx, src);
               break;
             }
 
@@ -3827,19 +3904,19 @@ namespace triton {
               /* RDX:RAX */
               auto rdx = triton::arch::OperandWrapper(TRITON_X86_REG_RDX);
               auto rax = triton::arch::OperandWrapper(TRITON_X86_REG_RAX);
-              auto dividend = triton::ast::concat(triton::api.buildSymbolicOperand(inst, rdx), triton::api.buildSymbolicOperand(inst, rax));
+              auto dividend = triton::ast::concat(triton::getContext().buildSymbolicOperand(inst, rdx), triton::getContext().buildSymbolicOperand(inst, rax));
               /* res = RDX:RAX / Source */
               auto result = triton::ast::extract((QWORD_SIZE_BIT - 1), 0, triton::ast::bvudiv(dividend, triton::ast::zx(QWORD_SIZE_BIT, divisor)));
               /* mod = RDX:RAX % Source */
               auto mod = triton::ast::extract((QWORD_SIZE_BIT - 1), 0, triton::ast::bvurem(dividend, triton::ast::zx(QWORD_SIZE_BIT, divisor)));
               /* Create the symbolic expression for RAX */
-              auto expr1 = triton::api.createSymbolicExpression(inst, result, rax, "DIV operation");
+              auto expr1 = triton::getContext().createSymbolicExpression(inst, result, rax, "DIV operation");
               /* Apply the taint for EAX */
-              expr1->isTainted = triton::api.taintUnion(rax, src);
+              expr1->isTainted = triton::getContext().taintUnion(rax, src);
               /* Create the symbolic expression for RDX */
-              auto expr2 = triton::api.createSymbolicExpression(inst, mod, rdx, "DIV operation");
+              auto expr2 = triton::getContext().createSymbolicExpression(inst, mod, rdx, "DIV operation");
               /* Apply the taint for EDX */
-              expr2->isTainted = triton::api.taintUnion(rdx, src);
+              expr2->isTainted = triton::getContext().taintUnion(rdx, src);
               break;
             }
 
@@ -3856,8 +3933,8 @@ namespace triton {
           auto& src2 = inst.operands[2];
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src1);
-          auto op3 = triton::api.buildSymbolicOperand(inst, src2);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src1);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, src2);
 
           /* Create the semantics */
           auto node = triton::ast::extract(DWORD_SIZE_BIT-1, 0,
@@ -3881,10 +3958,10 @@ namespace triton {
           }
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "EXTRACTPS operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "EXTRACTPS operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src1);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src1);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -3895,7 +3972,7 @@ namespace triton {
           auto& src = inst.operands[0];
 
           /* Create symbolic operands */
-          auto divisor = triton::api.buildSymbolicOperand(inst, src);
+          auto divisor = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create symbolic expression */
           switch (src.getSize()) {
@@ -3903,7 +3980,7 @@ namespace triton {
             case BYTE_SIZE: {
               /* AX */
               auto ax = triton::arch::OperandWrapper(TRITON_X86_REG_AX);
-              auto dividend = triton::api.buildSymbolicOperand(inst, ax);
+              auto dividend = triton::getContext().buildSymbolicOperand(inst, ax);
               /* res = AX / Source */
               auto result = triton::ast::bvsdiv(dividend, triton::ast::sx(BYTE_SIZE_BIT, divisor));
               /* mod = AX % Source */
@@ -3915,9 +3992,9 @@ namespace triton {
                             triton::ast::extract((BYTE_SIZE_BIT - 1), 0, result) /* AL = res */
                           );
               /* Create symbolic expression */
-              auto expr = triton::api.createSymbolicExpression(inst, node, ax, "IDIV operation");
+              auto expr = triton::getContext().createSymbolicExpression(inst, node, ax, "IDIV operation");
               /* Apply the taint */
-              expr->isTainted = triton::api.taintUnion(ax, src);
+              expr->isTainted = triton::getContext().taintUnion(ax, src);
               break;
             }
 
@@ -3925,19 +4002,19 @@ namespace triton {
               /* DX:AX */
               auto dx = triton::arch::OperandWrapper(TRITON_X86_REG_DX);
               auto ax = triton::arch::OperandWrapper(TRITON_X86_REG_AX);
-              auto dividend = triton::ast::concat(triton::api.buildSymbolicOperand(inst, dx), triton::api.buildSymbolicOperand(inst, ax));
+              auto dividend = triton::ast::concat(triton::getContext().buildSymbolicOperand(inst, dx), triton::getContext().buildSymbolicOperand(inst, ax));
               /* res = DX:AX / Source */
               auto result = triton::ast::extract((WORD_SIZE_BIT - 1), 0, triton::ast::bvsdiv(dividend, triton::ast::sx(WORD_SIZE_BIT, divisor)));
               /* mod = DX:AX % Source */
               auto mod = triton::ast::extract((WORD_SIZE_BIT - 1), 0, triton::ast::bvsrem(dividend, triton::ast::sx(WORD_SIZE_BIT, divisor)));
               /* Create the symbolic expression for AX */
-              auto expr1 = triton::api.createSymbolicExpression(inst, result, ax, "IDIV operation");
+              auto expr1 = triton::getContext().createSymbolicExpression(inst, result, ax, "IDIV operation");
               /* Apply the taint for AX */
-              expr1->isTainted = triton::api.taintUnion(ax, src);
+              expr1->isTainted = triton::getContext().taintUnion(ax, src);
               /* Create the symbolic expression for DX */
-              auto expr2 = triton::api.createSymbolicExpression(inst, mod, dx, "IDIV operation");
+              auto expr2 = triton::getContext().createSymbolicExpression(inst, mod, dx, "IDIV operation");
               /* Apply the taint for DX */
-              expr2->isTainted = triton::api.taintUnion(dx, src);
+              expr2->isTainted = triton::getContext().taintUnion(dx, src);
               break;
             }
 
@@ -3945,19 +4022,19 @@ namespace triton {
               /* EDX:EAX */
               auto edx = triton::arch::OperandWrapper(TRITON_X86_REG_EDX);
               auto eax = triton::arch::OperandWrapper(TRITON_X86_REG_EAX);
-              auto dividend = triton::ast::concat(triton::api.buildSymbolicOperand(inst, edx), triton::api.buildSymbolicOperand(inst, eax));
+              auto dividend = triton::ast::concat(triton::getContext().buildSymbolicOperand(inst, edx), triton::getContext().buildSymbolicOperand(inst, eax));
               /* res = EDX:EAX / Source */
               auto result = triton::ast::extract((DWORD_SIZE_BIT - 1), 0, triton::ast::bvsdiv(dividend, triton::ast::sx(DWORD_SIZE_BIT, divisor)));
               /* mod = EDX:EAX % Source */
               auto mod = triton::ast::extract((DWORD_SIZE_BIT - 1), 0, triton::ast::bvsrem(dividend, triton::ast::sx(DWORD_SIZE_BIT, divisor)));
               /* Create the symbolic expression for EAX */
-              auto expr1 = triton::api.createSymbolicExpression(inst, result, eax, "IDIV operation");
+              auto expr1 = triton::getContext().createSymbolicExpression(inst, result, eax, "IDIV operation");
               /* Apply the taint for EAX */
-              expr1->isTainted = triton::api.taintUnion(eax, src);
+              expr1->isTainted = triton::getContext().taintUnion(eax, src);
               /* Create the symbolic expression for EDX */
-              auto expr2 = triton::api.createSymbolicExpression(inst, mod, edx, "IDIV operation");
+              auto expr2 = triton::getContext().createSymbolicExpression(inst, mod, edx, "IDIV operation");
               /* Apply the taint for EDX */
-              expr2->isTainted = triton::api.taintUnion(edx, src);
+              expr2->isTainted = triton::getContext().taintUnion(edx, src);
               break;
             }
 
@@ -3965,19 +4042,19 @@ namespace triton {
               /* RDX:RAX */
               auto rdx = triton::arch::OperandWrapper(TRITON_X86_REG_RDX);
               auto rax = triton::arch::OperandWrapper(TRITON_X86_REG_RAX);
-              auto dividend = triton::ast::concat(triton::api.buildSymbolicOperand(inst, rdx), triton::api.buildSymbolicOperand(inst, rax));
+              auto dividend = triton::ast::concat(triton::getContext().buildSymbolicOperand(inst, rdx), triton::getContext().buildSymbolicOperand(inst, rax));
               /* res = RDX:RAX / Source */
               auto result = triton::ast::extract((QWORD_SIZE_BIT - 1), 0, triton::ast::bvsdiv(dividend, triton::ast::sx(QWORD_SIZE_BIT, divisor)));
               /* mod = RDX:RAX % Source */
               auto mod = triton::ast::extract((QWORD_SIZE_BIT - 1), 0, triton::ast::bvsrem(dividend, triton::ast::sx(QWORD_SIZE_BIT, divisor)));
               /* Create the symbolic expression for RAX */
-              auto expr1 = triton::api.createSymbolicExpression(inst, result, rax, "IDIV operation");
+              auto expr1 = triton::getContext().createSymbolicExpression(inst, result, rax, "IDIV operation");
               /* Apply the taint for EAX */
-              expr1->isTainted = triton::api.taintUnion(rax, src);
+              expr1->isTainted = triton::getContext().taintUnion(rax, src);
               /* Create the symbolic expression for RDX */
-              auto expr2 = triton::api.createSymbolicExpression(inst, mod, rdx, "IDIV operation");
+              auto expr2 = triton::getContext().createSymbolicExpression(inst, mod, rdx, "IDIV operation");
               /* Apply the taint for EDX */
-              expr2->isTainted = triton::api.taintUnion(rdx, src);
+              expr2->isTainted = triton::getContext().taintUnion(rdx, src);
               break;
             }
 
@@ -4002,11 +4079,11 @@ namespace triton {
                 case BYTE_SIZE: {
                   auto ax   = triton::arch::OperandWrapper(TRITON_X86_REG_AX);
                   auto al   = triton::arch::OperandWrapper(TRITON_X86_REG_AL);
-                  auto op1  = triton::api.buildSymbolicOperand(inst, al);
-                  auto op2  = triton::api.buildSymbolicOperand(inst, src);
+                  auto op1  = triton::getContext().buildSymbolicOperand(inst, al);
+                  auto op2  = triton::getContext().buildSymbolicOperand(inst, src);
                   auto node = triton::ast::bvmul(triton::ast::sx(BYTE_SIZE_BIT, op1), triton::ast::sx(BYTE_SIZE_BIT, op2));
-                  auto expr = triton::api.createSymbolicExpression(inst, node, ax, "IMUL operation");
-                  expr->isTainted = triton::api.taintUnion(ax, src);
+                  auto expr = triton::getContext().createSymbolicExpression(inst, node, ax, "IMUL operation");
+                  expr->isTainted = triton::getContext().taintUnion(ax, src);
                   triton::arch::x86::semantics::cfImul_s(inst, expr, al, triton::ast::bvmul(op1, op2), node);
                   triton::arch::x86::semantics::ofImul_s(inst, expr, al, triton::ast::bvmul(op1, op2), node);
                   break;
@@ -4016,13 +4093,13 @@ namespace triton {
                 case WORD_SIZE: {
                   auto ax    = triton::arch::OperandWrapper(TRITON_X86_REG_AX);
                   auto dx    = triton::arch::OperandWrapper(TRITON_X86_REG_DX);
-                  auto op1   = triton::api.buildSymbolicOperand(inst, ax);
-                  auto op2   = triton::api.buildSymbolicOperand(inst, src);
+                  auto op1   = triton::getContext().buildSymbolicOperand(inst, ax);
+                  auto op2   = triton::getContext().buildSymbolicOperand(inst, src);
                   auto node  = triton::ast::bvmul(triton::ast::sx(WORD_SIZE_BIT, op1), triton::ast::sx(WORD_SIZE_BIT, op2));
-                  auto expr1 = triton::api.createSymbolicExpression(inst, triton::ast::extract(WORD_SIZE_BIT-1, 0, node), ax, "IMUL operation");
-                  auto expr2 = triton::api.createSymbolicExpression(inst, triton::ast::extract(DWORD_SIZE_BIT-1, WORD_SIZE_BIT, node), dx, "IMUL operation");
-                  expr1->isTainted = triton::api.taintUnion(ax, src);
-                  expr2->isTainted = triton::api.taintUnion(dx, ax);
+                  auto expr1 = triton::getContext().createSymbolicExpression(inst, triton::ast::extract(WORD_SIZE_BIT-1, 0, node), ax, "IMUL operation");
+                  auto expr2 = triton::getContext().createSymbolicExpression(inst, triton::ast::extract(DWORD_SIZE_BIT-1, WORD_SIZE_BIT, node), dx, "IMUL operation");
+                  expr1->isTainted = triton::getContext().taintUnion(ax, src);
+                  expr2->isTainted = triton::getContext().taintUnion(dx, ax);
                   triton::arch::x86::semantics::cfImul_s(inst, expr1, ax, triton::ast::bvmul(op1, op2), node);
                   triton::arch::x86::semantics::ofImul_s(inst, expr1, ax, triton::ast::bvmul(op1, op2), node);
                   break;
@@ -4032,13 +4109,13 @@ namespace triton {
                 case DWORD_SIZE: {
                   auto eax   = triton::arch::OperandWrapper(TRITON_X86_REG_EAX);
                   auto edx   = triton::arch::OperandWrapper(TRITON_X86_REG_EDX);
-                  auto op1   = triton::api.buildSymbolicOperand(inst, eax);
-                  auto op2   = triton::api.buildSymbolicOperand(inst, src);
+                  auto op1   = triton::getContext().buildSymbolicOperand(inst, eax);
+                  auto op2   = triton::getContext().buildSymbolicOperand(inst, src);
                   auto node  = triton::ast::bvmul(triton::ast::sx(DWORD_SIZE_BIT, op1), triton::ast::sx(DWORD_SIZE_BIT, op2));
-                  auto expr1 = triton::api.createSymbolicExpression(inst, triton::ast::extract(DWORD_SIZE_BIT-1, 0, node), eax, "IMUL operation");
-                  auto expr2 = triton::api.createSymbolicExpression(inst, triton::ast::extract(QWORD_SIZE_BIT-1, DWORD_SIZE_BIT, node), edx, "IMUL operation");
-                  expr1->isTainted = triton::api.taintUnion(eax, src);
-                  expr2->isTainted = triton::api.taintUnion(edx, eax);
+                  auto expr1 = triton::getContext().createSymbolicExpression(inst, triton::ast::extract(DWORD_SIZE_BIT-1, 0, node), eax, "IMUL operation");
+                  auto expr2 = triton::getContext().createSymbolicExpression(inst, triton::ast::extract(QWORD_SIZE_BIT-1, DWORD_SIZE_BIT, node), edx, "IMUL operation");
+                  expr1->isTainted = triton::getContext().taintUnion(eax, src);
+                  expr2->isTainted = triton::getContext().taintUnion(edx, eax);
                   triton::arch::x86::semantics::cfImul_s(inst, expr1, eax, triton::ast::bvmul(op1, op2), node);
                   triton::arch::x86::semantics::ofImul_s(inst, expr1, eax, triton::ast::bvmul(op1, op2), node);
                   break;
@@ -4048,13 +4125,13 @@ namespace triton {
                 case QWORD_SIZE: {
                   auto rax   = triton::arch::OperandWrapper(TRITON_X86_REG_RAX);
                   auto rdx   = triton::arch::OperandWrapper(TRITON_X86_REG_RDX);
-                  auto op1   = triton::api.buildSymbolicOperand(inst, rax);
-                  auto op2   = triton::api.buildSymbolicOperand(inst, src);
+                  auto op1   = triton::getContext().buildSymbolicOperand(inst, rax);
+                  auto op2   = triton::getContext().buildSymbolicOperand(inst, src);
                   auto node  = triton::ast::bvmul(triton::ast::sx(QWORD_SIZE_BIT, op1), triton::ast::sx(QWORD_SIZE_BIT, op2));
-                  auto expr1 = triton::api.createSymbolicExpression(inst, triton::ast::extract(QWORD_SIZE_BIT-1, 0, node), rax, "IMUL operation");
-                  auto expr2 = triton::api.createSymbolicExpression(inst, triton::ast::extract(DQWORD_SIZE_BIT-1, QWORD_SIZE_BIT, node), rdx, "IMUL operation");
-                  expr1->isTainted = triton::api.taintUnion(rax, src);
-                  expr2->isTainted = triton::api.taintUnion(rdx, rax);
+                  auto expr1 = triton::getContext().createSymbolicExpression(inst, triton::ast::extract(QWORD_SIZE_BIT-1, 0, node), rax, "IMUL operation");
+                  auto expr2 = triton::getContext().createSymbolicExpression(inst, triton::ast::extract(DQWORD_SIZE_BIT-1, QWORD_SIZE_BIT, node), rdx, "IMUL operation");
+                  expr1->isTainted = triton::getContext().taintUnion(rax, src);
+                  expr2->isTainted = triton::getContext().taintUnion(rdx, rax);
                   triton::arch::x86::semantics::cfImul_s(inst, expr1, rax, triton::ast::bvmul(op1, op2), node);
                   triton::arch::x86::semantics::ofImul_s(inst, expr1, rax, triton::ast::bvmul(op1, op2), node);
                   break;
@@ -4068,11 +4145,11 @@ namespace triton {
             case 2: {
               auto& dst  = inst.operands[0];
               auto& src  = inst.operands[1];
-              auto  op1  = triton::api.buildSymbolicOperand(inst, dst);
-              auto  op2  = triton::api.buildSymbolicOperand(inst, src);
+              auto  op1  = triton::getContext().buildSymbolicOperand(inst, dst);
+              auto  op2  = triton::getContext().buildSymbolicOperand(inst, src);
               auto  node = triton::ast::bvmul(triton::ast::sx(dst.getBitSize(), op1), triton::ast::sx(src.getBitSize(), op2));
-              auto  expr = triton::api.createSymbolicExpression(inst, triton::ast::extract(dst.getBitSize()-1, 0, node), dst, "IMUL operation");
-              expr->isTainted = triton::api.taintUnion(dst, src);
+              auto  expr = triton::getContext().createSymbolicExpression(inst, triton::ast::extract(dst.getBitSize()-1, 0, node), dst, "IMUL operation");
+              expr->isTainted = triton::getContext().taintUnion(dst, src);
               triton::arch::x86::semantics::cfImul_s(inst, expr, dst, triton::ast::bvmul(op1, op2), node);
               triton::arch::x86::semantics::ofImul_s(inst, expr, dst, triton::ast::bvmul(op1, op2), node);
               break;
@@ -4083,11 +4160,11 @@ namespace triton {
               auto& dst  = inst.operands[0];
               auto& src1 = inst.operands[1];
               auto& src2 = inst.operands[2];
-              auto  op2  = triton::api.buildSymbolicOperand(inst, src1);
-              auto  op3  = triton::api.buildSymbolicOperand(inst, src2);
+              auto  op2  = triton::getContext().buildSymbolicOperand(inst, src1);
+              auto  op3  = triton::getContext().buildSymbolicOperand(inst, src2);
               auto  node = triton::ast::bvmul(triton::ast::sx(src1.getBitSize(), op2), triton::ast::sx(src2.getBitSize(), op3));
-              auto  expr = triton::api.createSymbolicExpression(inst, triton::ast::extract(dst.getBitSize()-1, 0, node), dst, "IMUL operation");
-              expr->isTainted = triton::api.setTaint(dst, triton::api.isTainted(src1) | triton::api.isTainted(src2));
+              auto  expr = triton::getContext().createSymbolicExpression(inst, triton::ast::extract(dst.getBitSize()-1, 0, node), dst, "IMUL operation");
+              expr->isTainted = triton::getContext().setTaint(dst, triton::getContext().isTainted(src1) | triton::getContext().isTainted(src2));
               triton::arch::x86::semantics::cfImul_s(inst, expr, dst, triton::ast::bvmul(op2, op3), node);
               triton::arch::x86::semantics::ofImul_s(inst, expr, dst, triton::ast::bvmul(op2, op3), node);
               break;
@@ -4104,17 +4181,17 @@ namespace triton {
           auto& dst = inst.operands[0];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
           auto op2 = triton::ast::bv(1, dst.getBitSize());
 
           /* Create the semantics */
           auto node = triton::ast::bvadd(op1, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "INC operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "INC operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, dst);
+          expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::af_s(inst, expr, dst, op1, op2);
@@ -4136,10 +4213,10 @@ namespace triton {
           auto& srcImm2 = inst.operands[0];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, cf);
-          auto op2 = triton::api.buildSymbolicOperand(inst, zf);
-          auto op3 = triton::api.buildSymbolicOperand(inst, srcImm1);
-          auto op4 = triton::api.buildSymbolicOperand(inst, srcImm2);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, cf);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, zf);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, srcImm1);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, srcImm2);
 
           /* Create the semantics */
           auto node = triton::ast::ite(
@@ -4152,18 +4229,18 @@ namespace triton {
                         ), op4, op3);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, pc, "Program Counter");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, pc, "Program Counter");
 
           /* Set condition flag */
           if ((!op1->evaluate().convert_to<bool>() & !op2->evaluate().convert_to<bool>()) == true)
             inst.setConditionTaken(true);
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(pc, cf);
-          expr->isTainted = triton::api.taintUnion(pc, zf);
+          expr->isTainted = triton::getContext().taintAssignment(pc, cf);
+          expr->isTainted = triton::getContext().taintUnion(pc, zf);
 
           /* Create the path constraint */
-          triton::api.addPathConstraint(inst, expr);
+          triton::getContext().addPathConstraint(inst, expr);
         }
 
 
@@ -4174,25 +4251,25 @@ namespace triton {
           auto& srcImm2 = inst.operands[0];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, cf);
-          auto op2 = triton::api.buildSymbolicOperand(inst, srcImm1);
-          auto op3 = triton::api.buildSymbolicOperand(inst, srcImm2);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, cf);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, srcImm1);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, srcImm2);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(op1, triton::ast::bvfalse()), op3, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, pc, "Program Counter");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, pc, "Program Counter");
 
           /* Set condition flag */
           if (!op1->evaluate().convert_to<bool>())
             inst.setConditionTaken(true);
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(pc, cf);
+          expr->isTainted = triton::getContext().taintAssignment(pc, cf);
 
           /* Create the path constraint */
-          triton::api.addPathConstraint(inst, expr);
+          triton::getContext().addPathConstraint(inst, expr);
         }
 
 
@@ -4203,25 +4280,25 @@ namespace triton {
           auto& srcImm2 = inst.operands[0];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, cf);
-          auto op2 = triton::api.buildSymbolicOperand(inst, srcImm1);
-          auto op3 = triton::api.buildSymbolicOperand(inst, srcImm2);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, cf);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, srcImm1);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, srcImm2);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(op1, triton::ast::bvtrue()), op3, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, pc, "Program Counter");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, pc, "Program Counter");
 
           /* Set condition flag */
           if (op1->evaluate().convert_to<bool>())
             inst.setConditionTaken(true);
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(pc, cf);
+          expr->isTainted = triton::getContext().taintAssignment(pc, cf);
 
           /* Create the path constraint */
-          triton::api.addPathConstraint(inst, expr);
+          triton::getContext().addPathConstraint(inst, expr);
         }
 
 
@@ -4233,16 +4310,16 @@ namespace triton {
           auto& srcImm2 = inst.operands[0];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, cf);
-          auto op2 = triton::api.buildSymbolicOperand(inst, zf);
-          auto op3 = triton::api.buildSymbolicOperand(inst, srcImm1);
-          auto op4 = triton::api.buildSymbolicOperand(inst, srcImm2);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, cf);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, zf);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, srcImm1);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, srcImm2);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(triton::ast::bvor(op1, op2), triton::ast::bvtrue()), op4, op3);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, pc, "Program Counter");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, pc, "Program Counter");
 
           /* Set condition flag */
           if (op1->evaluate().convert_to<bool>() | op2->evaluate().convert_to<bool>())
@@ -4250,11 +4327,11 @@ namespace triton {
 
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(pc, cf);
-          expr->isTainted = triton::api.taintUnion(pc, zf);
+          expr->isTainted = triton::getContext().taintAssignment(pc, cf);
+          expr->isTainted = triton::getContext().taintUnion(pc, zf);
 
           /* Create the path constraint */
-          triton::api.addPathConstraint(inst, expr);
+          triton::getContext().addPathConstraint(inst, expr);
         }
 
 
@@ -4265,25 +4342,25 @@ namespace triton {
           auto& srcImm2 = inst.operands[0];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, zf);
-          auto op2 = triton::api.buildSymbolicOperand(inst, srcImm1);
-          auto op3 = triton::api.buildSymbolicOperand(inst, srcImm2);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, zf);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, srcImm1);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, srcImm2);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(op1, triton::ast::bvtrue()), op3, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, pc, "Program Counter");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, pc, "Program Counter");
 
           /* Set condition flag */
           if (op1->evaluate().convert_to<bool>())
             inst.setConditionTaken(true);
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(pc, zf);
+          expr->isTainted = triton::getContext().taintAssignment(pc, zf);
 
           /* Create the path constraint */
-          triton::api.addPathConstraint(inst, expr);
+          triton::getContext().addPathConstraint(inst, expr);
         }
 
 
@@ -4296,29 +4373,29 @@ namespace triton {
           auto& srcImm2 = inst.operands[0];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, sf);
-          auto op2 = triton::api.buildSymbolicOperand(inst, of);
-          auto op3 = triton::api.buildSymbolicOperand(inst, zf);
-          auto op4 = triton::api.buildSymbolicOperand(inst, srcImm1);
-          auto op5 = triton::api.buildSymbolicOperand(inst, srcImm2);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, sf);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, of);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, zf);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, srcImm1);
+          auto op5 = triton::getContext().buildSymbolicOperand(inst, srcImm2);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(triton::ast::bvor(triton::ast::bvxor(op1, op2), op3), triton::ast::bvfalse()), op5, op4);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, pc, "Program Counter");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, pc, "Program Counter");
 
           /* Set condition flag */
           if (((op1->evaluate().convert_to<bool>() ^ op2->evaluate().convert_to<bool>()) | op3->evaluate().convert_to<bool>()) == false)
             inst.setConditionTaken(true);
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(pc, sf);
-          expr->isTainted = triton::api.taintUnion(pc, of);
-          expr->isTainted = triton::api.taintUnion(pc, zf);
+          expr->isTainted = triton::getContext().taintAssignment(pc, sf);
+          expr->isTainted = triton::getContext().taintUnion(pc, of);
+          expr->isTainted = triton::getContext().taintUnion(pc, zf);
 
           /* Create the path constraint */
-          triton::api.addPathConstraint(inst, expr);
+          triton::getContext().addPathConstraint(inst, expr);
         }
 
 
@@ -4330,27 +4407,27 @@ namespace triton {
           auto& srcImm2 = inst.operands[0];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, sf);
-          auto op2 = triton::api.buildSymbolicOperand(inst, of);
-          auto op3 = triton::api.buildSymbolicOperand(inst, srcImm1);
-          auto op4 = triton::api.buildSymbolicOperand(inst, srcImm2);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, sf);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, of);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, srcImm1);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, srcImm2);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(op1, op2), op4, op3);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, pc, "Program Counter");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, pc, "Program Counter");
 
           /* Set condition flag */
           if (op1->evaluate().convert_to<bool>() == op2->evaluate().convert_to<bool>())
             inst.setConditionTaken(true);
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(pc, sf);
-          expr->isTainted = triton::api.taintUnion(pc, of);
+          expr->isTainted = triton::getContext().taintAssignment(pc, sf);
+          expr->isTainted = triton::getContext().taintUnion(pc, of);
 
           /* Create the path constraint */
-          triton::api.addPathConstraint(inst, expr);
+          triton::getContext().addPathConstraint(inst, expr);
         }
 
 
@@ -4362,27 +4439,27 @@ namespace triton {
           auto& srcImm2 = inst.operands[0];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, sf);
-          auto op2 = triton::api.buildSymbolicOperand(inst, of);
-          auto op3 = triton::api.buildSymbolicOperand(inst, srcImm1);
-          auto op4 = triton::api.buildSymbolicOperand(inst, srcImm2);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, sf);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, of);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, srcImm1);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, srcImm2);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(triton::ast::bvxor(op1, op2), triton::ast::bvtrue()), op4, op3);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, pc, "Program Counter");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, pc, "Program Counter");
 
           /* Set condition flag */
           if (op1->evaluate().convert_to<bool>() ^ op2->evaluate().convert_to<bool>())
             inst.setConditionTaken(true);
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(pc, sf);
-          expr->isTainted = triton::api.taintUnion(pc, of);
+          expr->isTainted = triton::getContext().taintAssignment(pc, sf);
+          expr->isTainted = triton::getContext().taintUnion(pc, of);
 
           /* Create the path constraint */
-          triton::api.addPathConstraint(inst, expr);
+          triton::getContext().addPathConstraint(inst, expr);
         }
 
 
@@ -4395,29 +4472,29 @@ namespace triton {
           auto& srcImm2 = inst.operands[0];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, sf);
-          auto op2 = triton::api.buildSymbolicOperand(inst, of);
-          auto op3 = triton::api.buildSymbolicOperand(inst, zf);
-          auto op4 = triton::api.buildSymbolicOperand(inst, srcImm1);
-          auto op5 = triton::api.buildSymbolicOperand(inst, srcImm2);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, sf);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, of);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, zf);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, srcImm1);
+          auto op5 = triton::getContext().buildSymbolicOperand(inst, srcImm2);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(triton::ast::bvor(triton::ast::bvxor(op1, op2), op3), triton::ast::bvtrue()), op5, op4);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, pc, "Program Counter");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, pc, "Program Counter");
 
           /* Set condition flag */
           if (((op1->evaluate().convert_to<bool>() ^ op2->evaluate().convert_to<bool>()) | op3->evaluate().convert_to<bool>()) == true)
             inst.setConditionTaken(true);
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(pc, sf);
-          expr->isTainted = triton::api.taintUnion(pc, of);
-          expr->isTainted = triton::api.taintUnion(pc, zf);
+          expr->isTainted = triton::getContext().taintAssignment(pc, sf);
+          expr->isTainted = triton::getContext().taintUnion(pc, of);
+          expr->isTainted = triton::getContext().taintUnion(pc, zf);
 
           /* Create the path constraint */
-          triton::api.addPathConstraint(inst, expr);
+          triton::getContext().addPathConstraint(inst, expr);
         }
 
 
@@ -4426,22 +4503,22 @@ namespace triton {
           auto& src = inst.operands[0];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = op1;
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, pc, "Program Counter");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, pc, "Program Counter");
 
           /* Set condition flag */
           inst.setConditionTaken(true);
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(pc, src);
+          expr->isTainted = triton::getContext().taintAssignment(pc, src);
 
           /* Create the path constraint */
-          triton::api.addPathConstraint(inst, expr);
+          triton::getContext().addPathConstraint(inst, expr);
         }
 
 
@@ -4452,25 +4529,25 @@ namespace triton {
           auto& srcImm2 = inst.operands[0];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, zf);
-          auto op2 = triton::api.buildSymbolicOperand(inst, srcImm1);
-          auto op3 = triton::api.buildSymbolicOperand(inst, srcImm2);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, zf);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, srcImm1);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, srcImm2);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(op1, triton::ast::bvfalse()), op3, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, pc, "Program Counter");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, pc, "Program Counter");
 
           /* Set condition flag */
           if (!op1->evaluate().convert_to<bool>())
             inst.setConditionTaken(true);
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(pc, zf);
+          expr->isTainted = triton::getContext().taintAssignment(pc, zf);
 
           /* Create the path constraint */
-          triton::api.addPathConstraint(inst, expr);
+          triton::getContext().addPathConstraint(inst, expr);
         }
 
 
@@ -4481,25 +4558,25 @@ namespace triton {
           auto& srcImm2 = inst.operands[0];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, of);
-          auto op2 = triton::api.buildSymbolicOperand(inst, srcImm1);
-          auto op3 = triton::api.buildSymbolicOperand(inst, srcImm2);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, of);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, srcImm1);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, srcImm2);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(op1, triton::ast::bvfalse()), op3, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, pc, "Program Counter");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, pc, "Program Counter");
 
           /* Set condition flag */
           if (!op1->evaluate().convert_to<bool>())
             inst.setConditionTaken(true);
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(pc, of);
+          expr->isTainted = triton::getContext().taintAssignment(pc, of);
 
           /* Create the path constraint */
-          triton::api.addPathConstraint(inst, expr);
+          triton::getContext().addPathConstraint(inst, expr);
         }
 
 
@@ -4510,25 +4587,25 @@ namespace triton {
           auto& srcImm2 = inst.operands[0];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, pf);
-          auto op2 = triton::api.buildSymbolicOperand(inst, srcImm1);
-          auto op3 = triton::api.buildSymbolicOperand(inst, srcImm2);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, pf);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, srcImm1);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, srcImm2);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(op1, triton::ast::bvfalse()), op3, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, pc, "Program Counter");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, pc, "Program Counter");
 
           /* Set condition flag */
           if (!op1->evaluate().convert_to<bool>())
             inst.setConditionTaken(true);
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(pc, pf);
+          expr->isTainted = triton::getContext().taintAssignment(pc, pf);
 
           /* Create the path constraint */
-          triton::api.addPathConstraint(inst, expr);
+          triton::getContext().addPathConstraint(inst, expr);
         }
 
 
@@ -4539,25 +4616,25 @@ namespace triton {
           auto& srcImm2 = inst.operands[0];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, sf);
-          auto op2 = triton::api.buildSymbolicOperand(inst, srcImm1);
-          auto op3 = triton::api.buildSymbolicOperand(inst, srcImm2);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, sf);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, srcImm1);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, srcImm2);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(op1, triton::ast::bvfalse()), op3, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, pc, "Program Counter");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, pc, "Program Counter");
 
           /* Set condition flag */
           if (!op1->evaluate().convert_to<bool>())
             inst.setConditionTaken(true);
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(pc, sf);
+          expr->isTainted = triton::getContext().taintAssignment(pc, sf);
 
           /* Create the path constraint */
-          triton::api.addPathConstraint(inst, expr);
+          triton::getContext().addPathConstraint(inst, expr);
         }
 
 
@@ -4568,25 +4645,25 @@ namespace triton {
           auto& srcImm2 = inst.operands[0];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, of);
-          auto op2 = triton::api.buildSymbolicOperand(inst, srcImm1);
-          auto op3 = triton::api.buildSymbolicOperand(inst, srcImm2);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, of);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, srcImm1);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, srcImm2);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(op1, triton::ast::bvtrue()), op3, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, pc, "Program Counter");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, pc, "Program Counter");
 
           /* Set condition flag */
           if (op1->evaluate().convert_to<bool>())
             inst.setConditionTaken(true);
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(pc, of);
+          expr->isTainted = triton::getContext().taintAssignment(pc, of);
 
           /* Create the path constraint */
-          triton::api.addPathConstraint(inst, expr);
+          triton::getContext().addPathConstraint(inst, expr);
         }
 
 
@@ -4597,25 +4674,25 @@ namespace triton {
           auto& srcImm2 = inst.operands[0];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, pf);
-          auto op2 = triton::api.buildSymbolicOperand(inst, srcImm1);
-          auto op3 = triton::api.buildSymbolicOperand(inst, srcImm2);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, pf);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, srcImm1);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, srcImm2);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(op1, triton::ast::bvtrue()), op3, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, pc, "Program Counter");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, pc, "Program Counter");
 
           /* Set condition flag */
           if (op1->evaluate().convert_to<bool>())
             inst.setConditionTaken(true);
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(pc, pf);
+          expr->isTainted = triton::getContext().taintAssignment(pc, pf);
 
           /* Create the path constraint */
-          triton::api.addPathConstraint(inst, expr);
+          triton::getContext().addPathConstraint(inst, expr);
         }
 
 
@@ -4626,25 +4703,25 @@ namespace triton {
           auto& srcImm2 = inst.operands[0];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, sf);
-          auto op2 = triton::api.buildSymbolicOperand(inst, srcImm1);
-          auto op3 = triton::api.buildSymbolicOperand(inst, srcImm2);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, sf);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, srcImm1);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, srcImm2);
 
           /* Create the semantics */
           auto node = triton::ast::ite(triton::ast::equal(op1, triton::ast::bvtrue()), op3, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, pc, "Program Counter");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, pc, "Program Counter");
 
           /* Set condition flag */
           if (op1->evaluate().convert_to<bool>())
             inst.setConditionTaken(true);
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(pc, sf);
+          expr->isTainted = triton::getContext().taintAssignment(pc, sf);
 
           /* Create the path constraint */
-          triton::api.addPathConstraint(inst, expr);
+          triton::getContext().addPathConstraint(inst, expr);
         }
 
 
@@ -4657,11 +4734,11 @@ namespace triton {
           auto src5 = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src1);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src2);
-          auto op3 = triton::api.buildSymbolicOperand(inst, src3);
-          auto op4 = triton::api.buildSymbolicOperand(inst, src4);
-          auto op5 = triton::api.buildSymbolicOperand(inst, src5);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src1);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src2);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, src3);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, src4);
+          auto op5 = triton::getContext().buildSymbolicOperand(inst, src5);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> flags;
@@ -4678,14 +4755,14 @@ namespace triton {
           auto node = triton::ast::concat(flags);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "LAHF operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "LAHF operation");
 
           /* Spread taint */
-          triton::api.taintUnion(dst, src1);
-          triton::api.taintUnion(dst, src2);
-          triton::api.taintUnion(dst, src3);
-          triton::api.taintUnion(dst, src4);
-          expr->isTainted = triton::api.taintUnion(dst, src5);
+          triton::getContext().taintUnion(dst, src1);
+          triton::getContext().taintUnion(dst, src2);
+          triton::getContext().taintUnion(dst, src3);
+          triton::getContext().taintUnion(dst, src4);
+          expr->isTainted = triton::getContext().taintUnion(dst, src5);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -4697,13 +4774,13 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create the semantics */
-          auto node = triton::api.buildSymbolicOperand(inst, src);
+          auto node = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "LDDQU operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "LDDQU operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -4715,13 +4792,13 @@ namespace triton {
           auto& src = inst.operands[0];
 
           /* Create the semantics */
-          auto node = triton::api.buildSymbolicOperand(inst, src);
+          auto node = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "LDMXCSR operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "LDMXCSR operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -4747,14 +4824,14 @@ namespace triton {
           /* Create symbolic operands */
 
           /* Displacement */
-          auto op2 = triton::api.buildSymbolicImmediate(inst, srcDisp);
+          auto op2 = triton::getContext().buildSymbolicImmediate(inst, srcDisp);
           if (leaSize > srcDisp.getBitSize())
             op2 = triton::ast::zx(leaSize - srcDisp.getBitSize(), op2);
 
           /* Base */
           triton::ast::AbstractNode* op3;
           if (srcBase.isValid())
-            op3 = triton::api.buildSymbolicRegister(inst, srcBase);
+            op3 = triton::getContext().buildSymbolicRegister(inst, srcBase);
           else
             op3 = triton::ast::bv(0, leaSize);
 
@@ -4765,12 +4842,12 @@ namespace triton {
           /* Index */
           triton::ast::AbstractNode* op4;
           if (srcIndex.isValid())
-            op4 = triton::api.buildSymbolicRegister(inst, srcIndex);
+            op4 = triton::getContext().buildSymbolicRegister(inst, srcIndex);
           else
             op4 = triton::ast::bv(0, leaSize);
 
           /* Scale */
-          auto op5 = triton::api.buildSymbolicImmediate(inst, srcScale);
+          auto op5 = triton::getContext().buildSymbolicImmediate(inst, srcScale);
           if (leaSize > srcScale.getBitSize())
             op5 = triton::ast::zx(leaSize - srcScale.getBitSize(), op5);
 
@@ -4785,10 +4862,10 @@ namespace triton {
             node = triton::ast::extract(dst.getAbstractHigh(), dst.getAbstractLow(), node);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicRegisterExpression(inst, node, dst, "LEA operation");
+          auto expr = triton::getContext().createSymbolicRegisterExpression(inst, node, dst, "LEA operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.setTaint(dst, triton::api.isTainted(srcBase) | triton::api.isTainted(srcIndex));
+          expr->isTainted = triton::getContext().setTaint(dst, triton::getContext().isTainted(srcBase) | triton::getContext().isTainted(srcIndex));
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -4798,34 +4875,34 @@ namespace triton {
         void leave_s(triton::arch::Instruction& inst) {
           auto stack     = TRITON_X86_REG_SP.getParent();
           auto base      = TRITON_X86_REG_BP.getParent();
-          auto baseValue = triton::api.getConcreteRegisterValue(base).convert_to<triton::uint64>();
+          auto baseValue = triton::getContext().getConcreteRegisterValue(base).convert_to<triton::uint64>();
           auto bp1       = triton::arch::OperandWrapper(inst.popMemoryAccess(baseValue, base.getSize()));
           auto bp2       = triton::arch::OperandWrapper(TRITON_X86_REG_BP.getParent());
           auto sp        = triton::arch::OperandWrapper(stack);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, bp2);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, bp2);
 
           /* RSP = RBP */
           auto node1 = op1;
 
           /* Create the symbolic expression */
-          auto expr1 = triton::api.createSymbolicExpression(inst, node1, sp, "Stack Pointer");
+          auto expr1 = triton::getContext().createSymbolicExpression(inst, node1, sp, "Stack Pointer");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.taintAssignment(sp, bp2);
+          expr1->isTainted = triton::getContext().taintAssignment(sp, bp2);
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, bp1);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, bp1);
 
           /* RBP = pop() */
           auto node2 = op2;
 
           /* Create the symbolic expression */
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, bp2, "Stack Top Pointer");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, bp2, "Stack Top Pointer");
 
           /* Spread taint */
-          expr2->isTainted = triton::api.taintAssignment(bp2, bp1);
+          expr2->isTainted = triton::getContext().taintAssignment(bp2, bp1);
 
           /* Create the semantics - side effect */
           alignAddStack_s(inst, bp1.getSize());
@@ -4842,9 +4919,9 @@ namespace triton {
           auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
-          auto op2 = triton::api.buildSymbolicOperand(inst, index);
-          auto op3 = triton::api.buildSymbolicOperand(inst, df);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, index);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, df);
 
           /* Create the semantics */
           auto node1 = op1;
@@ -4855,12 +4932,12 @@ namespace triton {
                        );
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicExpression(inst, node1, dst, "LODSB operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, index, "Index operation");
+          auto expr1 = triton::getContext().createSymbolicExpression(inst, node1, dst, "LODSB operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, index, "Index operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.taintAssignment(dst, src);
-          expr2->isTainted = triton::api.taintUnion(index, index);
+          expr1->isTainted = triton::getContext().taintAssignment(dst, src);
+          expr2->isTainted = triton::getContext().taintUnion(index, index);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -4874,9 +4951,9 @@ namespace triton {
           auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
-          auto op2 = triton::api.buildSymbolicOperand(inst, index);
-          auto op3 = triton::api.buildSymbolicOperand(inst, df);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, index);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, df);
 
           /* Create the semantics */
           auto node1 = op1;
@@ -4887,12 +4964,12 @@ namespace triton {
                        );
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicExpression(inst, node1, dst, "LODSD operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, index, "Index operation");
+          auto expr1 = triton::getContext().createSymbolicExpression(inst, node1, dst, "LODSD operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, index, "Index operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.taintAssignment(dst, src);
-          expr2->isTainted = triton::api.taintUnion(index, index);
+          expr1->isTainted = triton::getContext().taintAssignment(dst, src);
+          expr2->isTainted = triton::getContext().taintUnion(index, index);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -4906,9 +4983,9 @@ namespace triton {
           auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
-          auto op2 = triton::api.buildSymbolicOperand(inst, index);
-          auto op3 = triton::api.buildSymbolicOperand(inst, df);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, index);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, df);
 
           /* Create the semantics */
           auto node1 = op1;
@@ -4919,12 +4996,12 @@ namespace triton {
                        );
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicExpression(inst, node1, dst, "LODSQ operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, index, "Index operation");
+          auto expr1 = triton::getContext().createSymbolicExpression(inst, node1, dst, "LODSQ operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, index, "Index operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.taintAssignment(dst, src);
-          expr2->isTainted = triton::api.taintUnion(index, index);
+          expr1->isTainted = triton::getContext().taintAssignment(dst, src);
+          expr2->isTainted = triton::getContext().taintUnion(index, index);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -4938,9 +5015,9 @@ namespace triton {
           auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
-          auto op2 = triton::api.buildSymbolicOperand(inst, index);
-          auto op3 = triton::api.buildSymbolicOperand(inst, df);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, index);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, df);
 
           /* Create the semantics */
           auto node1 = op1;
@@ -4951,12 +5028,12 @@ namespace triton {
                        );
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicExpression(inst, node1, dst, "LODSW operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, index, "Index operation");
+          auto expr1 = triton::getContext().createSymbolicExpression(inst, node1, dst, "LODSW operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, index, "Index operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.taintAssignment(dst, src);
-          expr2->isTainted = triton::api.taintUnion(index, index);
+          expr1->isTainted = triton::getContext().taintAssignment(dst, src);
+          expr2->isTainted = triton::getContext().taintUnion(index, index);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -4968,13 +5045,13 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create the semantics */
-          auto node = triton::api.buildSymbolicOperand(inst, src);
+          auto node = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOV operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOV operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -4986,13 +5063,13 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create the semantics */
-          auto node = triton::api.buildSymbolicOperand(inst, src);
+          auto node = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVABS operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVABS operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5004,13 +5081,13 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create the semantics */
-          auto node = triton::api.buildSymbolicOperand(inst, src);
+          auto node = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVAPD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVAPD operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5022,13 +5099,13 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create the semantics */
-          auto node = triton::api.buildSymbolicOperand(inst, src);
+          auto node = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVAPS operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVAPS operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5040,7 +5117,7 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           triton::ast::AbstractNode* node = nullptr;
@@ -5063,10 +5140,10 @@ namespace triton {
           }
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVD operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5078,16 +5155,16 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::concat(triton::ast::extract(QWORD_SIZE_BIT-1, 0, op2), triton::ast::extract(QWORD_SIZE_BIT-1, 0, op2));
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVDDUP operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVDDUP operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5099,16 +5176,16 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::extract(QWORD_SIZE_BIT-1, 0, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVDQ2Q operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVDQ2Q operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5120,13 +5197,13 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create the semantics */
-          auto node = triton::api.buildSymbolicOperand(inst, src);
+          auto node = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVDQA operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVDQA operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5138,13 +5215,13 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create the semantics */
-          auto node = triton::api.buildSymbolicOperand(inst, src);
+          auto node = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVDQU operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVDQU operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5156,8 +5233,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::concat(
@@ -5166,10 +5243,10 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVHLPS operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVHLPS operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5181,8 +5258,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::concat(
@@ -5191,10 +5268,10 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVHPD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVHPD operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5206,8 +5283,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::concat(
@@ -5216,10 +5293,10 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVHPS operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVHPS operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5231,8 +5308,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::concat(
@@ -5241,10 +5318,10 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVLHPS operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVLHPS operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5256,8 +5333,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::concat(
@@ -5266,10 +5343,10 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVLPD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVLPD operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5281,8 +5358,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::concat(
@@ -5291,10 +5368,10 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVLPS operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVLPS operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5306,7 +5383,7 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::zx(30,                       /* Destination[2..31] = 0        */
@@ -5317,10 +5394,10 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVMSKPD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVMSKPD operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5332,7 +5409,7 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> signs;
@@ -5345,10 +5422,10 @@ namespace triton {
           auto node = triton::ast::zx(28, triton::ast::concat(signs));
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVMSKPS operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVMSKPS operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5360,13 +5437,13 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create the semantics */
-          auto node = triton::api.buildSymbolicOperand(inst, src);
+          auto node = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVNTDQ operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVNTDQ operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5378,13 +5455,13 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create the semantics */
-          auto node = triton::api.buildSymbolicOperand(inst, src);
+          auto node = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVNTI operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVNTI operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5396,13 +5473,13 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create the semantics */
-          auto node = triton::api.buildSymbolicOperand(inst, src);
+          auto node = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVNTPD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVNTPD operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5414,13 +5491,13 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create the semantics */
-          auto node = triton::api.buildSymbolicOperand(inst, src);
+          auto node = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVNTPS operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVNTPS operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5432,13 +5509,13 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create the semantics */
-          auto node = triton::api.buildSymbolicOperand(inst, src);
+          auto node = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVNTQ operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVNTQ operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5449,7 +5526,7 @@ namespace triton {
           auto& dst = inst.operands[0];
           auto& src = inst.operands[1];
 
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> bytes;
@@ -5462,10 +5539,10 @@ namespace triton {
           auto node = triton::ast::concat(bytes);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVSHDUP operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVSHDUP operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5476,7 +5553,7 @@ namespace triton {
           auto& dst = inst.operands[0];
           auto& src = inst.operands[1];
 
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> bytes;
@@ -5489,10 +5566,10 @@ namespace triton {
           auto node = triton::ast::concat(bytes);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVSLDUP operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVSLDUP operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5503,8 +5580,8 @@ namespace triton {
           auto& dst = inst.operands[0];
           auto& src = inst.operands[1];
 
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           triton::ast::AbstractNode* node = nullptr;
@@ -5533,10 +5610,10 @@ namespace triton {
             throw triton::exceptions::Semantics("triton::arch::x86::semantics::movq_s(): Invalid operation.");
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVQ operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVQ operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5547,16 +5624,16 @@ namespace triton {
           auto& dst = inst.operands[0];
           auto& src = inst.operands[1];
 
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::zx(QWORD_SIZE_BIT, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVQ2DQ operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVQ2DQ operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5571,10 +5648,10 @@ namespace triton {
           auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
-          auto op2 = triton::api.buildSymbolicOperand(inst, index1);
-          auto op3 = triton::api.buildSymbolicOperand(inst, index2);
-          auto op4 = triton::api.buildSymbolicOperand(inst, df);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, index1);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, index2);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, df);
 
           /* Create the semantics */
           auto node1 = op1;
@@ -5590,14 +5667,14 @@ namespace triton {
                        );
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicExpression(inst, node1, dst, "MOVSB operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, index1, "Index (DI) operation");
-          auto expr3 = triton::api.createSymbolicExpression(inst, node3, index2, "Index (SI) operation");
+          auto expr1 = triton::getContext().createSymbolicExpression(inst, node1, dst, "MOVSB operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, index1, "Index (DI) operation");
+          auto expr3 = triton::getContext().createSymbolicExpression(inst, node3, index2, "Index (SI) operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.taintAssignment(dst, src);
-          expr2->isTainted = triton::api.taintUnion(index1, index1);
-          expr3->isTainted = triton::api.taintUnion(index2, index2);
+          expr1->isTainted = triton::getContext().taintAssignment(dst, src);
+          expr2->isTainted = triton::getContext().taintUnion(index1, index1);
+          expr3->isTainted = triton::getContext().taintUnion(index2, index2);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5612,10 +5689,10 @@ namespace triton {
           auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
-          auto op2 = triton::api.buildSymbolicOperand(inst, index1);
-          auto op3 = triton::api.buildSymbolicOperand(inst, index2);
-          auto op4 = triton::api.buildSymbolicOperand(inst, df);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, index1);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, index2);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, df);
 
           /* Create the semantics */
           auto node1 = op1;
@@ -5631,14 +5708,14 @@ namespace triton {
                        );
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicExpression(inst, node1, dst, "MOVSD operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, index1, "Index (DI) operation");
-          auto expr3 = triton::api.createSymbolicExpression(inst, node3, index2, "Index (SI) operation");
+          auto expr1 = triton::getContext().createSymbolicExpression(inst, node1, dst, "MOVSD operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, index1, "Index (DI) operation");
+          auto expr3 = triton::getContext().createSymbolicExpression(inst, node3, index2, "Index (SI) operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.taintAssignment(dst, src);
-          expr2->isTainted = triton::api.taintUnion(index1, index1);
-          expr3->isTainted = triton::api.taintUnion(index2, index2);
+          expr1->isTainted = triton::getContext().taintAssignment(dst, src);
+          expr2->isTainted = triton::getContext().taintUnion(index1, index1);
+          expr3->isTainted = triton::getContext().taintUnion(index2, index2);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5650,13 +5727,13 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create the semantics */
-          auto node = triton::api.buildSymbolicOperand(inst, src);
+          auto node = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVUPD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVUPD operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5668,13 +5745,13 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create the semantics */
-          auto node = triton::api.buildSymbolicOperand(inst, src);
+          auto node = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVUPS operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVUPS operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5689,10 +5766,10 @@ namespace triton {
           auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
-          auto op2 = triton::api.buildSymbolicOperand(inst, index1);
-          auto op3 = triton::api.buildSymbolicOperand(inst, index2);
-          auto op4 = triton::api.buildSymbolicOperand(inst, df);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, index1);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, index2);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, df);
 
           /* Create the semantics */
           auto node1 = op1;
@@ -5708,14 +5785,14 @@ namespace triton {
                        );
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicExpression(inst, node1, dst, "MOVSQ operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, index1, "Index (DI) operation");
-          auto expr3 = triton::api.createSymbolicExpression(inst, node3, index2, "Index (SI) operation");
+          auto expr1 = triton::getContext().createSymbolicExpression(inst, node1, dst, "MOVSQ operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, index1, "Index (DI) operation");
+          auto expr3 = triton::getContext().createSymbolicExpression(inst, node3, index2, "Index (SI) operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.taintAssignment(dst, src);
-          expr2->isTainted = triton::api.taintUnion(index1, index1);
-          expr3->isTainted = triton::api.taintUnion(index2, index2);
+          expr1->isTainted = triton::getContext().taintAssignment(dst, src);
+          expr2->isTainted = triton::getContext().taintUnion(index1, index1);
+          expr3->isTainted = triton::getContext().taintUnion(index2, index2);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5730,10 +5807,10 @@ namespace triton {
           auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
-          auto op2 = triton::api.buildSymbolicOperand(inst, index1);
-          auto op3 = triton::api.buildSymbolicOperand(inst, index2);
-          auto op4 = triton::api.buildSymbolicOperand(inst, df);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, index1);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, index2);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, df);
 
           /* Create the semantics */
           auto node1 = op1;
@@ -5749,14 +5826,14 @@ namespace triton {
                        );
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicExpression(inst, node1, dst, "MOVSW operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, index1, "Index (DI) operation");
-          auto expr3 = triton::api.createSymbolicExpression(inst, node3, index2, "Index (SI) operation");
+          auto expr1 = triton::getContext().createSymbolicExpression(inst, node1, dst, "MOVSW operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, index1, "Index (DI) operation");
+          auto expr3 = triton::getContext().createSymbolicExpression(inst, node3, index2, "Index (SI) operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.taintAssignment(dst, src);
-          expr2->isTainted = triton::api.taintUnion(index1, index1);
-          expr3->isTainted = triton::api.taintUnion(index2, index2);
+          expr1->isTainted = triton::getContext().taintAssignment(dst, src);
+          expr2->isTainted = triton::getContext().taintUnion(index1, index1);
+          expr3->isTainted = triton::getContext().taintUnion(index2, index2);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5768,16 +5845,16 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::sx(dst.getBitSize() - src.getBitSize(), op1);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVSX operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVSX operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5789,16 +5866,16 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::sx(dst.getBitSize() - src.getBitSize(), op1);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVSXD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVSXD operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5810,16 +5887,16 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::zx(dst.getBitSize() - src.getBitSize(), op1);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MOVZX operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MOVZX operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5836,14 +5913,14 @@ namespace triton {
               auto dst  = triton::arch::OperandWrapper(TRITON_X86_REG_AX);
               auto src1 = triton::arch::OperandWrapper(TRITON_X86_REG_AL);
               /* Create symbolic operands */
-              auto op1 = triton::api.buildSymbolicOperand(inst, src1);
-              auto op2 = triton::api.buildSymbolicOperand(inst, src2);
+              auto op1 = triton::getContext().buildSymbolicOperand(inst, src1);
+              auto op2 = triton::getContext().buildSymbolicOperand(inst, src2);
               /* Create the semantics */
               auto node = triton::ast::bvmul(triton::ast::zx(BYTE_SIZE_BIT, op1), triton::ast::zx(BYTE_SIZE_BIT, op2));
               /* Create symbolic expression */
-              auto expr = triton::api.createSymbolicExpression(inst, node, dst, "MUL operation");
+              auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "MUL operation");
               /* Apply the taint */
-              expr->isTainted = triton::api.taintUnion(dst, src2);
+              expr->isTainted = triton::getContext().taintUnion(dst, src2);
               /* Upate symbolic flags */
               auto ah = triton::ast::extract((WORD_SIZE_BIT - 1), BYTE_SIZE_BIT, node);
               triton::arch::x86::semantics::cfMul_s(inst, expr, src2, ah);
@@ -5857,21 +5934,21 @@ namespace triton {
               auto dst2 = triton::arch::OperandWrapper(TRITON_X86_REG_DX);
               auto src1 = triton::arch::OperandWrapper(TRITON_X86_REG_AX);
               /* Create symbolic operands */
-              auto op1 = triton::api.buildSymbolicOperand(inst, src1);
-              auto op2 = triton::api.buildSymbolicOperand(inst, src2);
+              auto op1 = triton::getContext().buildSymbolicOperand(inst, src1);
+              auto op2 = triton::getContext().buildSymbolicOperand(inst, src2);
               /* Create the semantics */
               auto node = triton::ast::bvmul(triton::ast::zx(WORD_SIZE_BIT, op1), triton::ast::zx(WORD_SIZE_BIT, op2));
               /* Create symbolic expression for ax */
               auto ax = triton::ast::extract((WORD_SIZE_BIT - 1), 0, node);
-              auto expr1 = triton::api.createSymbolicExpression(inst, ax, dst1, "MUL operation");
+              auto expr1 = triton::getContext().createSymbolicExpression(inst, ax, dst1, "MUL operation");
               /* Apply the taint */
-              expr1->isTainted = triton::api.taintUnion(dst1, src2);
+              expr1->isTainted = triton::getContext().taintUnion(dst1, src2);
               /* Create symbolic expression for dx */
               auto dx = triton::ast::extract((DWORD_SIZE_BIT - 1), WORD_SIZE_BIT, node);
-              auto expr2 = triton::api.createSymbolicExpression(inst, dx, dst2, "MUL operation");
+              auto expr2 = triton::getContext().createSymbolicExpression(inst, dx, dst2, "MUL operation");
               /* Apply the taint */
-              expr2->isTainted = triton::api.taintUnion(dst2, src2);
-              expr2->isTainted = triton::api.taintUnion(dst2, src1);
+              expr2->isTainted = triton::getContext().taintUnion(dst2, src2);
+              expr2->isTainted = triton::getContext().taintUnion(dst2, src1);
               /* Upate symbolic flags */
               triton::arch::x86::semantics::cfMul_s(inst, expr2, src2, dx);
               triton::arch::x86::semantics::ofMul_s(inst, expr2, src2, dx);
@@ -5884,21 +5961,21 @@ namespace triton {
               auto dst2 = triton::arch::OperandWrapper(TRITON_X86_REG_EDX);
               auto src1 = triton::arch::OperandWrapper(TRITON_X86_REG_EAX);
               /* Create symbolic operands */
-              auto op1 = triton::api.buildSymbolicOperand(inst, src1);
-              auto op2 = triton::api.buildSymbolicOperand(inst, src2);
+              auto op1 = triton::getContext().buildSymbolicOperand(inst, src1);
+              auto op2 = triton::getContext().buildSymbolicOperand(inst, src2);
               /* Create the semantics */
               auto node = triton::ast::bvmul(triton::ast::zx(DWORD_SIZE_BIT, op1), triton::ast::zx(DWORD_SIZE_BIT, op2));
               /* Create symbolic expression for eax */
               auto eax = triton::ast::extract((DWORD_SIZE_BIT - 1), 0, node);
-              auto expr1 = triton::api.createSymbolicExpression(inst, eax, dst1, "MUL operation");
+              auto expr1 = triton::getContext().createSymbolicExpression(inst, eax, dst1, "MUL operation");
               /* Apply the taint */
-              expr1->isTainted = triton::api.taintUnion(dst1, src2);
+              expr1->isTainted = triton::getContext().taintUnion(dst1, src2);
               /* Create symbolic expression for edx */
               auto edx = triton::ast::extract((QWORD_SIZE_BIT - 1), DWORD_SIZE_BIT, node);
-              auto expr2 = triton::api.createSymbolicExpression(inst, edx, dst2, "MUL operation");
+              auto expr2 = triton::getContext().createSymbolicExpression(inst, edx, dst2, "MUL operation");
               /* Apply the taint */
-              expr2->isTainted = triton::api.taintUnion(dst2, src2);
-              expr2->isTainted = triton::api.taintUnion(dst2, src1);
+              expr2->isTainted = triton::getContext().taintUnion(dst2, src2);
+              expr2->isTainted = triton::getContext().taintUnion(dst2, src1);
               /* Upate symbolic flags */
               triton::arch::x86::semantics::cfMul_s(inst, expr2, src2, edx);
               triton::arch::x86::semantics::ofMul_s(inst, expr2, src2, edx);
@@ -5911,21 +5988,21 @@ namespace triton {
               auto dst2 = triton::arch::OperandWrapper(TRITON_X86_REG_RDX);
               auto src1 = triton::arch::OperandWrapper(TRITON_X86_REG_RAX);
               /* Create symbolic operands */
-              auto op1 = triton::api.buildSymbolicOperand(inst, src1);
-              auto op2 = triton::api.buildSymbolicOperand(inst, src2);
+              auto op1 = triton::getContext().buildSymbolicOperand(inst, src1);
+              auto op2 = triton::getContext().buildSymbolicOperand(inst, src2);
               /* Create the semantics */
               auto node = triton::ast::bvmul(triton::ast::zx(QWORD_SIZE_BIT, op1), triton::ast::zx(QWORD_SIZE_BIT, op2));
               /* Create symbolic expression for eax */
               auto rax = triton::ast::extract((QWORD_SIZE_BIT - 1), 0, node);
-              auto expr1 = triton::api.createSymbolicExpression(inst, rax, dst1, "MUL operation");
+              auto expr1 = triton::getContext().createSymbolicExpression(inst, rax, dst1, "MUL operation");
               /* Apply the taint */
-              expr1->isTainted = triton::api.taintUnion(dst1, src2);
+              expr1->isTainted = triton::getContext().taintUnion(dst1, src2);
               /* Create symbolic expression for rdx */
               auto rdx = triton::ast::extract((DQWORD_SIZE_BIT - 1), QWORD_SIZE_BIT, node);
-              auto expr2 = triton::api.createSymbolicExpression(inst, rdx, dst2, "MUL operation");
+              auto expr2 = triton::getContext().createSymbolicExpression(inst, rdx, dst2, "MUL operation");
               /* Apply the taint */
-              expr2->isTainted = triton::api.taintUnion(dst2, src2);
-              expr2->isTainted = triton::api.taintUnion(dst2, src1);
+              expr2->isTainted = triton::getContext().taintUnion(dst2, src2);
+              expr2->isTainted = triton::getContext().taintUnion(dst2, src1);
               /* Upate symbolic flags */
               triton::arch::x86::semantics::cfMul_s(inst, expr2, src2, rdx);
               triton::arch::x86::semantics::ofMul_s(inst, expr2, src2, rdx);
@@ -5943,16 +6020,16 @@ namespace triton {
           auto& src = inst.operands[0];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::bvneg(op1);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, src, "NEG operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, src, "NEG operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintUnion(src, src);
+          expr->isTainted = triton::getContext().taintUnion(src, src);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::afNeg_s(inst, expr, src, op1);
@@ -5977,16 +6054,16 @@ namespace triton {
           auto& src = inst.operands[0];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::bvnot(op1);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, src, "NOT operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, src, "NOT operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintUnion(src, src);
+          expr->isTainted = triton::getContext().taintUnion(src, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -5998,17 +6075,17 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::bvor(op1, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "OR operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "OR operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::clearFlag_s(inst, TRITON_X86_REG_CF, "Clears carry flag");
@@ -6027,17 +6104,17 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::bvor(op1, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "ORPD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "ORPD operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -6049,17 +6126,17 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::bvor(op1, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "ORPS operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "ORPS operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -6071,8 +6148,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> packed;
@@ -6110,10 +6187,10 @@ namespace triton {
           auto node = triton::ast::concat(packed);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PADDB operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PADDB operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -6125,8 +6202,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> packed;
@@ -6152,10 +6229,10 @@ namespace triton {
           auto node = triton::ast::concat(packed);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PADDD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PADDD operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -6167,8 +6244,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> packed;
@@ -6192,10 +6269,10 @@ namespace triton {
           auto node = triton::ast::concat(packed);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PADDQ operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PADDQ operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -6207,8 +6284,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> packed;
@@ -6238,10 +6315,10 @@ namespace triton {
           auto node = triton::ast::concat(packed);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PADDW operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PADDW operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -6253,17 +6330,17 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::bvand(op1, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PAND operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PAND operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -6275,17 +6352,17 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::bvand(triton::ast::bvnot(op1), op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PANDN operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PANDN operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -6297,8 +6374,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> pck;
@@ -6325,10 +6402,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PAVGB operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PAVGB operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -6340,8 +6417,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> pck;
@@ -6368,10 +6445,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PAVGW operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PAVGW operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -6383,8 +6460,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -6403,10 +6480,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PCMPEQB operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PCMPEQB operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -6418,8 +6495,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -6438,10 +6515,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PCMPEQD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PCMPEQD operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -6453,8 +6530,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -6473,10 +6550,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PCMPEQW operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PCMPEQW operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -6488,8 +6565,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -6508,10 +6585,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PCMPGTB operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PCMPGTB operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -6523,8 +6600,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -6543,10 +6620,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PCMPGTD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PCMPGTD operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -6558,8 +6635,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -6578,10 +6655,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PCMPGTW operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PCMPGTW operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -6593,8 +6670,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -6613,10 +6690,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PMAXSB operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PMAXSB operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -6628,8 +6705,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -6648,10 +6725,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PMAXSD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PMAXSD operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -6663,8 +6740,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -6683,10 +6760,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PMAXSW operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PMAXSW operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -6698,8 +6775,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -6718,10 +6795,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PMAXUB operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PMAXUB operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -6733,8 +6810,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -6753,10 +6830,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PMAXUD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PMAXUD operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -6768,8 +6845,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -6788,10 +6865,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PMAXUW operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PMAXUW operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -6803,8 +6880,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -6823,10 +6900,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PMINSB operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PMINSB operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -6838,8 +6915,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -6858,10 +6935,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PMINSD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PMINSD operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -6873,8 +6950,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -6893,10 +6970,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PMINSW operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PMINSW operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -6908,8 +6985,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -6928,10 +7005,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PMINUB operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PMINUB operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -6943,8 +7020,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -6963,10 +7040,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PMINUD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PMINUD operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -6978,8 +7055,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -6998,10 +7075,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PMINUW operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PMINUW operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -7013,7 +7090,7 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> mskb;
@@ -7046,10 +7123,10 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PMOVMSKB operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PMOVMSKB operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -7061,7 +7138,7 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -7074,10 +7151,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PMOVSXBD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PMOVSXBD operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -7089,7 +7166,7 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -7100,10 +7177,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PMOVSXBQ operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PMOVSXBQ operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -7115,7 +7192,7 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -7132,10 +7209,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PMOVSXBW operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PMOVSXBW operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -7147,7 +7224,7 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -7158,10 +7235,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PMOVSXDQ operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PMOVSXDQ operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -7173,7 +7250,7 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -7186,10 +7263,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PMOVSXWD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PMOVSXWD operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -7201,7 +7278,7 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -7212,10 +7289,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PMOVSXWQ operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PMOVSXWQ operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -7227,7 +7304,7 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -7240,10 +7317,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PMOVZXBD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PMOVZXBD operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -7255,7 +7332,7 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -7266,10 +7343,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PMOVZXBQ operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PMOVZXBQ operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -7281,7 +7358,7 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -7298,10 +7375,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PMOVZXBW operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PMOVZXBW operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -7313,7 +7390,7 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -7324,10 +7401,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PMOVZXDQ operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PMOVZXDQ operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -7339,7 +7416,7 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -7352,10 +7429,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PMOVZXWD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PMOVZXWD operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -7367,7 +7444,7 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode *> pck;
@@ -7378,10 +7455,10 @@ namespace triton {
           auto node = triton::ast::concat(pck);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PMOVZXWQ operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PMOVZXWQ operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -7390,21 +7467,21 @@ namespace triton {
 
         void pop_s(triton::arch::Instruction& inst) {
           auto  stack      = TRITON_X86_REG_SP.getParent();
-          auto  stackValue = triton::api.getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+          auto  stackValue = triton::getContext().getConcreteRegisterValue(stack).convert_to<triton::uint64>();
           auto& dst        = inst.operands[0];
           auto  src        = triton::arch::OperandWrapper(inst.popMemoryAccess(stackValue, stack.getSize()));
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = op1;
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "POP operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "POP operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Create the semantics - side effect */
           alignAddStack_s(inst, src.getSize());
@@ -7416,7 +7493,7 @@ namespace triton {
 
         void popal_s(triton::arch::Instruction& inst) {
           auto stack      = TRITON_X86_REG_SP.getParent();
-          auto stackValue = triton::api.getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+          auto stackValue = triton::getContext().getConcreteRegisterValue(stack).convert_to<triton::uint64>();
           auto dst1       = triton::arch::OperandWrapper(TRITON_X86_REG_EDI);
           auto dst2       = triton::arch::OperandWrapper(TRITON_X86_REG_ESI);
           auto dst3       = triton::arch::OperandWrapper(TRITON_X86_REG_EBP);
@@ -7435,34 +7512,34 @@ namespace triton {
           auto src8       = triton::arch::OperandWrapper(inst.popMemoryAccess(stackValue+(stack.getSize() * 7), stack.getSize()));
 
           /* Create symbolic operands and semantics */
-          auto node1 = triton::api.buildSymbolicOperand(inst, src1);
-          auto node2 = triton::api.buildSymbolicOperand(inst, src2);
-          auto node3 = triton::api.buildSymbolicOperand(inst, src3);
-          auto node4 = triton::api.buildSymbolicOperand(inst, src4);
-          auto node5 = triton::api.buildSymbolicOperand(inst, src5);
-          auto node6 = triton::api.buildSymbolicOperand(inst, src6);
-          auto node7 = triton::api.buildSymbolicOperand(inst, src7);
-          auto node8 = triton::api.buildSymbolicOperand(inst, src8);
+          auto node1 = triton::getContext().buildSymbolicOperand(inst, src1);
+          auto node2 = triton::getContext().buildSymbolicOperand(inst, src2);
+          auto node3 = triton::getContext().buildSymbolicOperand(inst, src3);
+          auto node4 = triton::getContext().buildSymbolicOperand(inst, src4);
+          auto node5 = triton::getContext().buildSymbolicOperand(inst, src5);
+          auto node6 = triton::getContext().buildSymbolicOperand(inst, src6);
+          auto node7 = triton::getContext().buildSymbolicOperand(inst, src7);
+          auto node8 = triton::getContext().buildSymbolicOperand(inst, src8);
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicExpression(inst, node1, dst1, "POPAL EDI operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, dst2, "POPAL ESI operation");
-          auto expr3 = triton::api.createSymbolicExpression(inst, node3, dst3, "POPAL EBP operation");
-          auto expr4 = triton::api.createSymbolicExpression(inst, node4, dst4, "POPAL ESP operation");
-          auto expr5 = triton::api.createSymbolicExpression(inst, node5, dst5, "POPAL EBX operation");
-          auto expr6 = triton::api.createSymbolicExpression(inst, node6, dst6, "POPAL EDX operation");
-          auto expr7 = triton::api.createSymbolicExpression(inst, node7, dst7, "POPAL ECX operation");
-          auto expr8 = triton::api.createSymbolicExpression(inst, node8, dst8, "POPAL EAX operation");
+          auto expr1 = triton::getContext().createSymbolicExpression(inst, node1, dst1, "POPAL EDI operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, dst2, "POPAL ESI operation");
+          auto expr3 = triton::getContext().createSymbolicExpression(inst, node3, dst3, "POPAL EBP operation");
+          auto expr4 = triton::getContext().createSymbolicExpression(inst, node4, dst4, "POPAL ESP operation");
+          auto expr5 = triton::getContext().createSymbolicExpression(inst, node5, dst5, "POPAL EBX operation");
+          auto expr6 = triton::getContext().createSymbolicExpression(inst, node6, dst6, "POPAL EDX operation");
+          auto expr7 = triton::getContext().createSymbolicExpression(inst, node7, dst7, "POPAL ECX operation");
+          auto expr8 = triton::getContext().createSymbolicExpression(inst, node8, dst8, "POPAL EAX operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.taintAssignment(dst1, src1);
-          expr2->isTainted = triton::api.taintAssignment(dst2, src2);
-          expr3->isTainted = triton::api.taintAssignment(dst3, src3);
-          expr4->isTainted = triton::api.taintAssignment(dst4, src4);
-          expr5->isTainted = triton::api.taintAssignment(dst5, src5);
-          expr6->isTainted = triton::api.taintAssignment(dst6, src6);
-          expr7->isTainted = triton::api.taintAssignment(dst7, src7);
-          expr8->isTainted = triton::api.taintAssignment(dst8, src8);
+          expr1->isTainted = triton::getContext().taintAssignment(dst1, src1);
+          expr2->isTainted = triton::getContext().taintAssignment(dst2, src2);
+          expr3->isTainted = triton::getContext().taintAssignment(dst3, src3);
+          expr4->isTainted = triton::getContext().taintAssignment(dst4, src4);
+          expr5->isTainted = triton::getContext().taintAssignment(dst5, src5);
+          expr6->isTainted = triton::getContext().taintAssignment(dst6, src6);
+          expr7->isTainted = triton::getContext().taintAssignment(dst7, src7);
+          expr8->isTainted = triton::getContext().taintAssignment(dst8, src8);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -7471,7 +7548,7 @@ namespace triton {
 
         void popfd_s(triton::arch::Instruction& inst) {
           auto  stack      = TRITON_X86_REG_SP.getParent();
-          auto  stackValue = triton::api.getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+          auto  stackValue = triton::getContext().getConcreteRegisterValue(stack).convert_to<triton::uint64>();
           auto  dst1       = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
           auto  dst2       = triton::arch::OperandWrapper(TRITON_X86_REG_PF);
           auto  dst3       = triton::arch::OperandWrapper(TRITON_X86_REG_AF);
@@ -7484,7 +7561,7 @@ namespace triton {
           auto  src        = triton::arch::OperandWrapper(inst.popMemoryAccess(stackValue, stack.getSize()));
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node1 = triton::ast::extract(0,  0,  op1);
@@ -7498,26 +7575,26 @@ namespace triton {
           auto node9 = triton::ast::extract(11, 11, op1);
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicFlagExpression(inst, node1, dst1.getRegister(), "POPFD CF operation");
-          auto expr2 = triton::api.createSymbolicFlagExpression(inst, node2, dst2.getRegister(), "POPFD PF operation");
-          auto expr3 = triton::api.createSymbolicFlagExpression(inst, node3, dst3.getRegister(), "POPFD AF operation");
-          auto expr4 = triton::api.createSymbolicFlagExpression(inst, node4, dst4.getRegister(), "POPFD ZF operation");
-          auto expr5 = triton::api.createSymbolicFlagExpression(inst, node5, dst5.getRegister(), "POPFD SF operation");
-          auto expr6 = triton::api.createSymbolicFlagExpression(inst, node6, dst6.getRegister(), "POPFD TF operation");
-          auto expr7 = triton::api.createSymbolicFlagExpression(inst, node7, dst7.getRegister(), "POPFD IF operation");
-          auto expr8 = triton::api.createSymbolicFlagExpression(inst, node8, dst8.getRegister(), "POPFD DF operation");
-          auto expr9 = triton::api.createSymbolicFlagExpression(inst, node9, dst9.getRegister(), "POPFD OF operation");
+          auto expr1 = triton::getContext().createSymbolicFlagExpression(inst, node1, dst1.getRegister(), "POPFD CF operation");
+          auto expr2 = triton::getContext().createSymbolicFlagExpression(inst, node2, dst2.getRegister(), "POPFD PF operation");
+          auto expr3 = triton::getContext().createSymbolicFlagExpression(inst, node3, dst3.getRegister(), "POPFD AF operation");
+          auto expr4 = triton::getContext().createSymbolicFlagExpression(inst, node4, dst4.getRegister(), "POPFD ZF operation");
+          auto expr5 = triton::getContext().createSymbolicFlagExpression(inst, node5, dst5.getRegister(), "POPFD SF operation");
+          auto expr6 = triton::getContext().createSymbolicFlagExpression(inst, node6, dst6.getRegister(), "POPFD TF operation");
+          auto expr7 = triton::getContext().createSymbolicFlagExpression(inst, node7, dst7.getRegister(), "POPFD IF operation");
+          auto expr8 = triton::getContext().createSymbolicFlagExpression(inst, node8, dst8.getRegister(), "POPFD DF operation");
+          auto expr9 = triton::getContext().createSymbolicFlagExpression(inst, node9, dst9.getRegister(), "POPFD OF operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.taintAssignment(dst1, src);
-          expr2->isTainted = triton::api.taintAssignment(dst2, src);
-          expr3->isTainted = triton::api.taintAssignment(dst3, src);
-          expr4->isTainted = triton::api.taintAssignment(dst4, src);
-          expr5->isTainted = triton::api.taintAssignment(dst5, src);
-          expr6->isTainted = triton::api.taintAssignment(dst6, src);
-          expr7->isTainted = triton::api.taintAssignment(dst7, src);
-          expr8->isTainted = triton::api.taintAssignment(dst8, src);
-          expr9->isTainted = triton::api.taintAssignment(dst9, src);
+          expr1->isTainted = triton::getContext().taintAssignment(dst1, src);
+          expr2->isTainted = triton::getContext().taintAssignment(dst2, src);
+          expr3->isTainted = triton::getContext().taintAssignment(dst3, src);
+          expr4->isTainted = triton::getContext().taintAssignment(dst4, src);
+          expr5->isTainted = triton::getContext().taintAssignment(dst5, src);
+          expr6->isTainted = triton::getContext().taintAssignment(dst6, src);
+          expr7->isTainted = triton::getContext().taintAssignment(dst7, src);
+          expr8->isTainted = triton::getContext().taintAssignment(dst8, src);
+          expr9->isTainted = triton::getContext().taintAssignment(dst9, src);
 
           /* Create the semantics - side effect */
           alignAddStack_s(inst, src.getSize());
@@ -7529,7 +7606,7 @@ namespace triton {
 
         void popfq_s(triton::arch::Instruction& inst) {
           auto  stack      = TRITON_X86_REG_SP.getParent();
-          auto  stackValue = triton::api.getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+          auto  stackValue = triton::getContext().getConcreteRegisterValue(stack).convert_to<triton::uint64>();
           auto  dst1       = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
           auto  dst2       = triton::arch::OperandWrapper(TRITON_X86_REG_PF);
           auto  dst3       = triton::arch::OperandWrapper(TRITON_X86_REG_AF);
@@ -7542,7 +7619,7 @@ namespace triton {
           auto  src        = triton::arch::OperandWrapper(inst.popMemoryAccess(stackValue, stack.getSize()));
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node1 = triton::ast::extract(0,  0,  op1);
@@ -7556,26 +7633,26 @@ namespace triton {
           auto node9 = triton::ast::extract(11, 11, op1);
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicFlagExpression(inst, node1, dst1.getRegister(), "POPFQ CF operation");
-          auto expr2 = triton::api.createSymbolicFlagExpression(inst, node2, dst2.getRegister(), "POPFQ PF operation");
-          auto expr3 = triton::api.createSymbolicFlagExpression(inst, node3, dst3.getRegister(), "POPFQ AF operation");
-          auto expr4 = triton::api.createSymbolicFlagExpression(inst, node4, dst4.getRegister(), "POPFQ ZF operation");
-          auto expr5 = triton::api.createSymbolicFlagExpression(inst, node5, dst5.getRegister(), "POPFQ SF operation");
-          auto expr6 = triton::api.createSymbolicFlagExpression(inst, node6, dst6.getRegister(), "POPFQ TF operation");
-          auto expr7 = triton::api.createSymbolicFlagExpression(inst, node7, dst7.getRegister(), "POPFQ IF operation");
-          auto expr8 = triton::api.createSymbolicFlagExpression(inst, node8, dst8.getRegister(), "POPFQ DF operation");
-          auto expr9 = triton::api.createSymbolicFlagExpression(inst, node9, dst9.getRegister(), "POPFQ OF operation");
+          auto expr1 = triton::getContext().createSymbolicFlagExpression(inst, node1, dst1.getRegister(), "POPFQ CF operation");
+          auto expr2 = triton::getContext().createSymbolicFlagExpression(inst, node2, dst2.getRegister(), "POPFQ PF operation");
+          auto expr3 = triton::getContext().createSymbolicFlagExpression(inst, node3, dst3.getRegister(), "POPFQ AF operation");
+          auto expr4 = triton::getContext().createSymbolicFlagExpression(inst, node4, dst4.getRegister(), "POPFQ ZF operation");
+          auto expr5 = triton::getContext().createSymbolicFlagExpression(inst, node5, dst5.getRegister(), "POPFQ SF operation");
+          auto expr6 = triton::getContext().createSymbolicFlagExpression(inst, node6, dst6.getRegister(), "POPFQ TF operation");
+          auto expr7 = triton::getContext().createSymbolicFlagExpression(inst, node7, dst7.getRegister(), "POPFQ IF operation");
+          auto expr8 = triton::getContext().createSymbolicFlagExpression(inst, node8, dst8.getRegister(), "POPFQ DF operation");
+          auto expr9 = triton::getContext().createSymbolicFlagExpression(inst, node9, dst9.getRegister(), "POPFQ OF operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.taintAssignment(dst1, src);
-          expr2->isTainted = triton::api.taintAssignment(dst2, src);
-          expr3->isTainted = triton::api.taintAssignment(dst3, src);
-          expr4->isTainted = triton::api.taintAssignment(dst4, src);
-          expr5->isTainted = triton::api.taintAssignment(dst5, src);
-          expr6->isTainted = triton::api.taintAssignment(dst6, src);
-          expr7->isTainted = triton::api.taintAssignment(dst7, src);
-          expr8->isTainted = triton::api.taintAssignment(dst8, src);
-          expr9->isTainted = triton::api.taintAssignment(dst9, src);
+          expr1->isTainted = triton::getContext().taintAssignment(dst1, src);
+          expr2->isTainted = triton::getContext().taintAssignment(dst2, src);
+          expr3->isTainted = triton::getContext().taintAssignment(dst3, src);
+          expr4->isTainted = triton::getContext().taintAssignment(dst4, src);
+          expr5->isTainted = triton::getContext().taintAssignment(dst5, src);
+          expr6->isTainted = triton::getContext().taintAssignment(dst6, src);
+          expr7->isTainted = triton::getContext().taintAssignment(dst7, src);
+          expr8->isTainted = triton::getContext().taintAssignment(dst8, src);
+          expr9->isTainted = triton::getContext().taintAssignment(dst9, src);
 
           /* Create the semantics - side effect */
           alignAddStack_s(inst, src.getSize());
@@ -7590,17 +7667,17 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::bvor(op1, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "POR operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "POR operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -7611,7 +7688,7 @@ namespace triton {
           auto& src = inst.operands[0];
 
           /* Only specify that the instruction performs an implicit memory read */
-          triton::api.buildSymbolicOperand(inst, src);
+          triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -7624,8 +7701,8 @@ namespace triton {
           auto& ord = inst.operands[2];
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, ord);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, ord);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> pack;
@@ -7677,10 +7754,10 @@ namespace triton {
           auto node = triton::ast::concat(pack);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PSHUFD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PSHUFD operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -7693,8 +7770,8 @@ namespace triton {
           auto& ord = inst.operands[2];
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, ord);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, ord);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> pack;
@@ -7749,10 +7826,10 @@ namespace triton {
           auto node = triton::ast::concat(pack);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PSHUFHW operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PSHUFHW operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -7765,8 +7842,8 @@ namespace triton {
           auto& ord = inst.operands[2];
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, ord);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, ord);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> pack;
@@ -7821,10 +7898,10 @@ namespace triton {
           auto node = triton::ast::concat(pack);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PSHUFLW operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PSHUFLW operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -7837,8 +7914,8 @@ namespace triton {
           auto& ord = inst.operands[2];
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, ord);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, ord);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> pack;
@@ -7890,10 +7967,10 @@ namespace triton {
           auto node = triton::ast::concat(pack);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PSHUFW operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PSHUFW operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -7905,8 +7982,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::ast::zx(dst.getBitSize() - src.getBitSize(), triton::api.buildSymbolicOperand(inst, src));
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::ast::zx(dst.getBitSize() - src.getBitSize(), triton::getContext().buildSymbolicOperand(inst, src));
 
           /* Create the semantics */
           auto node = triton::ast::bvshl(
@@ -7922,10 +7999,10 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PSLLDQ operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PSLLDQ operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -7937,8 +8014,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::ast::zx(dst.getBitSize() - src.getBitSize(), triton::api.buildSymbolicOperand(inst, src));
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::ast::zx(dst.getBitSize() - src.getBitSize(), triton::getContext().buildSymbolicOperand(inst, src));
 
           /* Create the semantics */
           auto node = triton::ast::bvlshr(
@@ -7954,10 +8031,10 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PSRLDQ operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PSRLDQ operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -7969,8 +8046,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> packed;
@@ -8008,10 +8085,10 @@ namespace triton {
           auto node = triton::ast::concat(packed);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PSUBB operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PSUBB operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -8023,8 +8100,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> packed;
@@ -8050,10 +8127,10 @@ namespace triton {
           auto node = triton::ast::concat(packed);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PSUBD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PSUBD operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -8065,8 +8142,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> packed;
@@ -8090,10 +8167,10 @@ namespace triton {
           auto node = triton::ast::concat(packed);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PSUBQ operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PSUBQ operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -8105,8 +8182,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> packed;
@@ -8136,10 +8213,10 @@ namespace triton {
           auto node = triton::ast::concat(packed);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PSUBW operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PSUBW operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -8151,20 +8228,20 @@ namespace triton {
           auto& src2 = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src1);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src2);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src1);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src2);
 
           /* Create the semantics */
           auto node1 = triton::ast::bvand(op1, op2);
           auto node2 = triton::ast::bvand(op1, triton::ast::bvnot(op2));
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicVolatileExpression(inst, node1, "PTEST operation");
-          auto expr2 = triton::api.createSymbolicVolatileExpression(inst, node2, "PTEST operation");
+          auto expr1 = triton::getContext().createSymbolicVolatileExpression(inst, node1, "PTEST operation");
+          auto expr2 = triton::getContext().createSymbolicVolatileExpression(inst, node2, "PTEST operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.isTainted(src1) | triton::api.isTainted(src2);
-          expr2->isTainted = triton::api.isTainted(src1) | triton::api.isTainted(src2);
+          expr1->isTainted = triton::getContext().isTainted(src1) | triton::getContext().isTainted(src2);
+          expr2->isTainted = triton::getContext().isTainted(src1) | triton::getContext().isTainted(src2);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::clearFlag_s(inst, TRITON_X86_REG_AF, "Clears adjust flag");
@@ -8184,8 +8261,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> unpack;
@@ -8231,10 +8308,10 @@ namespace triton {
           auto node = triton::ast::concat(unpack);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PUNPCKHBW operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PUNPCKHBW operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -8246,8 +8323,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> unpack;
@@ -8275,10 +8352,10 @@ namespace triton {
           auto node = triton::ast::concat(unpack);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PUNPCKHDQ operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PUNPCKHDQ operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -8290,8 +8367,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> unpack;
@@ -8311,10 +8388,10 @@ namespace triton {
           auto node = triton::ast::concat(unpack);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PUNPCKHQDQ operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PUNPCKHQDQ operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -8326,8 +8403,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> unpack;
@@ -8361,10 +8438,10 @@ namespace triton {
           auto node = triton::ast::concat(unpack);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PUNPCKHWD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PUNPCKHWD operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -8376,8 +8453,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> unpack;
@@ -8423,10 +8500,10 @@ namespace triton {
           auto node = triton::ast::concat(unpack);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PUNPCKLBW operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PUNPCKLBW operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -8438,8 +8515,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> unpack;
@@ -8467,10 +8544,10 @@ namespace triton {
           auto node = triton::ast::concat(unpack);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PUNPCKLDQ operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PUNPCKLDQ operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -8482,8 +8559,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> unpack;
@@ -8503,10 +8580,10 @@ namespace triton {
           auto node = triton::ast::concat(unpack);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PUNPCKLQDQ operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PUNPCKLQDQ operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -8518,8 +8595,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> unpack;
@@ -8553,10 +8630,10 @@ namespace triton {
           auto node = triton::ast::concat(unpack);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PUNPCKLWD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PUNPCKLWD operation");
 
           /* Apply the taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -8572,16 +8649,16 @@ namespace triton {
           auto& src        = inst.operands[0];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::zx(dst.getBitSize() - src.getBitSize(), op1);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PUSH operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PUSH operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -8590,7 +8667,7 @@ namespace triton {
 
         void pushal_s(triton::arch::Instruction& inst) {
           auto stack      = TRITON_X86_REG_SP.getParent();
-          auto stackValue = triton::api.getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+          auto stackValue = triton::getContext().getConcreteRegisterValue(stack).convert_to<triton::uint64>();
           auto dst1       = triton::arch::OperandWrapper(inst.popMemoryAccess(stackValue-(stack.getSize() * 1), stack.getSize()));
           auto dst2       = triton::arch::OperandWrapper(inst.popMemoryAccess(stackValue-(stack.getSize() * 2), stack.getSize()));
           auto dst3       = triton::arch::OperandWrapper(inst.popMemoryAccess(stackValue-(stack.getSize() * 3), stack.getSize()));
@@ -8609,14 +8686,14 @@ namespace triton {
           auto src8       = triton::arch::OperandWrapper(TRITON_X86_REG_EDI);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src1);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src2);
-          auto op3 = triton::api.buildSymbolicOperand(inst, src3);
-          auto op4 = triton::api.buildSymbolicOperand(inst, src4);
-          auto op5 = triton::api.buildSymbolicOperand(inst, src5);
-          auto op6 = triton::api.buildSymbolicOperand(inst, src6);
-          auto op7 = triton::api.buildSymbolicOperand(inst, src7);
-          auto op8 = triton::api.buildSymbolicOperand(inst, src8);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src1);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src2);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, src3);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, src4);
+          auto op5 = triton::getContext().buildSymbolicOperand(inst, src5);
+          auto op6 = triton::getContext().buildSymbolicOperand(inst, src6);
+          auto op7 = triton::getContext().buildSymbolicOperand(inst, src7);
+          auto op8 = triton::getContext().buildSymbolicOperand(inst, src8);
 
           /* Create the semantics */
           auto node1 = triton::ast::zx(dst1.getBitSize() - src1.getBitSize(), op1);
@@ -8630,24 +8707,24 @@ namespace triton {
 
           /* Create symbolic expression */
           alignSubStack_s(inst, 32);
-          auto expr1 = triton::api.createSymbolicExpression(inst, node1, dst1, "PUSHAL EAX operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, dst2, "PUSHAL ECX operation");
-          auto expr3 = triton::api.createSymbolicExpression(inst, node3, dst3, "PUSHAL EDX operation");
-          auto expr4 = triton::api.createSymbolicExpression(inst, node4, dst4, "PUSHAL EBX operation");
-          auto expr5 = triton::api.createSymbolicExpression(inst, node5, dst5, "PUSHAL ESP operation");
-          auto expr6 = triton::api.createSymbolicExpression(inst, node6, dst6, "PUSHAL EBP operation");
-          auto expr7 = triton::api.createSymbolicExpression(inst, node7, dst7, "PUSHAL ESI operation");
-          auto expr8 = triton::api.createSymbolicExpression(inst, node8, dst8, "PUSHAL EDI operation");
+          auto expr1 = triton::getContext().createSymbolicExpression(inst, node1, dst1, "PUSHAL EAX operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, dst2, "PUSHAL ECX operation");
+          auto expr3 = triton::getContext().createSymbolicExpression(inst, node3, dst3, "PUSHAL EDX operation");
+          auto expr4 = triton::getContext().createSymbolicExpression(inst, node4, dst4, "PUSHAL EBX operation");
+          auto expr5 = triton::getContext().createSymbolicExpression(inst, node5, dst5, "PUSHAL ESP operation");
+          auto expr6 = triton::getContext().createSymbolicExpression(inst, node6, dst6, "PUSHAL EBP operation");
+          auto expr7 = triton::getContext().createSymbolicExpression(inst, node7, dst7, "PUSHAL ESI operation");
+          auto expr8 = triton::getContext().createSymbolicExpression(inst, node8, dst8, "PUSHAL EDI operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.taintAssignment(dst1, src1);
-          expr2->isTainted = triton::api.taintAssignment(dst2, src2);
-          expr3->isTainted = triton::api.taintAssignment(dst3, src3);
-          expr4->isTainted = triton::api.taintAssignment(dst4, src4);
-          expr5->isTainted = triton::api.taintAssignment(dst5, src5);
-          expr6->isTainted = triton::api.taintAssignment(dst6, src6);
-          expr7->isTainted = triton::api.taintAssignment(dst7, src7);
-          expr8->isTainted = triton::api.taintAssignment(dst8, src8);
+          expr1->isTainted = triton::getContext().taintAssignment(dst1, src1);
+          expr2->isTainted = triton::getContext().taintAssignment(dst2, src2);
+          expr3->isTainted = triton::getContext().taintAssignment(dst3, src3);
+          expr4->isTainted = triton::getContext().taintAssignment(dst4, src4);
+          expr5->isTainted = triton::getContext().taintAssignment(dst5, src5);
+          expr6->isTainted = triton::getContext().taintAssignment(dst6, src6);
+          expr7->isTainted = triton::getContext().taintAssignment(dst7, src7);
+          expr8->isTainted = triton::getContext().taintAssignment(dst8, src8);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -8671,15 +8748,15 @@ namespace triton {
           auto src9       = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src1);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src2);
-          auto op3 = triton::api.buildSymbolicOperand(inst, src3);
-          auto op4 = triton::api.buildSymbolicOperand(inst, src4);
-          auto op5 = triton::api.buildSymbolicOperand(inst, src5);
-          auto op6 = triton::api.buildSymbolicOperand(inst, src6);
-          auto op7 = triton::api.buildSymbolicOperand(inst, src7);
-          auto op8 = triton::api.buildSymbolicOperand(inst, src8);
-          auto op9 = triton::api.buildSymbolicOperand(inst, src9);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src1);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src2);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, src3);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, src4);
+          auto op5 = triton::getContext().buildSymbolicOperand(inst, src5);
+          auto op6 = triton::getContext().buildSymbolicOperand(inst, src6);
+          auto op7 = triton::getContext().buildSymbolicOperand(inst, src7);
+          auto op8 = triton::getContext().buildSymbolicOperand(inst, src8);
+          auto op9 = triton::getContext().buildSymbolicOperand(inst, src9);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> eflags;
@@ -8702,18 +8779,18 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PUSHFD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PUSHFD operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src1);
-          expr->isTainted = triton::api.taintUnion(dst, src2);
-          expr->isTainted = triton::api.taintUnion(dst, src3);
-          expr->isTainted = triton::api.taintUnion(dst, src4);
-          expr->isTainted = triton::api.taintUnion(dst, src5);
-          expr->isTainted = triton::api.taintUnion(dst, src6);
-          expr->isTainted = triton::api.taintUnion(dst, src7);
-          expr->isTainted = triton::api.taintUnion(dst, src8);
-          expr->isTainted = triton::api.taintUnion(dst, src9);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src1);
+          expr->isTainted = triton::getContext().taintUnion(dst, src2);
+          expr->isTainted = triton::getContext().taintUnion(dst, src3);
+          expr->isTainted = triton::getContext().taintUnion(dst, src4);
+          expr->isTainted = triton::getContext().taintUnion(dst, src5);
+          expr->isTainted = triton::getContext().taintUnion(dst, src6);
+          expr->isTainted = triton::getContext().taintUnion(dst, src7);
+          expr->isTainted = triton::getContext().taintUnion(dst, src8);
+          expr->isTainted = triton::getContext().taintUnion(dst, src9);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -8737,15 +8814,15 @@ namespace triton {
           auto src9       = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src1);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src2);
-          auto op3 = triton::api.buildSymbolicOperand(inst, src3);
-          auto op4 = triton::api.buildSymbolicOperand(inst, src4);
-          auto op5 = triton::api.buildSymbolicOperand(inst, src5);
-          auto op6 = triton::api.buildSymbolicOperand(inst, src6);
-          auto op7 = triton::api.buildSymbolicOperand(inst, src7);
-          auto op8 = triton::api.buildSymbolicOperand(inst, src8);
-          auto op9 = triton::api.buildSymbolicOperand(inst, src9);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src1);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src2);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, src3);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, src4);
+          auto op5 = triton::getContext().buildSymbolicOperand(inst, src5);
+          auto op6 = triton::getContext().buildSymbolicOperand(inst, src6);
+          auto op7 = triton::getContext().buildSymbolicOperand(inst, src7);
+          auto op8 = triton::getContext().buildSymbolicOperand(inst, src8);
+          auto op9 = triton::getContext().buildSymbolicOperand(inst, src9);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> eflags;
@@ -8768,18 +8845,18 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PUSHFQ operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PUSHFQ operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src1);
-          expr->isTainted = triton::api.taintUnion(dst, src2);
-          expr->isTainted = triton::api.taintUnion(dst, src3);
-          expr->isTainted = triton::api.taintUnion(dst, src4);
-          expr->isTainted = triton::api.taintUnion(dst, src5);
-          expr->isTainted = triton::api.taintUnion(dst, src6);
-          expr->isTainted = triton::api.taintUnion(dst, src7);
-          expr->isTainted = triton::api.taintUnion(dst, src8);
-          expr->isTainted = triton::api.taintUnion(dst, src9);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src1);
+          expr->isTainted = triton::getContext().taintUnion(dst, src2);
+          expr->isTainted = triton::getContext().taintUnion(dst, src3);
+          expr->isTainted = triton::getContext().taintUnion(dst, src4);
+          expr->isTainted = triton::getContext().taintUnion(dst, src5);
+          expr->isTainted = triton::getContext().taintUnion(dst, src6);
+          expr->isTainted = triton::getContext().taintUnion(dst, src7);
+          expr->isTainted = triton::getContext().taintUnion(dst, src8);
+          expr->isTainted = triton::getContext().taintUnion(dst, src9);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -8791,17 +8868,17 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::bvxor(op1, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "PXOR operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "PXOR operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -8822,18 +8899,18 @@ namespace triton {
           switch (dst.getBitSize()) {
             /* Mask: 0x1f without MOD */
             case QWORD_SIZE_BIT:
-              concreteOp2 = (triton::api.buildSymbolicOperand(inst, src)->evaluate() & (QWORD_SIZE_BIT-1));
+              concreteOp2 = (triton::getContext().buildSymbolicOperand(inst, src)->evaluate() & (QWORD_SIZE_BIT-1));
               break;
 
             /* Mask: 0x1f without MOD */
             case DWORD_SIZE_BIT:
-              concreteOp2 = (triton::api.buildSymbolicOperand(inst, src)->evaluate() & (DWORD_SIZE_BIT-1));
+              concreteOp2 = (triton::getContext().buildSymbolicOperand(inst, src)->evaluate() & (DWORD_SIZE_BIT-1));
               break;
 
             /* Mask: 0x1f MOD size + 1 */
             case WORD_SIZE_BIT:
             case BYTE_SIZE_BIT:
-              concreteOp2 = ((triton::api.buildSymbolicOperand(inst, src)->evaluate() & (DWORD_SIZE_BIT-1)) % (dst.getBitSize() + 1));
+              concreteOp2 = ((triton::getContext().buildSymbolicOperand(inst, src)->evaluate() & (DWORD_SIZE_BIT-1)) % (dst.getBitSize() + 1));
               break;
 
             default:
@@ -8841,28 +8918,28 @@ namespace triton {
           }
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
           auto op2 = triton::ast::decimal(concreteOp2);
-          auto op3 = triton::api.buildSymbolicOperand(inst, srcCf);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, srcCf);
 
           /* Create the semantics */
           auto node1 = triton::ast::bvrol(op2, triton::ast::concat(op3, op1));
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicVolatileExpression(inst, node1, "RCL tempory operation");
+          auto expr1 = triton::getContext().createSymbolicVolatileExpression(inst, node1, "RCL tempory operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.isTainted(dst) | triton::api.isTainted(src);
+          expr1->isTainted = triton::getContext().isTainted(dst) | triton::getContext().isTainted(src);
 
           /* Create the semantics */
           auto node2 = triton::ast::extract(dst.getBitSize()-1, 0, node1);
 
           /* Create symbolic expression */
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, dst, "RCL operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, dst, "RCL operation");
 
           /* Spread taint */
-          expr2->isTainted = triton::api.taintUnion(dst, src);
-          expr2->isTainted = triton::api.taintUnion(dst, srcCf);
+          expr2->isTainted = triton::getContext().taintUnion(dst, src);
+          expr2->isTainted = triton::getContext().taintUnion(dst, srcCf);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::cfRcl_s(inst, expr2, node1, op2);
@@ -8887,18 +8964,18 @@ namespace triton {
           switch (dst.getBitSize()) {
             /* Mask: 0x3f without MOD */
             case QWORD_SIZE_BIT:
-              concreteOp2 = (triton::api.buildSymbolicOperand(inst, src)->evaluate() & (QWORD_SIZE_BIT-1));
+              concreteOp2 = (triton::getContext().buildSymbolicOperand(inst, src)->evaluate() & (QWORD_SIZE_BIT-1));
               break;
 
             /* Mask: 0x1f without MOD */
             case DWORD_SIZE_BIT:
-              concreteOp2 = (triton::api.buildSymbolicOperand(inst, src)->evaluate() & (DWORD_SIZE_BIT-1));
+              concreteOp2 = (triton::getContext().buildSymbolicOperand(inst, src)->evaluate() & (DWORD_SIZE_BIT-1));
               break;
 
             /* Mask: 0x1f MOD size + 1 */
             case WORD_SIZE_BIT:
             case BYTE_SIZE_BIT:
-              concreteOp2 = ((triton::api.buildSymbolicOperand(inst, src)->evaluate() & (DWORD_SIZE_BIT-1)) % (dst.getBitSize() + 1));
+              concreteOp2 = ((triton::getContext().buildSymbolicOperand(inst, src)->evaluate() & (DWORD_SIZE_BIT-1)) % (dst.getBitSize() + 1));
               break;
 
             default:
@@ -8906,28 +8983,28 @@ namespace triton {
           }
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
           auto op2 = triton::ast::decimal(concreteOp2);
-          auto op3 = triton::api.buildSymbolicOperand(inst, srcCf);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, srcCf);
 
           /* Create the semantics */
           auto node1 = triton::ast::bvror(op2, triton::ast::concat(op3, op1));
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicVolatileExpression(inst, node1, "RCR tempory operation");
+          auto expr1 = triton::getContext().createSymbolicVolatileExpression(inst, node1, "RCR tempory operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.isTainted(dst) | triton::api.isTainted(src);
+          expr1->isTainted = triton::getContext().isTainted(dst) | triton::getContext().isTainted(src);
 
           /* Create the semantics */
           auto node2 = triton::ast::extract(dst.getBitSize()-1, 0, node1);
 
           /* Create symbolic expression */
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, dst, "RCR operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, dst, "RCR operation");
 
           /* Spread taint */
-          expr2->isTainted = triton::api.taintUnion(dst, src);
-          expr2->isTainted = triton::api.taintUnion(dst, srcCf);
+          expr2->isTainted = triton::getContext().taintUnion(dst, src);
+          expr2->isTainted = triton::getContext().taintUnion(dst, srcCf);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::ofRcr_s(inst, expr2, dst, op1, op2); /* OF must be set before CF */
@@ -8944,15 +9021,15 @@ namespace triton {
 
           /* Create symbolic operands */
           auto op1 = triton::ast::bv(0, dst1.getBitSize());
-          auto op2 = triton::ast::bv(triton::api.getSymbolicExpressions().size(), dst2.getBitSize());
+          auto op2 = triton::ast::bv(triton::getContext().getSymbolicExpressions().size(), dst2.getBitSize());
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicExpression(inst, op1, dst1, "RDTSC EDX operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, op2, dst2, "RDTSC EAX operation");
+          auto expr1 = triton::getContext().createSymbolicExpression(inst, op1, dst1, "RDTSC EDX operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, op2, dst2, "RDTSC EAX operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.setTaint(dst1, triton::engines::taint::UNTAINTED);
-          expr2->isTainted = triton::api.setTaint(dst2, triton::engines::taint::UNTAINTED);
+          expr1->isTainted = triton::getContext().setTaint(dst1, triton::engines::taint::UNTAINTED);
+          expr2->isTainted = triton::getContext().setTaint(dst2, triton::engines::taint::UNTAINTED);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -8961,21 +9038,21 @@ namespace triton {
 
         void ret_s(triton::arch::Instruction& inst) {
           auto stack      = TRITON_X86_REG_SP.getParent();
-          auto stackValue = triton::api.getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+          auto stackValue = triton::getContext().getConcreteRegisterValue(stack).convert_to<triton::uint64>();
           auto pc         = triton::arch::OperandWrapper(TRITON_X86_REG_PC);
           auto sp         = triton::arch::OperandWrapper(inst.popMemoryAccess(stackValue, stack.getSize()));
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, sp);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, sp);
 
           /* Create the semantics */
           auto node = op1;
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, pc, "Program Counter");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, pc, "Program Counter");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(pc, sp);
+          expr->isTainted = triton::getContext().taintAssignment(pc, sp);
 
           /* Create the semantics - side effect */
           alignAddStack_s(inst, sp.getSize());
@@ -8983,12 +9060,12 @@ namespace triton {
           /* Create the semantics - side effect */
           if (inst.operands.size() > 0) {
             auto offset = inst.operands[0].getImmediate();
-            triton::api.buildSymbolicImmediate(inst, offset);
+            triton::getContext().buildSymbolicImmediate(inst, offset);
             alignAddStack_s(inst, static_cast<triton::uint32>(offset.getValue()));
           }
 
           /* Create the path constraint */
-          triton::api.addPathConstraint(inst, expr);
+          triton::getContext().addPathConstraint(inst, expr);
         }
 
 
@@ -9005,14 +9082,14 @@ namespace triton {
           switch (dst.getBitSize()) {
             /* Mask 0x3f MOD size */
             case QWORD_SIZE_BIT:
-              concreteOp2 = ((triton::api.buildSymbolicOperand(inst, src)->evaluate() & (QWORD_SIZE_BIT-1)) % dst.getBitSize());
+              concreteOp2 = ((triton::getContext().buildSymbolicOperand(inst, src)->evaluate() & (QWORD_SIZE_BIT-1)) % dst.getBitSize());
               break;
 
             /* Mask 0x1f MOD size */
             case DWORD_SIZE_BIT:
             case WORD_SIZE_BIT:
             case BYTE_SIZE_BIT:
-              concreteOp2 = ((triton::api.buildSymbolicOperand(inst, src)->evaluate() & (DWORD_SIZE_BIT-1)) % dst.getBitSize());
+              concreteOp2 = ((triton::getContext().buildSymbolicOperand(inst, src)->evaluate() & (DWORD_SIZE_BIT-1)) % dst.getBitSize());
               break;
 
             default:
@@ -9020,17 +9097,17 @@ namespace triton {
           }
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
           auto op2 = triton::ast::decimal(concreteOp2);
 
           /* Create the semantics */
           auto node = triton::ast::bvrol(op2, op1);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "ROL operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "ROL operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::cfRol_s(inst, expr, dst, op2);
@@ -9054,14 +9131,14 @@ namespace triton {
           switch (dst.getBitSize()) {
             /* Mask 0x3f MOD size */
             case QWORD_SIZE_BIT:
-              concreteOp2 = ((triton::api.buildSymbolicOperand(inst, src)->evaluate() & (QWORD_SIZE_BIT-1)) % dst.getBitSize());
+              concreteOp2 = ((triton::getContext().buildSymbolicOperand(inst, src)->evaluate() & (QWORD_SIZE_BIT-1)) % dst.getBitSize());
               break;
 
             /* Mask 0x1f MOD size */
             case DWORD_SIZE_BIT:
             case WORD_SIZE_BIT:
             case BYTE_SIZE_BIT:
-              concreteOp2 = ((triton::api.buildSymbolicOperand(inst, src)->evaluate() & (DWORD_SIZE_BIT-1)) % dst.getBitSize());
+              concreteOp2 = ((triton::getContext().buildSymbolicOperand(inst, src)->evaluate() & (DWORD_SIZE_BIT-1)) % dst.getBitSize());
               break;
 
             default:
@@ -9069,17 +9146,17 @@ namespace triton {
           }
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
           auto op2 = triton::ast::decimal(concreteOp2);
 
           /* Create the semantics */
           auto node = triton::ast::bvror(op2, op1);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "ROR operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "ROR operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::cfRor_s(inst, expr, dst, op2);
@@ -9099,7 +9176,7 @@ namespace triton {
           auto src  = triton::arch::OperandWrapper(TRITON_X86_REG_AH);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node1 = triton::ast::extract(7, 7, op1);
@@ -9109,18 +9186,18 @@ namespace triton {
           auto node5 = triton::ast::extract(0, 0, op1);
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicFlagExpression(inst, node1, dst1.getRegister(), "SAHF SF operation");
-          auto expr2 = triton::api.createSymbolicFlagExpression(inst, node2, dst2.getRegister(), "SAHF ZF operation");
-          auto expr3 = triton::api.createSymbolicFlagExpression(inst, node3, dst3.getRegister(), "SAHF AF operation");
-          auto expr4 = triton::api.createSymbolicFlagExpression(inst, node4, dst4.getRegister(), "SAHF PF operation");
-          auto expr5 = triton::api.createSymbolicFlagExpression(inst, node5, dst5.getRegister(), "SAHF CF operation");
+          auto expr1 = triton::getContext().createSymbolicFlagExpression(inst, node1, dst1.getRegister(), "SAHF SF operation");
+          auto expr2 = triton::getContext().createSymbolicFlagExpression(inst, node2, dst2.getRegister(), "SAHF ZF operation");
+          auto expr3 = triton::getContext().createSymbolicFlagExpression(inst, node3, dst3.getRegister(), "SAHF AF operation");
+          auto expr4 = triton::getContext().createSymbolicFlagExpression(inst, node4, dst4.getRegister(), "SAHF PF operation");
+          auto expr5 = triton::getContext().createSymbolicFlagExpression(inst, node5, dst5.getRegister(), "SAHF CF operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.taintAssignment(dst1, src);
-          expr2->isTainted = triton::api.taintAssignment(dst2, src);
-          expr3->isTainted = triton::api.taintAssignment(dst3, src);
-          expr4->isTainted = triton::api.taintAssignment(dst4, src);
-          expr5->isTainted = triton::api.taintAssignment(dst5, src);
+          expr1->isTainted = triton::getContext().taintAssignment(dst1, src);
+          expr2->isTainted = triton::getContext().taintAssignment(dst2, src);
+          expr3->isTainted = triton::getContext().taintAssignment(dst3, src);
+          expr4->isTainted = triton::getContext().taintAssignment(dst4, src);
+          expr5->isTainted = triton::getContext().taintAssignment(dst5, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -9132,8 +9209,8 @@ namespace triton {
           auto& src   = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::ast::zx(dst.getBitSize() - src.getBitSize(), triton::api.buildSymbolicOperand(inst, src));
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::ast::zx(dst.getBitSize() - src.getBitSize(), triton::getContext().buildSymbolicOperand(inst, src));
 
           if (dst.getBitSize() == QWORD_SIZE_BIT)
             op2 = triton::ast::bvand(op2, triton::ast::bv(QWORD_SIZE_BIT-1, dst.getBitSize()));
@@ -9144,10 +9221,10 @@ namespace triton {
           auto node = triton::ast::bvashr(op1, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "SAR operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "SAR operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::cfSar_s(inst, expr, dst, op1, op2);
@@ -9167,19 +9244,19 @@ namespace triton {
           auto  srcCf = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::ast::zx(src.getBitSize()-1, triton::api.buildSymbolicOperand(inst, srcCf));
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::ast::zx(src.getBitSize()-1, triton::getContext().buildSymbolicOperand(inst, srcCf));
 
           /* Create the semantics */
           auto node = triton::ast::bvsub(op1, triton::ast::bvadd(op2, op3));
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "SBB operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "SBB operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
-          expr->isTainted = triton::api.taintUnion(dst, srcCf);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, srcCf);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::af_s(inst, expr, dst, op1, op2);
@@ -9205,10 +9282,10 @@ namespace triton {
             inst.setPrefix(triton::arch::x86::ID_PREFIX_REPE);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, index);
-          auto op4 = triton::api.buildSymbolicOperand(inst, df);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, index);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, df);
 
           /* Create the semantics */
           auto node1 = triton::ast::bvsub(op1, op2);
@@ -9219,12 +9296,12 @@ namespace triton {
                        );
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicVolatileExpression(inst, node1, "SCASB operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, index, "Index operation");
+          auto expr1 = triton::getContext().createSymbolicVolatileExpression(inst, node1, "SCASB operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, index, "Index operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.isTainted(dst) | triton::api.isTainted(src);
-          expr2->isTainted = triton::api.taintUnion(index, index);
+          expr1->isTainted = triton::getContext().isTainted(dst) | triton::getContext().isTainted(src);
+          expr2->isTainted = triton::getContext().taintUnion(index, index);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::af_s(inst, expr1, dst, op1, op2, true);
@@ -9250,10 +9327,10 @@ namespace triton {
             inst.setPrefix(triton::arch::x86::ID_PREFIX_REPE);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, index);
-          auto op4 = triton::api.buildSymbolicOperand(inst, df);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, index);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, df);
 
           /* Create the semantics */
           auto node1 = triton::ast::bvsub(op1, op2);
@@ -9264,12 +9341,12 @@ namespace triton {
                        );
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicVolatileExpression(inst, node1, "SCASD operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, index, "Index operation");
+          auto expr1 = triton::getContext().createSymbolicVolatileExpression(inst, node1, "SCASD operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, index, "Index operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.isTainted(dst) | triton::api.isTainted(src);
-          expr2->isTainted = triton::api.taintUnion(index, index);
+          expr1->isTainted = triton::getContext().isTainted(dst) | triton::getContext().isTainted(src);
+          expr2->isTainted = triton::getContext().taintUnion(index, index);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::af_s(inst, expr1, dst, op1, op2, true);
@@ -9295,10 +9372,10 @@ namespace triton {
             inst.setPrefix(triton::arch::x86::ID_PREFIX_REPE);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, index);
-          auto op4 = triton::api.buildSymbolicOperand(inst, df);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, index);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, df);
 
           /* Create the semantics */
           auto node1 = triton::ast::bvsub(op1, op2);
@@ -9309,12 +9386,12 @@ namespace triton {
                        );
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicVolatileExpression(inst, node1, "SCASQ operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, index, "Index operation");
+          auto expr1 = triton::getContext().createSymbolicVolatileExpression(inst, node1, "SCASQ operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, index, "Index operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.isTainted(dst) | triton::api.isTainted(src);
-          expr2->isTainted = triton::api.taintUnion(index, index);
+          expr1->isTainted = triton::getContext().isTainted(dst) | triton::getContext().isTainted(src);
+          expr2->isTainted = triton::getContext().taintUnion(index, index);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::af_s(inst, expr1, dst, op1, op2, true);
@@ -9340,10 +9417,10 @@ namespace triton {
             inst.setPrefix(triton::arch::x86::ID_PREFIX_REPE);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, index);
-          auto op4 = triton::api.buildSymbolicOperand(inst, df);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, index);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, df);
 
           /* Create the semantics */
           auto node1 = triton::ast::bvsub(op1, op2);
@@ -9354,12 +9431,12 @@ namespace triton {
                        );
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicVolatileExpression(inst, node1, "SCASW operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, index, "Index operation");
+          auto expr1 = triton::getContext().createSymbolicVolatileExpression(inst, node1, "SCASW operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, index, "Index operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.isTainted(dst) | triton::api.isTainted(src);
-          expr2->isTainted = triton::api.taintUnion(index, index);
+          expr1->isTainted = triton::getContext().isTainted(dst) | triton::getContext().isTainted(src);
+          expr2->isTainted = triton::getContext().taintUnion(index, index);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::af_s(inst, expr1, dst, op1, op2, true);
@@ -9380,8 +9457,8 @@ namespace triton {
           auto  zf  = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, cf);
-          auto op3 = triton::api.buildSymbolicOperand(inst, zf);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, cf);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, zf);
 
           /* Create the semantics */
           auto node = triton::ast::ite(
@@ -9397,16 +9474,16 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "SETA operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "SETA operation");
 
           /* Spread taint and condition flag */
           if (((!op2->evaluate().convert_to<bool>() & !op3->evaluate().convert_to<bool>())) == true) {
-            expr->isTainted = triton::api.taintUnion(dst, cf);
-            expr->isTainted = triton::api.taintUnion(dst, zf);
+            expr->isTainted = triton::getContext().taintUnion(dst, cf);
+            expr->isTainted = triton::getContext().taintUnion(dst, zf);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -9418,7 +9495,7 @@ namespace triton {
           auto  cf  = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, cf);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, cf);
 
           /* Create the semantics */
           auto node = triton::ast::ite(
@@ -9428,15 +9505,15 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "SETAE operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "SETAE operation");
 
           /* Spread taint and condition flag */
           if (!op2->evaluate().convert_to<bool>()) {
-            expr->isTainted = triton::api.taintUnion(dst, cf);
+            expr->isTainted = triton::getContext().taintUnion(dst, cf);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -9448,7 +9525,7 @@ namespace triton {
           auto  cf  = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, cf);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, cf);
 
           /* Create the semantics */
           auto node = triton::ast::ite(
@@ -9458,15 +9535,15 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "SETB operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "SETB operation");
 
           /* Spread taint and condition flag */
           if (op2->evaluate().convert_to<bool>()) {
-            expr->isTainted = triton::api.taintUnion(dst, cf);
+            expr->isTainted = triton::getContext().taintUnion(dst, cf);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -9479,8 +9556,8 @@ namespace triton {
           auto  zf  = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, cf);
-          auto op3 = triton::api.buildSymbolicOperand(inst, zf);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, cf);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, zf);
 
           /* Create the semantics */
           auto node = triton::ast::ite(
@@ -9490,16 +9567,16 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "SETBE operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "SETBE operation");
 
           /* Spread taint and condition flag */
           if (op2->evaluate().convert_to<bool>() | op3->evaluate().convert_to<bool>()) {
-            expr->isTainted = triton::api.taintUnion(dst, cf);
-            expr->isTainted = triton::api.taintUnion(dst, zf);
+            expr->isTainted = triton::getContext().taintUnion(dst, cf);
+            expr->isTainted = triton::getContext().taintUnion(dst, zf);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -9511,7 +9588,7 @@ namespace triton {
           auto  zf  = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, zf);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, zf);
 
           /* Create the semantics */
           auto node = triton::ast::ite(
@@ -9521,15 +9598,15 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "SETE operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "SETE operation");
 
           /* Spread taint and condition flag */
           if (op2->evaluate().convert_to<bool>()) {
-            expr->isTainted = triton::api.taintUnion(dst, zf);
+            expr->isTainted = triton::getContext().taintUnion(dst, zf);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -9543,9 +9620,9 @@ namespace triton {
           auto  zf  = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, sf);
-          auto op3 = triton::api.buildSymbolicOperand(inst, of);
-          auto op4 = triton::api.buildSymbolicOperand(inst, zf);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, sf);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, of);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, zf);
 
           /* Create the semantics */
           auto node = triton::ast::ite(
@@ -9555,17 +9632,17 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "SETG operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "SETG operation");
 
           /* Spread taint and condition flag */
           if (((op2->evaluate().convert_to<bool>() ^ op3->evaluate().convert_to<bool>()) | op4->evaluate().convert_to<bool>()) == false) {
-            expr->isTainted = triton::api.taintUnion(dst, sf);
-            expr->isTainted = triton::api.taintUnion(dst, of);
-            expr->isTainted = triton::api.taintUnion(dst, zf);
+            expr->isTainted = triton::getContext().taintUnion(dst, sf);
+            expr->isTainted = triton::getContext().taintUnion(dst, of);
+            expr->isTainted = triton::getContext().taintUnion(dst, zf);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -9578,8 +9655,8 @@ namespace triton {
           auto  of  = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, sf);
-          auto op3 = triton::api.buildSymbolicOperand(inst, of);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, sf);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, of);
 
           /* Create the semantics */
           auto node = triton::ast::ite(
@@ -9589,16 +9666,16 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "SETGE operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "SETGE operation");
 
           /* Spread taint and condition flag */
           if (op2->evaluate().convert_to<bool>() == op3->evaluate().convert_to<bool>()) {
-            expr->isTainted = triton::api.taintUnion(dst, sf);
-            expr->isTainted = triton::api.taintUnion(dst, of);
+            expr->isTainted = triton::getContext().taintUnion(dst, sf);
+            expr->isTainted = triton::getContext().taintUnion(dst, of);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -9611,8 +9688,8 @@ namespace triton {
           auto  of  = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, sf);
-          auto op3 = triton::api.buildSymbolicOperand(inst, of);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, sf);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, of);
 
           /* Create the semantics */
           auto node = triton::ast::ite(
@@ -9622,16 +9699,16 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "SETL operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "SETL operation");
 
           /* Spread taint and condition flag */
           if (op2->evaluate().convert_to<bool>() ^ op3->evaluate().convert_to<bool>()) {
-            expr->isTainted = triton::api.taintUnion(dst, sf);
-            expr->isTainted = triton::api.taintUnion(dst, of);
+            expr->isTainted = triton::getContext().taintUnion(dst, sf);
+            expr->isTainted = triton::getContext().taintUnion(dst, of);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -9645,9 +9722,9 @@ namespace triton {
           auto  zf  = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, sf);
-          auto op3 = triton::api.buildSymbolicOperand(inst, of);
-          auto op4 = triton::api.buildSymbolicOperand(inst, zf);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, sf);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, of);
+          auto op4 = triton::getContext().buildSymbolicOperand(inst, zf);
 
           /* Create the semantics */
           auto node = triton::ast::ite(
@@ -9657,17 +9734,17 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "SETLE operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "SETLE operation");
 
           /* Spread taint and condition flag */
           if (((op2->evaluate().convert_to<bool>() ^ op3->evaluate().convert_to<bool>()) | op4->evaluate().convert_to<bool>()) == true) {
-            expr->isTainted = triton::api.taintUnion(dst, sf);
-            expr->isTainted = triton::api.taintUnion(dst, of);
-            expr->isTainted = triton::api.taintUnion(dst, zf);
+            expr->isTainted = triton::getContext().taintUnion(dst, sf);
+            expr->isTainted = triton::getContext().taintUnion(dst, of);
+            expr->isTainted = triton::getContext().taintUnion(dst, zf);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -9679,7 +9756,7 @@ namespace triton {
           auto  zf  = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, zf);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, zf);
 
           /* Create the semantics */
           auto node = triton::ast::ite(
@@ -9689,15 +9766,15 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "SETNE operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "SETNE operation");
 
           /* Spread taint and condition flag */
           if (!op2->evaluate().convert_to<bool>()) {
-            expr->isTainted = triton::api.taintUnion(dst, zf);
+            expr->isTainted = triton::getContext().taintUnion(dst, zf);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -9709,7 +9786,7 @@ namespace triton {
           auto  of  = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, of);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, of);
 
           /* Create the semantics */
           auto node = triton::ast::ite(
@@ -9719,15 +9796,15 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "SETNO operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "SETNO operation");
 
           /* Spread taint and condition flag */
           if (!op2->evaluate().convert_to<bool>()) {
-            expr->isTainted = triton::api.taintUnion(dst, of);
+            expr->isTainted = triton::getContext().taintUnion(dst, of);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -9739,7 +9816,7 @@ namespace triton {
           auto  pf  = triton::arch::OperandWrapper(TRITON_X86_REG_PF);
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, pf);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, pf);
 
           /* Create the semantics */
           auto node = triton::ast::ite(
@@ -9749,15 +9826,15 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "SETNP operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "SETNP operation");
 
           /* Spread taint and condition flag */
           if (!op2->evaluate().convert_to<bool>()) {
-            expr->isTainted = triton::api.taintUnion(dst, pf);
+            expr->isTainted = triton::getContext().taintUnion(dst, pf);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -9769,7 +9846,7 @@ namespace triton {
           auto  sf  = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, sf);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, sf);
 
           /* Create the semantics */
           auto node = triton::ast::ite(
@@ -9779,15 +9856,15 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "SETNS operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "SETNS operation");
 
           /* Spread taint and condition flag */
           if (!op2->evaluate().convert_to<bool>()) {
-            expr->isTainted = triton::api.taintUnion(dst, sf);
+            expr->isTainted = triton::getContext().taintUnion(dst, sf);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -9799,7 +9876,7 @@ namespace triton {
           auto  of  = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, of);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, of);
 
           /* Create the semantics */
           auto node = triton::ast::ite(
@@ -9809,15 +9886,15 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "SETO operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "SETO operation");
 
           /* Spread taint and condition flag */
           if (op2->evaluate().convert_to<bool>()) {
-            expr->isTainted = triton::api.taintUnion(dst, of);
+            expr->isTainted = triton::getContext().taintUnion(dst, of);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -9829,7 +9906,7 @@ namespace triton {
           auto  pf  = triton::arch::OperandWrapper(TRITON_X86_REG_PF);
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, pf);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, pf);
 
           /* Create the semantics */
           auto node = triton::ast::ite(
@@ -9839,15 +9916,15 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "SETP operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "SETP operation");
 
           /* Spread taint and condition flag */
           if (op2->evaluate().convert_to<bool>()) {
-            expr->isTainted = triton::api.taintUnion(dst, pf);
+            expr->isTainted = triton::getContext().taintUnion(dst, pf);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -9859,7 +9936,7 @@ namespace triton {
           auto  sf  = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, sf);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, sf);
 
           /* Create the semantics */
           auto node = triton::ast::ite(
@@ -9869,15 +9946,15 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "SETS operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "SETS operation");
 
           /* Spread taint and condition flag */
           if (op2->evaluate().convert_to<bool>()) {
-            expr->isTainted = triton::api.taintUnion(dst, sf);
+            expr->isTainted = triton::getContext().taintUnion(dst, sf);
             inst.setConditionTaken(true);
           }
           else
-            expr->isTainted = triton::api.taintUnion(dst, dst);
+            expr->isTainted = triton::getContext().taintUnion(dst, dst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -9889,8 +9966,8 @@ namespace triton {
           auto& src   = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::ast::zx(dst.getBitSize() - src.getBitSize(), triton::api.buildSymbolicOperand(inst, src));
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::ast::zx(dst.getBitSize() - src.getBitSize(), triton::getContext().buildSymbolicOperand(inst, src));
 
           if (dst.getBitSize() == QWORD_SIZE_BIT)
             op2 = triton::ast::bvand(op2, triton::ast::bv(QWORD_SIZE_BIT-1, dst.getBitSize()));
@@ -9901,10 +9978,10 @@ namespace triton {
           auto node = triton::ast::bvshl(op1, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "SHL operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "SHL operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::cfShl_s(inst, expr, dst, op1, op2);
@@ -9923,8 +10000,8 @@ namespace triton {
           auto& src   = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::ast::zx(dst.getBitSize() - src.getBitSize(), triton::api.buildSymbolicOperand(inst, src));
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::ast::zx(dst.getBitSize() - src.getBitSize(), triton::getContext().buildSymbolicOperand(inst, src));
 
           if (dst.getBitSize() == QWORD_SIZE_BIT)
             op2 = triton::ast::bvand(op2, triton::ast::bv(QWORD_SIZE_BIT-1, dst.getBitSize()));
@@ -9935,10 +10012,10 @@ namespace triton {
           auto node = triton::ast::bvlshr(op1, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "SHR operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "SHR operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::cfShr_s(inst, expr, dst, op1, op2);
@@ -9971,16 +10048,16 @@ namespace triton {
           auto  src = triton::arch::OperandWrapper(TRITON_X86_REG_MXCSR);
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::extract(DWORD_SIZE_BIT-1, 0, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "STMXCSR operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "STMXCSR operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -9994,9 +10071,9 @@ namespace triton {
           auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
-          auto op2 = triton::api.buildSymbolicOperand(inst, index);
-          auto op3 = triton::api.buildSymbolicOperand(inst, df);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, index);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, df);
 
           /* Create the semantics */
           auto node1 = op1;
@@ -10007,12 +10084,12 @@ namespace triton {
                        );
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicExpression(inst, node1, dst, "STOSB operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, index, "Index operation");
+          auto expr1 = triton::getContext().createSymbolicExpression(inst, node1, dst, "STOSB operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, index, "Index operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.taintAssignment(dst, src);
-          expr2->isTainted = triton::api.taintUnion(index, index);
+          expr1->isTainted = triton::getContext().taintAssignment(dst, src);
+          expr2->isTainted = triton::getContext().taintUnion(index, index);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -10026,9 +10103,9 @@ namespace triton {
           auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
-          auto op2 = triton::api.buildSymbolicOperand(inst, index);
-          auto op3 = triton::api.buildSymbolicOperand(inst, df);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, index);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, df);
 
           /* Create the semantics */
           auto node1 = op1;
@@ -10039,12 +10116,12 @@ namespace triton {
                        );
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicExpression(inst, node1, dst, "STOSD operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, index, "Index operation");
+          auto expr1 = triton::getContext().createSymbolicExpression(inst, node1, dst, "STOSD operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, index, "Index operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.taintAssignment(dst, src);
-          expr2->isTainted = triton::api.taintUnion(index, index);
+          expr1->isTainted = triton::getContext().taintAssignment(dst, src);
+          expr2->isTainted = triton::getContext().taintUnion(index, index);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -10058,9 +10135,9 @@ namespace triton {
           auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
-          auto op2 = triton::api.buildSymbolicOperand(inst, index);
-          auto op3 = triton::api.buildSymbolicOperand(inst, df);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, index);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, df);
 
           /* Create the semantics */
           auto node1 = op1;
@@ -10071,12 +10148,12 @@ namespace triton {
                        );
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicExpression(inst, node1, dst, "STOSQ operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, index, "Index operation");
+          auto expr1 = triton::getContext().createSymbolicExpression(inst, node1, dst, "STOSQ operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, index, "Index operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.taintAssignment(dst, src);
-          expr2->isTainted = triton::api.taintUnion(index, index);
+          expr1->isTainted = triton::getContext().taintAssignment(dst, src);
+          expr2->isTainted = triton::getContext().taintUnion(index, index);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -10090,9 +10167,9 @@ namespace triton {
           auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src);
-          auto op2 = triton::api.buildSymbolicOperand(inst, index);
-          auto op3 = triton::api.buildSymbolicOperand(inst, df);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, index);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, df);
 
           /* Create the semantics */
           auto node1 = op1;
@@ -10103,12 +10180,12 @@ namespace triton {
                        );
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicExpression(inst, node1, dst, "STOSW operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, index, "Index operation");
+          auto expr1 = triton::getContext().createSymbolicExpression(inst, node1, dst, "STOSW operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, index, "Index operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.taintAssignment(dst, src);
-          expr2->isTainted = triton::api.taintUnion(index, index);
+          expr1->isTainted = triton::getContext().taintAssignment(dst, src);
+          expr2->isTainted = triton::getContext().taintUnion(index, index);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -10120,17 +10197,17 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::bvsub(op1, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "SUB operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "SUB operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::af_s(inst, expr, dst, op1, op2);
@@ -10152,20 +10229,20 @@ namespace triton {
           auto src2 = triton::arch::OperandWrapper(TRITON_X86_REG_EFLAGS);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src1);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src2);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src1);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src2);
 
           /* Create the semantics */
           auto node1 = triton::ast::bvadd(op1, triton::ast::bv(inst.getSize(), src1.getBitSize()));
           auto node2 = op2;
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicExpression(inst, node1, dst1, "SYSCALL RCX operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, dst2, "SYSCALL R11 operation");
+          auto expr1 = triton::getContext().createSymbolicExpression(inst, node1, dst1, "SYSCALL RCX operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, dst2, "SYSCALL R11 operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.taintAssignment(dst1, src1);
-          expr2->isTainted = triton::api.taintAssignment(dst2, src2);
+          expr1->isTainted = triton::getContext().taintAssignment(dst1, src1);
+          expr2->isTainted = triton::getContext().taintAssignment(dst2, src2);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -10177,17 +10254,17 @@ namespace triton {
           auto& src2 = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src1);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src2);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src1);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src2);
 
           /* Create the semantics */
           auto node = triton::ast::bvand(op1, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicVolatileExpression(inst, node, "TEST operation");
+          auto expr = triton::getContext().createSymbolicVolatileExpression(inst, node, "TEST operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.isTainted(src1) | triton::api.isTainted(src2);
+          expr->isTainted = triton::getContext().isTainted(src1) | triton::getContext().isTainted(src2);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::clearFlag_s(inst, TRITON_X86_REG_CF, "Clears carry flag");
@@ -10206,8 +10283,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::concat(
@@ -10216,10 +10293,10 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "UNPCKHPD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "UNPCKHPD operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -10231,8 +10308,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> unpack;
@@ -10245,10 +10322,10 @@ namespace triton {
           auto node = triton::ast::concat(unpack);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "UNPCKHPS operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "UNPCKHPS operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -10260,8 +10337,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::concat(
@@ -10270,10 +10347,10 @@ namespace triton {
                       );
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "UNPCKLPD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "UNPCKLPD operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -10285,8 +10362,8 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> unpack;
@@ -10299,10 +10376,10 @@ namespace triton {
           auto node = triton::ast::concat(unpack);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "UNPCKLPS operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "UNPCKLPS operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -10314,13 +10391,13 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create the semantics */
-          auto node = triton::api.buildSymbolicOperand(inst, src);
+          auto node = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "VMOVDQA operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "VMOVDQA operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -10333,17 +10410,17 @@ namespace triton {
           auto& src2 = inst.operands[2];
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src1);
-          auto op3 = triton::api.buildSymbolicOperand(inst, src2);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src1);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, src2);
 
           /* Create the semantics */
           auto node = triton::ast::bvand(op2, op3);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "VPAND operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "VPAND operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src1) | triton::api.taintUnion(dst, src2);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src1) | triton::getContext().taintUnion(dst, src2);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -10356,17 +10433,17 @@ namespace triton {
           auto& src2 = inst.operands[2];
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src1);
-          auto op3 = triton::api.buildSymbolicOperand(inst, src2);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src1);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, src2);
 
           /* Create the semantics */
           auto node = triton::ast::bvand(triton::ast::bvnot(op2), op3);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "VPANDN operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "VPANDN operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src1) | triton::api.taintUnion(dst, src2);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src1) | triton::getContext().taintUnion(dst, src2);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -10379,17 +10456,17 @@ namespace triton {
           auto& src2 = inst.operands[2];
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src1);
-          auto op3 = triton::api.buildSymbolicOperand(inst, src2);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src1);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, src2);
 
           /* Create the semantics */
           auto node = triton::ast::bvor(op2, op3);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "VPOR operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "VPOR operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src1) | triton::api.taintUnion(dst, src2);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src1) | triton::getContext().taintUnion(dst, src2);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -10403,8 +10480,8 @@ namespace triton {
           triton::uint32 dstSize  = dst.getBitSize();
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
-          auto op3 = triton::api.buildSymbolicOperand(inst, ord);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, ord);
 
           /* Create the semantics */
           std::list<triton::ast::AbstractNode*> pack;
@@ -10513,10 +10590,10 @@ namespace triton {
           auto node = triton::ast::concat(pack);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "VPSHUFD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "VPSHUFD operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -10528,20 +10605,20 @@ namespace triton {
           auto& src2 = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, src1);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src2);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, src1);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src2);
 
           /* Create the semantics */
           auto node1 = triton::ast::bvand(op1, op2);
           auto node2 = triton::ast::bvand(op1, triton::ast::bvnot(op2));
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicVolatileExpression(inst, node1, "VPTEST operation");
-          auto expr2 = triton::api.createSymbolicVolatileExpression(inst, node2, "VPTEST operation");
+          auto expr1 = triton::getContext().createSymbolicVolatileExpression(inst, node1, "VPTEST operation");
+          auto expr2 = triton::getContext().createSymbolicVolatileExpression(inst, node2, "VPTEST operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.isTainted(src1) | triton::api.isTainted(src2);
-          expr2->isTainted = triton::api.isTainted(src1) | triton::api.isTainted(src2);
+          expr1->isTainted = triton::getContext().isTainted(src1) | triton::getContext().isTainted(src2);
+          expr2->isTainted = triton::getContext().isTainted(src1) | triton::getContext().isTainted(src2);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::clearFlag_s(inst, TRITON_X86_REG_AF, "Clears adjust flag");
@@ -10562,17 +10639,17 @@ namespace triton {
           auto& src2 = inst.operands[2];
 
           /* Create symbolic operands */
-          auto op2 = triton::api.buildSymbolicOperand(inst, src1);
-          auto op3 = triton::api.buildSymbolicOperand(inst, src2);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src1);
+          auto op3 = triton::getContext().buildSymbolicOperand(inst, src2);
 
           /* Create the semantics */
           auto node = triton::ast::bvxor(op2, op3);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "VPXOR operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "VPXOR operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintAssignment(dst, src1) | triton::api.taintUnion(dst, src2);
+          expr->isTainted = triton::getContext().taintAssignment(dst, src1) | triton::getContext().taintUnion(dst, src2);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -10582,37 +10659,37 @@ namespace triton {
         void xadd_s(triton::arch::Instruction& inst) {
           auto& dst  = inst.operands[0];
           auto& src  = inst.operands[1];
-          bool  dstT = triton::api.isTainted(dst);
-          bool  srcT = triton::api.isTainted(src);
+          bool  dstT = triton::getContext().isTainted(dst);
+          bool  srcT = triton::getContext().isTainted(src);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node1 = op2;
           auto node2 = op1;
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicExpression(inst, node1, dst, "XCHG operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, src, "XCHG operation");
+          auto expr1 = triton::getContext().createSymbolicExpression(inst, node1, dst, "XCHG operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, src, "XCHG operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.setTaint(dst, srcT);
-          expr2->isTainted = triton::api.setTaint(src, dstT);
+          expr1->isTainted = triton::getContext().setTaint(dst, srcT);
+          expr2->isTainted = triton::getContext().setTaint(src, dstT);
 
           /* Create symbolic operands */
-          op1 = triton::api.buildSymbolicOperand(inst, dst);
-          op2 = triton::api.buildSymbolicOperand(inst, src);
+          op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node3 = triton::ast::bvadd(op1, op2);
 
           /* Create symbolic expression */
-          auto expr3 = triton::api.createSymbolicExpression(inst, node3, dst, "ADD operation");
+          auto expr3 = triton::getContext().createSymbolicExpression(inst, node3, dst, "ADD operation");
 
           /* Spread taint */
-          expr3->isTainted = triton::api.taintUnion(dst, src);
+          expr3->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::af_s(inst, expr3, dst, op1, op2);
@@ -10630,24 +10707,24 @@ namespace triton {
         void xchg_s(triton::arch::Instruction& inst) {
           auto& dst  = inst.operands[0];
           auto& src  = inst.operands[1];
-          bool  dstT = triton::api.isTainted(dst);
-          bool  srcT = triton::api.isTainted(src);
+          bool  dstT = triton::getContext().isTainted(dst);
+          bool  srcT = triton::getContext().isTainted(src);
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node1 = op2;
           auto node2 = op1;
 
           /* Create symbolic expression */
-          auto expr1 = triton::api.createSymbolicExpression(inst, node1, dst, "XCHG operation");
-          auto expr2 = triton::api.createSymbolicExpression(inst, node2, src, "XCHG operation");
+          auto expr1 = triton::getContext().createSymbolicExpression(inst, node1, dst, "XCHG operation");
+          auto expr2 = triton::getContext().createSymbolicExpression(inst, node2, src, "XCHG operation");
 
           /* Spread taint */
-          expr1->isTainted = triton::api.setTaint(dst, srcT);
-          expr2->isTainted = triton::api.setTaint(src, dstT);
+          expr1->isTainted = triton::getContext().setTaint(dst, srcT);
+          expr2->isTainted = triton::getContext().setTaint(src, dstT);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -10659,17 +10736,17 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::bvxor(op1, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "XOR operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "XOR operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate symbolic flags */
           triton::arch::x86::semantics::clearFlag_s(inst, TRITON_X86_REG_CF, "Clears carry flag");
@@ -10688,17 +10765,17 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::bvxor(op1, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "XORPD operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "XORPD operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -10710,17 +10787,17 @@ namespace triton {
           auto& src = inst.operands[1];
 
           /* Create symbolic operands */
-          auto op1 = triton::api.buildSymbolicOperand(inst, dst);
-          auto op2 = triton::api.buildSymbolicOperand(inst, src);
+          auto op1 = triton::getContext().buildSymbolicOperand(inst, dst);
+          auto op2 = triton::getContext().buildSymbolicOperand(inst, src);
 
           /* Create the semantics */
           auto node = triton::ast::bvxor(op1, op2);
 
           /* Create symbolic expression */
-          auto expr = triton::api.createSymbolicExpression(inst, node, dst, "XORPS operation");
+          auto expr = triton::getContext().createSymbolicExpression(inst, node, dst, "XORPS operation");
 
           /* Spread taint */
-          expr->isTainted = triton::api.taintUnion(dst, src);
+          expr->isTainted = triton::getContext().taintUnion(dst, src);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -454,7 +454,7 @@ namespace triton {
         std::get<2>(ret) = 0;         /* lower bit      */
         std::get<3>(ret) = 0;         /* higest reg id  */
 
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getContext().getArchitecture() == triton::arch::ARCH_INVALID)
           return ret;
 
         switch (reg) {
@@ -470,28 +470,28 @@ namespace triton {
             std::get<0>(ret) = "eax";
             std::get<1>(ret) = DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RAX : triton::arch::x86::ID_REG_EAX;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RAX : triton::arch::x86::ID_REG_EAX;
             break;
 
           case triton::arch::x86::ID_REG_AX:
             std::get<0>(ret) = "ax";
             std::get<1>(ret) = WORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RAX : triton::arch::x86::ID_REG_EAX;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RAX : triton::arch::x86::ID_REG_EAX;
             break;
 
           case triton::arch::x86::ID_REG_AH:
             std::get<0>(ret) = "ah";
             std::get<1>(ret) = WORD_SIZE_BIT-1;
             std::get<2>(ret) = BYTE_SIZE_BIT;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RAX : triton::arch::x86::ID_REG_EAX;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RAX : triton::arch::x86::ID_REG_EAX;
             break;
 
           case triton::arch::x86::ID_REG_AL:
             std::get<0>(ret) = "al";
             std::get<1>(ret) = BYTE_SIZE_BIT-1;
             std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RAX : triton::arch::x86::ID_REG_EAX;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RAX : triton::arch::x86::ID_REG_EAX;
             break;
 
           case triton::arch::x86::ID_REG_RBX:
@@ -505,28 +505,28 @@ namespace triton {
             std::get<0>(ret) = "ebx";
             std::get<1>(ret) = DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RBX : triton::arch::x86::ID_REG_EBX;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RBX : triton::arch::x86::ID_REG_EBX;
             break;
 
           case triton::arch::x86::ID_REG_BX:
             std::get<0>(ret) = "bx";
             std::get<1>(ret) = WORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RBX : triton::arch::x86::ID_REG_EBX;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RBX : triton::arch::x86::ID_REG_EBX;
             break;
 
           case triton::arch::x86::ID_REG_BH:
             std::get<0>(ret) = "bh";
             std::get<1>(ret) = WORD_SIZE_BIT-1;
             std::get<2>(ret) = BYTE_SIZE_BIT;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RBX : triton::arch::x86::ID_REG_EBX;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RBX : triton::arch::x86::ID_REG_EBX;
             break;
 
           case triton::arch::x86::ID_REG_BL:
             std::get<0>(ret) = "bl";
             std::get<1>(ret) = BYTE_SIZE_BIT-1;
             std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RBX : triton::arch::x86::ID_REG_EBX;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RBX : triton::arch::x86::ID_REG_EBX;
             break;
 
           case triton::arch::x86::ID_REG_RCX:
@@ -540,28 +540,28 @@ namespace triton {
             std::get<0>(ret) = "ecx";
             std::get<1>(ret) = DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RCX : triton::arch::x86::ID_REG_ECX;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RCX : triton::arch::x86::ID_REG_ECX;
             break;
 
           case triton::arch::x86::ID_REG_CX:
             std::get<0>(ret) = "cx";
             std::get<1>(ret) = WORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RCX : triton::arch::x86::ID_REG_ECX;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RCX : triton::arch::x86::ID_REG_ECX;
             break;
 
           case triton::arch::x86::ID_REG_CH:
             std::get<0>(ret) = "ch";
             std::get<1>(ret) = WORD_SIZE_BIT-1;
             std::get<2>(ret) = BYTE_SIZE_BIT;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RCX : triton::arch::x86::ID_REG_ECX;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RCX : triton::arch::x86::ID_REG_ECX;
             break;
 
           case triton::arch::x86::ID_REG_CL:
             std::get<0>(ret) = "cl";
             std::get<1>(ret) = BYTE_SIZE_BIT-1;
             std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RCX : triton::arch::x86::ID_REG_ECX;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RCX : triton::arch::x86::ID_REG_ECX;
             break;
 
           case triton::arch::x86::ID_REG_RDX:
@@ -575,28 +575,28 @@ namespace triton {
             std::get<0>(ret) = "edx";
             std::get<1>(ret) = DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RDX : triton::arch::x86::ID_REG_EDX;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RDX : triton::arch::x86::ID_REG_EDX;
             break;
 
           case triton::arch::x86::ID_REG_DX:
             std::get<0>(ret) = "dx";
             std::get<1>(ret) = WORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RDX : triton::arch::x86::ID_REG_EDX;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RDX : triton::arch::x86::ID_REG_EDX;
             break;
 
           case triton::arch::x86::ID_REG_DH:
             std::get<0>(ret) = "dh";
             std::get<1>(ret) = WORD_SIZE_BIT-1;
             std::get<2>(ret) = BYTE_SIZE_BIT;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RDX : triton::arch::x86::ID_REG_EDX;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RDX : triton::arch::x86::ID_REG_EDX;
             break;
 
           case triton::arch::x86::ID_REG_DL:
             std::get<0>(ret) = "dl";
             std::get<1>(ret) = BYTE_SIZE_BIT-1;
             std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RDX : triton::arch::x86::ID_REG_EDX;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RDX : triton::arch::x86::ID_REG_EDX;
             break;
 
           case triton::arch::x86::ID_REG_RDI:
@@ -610,21 +610,21 @@ namespace triton {
             std::get<0>(ret) = "edi";
             std::get<1>(ret) = DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RDI : triton::arch::x86::ID_REG_EDI;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RDI : triton::arch::x86::ID_REG_EDI;
             break;
 
           case triton::arch::x86::ID_REG_DI:
             std::get<0>(ret) = "di";
             std::get<1>(ret) = WORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RDI : triton::arch::x86::ID_REG_EDI;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RDI : triton::arch::x86::ID_REG_EDI;
             break;
 
           case triton::arch::x86::ID_REG_DIL:
             std::get<0>(ret) = "dil";
             std::get<1>(ret) = BYTE_SIZE_BIT-1;
             std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RDI : triton::arch::x86::ID_REG_EDI;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RDI : triton::arch::x86::ID_REG_EDI;
             break;
 
           case triton::arch::x86::ID_REG_RSI:
@@ -638,21 +638,21 @@ namespace triton {
             std::get<0>(ret) = "esi";
             std::get<1>(ret) = DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RSI : triton::arch::x86::ID_REG_ESI;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RSI : triton::arch::x86::ID_REG_ESI;
             break;
 
           case triton::arch::x86::ID_REG_SI:
             std::get<0>(ret) = "si";
             std::get<1>(ret) = WORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RSI : triton::arch::x86::ID_REG_ESI;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RSI : triton::arch::x86::ID_REG_ESI;
             break;
 
           case triton::arch::x86::ID_REG_SIL:
             std::get<0>(ret) = "sil";
             std::get<1>(ret) = BYTE_SIZE_BIT-1;
             std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RSI : triton::arch::x86::ID_REG_ESI;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RSI : triton::arch::x86::ID_REG_ESI;
             break;
 
           case triton::arch::x86::ID_REG_RBP:
@@ -666,21 +666,21 @@ namespace triton {
             std::get<0>(ret) = "ebp";
             std::get<1>(ret) = DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RBP : triton::arch::x86::ID_REG_EBP;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RBP : triton::arch::x86::ID_REG_EBP;
             break;
 
           case triton::arch::x86::ID_REG_BP:
             std::get<0>(ret) = "bp";
             std::get<1>(ret) = WORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RBP : triton::arch::x86::ID_REG_EBP;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RBP : triton::arch::x86::ID_REG_EBP;
             break;
 
           case triton::arch::x86::ID_REG_BPL:
             std::get<0>(ret) = "bpl";
             std::get<1>(ret) = BYTE_SIZE_BIT-1;
             std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RBP : triton::arch::x86::ID_REG_EBP;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RBP : triton::arch::x86::ID_REG_EBP;
             break;
 
           case triton::arch::x86::ID_REG_RSP:
@@ -694,21 +694,21 @@ namespace triton {
             std::get<0>(ret) = "esp";
             std::get<1>(ret) = DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RSP : triton::arch::x86::ID_REG_ESP;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RSP : triton::arch::x86::ID_REG_ESP;
             break;
 
           case triton::arch::x86::ID_REG_SP:
             std::get<0>(ret) = "sp";
             std::get<1>(ret) = WORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RSP : triton::arch::x86::ID_REG_ESP;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RSP : triton::arch::x86::ID_REG_ESP;
             break;
 
           case triton::arch::x86::ID_REG_SPL:
             std::get<0>(ret) = "spl";
             std::get<1>(ret) = BYTE_SIZE_BIT-1;
             std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RSP : triton::arch::x86::ID_REG_ESP;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RSP : triton::arch::x86::ID_REG_ESP;
             break;
 
           case triton::arch::x86::ID_REG_RIP:
@@ -722,19 +722,19 @@ namespace triton {
             std::get<0>(ret) = "eip";
             std::get<1>(ret) = DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RIP : triton::arch::x86::ID_REG_EIP;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RIP : triton::arch::x86::ID_REG_EIP;
             break;
 
           case triton::arch::x86::ID_REG_IP:
             std::get<0>(ret) = "ip";
             std::get<1>(ret) = WORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RIP : triton::arch::x86::ID_REG_EIP;
+            std::get<3>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RIP : triton::arch::x86::ID_REG_EIP;
             break;
 
           case triton::arch::x86::ID_REG_EFLAGS:
             std::get<0>(ret) = "eflags";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
+            std::get<1>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
             std::get<3>(ret) = triton::arch::x86::ID_REG_EFLAGS;
             break;
@@ -1469,119 +1469,119 @@ namespace triton {
 
           case triton::arch::x86::ID_REG_MXCSR:
             std::get<0>(ret) = "mxcsr";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
+            std::get<1>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
             std::get<3>(ret) = triton::arch::x86::ID_REG_MXCSR;
             break;
 
           case triton::arch::x86::ID_REG_CR0:
             std::get<0>(ret) = "cr0";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
+            std::get<1>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
             std::get<3>(ret) = triton::arch::x86::ID_REG_CR0;
             break;
 
           case triton::arch::x86::ID_REG_CR1:
             std::get<0>(ret) = "cr1";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
+            std::get<1>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
             std::get<3>(ret) = triton::arch::x86::ID_REG_CR1;
             break;
 
           case triton::arch::x86::ID_REG_CR2:
             std::get<0>(ret) = "cr2";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
+            std::get<1>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
             std::get<3>(ret) = triton::arch::x86::ID_REG_CR2;
             break;
 
           case triton::arch::x86::ID_REG_CR3:
             std::get<0>(ret) = "cr3";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
+            std::get<1>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
             std::get<3>(ret) = triton::arch::x86::ID_REG_CR3;
             break;
 
           case triton::arch::x86::ID_REG_CR4:
             std::get<0>(ret) = "cr4";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
+            std::get<1>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
             std::get<3>(ret) = triton::arch::x86::ID_REG_CR4;
             break;
 
           case triton::arch::x86::ID_REG_CR5:
             std::get<0>(ret) = "cr5";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
+            std::get<1>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
             std::get<3>(ret) = triton::arch::x86::ID_REG_CR5;
             break;
 
           case triton::arch::x86::ID_REG_CR6:
             std::get<0>(ret) = "cr6";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
+            std::get<1>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
             std::get<3>(ret) = triton::arch::x86::ID_REG_CR6;
             break;
 
           case triton::arch::x86::ID_REG_CR7:
             std::get<0>(ret) = "cr7";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
+            std::get<1>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
             std::get<3>(ret) = triton::arch::x86::ID_REG_CR7;
             break;
 
           case triton::arch::x86::ID_REG_CR8:
             std::get<0>(ret) = "cr8";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
+            std::get<1>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
             std::get<3>(ret) = triton::arch::x86::ID_REG_CR8;
             break;
 
           case triton::arch::x86::ID_REG_CR9:
             std::get<0>(ret) = "cr9";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
+            std::get<1>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
             std::get<3>(ret) = triton::arch::x86::ID_REG_CR9;
             break;
 
           case triton::arch::x86::ID_REG_CR10:
             std::get<0>(ret) = "cr10";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
+            std::get<1>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
             std::get<3>(ret) = triton::arch::x86::ID_REG_CR10;
             break;
 
           case triton::arch::x86::ID_REG_CR11:
             std::get<0>(ret) = "cr11";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
+            std::get<1>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
             std::get<3>(ret) = triton::arch::x86::ID_REG_CR11;
             break;
 
           case triton::arch::x86::ID_REG_CR12:
             std::get<0>(ret) = "cr12";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
+            std::get<1>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
             std::get<3>(ret) = triton::arch::x86::ID_REG_CR12;
             break;
 
           case triton::arch::x86::ID_REG_CR13:
             std::get<0>(ret) = "cr13";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
+            std::get<1>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
             std::get<3>(ret) = triton::arch::x86::ID_REG_CR13;
             break;
 
           case triton::arch::x86::ID_REG_CR14:
             std::get<0>(ret) = "cr14";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
+            std::get<1>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
             std::get<3>(ret) = triton::arch::x86::ID_REG_CR14;
             break;
 
           case triton::arch::x86::ID_REG_CR15:
             std::get<0>(ret) = "cr15";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
+            std::get<1>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
             std::get<3>(ret) = triton::arch::x86::ID_REG_CR15;
             break;
@@ -1763,42 +1763,42 @@ namespace triton {
 
           case triton::arch::x86::ID_REG_CS:
             std::get<0>(ret) = "cs";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
+            std::get<1>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
             std::get<3>(ret) = triton::arch::x86::ID_REG_CS;
             break;
 
           case triton::arch::x86::ID_REG_DS:
             std::get<0>(ret) = "ds";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
+            std::get<1>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
             std::get<3>(ret) = triton::arch::x86::ID_REG_DS;
             break;
 
           case triton::arch::x86::ID_REG_ES:
             std::get<0>(ret) = "es";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
+            std::get<1>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
             std::get<3>(ret) = triton::arch::x86::ID_REG_ES;
             break;
 
           case triton::arch::x86::ID_REG_FS:
             std::get<0>(ret) = "fs";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
+            std::get<1>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
             std::get<3>(ret) = triton::arch::x86::ID_REG_FS;
             break;
 
           case triton::arch::x86::ID_REG_GS:
             std::get<0>(ret) = "gs";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
+            std::get<1>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
             std::get<3>(ret) = triton::arch::x86::ID_REG_GS;
             break;
 
           case triton::arch::x86::ID_REG_SS:
             std::get<0>(ret) = "ss";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
+            std::get<1>(ret) = (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
             std::get<2>(ret) = 0;
             std::get<3>(ret) = triton::arch::x86::ID_REG_SS;
             break;
@@ -1812,7 +1812,7 @@ namespace triton {
       triton::uint32 capstoneRegisterToTritonRegister(triton::uint32 id) {
         triton::uint32 tritonId = triton::arch::x86::ID_REG_INVALID;
 
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getContext().getArchitecture() == triton::arch::ARCH_INVALID)
           return tritonId;
 
         switch (id) {
@@ -2494,7 +2494,7 @@ namespace triton {
       triton::uint32 capstoneInstructionToTritonInstruction(triton::uint32 id) {
         triton::uint32 tritonId = triton::arch::x86::ID_INST_INVALID;
 
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getContext().getArchitecture() == triton::arch::ARCH_INVALID)
           return tritonId;
 
         switch (id) {
@@ -7692,7 +7692,7 @@ namespace triton {
       triton::uint32 capstonePrefixToTritonPrefix(triton::uint32 id) {
         triton::uint32 tritonId = triton::arch::x86::ID_PREFIX_INVALID;
 
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getContext().getArchitecture() == triton::arch::ARCH_INVALID)
           return tritonId;
 
         switch (id) {
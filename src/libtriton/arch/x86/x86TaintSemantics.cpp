@@ -0,0 +1,534 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <api.hpp>
+#include <cpuSize.hpp>
+#include <exceptions.hpp>
+#include <x86Semantics.hpp>
+#include <x86Specifications.hpp>
+
+
+
+/*
+ * The taint semantics are used when the symbolic engine is disabled and the
+ * TAINT_ONLY_SEMANTICS optimization is enabled. They spread the taint exactly
+ * like the symbolic semantics (see x86Semantics.cpp) and they update the
+ * concrete state with the same values, but they never allocate any symbolic
+ * expression nor AST node. An instruction which is not handled here falls
+ * back on the symbolic semantics.
+ */
+
+namespace triton {
+  namespace arch {
+    namespace x86 {
+      namespace semantics {
+
+        /* Returns the mask of a bit size */
+        static triton::uint512 mask_t(triton::uint32 bitSize) {
+          return ((triton::uint512(1) << bitSize) - 1);
+        }
+
+
+        /* Returns the most significant bit of a value */
+        static bool msb_t(const triton::uint512& value, triton::uint32 bitSize) {
+          return ((value >> (bitSize - 1)) & 1) == 1;
+        }
+
+
+        /* Sign extends a value from `bitSize` to `extendedSize` */
+        static triton::uint512 sx_t(const triton::uint512& value, triton::uint32 bitSize, triton::uint32 extendedSize) {
+          if (extendedSize > bitSize && msb_t(value, bitSize))
+            return (value | (mask_t(extendedSize) ^ mask_t(bitSize)));
+          return value;
+        }
+
+
+        /* Returns the concrete value of an operand */
+        static triton::uint512 value_t(const triton::arch::OperandWrapper& op) {
+          switch (op.getType()) {
+            case triton::arch::OP_IMM: return op.getConstImmediate().getValue();
+            case triton::arch::OP_MEM: return triton::getContext().getConcreteMemoryValue(op.getConstMemory());
+            case triton::arch::OP_REG: return triton::getContext().getConcreteRegisterValue(op.getConstRegister());
+            default:
+              throw triton::exceptions::Semantics("triton::arch::x86::semantics::value_t(): Invalid operand.");
+          }
+        }
+
+
+        /* Sets the concrete value of a register */
+        static void setRegister_t(const triton::arch::Register& reg, const triton::uint512& value) {
+          triton::arch::Register written = reg;
+          written.setConcreteValue(value & mask_t(reg.getBitSize()));
+          triton::getContext().setConcreteRegisterValue(written);
+        }
+
+
+        /* Sets the concrete value of an operand. Mirrors createSymbolicExpression. */
+        static void setValue_t(triton::arch::OperandWrapper& op, const triton::uint512& value) {
+          switch (op.getType()) {
+            case triton::arch::OP_MEM: {
+              triton::arch::MemoryAccess mem = op.getConstMemory();
+              mem.setConcreteValue(value & mask_t(mem.getBitSize()));
+              triton::getContext().setConcreteMemoryValue(mem);
+              break;
+            }
+
+            case triton::arch::OP_REG: {
+              const triton::arch::Register& reg = op.getConstRegister();
+              /* In AMD64, if a reg32 is written, it clears the 32-bit MSB of the corresponding register */
+              if (reg.getSize() == DWORD_SIZE && triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64)
+                setRegister_t(reg.getParent(), value & mask_t(reg.getBitSize()));
+              else
+                setRegister_t(reg, value);
+              break;
+            }
+
+            default:
+              throw triton::exceptions::Semantics("triton::arch::x86::semantics::setValue_t(): Invalid operand.");
+          }
+        }
+
+
+        /* Returns the concrete value of a flag */
+        static bool flag_t(const triton::arch::Register& flag) {
+          return triton::getContext().getConcreteRegisterValue(flag).convert_to<bool>();
+        }
+
+
+        /* Sets the concrete value of a flag */
+        static void setFlag_t(const triton::arch::Register& flag, bool value) {
+          setRegister_t(flag, value ? 1 : 0);
+        }
+
+
+        /* Adds `delta` to the stack pointer and returns its new value. Mirrors alignAddStack_s. */
+        static triton::uint64 alignAddStack_t(triton::uint32 delta) {
+          auto stack = TRITON_X86_REG_SP.getParent();
+          auto value = (triton::getContext().getConcreteRegisterValue(stack) + delta) & mask_t(stack.getBitSize());
+          setRegister_t(stack, value);
+          return value.convert_to<triton::uint64>();
+        }
+
+
+        /* Subtracts `delta` from the stack pointer and returns its new value. Mirrors alignSubStack_s. */
+        static triton::uint64 alignSubStack_t(triton::uint32 delta) {
+          auto stack = TRITON_X86_REG_SP.getParent();
+          auto value = (triton::getContext().getConcreteRegisterValue(stack) - delta) & mask_t(stack.getBitSize());
+          setRegister_t(stack, value);
+          return value.convert_to<triton::uint64>();
+        }
+
+
+        /* Sets the program counter */
+        static void setPc_t(const triton::uint512& value) {
+          setRegister_t(TRITON_X86_REG_PC, value);
+        }
+
+
+        /* Spreads the taint and updates the program counter. Mirrors controlFlow_s. */
+        static void controlFlow_t(triton::arch::Instruction& inst) {
+          auto pc      = triton::arch::OperandWrapper(TRITON_X86_REG_PC.getParent());
+          auto counter = triton::arch::OperandWrapper(TRITON_X86_REG_CX.getParent());
+
+          switch (inst.getPrefix()) {
+            case triton::arch::x86::ID_PREFIX_REP:
+            case triton::arch::x86::ID_PREFIX_REPE:
+            case triton::arch::x86::ID_PREFIX_REPNE: {
+              auto count = (value_t(counter) - 1) & mask_t(counter.getBitSize());
+              auto done  = (count == 0);
+              if (inst.getPrefix() == triton::arch::x86::ID_PREFIX_REPE)
+                done |= !flag_t(TRITON_X86_REG_ZF);
+              if (inst.getPrefix() == triton::arch::x86::ID_PREFIX_REPNE)
+                done |= flag_t(TRITON_X86_REG_ZF);
+              setValue_t(counter, count);
+              setPc_t(done ? inst.getNextAddress() : inst.getAddress());
+              triton::getContext().taintAssignment(pc, counter);
+              break;
+            }
+
+            default:
+              setPc_t(inst.getNextAddress());
+              triton::getContext().setTaintRegister(TRITON_X86_REG_PC, triton::engines::taint::UNTAINTED);
+              break;
+          }
+        }
+
+
+        /* PF, SF and ZF are computed from the result. Mirrors pf_s, sf_s and zf_s. */
+        static void resultFlags_t(bool isTainted, const triton::uint512& res, triton::uint32 bitSize) {
+          bool parity = true;
+          for (triton::uint32 counter = 0; counter <= BYTE_SIZE_BIT-1; counter++)
+            parity ^= (((res >> counter) & 1) == 1);
+
+          setFlag_t(TRITON_X86_REG_PF, parity);
+          setFlag_t(TRITON_X86_REG_SF, msb_t(res, bitSize));
+          setFlag_t(TRITON_X86_REG_ZF, res == 0);
+          triton::getContext().setTaintRegister(TRITON_X86_REG_PF, isTainted);
+          triton::getContext().setTaintRegister(TRITON_X86_REG_SF, isTainted);
+          triton::getContext().setTaintRegister(TRITON_X86_REG_ZF, isTainted);
+        }
+
+
+        /* AF and OF of an addition or of a subtraction. Mirrors af_s, ofAdd_s and ofSub_s. */
+        static void adjustOverflowFlags_t(bool isTainted, bool sub, const triton::uint512& res, const triton::uint512& op1, const triton::uint512& op2, triton::uint32 bitSize) {
+          setFlag_t(TRITON_X86_REG_AF, ((res ^ (op1 ^ op2)) & 0x10) == 0x10);
+          setFlag_t(TRITON_X86_REG_OF, msb_t(sub ? ((op1 ^ op2) & (op1 ^ res)) : ((op1 ^ ~op2) & (op1 ^ res)), bitSize));
+          triton::getContext().setTaintRegister(TRITON_X86_REG_AF, isTainted);
+          triton::getContext().setTaintRegister(TRITON_X86_REG_OF, isTainted);
+        }
+
+
+        /* AF, CF, OF, PF, SF and ZF of an addition or of a subtraction. Mirrors cfAdd_s and cfSub_s for CF. */
+        static void arithmeticFlags_t(bool isTainted, bool sub, const triton::uint512& res, const triton::uint512& op1, const triton::uint512& op2, triton::uint32 bitSize) {
+          auto carry = sub ? ((op1 ^ (op2 ^ res)) ^ ((op1 ^ res) & (op1 ^ op2))) : ((op1 & op2) ^ (((op1 ^ op2) ^ res) & (op1 ^ op2)));
+
+          adjustOverflowFlags_t(isTainted, sub, res, op1, op2, bitSize);
+          setFlag_t(TRITON_X86_REG_CF, msb_t(carry, bitSize));
+          triton::getContext().setTaintRegister(TRITON_X86_REG_CF, isTainted);
+          resultFlags_t(isTainted, res, bitSize);
+        }
+
+
+        /* CF and OF are cleared, PF, SF and ZF are computed from the result */
+        static void logicalFlags_t(bool isTainted, const triton::uint512& res, triton::uint32 bitSize) {
+          setFlag_t(TRITON_X86_REG_CF, false);
+          setFlag_t(TRITON_X86_REG_OF, false);
+          triton::getContext().setTaintRegister(TRITON_X86_REG_CF, triton::engines::taint::UNTAINTED);
+          triton::getContext().setTaintRegister(TRITON_X86_REG_OF, triton::engines::taint::UNTAINTED);
+          resultFlags_t(isTainted, res, bitSize);
+        }
+
+
+        /* Spreads the taint of a conditional jump and updates the program counter. Mirrors the jcc_s handlers. */
+        static void jcc_t(triton::arch::Instruction& inst, bool taken, const triton::arch::Register& flag1, const triton::arch::Register* flag2=nullptr, const triton::arch::Register* flag3=nullptr) {
+          auto pc = triton::arch::OperandWrapper(TRITON_X86_REG_PC);
+
+          /* Set condition flag */
+          if (taken)
+            inst.setConditionTaken(true);
+
+          setPc_t(taken ? value_t(inst.operands[0]) : triton::uint512(inst.getNextAddress()));
+
+          /* Spread taint */
+          triton::getContext().taintAssignment(pc, triton::arch::OperandWrapper(flag1));
+          if (flag2)
+            triton::getContext().taintUnion(pc, triton::arch::OperandWrapper(*flag2));
+          if (flag3)
+            triton::getContext().taintUnion(pc, triton::arch::OperandWrapper(*flag3));
+        }
+
+
+        /* ADD, SUB, ADC and SBB */
+        static void arithmetic_t(triton::arch::Instruction& inst, bool sub, bool withCarry) {
+          auto& dst   = inst.operands[0];
+          auto& src   = inst.operands[1];
+          auto  op1   = value_t(dst);
+          auto  op2   = value_t(src);
+          auto  carry = withCarry ? triton::uint512(flag_t(TRITON_X86_REG_CF)) : triton::uint512(0);
+          auto  size  = dst.getBitSize();
+          auto  res   = (sub ? (op1 - ((op2 + carry) & mask_t(size))) : (op1 + op2 + carry)) & mask_t(size);
+
+          bool isTainted = triton::getContext().taintUnion(dst, src);
+          if (withCarry)
+            isTainted = triton::getContext().taintUnion(dst, triton::arch::OperandWrapper(TRITON_X86_REG_CF));
+
+          setValue_t(dst, res);
+          arithmeticFlags_t(isTainted, sub, res, op1, op2, size);
+          controlFlow_t(inst);
+        }
+
+
+        /* AND, OR and XOR */
+        static void logical_t(triton::arch::Instruction& inst) {
+          auto& dst = inst.operands[0];
+          auto& src = inst.operands[1];
+          auto  op1 = value_t(dst);
+          auto  op2 = value_t(src);
+          triton::uint512 res = 0;
+
+          switch (inst.getType()) {
+            case ID_INS_AND: res = op1 & op2; break;
+            case ID_INS_OR:  res = op1 | op2; break;
+            default:         res = op1 ^ op2; break;
+          }
+
+          bool isTainted = triton::getContext().taintUnion(dst, src);
+          setValue_t(dst, res);
+          logicalFlags_t(isTainted, res, dst.getBitSize());
+          controlFlow_t(inst);
+        }
+
+
+        /* CMP */
+        static void cmp_t(triton::arch::Instruction& inst) {
+          auto& dst  = inst.operands[0];
+          auto& src  = inst.operands[1];
+          auto  size = dst.getBitSize();
+          auto  op1  = value_t(dst);
+          auto  op2  = sx_t(value_t(src), src.getBitSize(), size);
+          auto  res  = (op1 - op2) & mask_t(size);
+
+          arithmeticFlags_t(triton::getContext().isTainted(dst) | triton::getContext().isTainted(src), true, res, op1, op2, size);
+          controlFlow_t(inst);
+        }
+
+
+        /* TEST */
+        static void test_t(triton::arch::Instruction& inst) {
+          auto& src1 = inst.operands[0];
+          auto& src2 = inst.operands[1];
+
+          logicalFlags_t(triton::getContext().isTainted(src1) | triton::getContext().isTainted(src2), value_t(src1) & value_t(src2), src1.getBitSize());
+          controlFlow_t(inst);
+        }
+
+
+        /* INC and DEC, CF is unchanged */
+        static void incDec_t(triton::arch::Instruction& inst, bool sub) {
+          auto& dst  = inst.operands[0];
+          auto  size = dst.getBitSize();
+          auto  op1  = value_t(dst);
+          auto  res  = (sub ? (op1 - 1) : (op1 + 1)) & mask_t(size);
+
+          bool isTainted = triton::getContext().taintUnion(dst, dst);
+          setValue_t(dst, res);
+          adjustOverflowFlags_t(isTainted, sub, res, op1, 1, size);
+          resultFlags_t(isTainted, res, size);
+          controlFlow_t(inst);
+        }
+
+
+        /* NEG. Mirrors afNeg_s, cfNeg_s and ofNeg_s. */
+        static void neg_t(triton::arch::Instruction& inst) {
+          auto& src  = inst.operands[0];
+          auto  size = src.getBitSize();
+          auto  op1  = value_t(src);
+          auto  res  = (mask_t(size) - op1 + 1) & mask_t(size);
+
+          bool isTainted = triton::getContext().taintUnion(src, src);
+          setValue_t(src, res);
+          setFlag_t(TRITON_X86_REG_AF, ((op1 ^ res) & 0x10) == 0x10);
+          setFlag_t(TRITON_X86_REG_CF, op1 != 0);
+          setFlag_t(TRITON_X86_REG_OF, msb_t(res & op1, size));
+          triton::getContext().setTaintRegister(TRITON_X86_REG_AF, isTainted);
+          triton::getContext().setTaintRegister(TRITON_X86_REG_CF, isTainted);
+          triton::getContext().setTaintRegister(TRITON_X86_REG_OF, isTainted);
+          resultFlags_t(isTainted, res, size);
+          controlFlow_t(inst);
+        }
+
+
+        /* NOT */
+        static void not_t(triton::arch::Instruction& inst) {
+          auto& src = inst.operands[0];
+
+          triton::getContext().taintUnion(src, src);
+          setValue_t(src, value_t(src) ^ mask_t(src.getBitSize()));
+          controlFlow_t(inst);
+        }
+
+
+        /* MOV, MOVZX, MOVSX and MOVSXD */
+        static void mov_t(triton::arch::Instruction& inst, bool signExtend) {
+          auto& dst   = inst.operands[0];
+          auto& src   = inst.operands[1];
+          auto  value = value_t(src);
+
+          if (signExtend)
+            value = sx_t(value, src.getBitSize(), dst.getBitSize());
+
+          triton::getContext().taintAssignment(dst, src);
+          setValue_t(dst, value);
+          controlFlow_t(inst);
+        }
+
+
+        /* LEA. Mirrors lea_s. */
+        static void lea_t(triton::arch::Instruction& inst) {
+          auto& dst      = inst.operands[0];
+          auto& srcDisp  = inst.operands[1].getMemory().getDisplacement();
+          auto& srcBase  = inst.operands[1].getMemory().getBaseRegister();
+          auto& srcIndex = inst.operands[1].getMemory().getIndexRegister();
+          auto& srcScale = inst.operands[1].getMemory().getScale();
+          triton::uint512 base  = 0;
+          triton::uint512 index = 0;
+          triton::uint32 leaSize = 0;
+
+          /* Setup LEA size */
+          if (srcBase.isValid())
+            leaSize = srcBase.getBitSize();
+          else if (srcIndex.isValid())
+            leaSize = srcIndex.getBitSize();
+          else
+            leaSize = srcDisp.getBitSize();
+
+          if (srcBase.isValid())
+            base = triton::getContext().getConcreteRegisterValue(srcBase);
+
+          /* Base with PC */
+          if (srcBase.isValid() && (srcBase.getParent().getId() == TRITON_X86_REG_PC.getId()))
+            base += inst.getSize();
+
+          if (srcIndex.isValid())
+            index = triton::getContext().getConcreteRegisterValue(srcIndex);
+
+          /* Effective address = Displacement + BaseReg + IndexReg * Scale */
+          auto address = (srcDisp.getValue() + base + index * srcScale.getValue()) & mask_t(leaSize);
+          if (dst.getBitSize() < leaSize)
+            address = (address >> dst.getAbstractLow()) & mask_t(dst.getBitSize());
+
+          triton::getContext().setTaint(dst, triton::getContext().isTainted(srcBase) | triton::getContext().isTainted(srcIndex));
+          setValue_t(dst, address);
+          controlFlow_t(inst);
+        }
+
+
+        /* XCHG */
+        static void xchg_t(triton::arch::Instruction& inst) {
+          auto& dst  = inst.operands[0];
+          auto& src  = inst.operands[1];
+          auto  op1  = value_t(dst);
+          auto  op2  = value_t(src);
+          bool  dstT = triton::getContext().isTainted(dst);
+          bool  srcT = triton::getContext().isTainted(src);
+
+          triton::getContext().setTaint(dst, srcT);
+          triton::getContext().setTaint(src, dstT);
+          setValue_t(dst, op2);
+          setValue_t(src, op1);
+          controlFlow_t(inst);
+        }
+
+
+        /* PUSH */
+        static void push_t(triton::arch::Instruction& inst) {
+          auto  stack      = TRITON_X86_REG_SP.getParent();
+          auto  stackValue = alignSubStack_t(stack.getSize());
+          auto  dst        = triton::arch::OperandWrapper(inst.popMemoryAccess(stackValue, stack.getSize()));
+          auto& src        = inst.operands[0];
+
+          triton::getContext().taintAssignment(dst, src);
+          setValue_t(dst, value_t(src));
+          controlFlow_t(inst);
+        }
+
+
+        /* POP */
+        static void pop_t(triton::arch::Instruction& inst) {
+          auto  stack      = TRITON_X86_REG_SP.getParent();
+          auto  stackValue = triton::getContext().getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+          auto& dst        = inst.operands[0];
+          auto  src        = triton::arch::OperandWrapper(inst.popMemoryAccess(stackValue, stack.getSize()));
+
+          triton::getContext().taintAssignment(dst, src);
+          setValue_t(dst, value_t(src));
+          alignAddStack_t(src.getSize());
+          controlFlow_t(inst);
+        }
+
+
+        /* CALL */
+        static void call_t(triton::arch::Instruction& inst) {
+          auto  stack      = TRITON_X86_REG_SP.getParent();
+          auto  stackValue = alignSubStack_t(stack.getSize());
+          auto  pc         = triton::arch::OperandWrapper(TRITON_X86_REG_PC);
+          auto  sp         = triton::arch::OperandWrapper(inst.popMemoryAccess(stackValue, stack.getSize()));
+          auto& src        = inst.operands[0];
+          auto  target     = value_t(src);
+
+          triton::getContext().taintAssignmentMemoryImmediate(sp.getMemory());
+          triton::getContext().taintAssignment(pc, src);
+          setValue_t(sp, inst.getNextAddress());
+          setPc_t(target);
+        }
+
+
+        /* RET */
+        static void ret_t(triton::arch::Instruction& inst) {
+          auto stack      = TRITON_X86_REG_SP.getParent();
+          auto stackValue = triton::getContext().getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+          auto pc         = triton::arch::OperandWrapper(TRITON_X86_REG_PC);
+          auto sp         = triton::arch::OperandWrapper(inst.popMemoryAccess(stackValue, stack.getSize()));
+
+          triton::getContext().taintAssignment(pc, sp);
+          setPc_t(value_t(sp));
+          alignAddStack_t(sp.getSize());
+          if (inst.operands.size() > 0)
+            alignAddStack_t(static_cast<triton::uint32>(inst.operands[0].getImmediate().getValue()));
+        }
+
+
+        /* JMP */
+        static void jmp_t(triton::arch::Instruction& inst) {
+          auto  pc  = triton::arch::OperandWrapper(TRITON_X86_REG_PC);
+          auto& src = inst.operands[0];
+
+          inst.setConditionTaken(true);
+          triton::getContext().taintAssignment(pc, src);
+          setPc_t(value_t(src));
+        }
+
+
+        bool buildTaint(triton::arch::Instruction& inst) {
+          auto& cf = TRITON_X86_REG_CF;
+          auto& of = TRITON_X86_REG_OF;
+          auto& pf = TRITON_X86_REG_PF;
+          auto& sf = TRITON_X86_REG_SF;
+          auto& zf = TRITON_X86_REG_ZF;
+
+          switch (inst.getType()) {
+            case ID_INS_ADC:      arithmetic_t(inst, false, true);                                         break;
+            case ID_INS_ADD:      arithmetic_t(inst, false, false);                                        break;
+            case ID_INS_AND:      logical_t(inst);                                                         break;
+            case ID_INS_CALL:     call_t(inst);                                                            break;
+            case ID_INS_CMP:      cmp_t(inst);                                                             break;
+            case ID_INS_DEC:      incDec_t(inst, true);                                                    break;
+            case ID_INS_INC:      incDec_t(inst, false);                                                   break;
+            case ID_INS_JA:       jcc_t(inst, !flag_t(cf) & !flag_t(zf), cf, &zf);                         break;
+            case ID_INS_JAE:      jcc_t(inst, !flag_t(cf), cf);                                            break;
+            case ID_INS_JB:       jcc_t(inst, flag_t(cf), cf);                                             break;
+            case ID_INS_JBE:      jcc_t(inst, flag_t(cf) | flag_t(zf), cf, &zf);                           break;
+            case ID_INS_JE:       jcc_t(inst, flag_t(zf), zf);                                             break;
+            case ID_INS_JG:       jcc_t(inst, ((flag_t(sf) ^ flag_t(of)) | flag_t(zf)) == false, sf, &of, &zf); break;
+            case ID_INS_JGE:      jcc_t(inst, flag_t(sf) == flag_t(of), sf, &of);                          break;
+            case ID_INS_JL:       jcc_t(inst, flag_t(sf) ^ flag_t(of), sf, &of);                           break;
+            case ID_INS_JLE:      jcc_t(inst, ((flag_t(sf) ^ flag_t(of)) | flag_t(zf)) == true, sf, &of, &zf); break;
+            case ID_INS_JMP:      jmp_t(inst);                                                             break;
+            case ID_INS_JNE:      jcc_t(inst, !flag_t(zf), zf);                                            break;
+            case ID_INS_JNO:      jcc_t(inst, !flag_t(of), of);                                            break;
+            case ID_INS_JNP:      jcc_t(inst, !flag_t(pf), pf);                                            break;
+            case ID_INS_JNS:      jcc_t(inst, !flag_t(sf), sf);                                            break;
+            case ID_INS_JO:       jcc_t(inst, flag_t(of), of);                                             break;
+            case ID_INS_JP:       jcc_t(inst, flag_t(pf), pf);                                             break;
+            case ID_INS_JS:       jcc_t(inst, flag_t(sf), sf);                                             break;
+            case ID_INS_LEA:      lea_t(inst);                                                             break;
+            case ID_INS_MOV:      mov_t(inst, false);                                                      break;
+            case ID_INS_MOVSX:    mov_t(inst, true);                                                       break;
+            case ID_INS_MOVSXD:   mov_t(inst, true);                                                       break;
+            case ID_INS_MOVZX:    mov_t(inst, false);                                                      break;
+            case ID_INS_NEG:      neg_t(inst);                                                             break;
+            case ID_INS_NOP:      controlFlow_t(inst);                                                     break;
+            case ID_INS_NOT:      not_t(inst);                                                             break;
+            case ID_INS_OR:       logical_t(inst);                                                         break;
+            case ID_INS_POP:      pop_t(inst);                                                             break;
+            case ID_INS_PUSH:     push_t(inst);                                                            break;
+            case ID_INS_RET:      ret_t(inst);                                                             break;
+            case ID_INS_SBB:      arithmetic_t(inst, true, true);                                          break;
+            case ID_INS_SUB:      arithmetic_t(inst, true, false);                                         break;
+            case ID_INS_TEST:     test_t(inst);                                                            break;
+            case ID_INS_XCHG:     xchg_t(inst);                                                            break;
+            case ID_INS_XOR:      logical_t(inst);                                                         break;
+            default:
+              return false;
+          }
+          return true;
+        }
+
+      }; /* semantics namespace */
+    }; /* x86 namespace */
+  }; /* arch namespace */
+}; /* triton namespace */
@@ -6,9 +6,11 @@
 */
 
 #include <cmath>
+#include <functional>
 
 #include <api.hpp>
 #include <ast.hpp>
+#include <astArena.hpp>
 #include <exceptions.hpp>
 #include <tritonToZ3Ast.hpp>
 #include <z3Result.hpp>
@@ -21,6 +23,8 @@ namespace triton {
     /* ====== Abstract node */
 
     AbstractNode::AbstractNode(enum kind_e kind) {
+      this->stale       = false;
+      this->hashValue   = 0;
       this->eval        = 0;
       this->kind        = kind;
       this->size        = 0;
@@ -29,6 +33,8 @@ namespace triton {
 
 
     AbstractNode::AbstractNode() {
+      this->stale       = false;
+      this->hashValue   = 0;
       this->eval        = 0;
       this->kind        = UNDEFINED_NODE;
       this->size        = 0;
@@ -38,6 +44,8 @@ namespace triton {
 
     AbstractNode::AbstractNode(const AbstractNode& copy) {
       this->eval        = copy.eval;
+      this->hashValue   = copy.hashValue;
+      this->stale       = copy.stale;
       this->kind        = copy.kind;
       this->parents     = copy.parents;
       this->size        = copy.size;
@@ -53,12 +61,29 @@ namespace triton {
     }
 
 
+    void* AbstractNode::operator new(std::size_t size) {
+      return triton::getContext().allocateAstNode(size);
+    }
+
+
+    void AbstractNode::operator delete(void* ptr) {
+      /* A node is released into the arena which allocated it, whatever the context of the thread */
+      if (ptr != nullptr) {
+        triton::ast::AstArena* owner = triton::ast::AstArena::getOwner(ptr);
+        if (owner != nullptr)
+          owner->deallocate(ptr);
+      }
+    }
+
+
     enum kind_e AbstractNode::getKind(void) const {
       return this->kind;
     }
 
 
     triton::uint32 AbstractNode::getBitvectorSize(void) const {
+      if (this->stale)
+        const_cast<AbstractNode*>(this)->update();
       return this->size;
     }
 
@@ -71,6 +96,8 @@ namespace triton {
 
 
     bool AbstractNode::isSigned(void) const {
+      if (this->stale)
+        const_cast<AbstractNode*>(this)->update();
       if ((this->eval >> (this->size-1)) & 1)
         return true;
       return false;
@@ -78,15 +105,97 @@ namespace triton {
 
 
     bool AbstractNode::isSymbolized(void) const {
+      if (this->stale)
+        const_cast<AbstractNode*>(this)->update();
       return this->symbolized;
     }
 
 
     triton::uint512 AbstractNode::evaluate(void) const {
+      if (this->stale)
+        const_cast<AbstractNode*>(this)->update();
       return this->eval;
     }
 
 
+    triton::uint64 AbstractNode::getHash(void) const {
+      if (this->stale)
+        const_cast<AbstractNode*>(this)->update();
+      return this->hashValue;
+    }
+
+
+    bool AbstractNode::isStale(void) const {
+      return this->stale;
+    }
+
+
+    void AbstractNode::initParents(void) {
+      std::vector<AbstractNode*> worklist;
+
+      this->stale = false;
+
+      /*
+       * Mark all ancestors as stale. An ancestor of a stale node is always
+       * stale, so the walk stops at nodes which are already stale.
+       */
+      worklist.push_back(this);
+      while (!worklist.empty()) {
+        AbstractNode* node = worklist.back();
+        worklist.pop_back();
+        for (std::set<AbstractNode*>::iterator it = node->parents.begin(); it != node->parents.end(); it++) {
+          if (!(*it)->stale) {
+            (*it)->stale = true;
+            worklist.push_back(*it);
+          }
+        }
+      }
+    }
+
+
+    void AbstractNode::update(void) {
+      std::vector<std::pair<AbstractNode*, triton::uint32>> worklist;
+
+      /* Recompute stale nodes in post-order, each node at most once */
+      worklist.push_back(std::make_pair(this, 0));
+      while (!worklist.empty()) {
+        AbstractNode* node   = worklist.back().first;
+        triton::uint32 index = worklist.back().second;
+
+        if (index < node->childs.size()) {
+          worklist.back().second++;
+          if (node->childs[index]->stale)
+            worklist.push_back(std::make_pair(node->childs[index], 0));
+          continue;
+        }
+
+        worklist.pop_back();
+        if (node->stale) {
+          node->stale = false;
+          node->init();
+        }
+      }
+    }
+
+
+    void AbstractNode::initHash(bool commutative, triton::uint64 payload) {
+      triton::uint64 h = triton::ast::hashMix(triton::ast::hashMix(this->kind, this->size), payload);
+
+      if (commutative) {
+        triton::uint64 sum = 0;
+        for (triton::uint32 index = 0; index < this->childs.size(); index++)
+          sum += triton::ast::hashMix(this->childs.size(), this->childs[index]->getHash());
+        h = triton::ast::hashMix(h, sum);
+      }
+      else {
+        for (triton::uint32 index = 0; index < this->childs.size(); index++)
+          h = triton::ast::hashMix(h, this->childs[index]->getHash());
+      }
+
+      this->hashValue = h;
+    }
+
+
     std::vector<AbstractNode*>& AbstractNode::getChilds(void) {
       return this->childs;
     }
@@ -133,6 +242,9 @@ namespace triton {
 
       /* Setup the child of the parent */
       this->childs[index] = child;
+
+      /* This node and its parents may have been translated with the old child */
+      triton::getContext().clearTranslatedNodes();
     }
 
 
@@ -173,9 +285,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(true);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -229,9 +343,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(true);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -285,9 +401,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(true);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -374,9 +492,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(false);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -438,9 +558,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(false);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -494,9 +616,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(false);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -550,9 +674,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(true);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -606,9 +732,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(true);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -658,9 +786,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(true);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -714,9 +844,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(true);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -766,9 +898,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(true);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -822,9 +956,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(true);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -894,9 +1030,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(false);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -965,9 +1103,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(false);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1034,9 +1174,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(false);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1097,9 +1239,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(false);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1160,9 +1304,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(false);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1216,9 +1362,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(false);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1279,9 +1427,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(false);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1342,9 +1492,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(false);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1409,9 +1561,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(false);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1476,9 +1630,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(false);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1532,9 +1688,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(false);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1592,9 +1750,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(false);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1648,9 +1808,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(false);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1704,9 +1866,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(false);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1760,9 +1924,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(false);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1816,9 +1982,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(false);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1876,9 +2044,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(false);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1932,9 +2102,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(true);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1988,9 +2160,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(true);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2056,9 +2230,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(false);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2109,9 +2285,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(true);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2187,9 +2365,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(false);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2232,9 +2412,11 @@ namespace triton {
       this->size        = 0;
       this->symbolized  = false;
 
+      /* Init the hash */
+      this->initHash(false, triton::ast::hashUint512(this->value));
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2293,9 +2475,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(false);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2346,9 +2530,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(true);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2399,9 +2585,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(true);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2468,9 +2656,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(false);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2525,9 +2715,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(false);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2578,9 +2770,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(true);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2635,9 +2829,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(false);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2687,9 +2883,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(true);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2740,9 +2938,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(true);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2781,22 +2981,24 @@ namespace triton {
 
     void ReferenceNode::init(void) {
       /* Init attributes */
-      if (!triton::api.isSymbolicExpressionIdExists(this->value)) {
+      if (!triton::getContext().isSymbolicExpressionIdExists(this->value)) {
         this->eval        = 0;
         this->size        = 0;
         this->symbolized  = false;
       }
       else {
-        this->eval        = triton::api.getAstFromId(this->value)->evaluate();
-        this->size        = triton::api.getAstFromId(this->value)->getBitvectorSize();
-        this->symbolized  = triton::api.getAstFromId(this->value)->isSymbolized();
+        this->eval        = triton::getContext().getAstFromId(this->value)->evaluate();
+        this->size        = triton::getContext().getAstFromId(this->value)->getBitvectorSize();
+        this->symbolized  = triton::getContext().getAstFromId(this->value)->isSymbolized();
 
-        triton::api.getAstFromId(this->value)->setParent(this);
+        triton::getContext().getAstFromId(this->value)->setParent(this);
       }
 
+      /* Init the hash */
+      this->initHash(false, static_cast<triton::uint64>(this->value));
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2841,9 +3043,11 @@ namespace triton {
       this->size        = 0;
       this->symbolized  = false;
 
+      /* Init the hash */
+      this->initHash(false, std::hash<std::string>()(this->value));
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2909,9 +3113,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(false);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2951,7 +3157,7 @@ namespace triton {
     void VariableNode::init(void) {
       triton::engines::symbolic::SymbolicVariable* symVar = nullptr;
 
-      symVar = triton::api.getSymbolicVariableFromName(this->value);
+      symVar = triton::getContext().getSymbolicVariableFromName(this->value);
       if (symVar) {
         this->size        = symVar->getSize();
         this->eval        = (symVar->getConcreteValue() & this->getBitvectorMask());
@@ -2960,9 +3166,11 @@ namespace triton {
       else
         throw triton::exceptions::Ast("VariableNode::init(): Variable not found.");
 
+      /* Init the hash */
+      this->initHash(false, std::hash<std::string>()(this->value));
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -3028,9 +3236,11 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the hash */
+      this->initHash(false);
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -3059,7 +3269,7 @@ namespace triton {
 
     /* Representation dispatcher from an abstract node */
     std::ostream& operator<<(std::ostream& stream, AbstractNode* node) {
-      return triton::api.printAstRepresentation(stream, node);
+      return triton::getContext().printAstRepresentation(stream, node);
     }
 
 
@@ -3067,7 +3277,7 @@ namespace triton {
     bool operator==(AbstractNode& node1, AbstractNode& node2) {
       return (node1.evaluate() == node2.evaluate()) &&
              (node1.getBitvectorSize() == node2.getBitvectorSize()) &&
-             (node1.hash(1) == node2.hash(1));
+             (node1.getHash() == node2.getHash());
     }
 
 
@@ -3096,6 +3306,27 @@ namespace triton {
     }
 
 
+    triton::uint64 hashMix(triton::uint64 hash, triton::uint64 value) {
+      hash ^= value + 0x9e3779b97f4a7c15 + (hash << 6) + (hash >> 2);
+      hash ^= hash >> 30;
+      hash *= 0xbf58476d1ce4e5b9;
+      hash ^= hash >> 27;
+      hash *= 0x94d049bb133111eb;
+      hash ^= hash >> 31;
+      return hash;
+    }
+
+
+    triton::uint64 hashUint512(triton::uint512 value) {
+      triton::uint64 hash = 0;
+      do {
+        hash   = triton::ast::hashMix(hash, static_cast<triton::uint64>(value & 0xffffffffffffffff));
+        value >>= 64;
+      } while (value != 0);
+      return hash;
+    }
+
+
     triton::sint512 modularSignExtend(AbstractNode* node) {
       triton::sint512 value = 0;
 
@@ -3124,7 +3355,7 @@ namespace triton {
       AbstractNode* node = new AssertNode(expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3132,7 +3363,7 @@ namespace triton {
       AbstractNode* node = new BvNode(value, size);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3140,7 +3371,7 @@ namespace triton {
       AbstractNode* node = new BvaddNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3148,7 +3379,7 @@ namespace triton {
       AbstractNode* node = new BvandNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3156,7 +3387,7 @@ namespace triton {
       AbstractNode* node = new BvashrNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3164,7 +3395,7 @@ namespace triton {
       AbstractNode* node = new BvdeclNode(size);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3172,7 +3403,7 @@ namespace triton {
       AbstractNode* node = new BvNode(0, 1);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3180,7 +3411,7 @@ namespace triton {
       AbstractNode* node = new BvlshrNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3188,7 +3419,7 @@ namespace triton {
       AbstractNode* node = new BvmulNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3196,7 +3427,7 @@ namespace triton {
       AbstractNode* node = new BvnandNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3204,7 +3435,7 @@ namespace triton {
       AbstractNode* node = new BvnegNode(expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3212,7 +3443,7 @@ namespace triton {
       AbstractNode* node = new BvnorNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3220,7 +3451,7 @@ namespace triton {
       AbstractNode* node = new BvnotNode(expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3228,7 +3459,7 @@ namespace triton {
       AbstractNode* node = new BvorNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3236,7 +3467,7 @@ namespace triton {
       AbstractNode* node = new BvrolNode(rot, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3244,7 +3475,7 @@ namespace triton {
       AbstractNode* node = new BvrolNode(rot, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3252,7 +3483,7 @@ namespace triton {
       AbstractNode* node = new BvrorNode(rot, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3260,7 +3491,7 @@ namespace triton {
       AbstractNode* node = new BvrorNode(rot, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3268,7 +3499,7 @@ namespace triton {
       AbstractNode* node = new BvsdivNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3276,7 +3507,7 @@ namespace triton {
       AbstractNode* node = new BvsgeNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3284,7 +3515,7 @@ namespace triton {
       AbstractNode* node = new BvsgtNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3292,7 +3523,7 @@ namespace triton {
       AbstractNode* node = new BvshlNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3300,7 +3531,7 @@ namespace triton {
       AbstractNode* node = new BvsleNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3308,7 +3539,7 @@ namespace triton {
       AbstractNode* node = new BvsltNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3316,7 +3547,7 @@ namespace triton {
       AbstractNode* node = new BvsmodNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3324,7 +3555,7 @@ namespace triton {
       AbstractNode* node = new BvsremNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3332,7 +3563,7 @@ namespace triton {
       AbstractNode* node = new BvsubNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3340,7 +3571,7 @@ namespace triton {
       AbstractNode* node = new BvNode(1, 1);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3348,7 +3579,7 @@ namespace triton {
       AbstractNode* node = new BvudivNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3356,7 +3587,7 @@ namespace triton {
       AbstractNode* node = new BvugeNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3364,7 +3595,7 @@ namespace triton {
       AbstractNode* node = new BvugtNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3372,7 +3603,7 @@ namespace triton {
       AbstractNode* node = new BvuleNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3380,7 +3611,7 @@ namespace triton {
       AbstractNode* node = new BvultNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3388,7 +3619,7 @@ namespace triton {
       AbstractNode* node = new BvuremNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3396,7 +3627,7 @@ namespace triton {
       AbstractNode* node = new BvxnorNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3404,7 +3635,7 @@ namespace triton {
       AbstractNode* node = new BvxorNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3412,7 +3643,7 @@ namespace triton {
       AbstractNode* node = new CompoundNode(exprs);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3420,7 +3651,7 @@ namespace triton {
       AbstractNode* node = new ConcatNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3428,7 +3659,7 @@ namespace triton {
       AbstractNode* node = new ConcatNode(exprs);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3436,7 +3667,7 @@ namespace triton {
       AbstractNode* node = new ConcatNode(exprs);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3444,7 +3675,7 @@ namespace triton {
       AbstractNode* node = new DecimalNode(value);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3452,7 +3683,7 @@ namespace triton {
       AbstractNode* node = new DeclareFunctionNode(name, bvDecl);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3460,7 +3691,7 @@ namespace triton {
       AbstractNode* node = new DistinctNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3468,7 +3699,7 @@ namespace triton {
       AbstractNode* node = new EqualNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3476,7 +3707,7 @@ namespace triton {
       AbstractNode* node = new ExtractNode(high, low, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3484,7 +3715,7 @@ namespace triton {
       AbstractNode* node = new IteNode(ifExpr, thenExpr, elseExpr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3492,7 +3723,7 @@ namespace triton {
       AbstractNode* node = new LandNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3500,7 +3731,7 @@ namespace triton {
       AbstractNode* node = new LetNode(alias, expr2, expr3);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3508,7 +3739,7 @@ namespace triton {
       AbstractNode* node = new LnotNode(expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3516,7 +3747,7 @@ namespace triton {
       AbstractNode* node = new LorNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3524,7 +3755,7 @@ namespace triton {
       AbstractNode* node = new ReferenceNode(value);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3532,7 +3763,7 @@ namespace triton {
       AbstractNode* node = new StringNode(value);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3540,7 +3771,7 @@ namespace triton {
       AbstractNode* node = new SxNode(sizeExt, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3549,8 +3780,8 @@ namespace triton {
       AbstractNode* node = new VariableNode(symVar);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      ret = triton::api.recordAstNode(node);
-      triton::api.recordVariableAstNode(symVar.getName(), ret);
+      ret = triton::getContext().recordAstNode(node);
+      triton::getContext().recordVariableAstNode(symVar.getName(), ret);
       return ret;
     }
 
@@ -3559,7 +3790,7 @@ namespace triton {
       AbstractNode* node = new ZxNode(sizeExt, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getContext().recordAstNode(node);
     }
 
 
@@ -3623,6 +3854,73 @@ namespace triton {
       return newNode;
     }
 
+
+    AbstractNode* newInstance(AbstractNode* node, const std::vector<AbstractNode*>& childs) {
+      if (node->getChilds().size() != childs.size())
+        throw triton::exceptions::Ast("triton::ast::newInstance(): Invalid number of childs.");
+
+      switch (node->getKind()) {
+        case ASSERT_NODE:               return triton::ast::assert_(childs[0]);
+        case BVADD_NODE:                return triton::ast::bvadd(childs[0], childs[1]);
+        case BVAND_NODE:                return triton::ast::bvand(childs[0], childs[1]);
+        case BVASHR_NODE:               return triton::ast::bvashr(childs[0], childs[1]);
+        case BVLSHR_NODE:               return triton::ast::bvlshr(childs[0], childs[1]);
+        case BVMUL_NODE:                return triton::ast::bvmul(childs[0], childs[1]);
+        case BVNAND_NODE:               return triton::ast::bvnand(childs[0], childs[1]);
+        case BVNEG_NODE:                return triton::ast::bvneg(childs[0]);
+        case BVNOR_NODE:                return triton::ast::bvnor(childs[0], childs[1]);
+        case BVNOT_NODE:                return triton::ast::bvnot(childs[0]);
+        case BVOR_NODE:                 return triton::ast::bvor(childs[0], childs[1]);
+        case BVROL_NODE:                return triton::ast::bvrol(childs[0], childs[1]);
+        case BVROR_NODE:                return triton::ast::bvror(childs[0], childs[1]);
+        case BVSDIV_NODE:               return triton::ast::bvsdiv(childs[0], childs[1]);
+        case BVSGE_NODE:                return triton::ast::bvsge(childs[0], childs[1]);
+        case BVSGT_NODE:                return triton::ast::bvsgt(childs[0], childs[1]);
+        case BVSHL_NODE:                return triton::ast::bvshl(childs[0], childs[1]);
+        case BVSLE_NODE:                return triton::ast::bvsle(childs[0], childs[1]);
+        case BVSLT_NODE:                return triton::ast::bvslt(childs[0], childs[1]);
+        case BVSMOD_NODE:               return triton::ast::bvsmod(childs[0], childs[1]);
+        case BVSREM_NODE:               return triton::ast::bvsrem(childs[0], childs[1]);
+        case BVSUB_NODE:                return triton::ast::bvsub(childs[0], childs[1]);
+        case BVUDIV_NODE:               return triton::ast::bvudiv(childs[0], childs[1]);
+        case BVUGE_NODE:                return triton::ast::bvuge(childs[0], childs[1]);
+        case BVUGT_NODE:                return triton::ast::bvugt(childs[0], childs[1]);
+        case BVULE_NODE:                return triton::ast::bvule(childs[0], childs[1]);
+        case BVULT_NODE:                return triton::ast::bvult(childs[0], childs[1]);
+        case BVUREM_NODE:               return triton::ast::bvurem(childs[0], childs[1]);
+        case BVXNOR_NODE:               return triton::ast::bvxnor(childs[0], childs[1]);
+        case BVXOR_NODE:                return triton::ast::bvxor(childs[0], childs[1]);
+        case COMPOUND_NODE:             return triton::ast::compound(childs);
+        case CONCAT_NODE:               return triton::ast::concat(childs);
+        case DECLARE_FUNCTION_NODE:     return triton::ast::declareFunction(reinterpret_cast<StringNode*>(childs[0])->getValue(), childs[1]);
+        case DISTINCT_NODE:             return triton::ast::distinct(childs[0], childs[1]);
+        case EQUAL_NODE:                return triton::ast::equal(childs[0], childs[1]);
+        case EXTRACT_NODE:              return triton::ast::extract(
+                                                 reinterpret_cast<DecimalNode*>(childs[0])->getValue().convert_to<triton::uint32>(),
+                                                 reinterpret_cast<DecimalNode*>(childs[1])->getValue().convert_to<triton::uint32>(),
+                                                 childs[2]);
+        case ITE_NODE:                  return triton::ast::ite(childs[0], childs[1], childs[2]);
+        case LAND_NODE:                 return triton::ast::land(childs[0], childs[1]);
+        case LET_NODE:                  return triton::ast::let(reinterpret_cast<StringNode*>(childs[0])->getValue(), childs[1], childs[2]);
+        case LNOT_NODE:                 return triton::ast::lnot(childs[0]);
+        case LOR_NODE:                  return triton::ast::lor(childs[0], childs[1]);
+        case SX_NODE:                   return triton::ast::sx(reinterpret_cast<DecimalNode*>(childs[0])->getValue().convert_to<triton::uint32>(), childs[1]);
+        case ZX_NODE:                   return triton::ast::zx(reinterpret_cast<DecimalNode*>(childs[0])->getValue().convert_to<triton::uint32>(), childs[1]);
+
+        /* The leaves have no child */
+        case BV_NODE:
+        case BVDECL_NODE:
+        case DECIMAL_NODE:
+        case REFERENCE_NODE:
+        case STRING_NODE:
+        case VARIABLE_NODE:
+          return node;
+
+        default:
+          throw triton::exceptions::Ast("triton::ast::newInstance(): Invalid kind node.");
+      }
+    }
+
   }; /* ast namespace */
 }; /* triton namespace */
 
@@ -0,0 +1,187 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <new>
+
+#include <astArena.hpp>
+#include <exceptions.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    static_assert(sizeof(AstArena::Slot) <= AST_ARENA_GRANULARITY, "The header of a slot must fit into the granularity.");
+
+
+    AstArena::AstArena() {
+      this->liveObjects = 0;
+      this->liveBytes   = 0;
+
+      for (triton::uint32 index = 0; index < AST_ARENA_CLASSES; index++) {
+        this->classes[index].freeList = nullptr;
+        this->classes[index].offset   = AST_ARENA_SLAB_SIZE;
+      }
+    }
+
+
+    AstArena::~AstArena() {
+      this->release();
+    }
+
+
+    AstArena::Slot* AstArena::getSlot(const void* ptr) {
+      return reinterpret_cast<Slot*>(const_cast<triton::uint8*>(reinterpret_cast<const triton::uint8*>(ptr) - AST_ARENA_GRANULARITY));
+    }
+
+
+    triton::usize AstArena::getSlotSize(triton::uint32 index) {
+      return AST_ARENA_GRANULARITY + (index + 1) * AST_ARENA_GRANULARITY;
+    }
+
+
+    void* AstArena::allocate(triton::usize size) {
+      triton::uint32 index = static_cast<triton::uint32>((size + AST_ARENA_GRANULARITY - 1) / AST_ARENA_GRANULARITY);
+      Slot* slot           = nullptr;
+
+      if (index == 0)
+        index = 1;
+
+      if (index > AST_ARENA_CLASSES)
+        throw triton::exceptions::Ast("AstArena::allocate(): The object is too large.");
+
+      SizeClass& sc = this->classes[--index];
+
+      /* Reuse a released slot */
+      if (sc.freeList != nullptr) {
+        slot        = sc.freeList;
+        sc.freeList = slot->next;
+      }
+
+      /* Bump into the last slab */
+      else {
+        triton::usize slotSize = AstArena::getSlotSize(index);
+        if (sc.offset + slotSize > AST_ARENA_SLAB_SIZE) {
+          triton::uint8* slab = new (std::nothrow) triton::uint8[AST_ARENA_SLAB_SIZE];
+          if (slab == nullptr)
+            throw triton::exceptions::Ast("AstArena::allocate(): Not enough memory.");
+          sc.slabs.push_back(slab);
+          sc.offset = 0;
+        }
+        slot       = reinterpret_cast<Slot*>(sc.slabs.back() + sc.offset);
+        sc.offset += slotSize;
+      }
+
+      slot->owner    = this;
+      slot->size     = static_cast<triton::uint32>(size);
+      slot->recorded = false;
+
+      this->liveObjects++;
+      this->liveBytes += size;
+
+      return reinterpret_cast<triton::uint8*>(slot) + AST_ARENA_GRANULARITY;
+    }
+
+
+    void AstArena::deallocate(void* ptr) {
+      if (ptr == nullptr)
+        return;
+
+      Slot* slot = AstArena::getSlot(ptr);
+      if (slot->size == 0)
+        return;
+
+      SizeClass& sc = this->classes[(slot->size + AST_ARENA_GRANULARITY - 1) / AST_ARENA_GRANULARITY - 1];
+
+      this->liveObjects--;
+      this->liveBytes -= slot->size;
+
+      slot->size     = 0;
+      slot->recorded = false;
+      slot->next     = sc.freeList;
+      sc.freeList    = slot;
+    }
+
+
+    AstArena* AstArena::getOwner(const void* ptr) {
+      const Slot* slot = AstArena::getSlot(ptr);
+      return (slot->size != 0) ? slot->owner : nullptr;
+    }
+
+
+    void AstArena::release(void) {
+      for (triton::uint32 index = 0; index < AST_ARENA_CLASSES; index++) {
+        SizeClass& sc = this->classes[index];
+        for (auto it = sc.slabs.begin(); it != sc.slabs.end(); it++)
+          delete[] *it;
+        sc.slabs.clear();
+        sc.freeList = nullptr;
+        sc.offset   = AST_ARENA_SLAB_SIZE;
+      }
+      this->liveObjects = 0;
+      this->liveBytes   = 0;
+    }
+
+
+    bool AstArena::isRecorded(const void* ptr) const {
+      return AstArena::getSlot(ptr)->recorded;
+    }
+
+
+    void AstArena::setRecorded(void* ptr, bool flag) {
+      AstArena::getSlot(ptr)->recorded = flag;
+    }
+
+
+    void AstArena::getLiveObjects(std::vector<void*>& objects, bool onlyRecorded) const {
+      for (triton::uint32 index = 0; index < AST_ARENA_CLASSES; index++) {
+        const SizeClass& sc    = this->classes[index];
+        triton::usize slotSize = AstArena::getSlotSize(index);
+
+        for (triton::usize i = 0; i < sc.slabs.size(); i++) {
+          /* Only the last slab is partially used */
+          triton::usize end = (i + 1 == sc.slabs.size()) ? sc.offset : (AST_ARENA_SLAB_SIZE / slotSize) * slotSize;
+          for (triton::usize offset = 0; offset < end; offset += slotSize) {
+            const Slot* slot = reinterpret_cast<const Slot*>(sc.slabs[i] + offset);
+            if (slot->size == 0 || (onlyRecorded && !slot->recorded))
+              continue;
+            objects.push_back(reinterpret_cast<triton::uint8*>(sc.slabs[i] + offset) + AST_ARENA_GRANULARITY);
+          }
+        }
+      }
+    }
+
+
+    triton::usize AstArena::getNumberOfLiveObjects(void) const {
+      return this->liveObjects;
+    }
+
+
+    triton::usize AstArena::getNumberOfLiveBytes(void) const {
+      return this->liveBytes;
+    }
+
+
+    triton::usize AstArena::getNumberOfSlabs(void) const {
+      triton::usize count = 0;
+      for (triton::uint32 index = 0; index < AST_ARENA_CLASSES; index++)
+        count += this->classes[index].slabs.size();
+      return count;
+    }
+
+
+    std::map<std::string, triton::usize> AstArena::getStats(void) const {
+      std::map<std::string, triton::usize> stats;
+      stats["liveNodes"]     = this->getNumberOfLiveObjects();
+      stats["liveBytes"]     = this->getNumberOfLiveBytes();
+      stats["slabs"]         = this->getNumberOfSlabs();
+      stats["reservedBytes"] = this->getNumberOfSlabs() * AST_ARENA_SLAB_SIZE;
+      return stats;
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
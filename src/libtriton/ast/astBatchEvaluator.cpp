@@ -0,0 +1,628 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+
+#include <api.hpp>
+#include <astBatchEvaluator.hpp>
+#include <exceptions.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* Returns the mask of a size on 64 bits */
+    static inline triton::uint64 narrowMask(triton::uint32 size) {
+      return (size >= 64) ? std::numeric_limits<triton::uint64>::max() : ((static_cast<triton::uint64>(1) << size) - 1);
+    }
+
+
+    /* Returns the mask of a size on 512 bits */
+    static inline triton::uint512 wideMask(triton::uint32 size) {
+      triton::uint512 mask = -1;
+      return mask >> (512 - size);
+    }
+
+
+    /* Sign extends a value of a size on 64 bits */
+    static inline triton::uint64 narrowSignExtend(triton::uint64 value, triton::uint32 size) {
+      if (size < 64 && ((value >> (size - 1)) & 1))
+        return value | ~narrowMask(size);
+      return value;
+    }
+
+
+    /* Sign extends a value of a size */
+    static triton::sint512 wideSignExtend(const triton::uint512& value, triton::uint32 size) {
+      if ((value >> (size - 1)) & 1)
+        return -static_cast<triton::sint512>(((~value) + 1) & wideMask(size));
+      return static_cast<triton::sint512>(value);
+    }
+
+
+    /* Returns the two's complement of a signed value, masked */
+    static triton::uint512 wideUnsigned(const triton::sint512& value, const triton::uint512& mask) {
+      if (value < 0)
+        return ((~static_cast<triton::uint512>(-value)) + 1) & mask;
+      return static_cast<triton::uint512>(value) & mask;
+    }
+
+
+    /* Returns the index of the first operand of a node, the previous childs are immediates */
+    static triton::usize getFirstOperand(AbstractNode* node) {
+      switch (node->getKind()) {
+        case BVROL_NODE:
+        case BVROR_NODE:
+        case SX_NODE:
+        case ZX_NODE:
+          return 1;
+        case EXTRACT_NODE:
+        case LET_NODE:
+          return 2;
+        default:
+          return 0;
+      }
+    }
+
+
+    AstBatchEvaluator::AstBatchEvaluator(AbstractNode* node) {
+      if (node == nullptr)
+        throw triton::exceptions::Ast("AstBatchEvaluator::AstBatchEvaluator(): node cannot be null.");
+
+      this->narrowRegisters = 0;
+      this->wideRegisters   = 0;
+      this->compile(node);
+    }
+
+
+    AstBatchEvaluator::~AstBatchEvaluator() {
+    }
+
+
+    void AstBatchEvaluator::compile(AbstractNode* node) {
+      std::unordered_map<AbstractNode*, triton::uint32> values;
+      std::unordered_map<triton::usize, triton::uint32> inputs;
+      std::vector<std::pair<AbstractNode*, bool>> worklist;
+
+      /*
+       * Iterative post-order walk. Each node is linearized once into an instruction
+       * whose result is a value (the index of the instruction). The operands refer
+       * to the values until the registers are allocated.
+       */
+      worklist.push_back(std::make_pair(node, false));
+      while (!worklist.empty()) {
+        AbstractNode* current = worklist.back().first;
+        bool expanded         = worklist.back().second;
+
+        if (values.find(current) != values.end()) {
+          worklist.pop_back();
+          continue;
+        }
+
+        /* A reference is the value of the AST of its symbolic expression */
+        if (current->getKind() == REFERENCE_NODE) {
+          triton::usize id      = reinterpret_cast<ReferenceNode*>(current)->getValue();
+          AbstractNode* target  = triton::getContext().getSymbolicExpressionFromId(id)->getAst();
+          auto it               = values.find(target);
+
+          if (it != values.end()) {
+            values[current] = it->second;
+            worklist.pop_back();
+          }
+          else {
+            worklist.push_back(std::make_pair(target, false));
+          }
+          continue;
+        }
+
+        Instruction inst;
+        inst.kind    = current->getKind();
+        inst.size    = current->getBitvectorSize();
+        inst.wide    = false;
+        inst.dst     = static_cast<triton::uint32>(this->program.size());
+        inst.operand = this->operands.size();
+        inst.count   = 0;
+        inst.param   = 0;
+
+        /* An input */
+        if (inst.kind == VARIABLE_NODE) {
+          triton::engines::symbolic::SymbolicVariable* symVar = triton::getContext().getSymbolicVariableFromName(reinterpret_cast<VariableNode*>(current)->getValue());
+          if (symVar != nullptr) {
+            auto it = inputs.find(symVar->getId());
+            if (it == inputs.end()) {
+              it = inputs.insert(std::make_pair(symVar->getId(), static_cast<triton::uint32>(this->variables.size()))).first;
+              this->variables.push_back(symVar->getId());
+              this->variableSizes.push_back(inst.size);
+            }
+            inst.param = it->second;
+            inst.wide  = (inst.size > 64);
+            values[current] = inst.dst;
+            this->program.push_back(inst);
+            worklist.pop_back();
+            continue;
+          }
+        }
+
+        /* The nodes without symbolic variables, the commands and the unknown variables are folded into constants */
+        bool constant = !current->isSymbolized();
+        switch (inst.kind) {
+          case ASSERT_NODE:
+          case BVDECL_NODE:
+          case BV_NODE:
+          case COMPOUND_NODE:
+          case DECIMAL_NODE:
+          case DECLARE_FUNCTION_NODE:
+          case STRING_NODE:
+          case VARIABLE_NODE:
+            constant = true;
+            break;
+          default:
+            break;
+        }
+
+        if (constant) {
+          inst.kind  = BV_NODE;
+          inst.size  = (inst.size == 0) ? 1 : inst.size;
+          inst.wide  = (inst.size > 64);
+          inst.param = current->evaluate() & wideMask(inst.size);
+          values[current] = inst.dst;
+          this->program.push_back(inst);
+          worklist.pop_back();
+          continue;
+        }
+
+        std::vector<AbstractNode*>& childs = current->getChilds();
+        triton::usize first                = getFirstOperand(current);
+
+        if (!expanded) {
+          worklist.back().second = true;
+          for (triton::usize index = childs.size(); index > first; index--) {
+            if (values.find(childs[index-1]) == values.end())
+              worklist.push_back(std::make_pair(childs[index-1], false));
+          }
+          continue;
+        }
+
+        worklist.pop_back();
+
+        /* A let is the value of its body */
+        if (inst.kind == LET_NODE) {
+          values[current] = values[childs[2]];
+          continue;
+        }
+
+        for (triton::usize index = first; index < childs.size(); index++) {
+          Operand op;
+          op.reg  = values[childs[index]];
+          op.size = this->program[op.reg].size;
+          inst.wide |= (op.size > 64);
+          this->operands.push_back(op);
+          inst.count++;
+        }
+
+        if (first > 0)
+          inst.param = reinterpret_cast<DecimalNode*>(childs[first - 1])->getValue();
+
+        inst.wide |= (inst.size > 64);
+        values[current] = inst.dst;
+        this->program.push_back(inst);
+      }
+
+      /*
+       * Register allocation. A register is released after the last instruction
+       * which reads it. The result of an instruction never shares its register
+       * with one of its operands.
+       */
+      triton::uint32 root = values[node];
+      std::vector<triton::usize> lastUse(this->program.size());
+      std::vector<triton::uint32> physical(this->program.size());
+      std::vector<triton::uint32> freeNarrow;
+      std::vector<triton::uint32> freeWide;
+
+      for (triton::usize index = 0; index < this->program.size(); index++) {
+        lastUse[index] = index;
+        for (triton::uint32 op = 0; op < this->program[index].count; op++)
+          lastUse[this->operands[this->program[index].operand + op].reg] = index;
+      }
+      lastUse[root] = std::numeric_limits<triton::usize>::max();
+
+      for (triton::usize index = 0; index < this->program.size(); index++) {
+        Instruction& inst = this->program[index];
+        bool wideResult   = (inst.size > 64);
+
+        if (wideResult) {
+          if (freeWide.empty())
+            freeWide.push_back(this->wideRegisters++);
+          physical[index] = freeWide.back();
+          freeWide.pop_back();
+        }
+        else {
+          if (freeNarrow.empty())
+            freeNarrow.push_back(this->narrowRegisters++);
+          physical[index] = freeNarrow.back();
+          freeNarrow.pop_back();
+        }
+        inst.dst = physical[index];
+
+        for (triton::uint32 op = 0; op < inst.count; op++) {
+          Operand& operand  = this->operands[inst.operand + op];
+          triton::usize def = operand.reg;
+
+          operand.reg = physical[def];
+          if (lastUse[def] == index) {
+            (operand.size > 64 ? freeWide : freeNarrow).push_back(operand.reg);
+            lastUse[def] = std::numeric_limits<triton::usize>::max() - 1;
+          }
+        }
+
+        /* The result is never read */
+        if (lastUse[index] == index)
+          (wideResult ? freeWide : freeNarrow).push_back(inst.dst);
+      }
+
+      this->result.reg  = physical[root];
+      this->result.size = this->program[root].size;
+    }
+
+
+    void AstBatchEvaluator::runNarrow(const Instruction& inst, triton::uint64* narrow, triton::uint32 lanes) const {
+      const Operand* ops  = this->operands.data() + inst.operand;
+      triton::uint64* d   = narrow + (inst.dst * AST_BATCH_LANES);
+      const triton::uint64* a = (inst.count > 0) ? narrow + (ops[0].reg * AST_BATCH_LANES) : nullptr;
+      const triton::uint64* b = (inst.count > 1) ? narrow + (ops[1].reg * AST_BATCH_LANES) : nullptr;
+      const triton::uint64* c = (inst.count > 2) ? narrow + (ops[2].reg * AST_BATCH_LANES) : nullptr;
+      triton::uint32 size     = inst.size;
+      triton::uint64 m        = narrowMask(size);
+
+      switch (inst.kind) {
+        case BV_NODE: {
+          triton::uint64 value = inst.param.convert_to<triton::uint64>();
+          for (triton::uint32 l = 0; l < lanes; l++) d[l] = value;
+          break;
+        }
+
+        case BVADD_NODE:  for (triton::uint32 l = 0; l < lanes; l++) d[l] = (a[l] + b[l]) & m; break;
+        case BVAND_NODE:  for (triton::uint32 l = 0; l < lanes; l++) d[l] = a[l] & b[l]; break;
+        case BVMUL_NODE:  for (triton::uint32 l = 0; l < lanes; l++) d[l] = (a[l] * b[l]) & m; break;
+        case BVNAND_NODE: for (triton::uint32 l = 0; l < lanes; l++) d[l] = ~(a[l] & b[l]) & m; break;
+        case BVNEG_NODE:  for (triton::uint32 l = 0; l < lanes; l++) d[l] = (0 - a[l]) & m; break;
+        case BVNOR_NODE:  for (triton::uint32 l = 0; l < lanes; l++) d[l] = ~(a[l] | b[l]) & m; break;
+        case BVNOT_NODE:  for (triton::uint32 l = 0; l < lanes; l++) d[l] = ~a[l] & m; break;
+        case BVOR_NODE:   for (triton::uint32 l = 0; l < lanes; l++) d[l] = a[l] | b[l]; break;
+        case BVSUB_NODE:  for (triton::uint32 l = 0; l < lanes; l++) d[l] = (a[l] - b[l]) & m; break;
+        case BVXNOR_NODE: for (triton::uint32 l = 0; l < lanes; l++) d[l] = ~(a[l] ^ b[l]) & m; break;
+        case BVXOR_NODE:  for (triton::uint32 l = 0; l < lanes; l++) d[l] = a[l] ^ b[l]; break;
+
+        case BVSHL_NODE:  for (triton::uint32 l = 0; l < lanes; l++) d[l] = (b[l] >= size) ? 0 : ((a[l] << b[l]) & m); break;
+        case BVLSHR_NODE: for (triton::uint32 l = 0; l < lanes; l++) d[l] = (b[l] >= size) ? 0 : (a[l] >> b[l]); break;
+
+        case BVASHR_NODE:
+          for (triton::uint32 l = 0; l < lanes; l++) {
+            bool sign = (a[l] >> (size - 1)) & 1;
+            if (b[l] >= size)
+              d[l] = sign ? m : 0;
+            else
+              d[l] = sign ? ((a[l] >> b[l]) | (m & ~(m >> b[l]))) : (a[l] >> b[l]);
+          }
+          break;
+
+        case BVROL_NODE: {
+          triton::uint32 rot = (inst.param % size).convert_to<triton::uint32>();
+          if (rot == 0)
+            for (triton::uint32 l = 0; l < lanes; l++) d[l] = a[l];
+          else
+            for (triton::uint32 l = 0; l < lanes; l++) d[l] = ((a[l] << rot) | (a[l] >> (size - rot))) & m;
+          break;
+        }
+
+        case BVROR_NODE: {
+          triton::uint32 rot = (inst.param % size).convert_to<triton::uint32>();
+          if (rot == 0)
+            for (triton::uint32 l = 0; l < lanes; l++) d[l] = a[l];
+          else
+            for (triton::uint32 l = 0; l < lanes; l++) d[l] = ((a[l] >> rot) | (a[l] << (size - rot))) & m;
+          break;
+        }
+
+        case BVUDIV_NODE: for (triton::uint32 l = 0; l < lanes; l++) d[l] = (b[l] == 0) ? m : (a[l] / b[l]); break;
+        case BVUREM_NODE: for (triton::uint32 l = 0; l < lanes; l++) d[l] = (b[l] == 0) ? a[l] : (a[l] % b[l]); break;
+
+        /* The signed divisions work on the magnitudes, so they never overflow */
+        case BVSDIV_NODE:
+        case BVSREM_NODE:
+        case BVSMOD_NODE:
+          for (triton::uint32 l = 0; l < lanes; l++) {
+            triton::uint64 sa = narrowSignExtend(a[l], size);
+            triton::uint64 sb = narrowSignExtend(b[l], size);
+            bool negA         = (sa >> 63) & 1;
+            bool negB         = (sb >> 63) & 1;
+            triton::uint64 ua = negA ? (0 - sa) : sa;
+            triton::uint64 ub = negB ? (0 - sb) : sb;
+
+            if (inst.kind == BVSDIV_NODE) {
+              if (ub == 0)
+                d[l] = negA ? 1 : m;
+              else
+                d[l] = ((negA != negB) ? (0 - (ua / ub)) : (ua / ub)) & m;
+            }
+            else if (ub == 0) {
+              d[l] = a[l];
+            }
+            else {
+              triton::uint64 rem = negA ? (0 - (ua % ub)) : (ua % ub);
+              if (inst.kind == BVSMOD_NODE && rem != 0 && negA != negB)
+                rem += sb;
+              d[l] = rem & m;
+            }
+          }
+          break;
+
+        /* The signed comparisons flip the sign bits and compare unsigned */
+        case BVSGE_NODE:
+        case BVSGT_NODE:
+        case BVSLE_NODE:
+        case BVSLT_NODE: {
+          triton::uint64 flip = static_cast<triton::uint64>(1) << (ops[0].size - 1);
+          for (triton::uint32 l = 0; l < lanes; l++) {
+            triton::uint64 x = a[l] ^ flip;
+            triton::uint64 y = b[l] ^ flip;
+            switch (inst.kind) {
+              case BVSGE_NODE: d[l] = (x >= y); break;
+              case BVSGT_NODE: d[l] = (x > y); break;
+              case BVSLE_NODE: d[l] = (x <= y); break;
+              default:         d[l] = (x < y); break;
+            }
+          }
+          break;
+        }
+
+        case BVUGE_NODE:    for (triton::uint32 l = 0; l < lanes; l++) d[l] = (a[l] >= b[l]); break;
+        case BVUGT_NODE:    for (triton::uint32 l = 0; l < lanes; l++) d[l] = (a[l] > b[l]); break;
+        case BVULE_NODE:    for (triton::uint32 l = 0; l < lanes; l++) d[l] = (a[l] <= b[l]); break;
+        case BVULT_NODE:    for (triton::uint32 l = 0; l < lanes; l++) d[l] = (a[l] < b[l]); break;
+        case DISTINCT_NODE: for (triton::uint32 l = 0; l < lanes; l++) d[l] = (a[l] != b[l]); break;
+        case EQUAL_NODE:    for (triton::uint32 l = 0; l < lanes; l++) d[l] = (a[l] == b[l]); break;
+
+        case ITE_NODE:      for (triton::uint32 l = 0; l < lanes; l++) d[l] = a[l] ? b[l] : c[l]; break;
+        case LAND_NODE:     for (triton::uint32 l = 0; l < lanes; l++) d[l] = (a[l] && b[l]); break;
+        case LNOT_NODE:     for (triton::uint32 l = 0; l < lanes; l++) d[l] = !a[l]; break;
+        case LOR_NODE:      for (triton::uint32 l = 0; l < lanes; l++) d[l] = (a[l] || b[l]); break;
+
+        case CONCAT_NODE:
+          for (triton::uint32 l = 0; l < lanes; l++) d[l] = a[l];
+          for (triton::uint32 op = 1; op < inst.count; op++) {
+            const triton::uint64* v = narrow + (ops[op].reg * AST_BATCH_LANES);
+            triton::uint32 shift    = ops[op].size;
+            for (triton::uint32 l = 0; l < lanes; l++) d[l] = (d[l] << shift) | v[l];
+          }
+          break;
+
+        case EXTRACT_NODE: {
+          triton::uint32 low = inst.param.convert_to<triton::uint32>();
+          for (triton::uint32 l = 0; l < lanes; l++) d[l] = (a[l] >> low) & m;
+          break;
+        }
+
+        case SX_NODE: {
+          triton::uint32 from = ops[0].size;
+          for (triton::uint32 l = 0; l < lanes; l++) d[l] = narrowSignExtend(a[l], from) & m;
+          break;
+        }
+
+        case ZX_NODE:       for (triton::uint32 l = 0; l < lanes; l++) d[l] = a[l]; break;
+
+        default:
+          throw triton::exceptions::Ast("AstBatchEvaluator::runNarrow(): Invalid kind node.");
+      }
+    }
+
+
+    void AstBatchEvaluator::runWide(const Instruction& inst, triton::uint64* narrow, triton::uint512* wide, triton::uint32 lanes) const {
+      const Operand* ops = this->operands.data() + inst.operand;
+      triton::uint32 size = inst.size;
+      triton::uint512 m   = wideMask(size);
+      triton::uint512 v[3];
+      triton::uint512 r;
+
+      for (triton::uint32 l = 0; l < lanes; l++) {
+        for (triton::uint32 op = 0; op < inst.count && op < 3; op++) {
+          if (ops[op].size > 64)
+            v[op] = wide[ops[op].reg * AST_BATCH_LANES + l];
+          else
+            v[op] = narrow[ops[op].reg * AST_BATCH_LANES + l];
+        }
+
+        switch (inst.kind) {
+          case BV_NODE:     r = inst.param; break;
+          case BVADD_NODE:  r = (v[0] + v[1]) & m; break;
+          case BVAND_NODE:  r = v[0] & v[1]; break;
+          case BVMUL_NODE:  r = (v[0] * v[1]) & m; break;
+          case BVNAND_NODE: r = ~(v[0] & v[1]) & m; break;
+          case BVNEG_NODE:  r = ((~v[0]) + 1) & m; break;
+          case BVNOR_NODE:  r = ~(v[0] | v[1]) & m; break;
+          case BVNOT_NODE:  r = ~v[0] & m; break;
+          case BVOR_NODE:   r = v[0] | v[1]; break;
+          case BVSUB_NODE:  r = (v[0] - v[1]) & m; break;
+          case BVXNOR_NODE: r = ~(v[0] ^ v[1]) & m; break;
+          case BVXOR_NODE:  r = v[0] ^ v[1]; break;
+
+          case BVSHL_NODE:  r = (v[1] >= size) ? 0 : ((v[0] << v[1].convert_to<triton::uint32>()) & m); break;
+          case BVLSHR_NODE: r = (v[1] >= size) ? 0 : (v[0] >> v[1].convert_to<triton::uint32>()); break;
+
+          case BVASHR_NODE: {
+            bool sign = ((v[0] >> (size - 1)) & 1) != 0;
+            if (v[1] >= size)
+              r = sign ? m : 0;
+            else {
+              triton::uint32 shift = v[1].convert_to<triton::uint32>();
+              r = sign ? ((v[0] >> shift) | (m & ~(m >> shift))) : (v[0] >> shift);
+            }
+            break;
+          }
+
+          case BVROL_NODE:
+          case BVROR_NODE: {
+            triton::uint32 rot = (inst.param % size).convert_to<triton::uint32>();
+            if (rot == 0)
+              r = v[0];
+            else if (inst.kind == BVROL_NODE)
+              r = ((v[0] << rot) | (v[0] >> (size - rot))) & m;
+            else
+              r = ((v[0] >> rot) | (v[0] << (size - rot))) & m;
+            break;
+          }
+
+          case BVUDIV_NODE: r = (v[1] == 0) ? m : (v[0] / v[1]); break;
+          case BVUREM_NODE: r = (v[1] == 0) ? v[0] : (v[0] % v[1]); break;
+
+          case BVSDIV_NODE:
+          case BVSREM_NODE:
+          case BVSMOD_NODE: {
+            triton::sint512 sa = wideSignExtend(v[0], size);
+            triton::sint512 sb = wideSignExtend(v[1], size);
+            if (inst.kind == BVSDIV_NODE)
+              r = (sb == 0) ? (sa < 0 ? triton::uint512(1) : m) : wideUnsigned(sa / sb, m);
+            else if (sb == 0)
+              r = v[0];
+            else if (inst.kind == BVSREM_NODE)
+              r = wideUnsigned(sa - ((sa / sb) * sb), m);
+            else
+              r = wideUnsigned(((sa % sb) + sb) % sb, m);
+            break;
+          }
+
+          case BVSGE_NODE:  r = (wideSignExtend(v[0], ops[0].size) >= wideSignExtend(v[1], ops[1].size)); break;
+          case BVSGT_NODE:  r = (wideSignExtend(v[0], ops[0].size) >  wideSignExtend(v[1], ops[1].size)); break;
+          case BVSLE_NODE:  r = (wideSignExtend(v[0], ops[0].size) <= wideSignExtend(v[1], ops[1].size)); break;
+          case BVSLT_NODE:  r = (wideSignExtend(v[0], ops[0].size) <  wideSignExtend(v[1], ops[1].size)); break;
+
+          case BVUGE_NODE:    r = (v[0] >= v[1]); break;
+          case BVUGT_NODE:    r = (v[0] > v[1]); break;
+          case BVULE_NODE:    r = (v[0] <= v[1]); break;
+          case BVULT_NODE:    r = (v[0] < v[1]); break;
+          case DISTINCT_NODE: r = (v[0] != v[1]); break;
+          case EQUAL_NODE:    r = (v[0] == v[1]); break;
+
+          case ITE_NODE:      r = (v[0] != 0) ? v[1] : v[2]; break;
+          case LAND_NODE:     r = (v[0] != 0 && v[1] != 0); break;
+          case LNOT_NODE:     r = (v[0] == 0); break;
+          case LOR_NODE:      r = (v[0] != 0 || v[1] != 0); break;
+
+          case CONCAT_NODE:
+            r = v[0];
+            for (triton::uint32 op = 1; op < inst.count; op++) {
+              triton::uint512 value = (ops[op].size > 64) ? wide[ops[op].reg * AST_BATCH_LANES + l] : triton::uint512(narrow[ops[op].reg * AST_BATCH_LANES + l]);
+              r = (r << ops[op].size) | value;
+            }
+            break;
+
+          case EXTRACT_NODE:  r = (v[0] >> inst.param.convert_to<triton::uint32>()) & m; break;
+          case SX_NODE:       r = (((v[0] >> (ops[0].size - 1)) & 1) ? (v[0] | ~wideMask(ops[0].size)) : v[0]) & m; break;
+          case ZX_NODE:       r = v[0]; break;
+
+          default:
+            throw triton::exceptions::Ast("AstBatchEvaluator::runWide(): Invalid kind node.");
+        }
+
+        if (size > 64)
+          wide[inst.dst * AST_BATCH_LANES + l] = r;
+        else
+          narrow[inst.dst * AST_BATCH_LANES + l] = r.convert_to<triton::uint64>();
+      }
+    }
+
+
+    const std::vector<triton::usize>& AstBatchEvaluator::getVariables(void) const {
+      return this->variables;
+    }
+
+
+    triton::usize AstBatchEvaluator::getNumberOfInstructions(void) const {
+      return this->program.size();
+    }
+
+
+    std::vector<triton::uint512> AstBatchEvaluator::evaluate(const std::map<triton::usize, std::vector<triton::uint512>>& inputs) const {
+      std::vector<const std::vector<triton::uint512>*> columns(this->variables.size(), nullptr);
+      std::vector<std::vector<triton::uint64>> narrowColumns(this->variables.size());
+      std::vector<triton::uint512> defaults(this->variables.size());
+      triton::usize count = inputs.empty() ? 1 : inputs.begin()->second.size();
+
+      for (auto it = inputs.begin(); it != inputs.end(); it++) {
+        if (it->second.size() != count)
+          throw triton::exceptions::Ast("AstBatchEvaluator::evaluate(): All the inputs must have the same number of values.");
+      }
+
+      /* The inputs are masked and the columns of at most 64 bits are converted once */
+      for (triton::usize index = 0; index < this->variables.size(); index++) {
+        triton::uint512 mask = wideMask(this->variableSizes[index]);
+        auto it              = inputs.find(this->variables[index]);
+
+        defaults[index] = triton::getContext().getSymbolicVariableFromId(this->variables[index])->getConcreteValue() & mask;
+        if (it == inputs.end())
+          continue;
+
+        columns[index] = &it->second;
+        if (this->variableSizes[index] <= 64) {
+          narrowColumns[index].resize(count);
+          for (triton::usize lane = 0; lane < count; lane++)
+            narrowColumns[index][lane] = (it->second[lane] & mask).convert_to<triton::uint64>();
+        }
+      }
+
+      std::vector<triton::uint64> narrow(static_cast<triton::usize>(this->narrowRegisters) * AST_BATCH_LANES);
+      std::vector<triton::uint512> wide(static_cast<triton::usize>(this->wideRegisters) * AST_BATCH_LANES);
+      std::vector<triton::uint512> results(count);
+
+      for (triton::usize base = 0; base < count; base += AST_BATCH_LANES) {
+        triton::uint32 lanes = static_cast<triton::uint32>(std::min<triton::usize>(AST_BATCH_LANES, count - base));
+
+        for (const Instruction& inst : this->program) {
+          if (inst.kind == VARIABLE_NODE) {
+            triton::usize index = inst.param.convert_to<triton::usize>();
+            if (inst.size <= 64) {
+              triton::uint64* d = narrow.data() + (inst.dst * AST_BATCH_LANES);
+              if (columns[index] == nullptr) {
+                triton::uint64 value = defaults[index].convert_to<triton::uint64>();
+                for (triton::uint32 l = 0; l < lanes; l++) d[l] = value;
+              }
+              else {
+                const triton::uint64* s = narrowColumns[index].data() + base;
+                for (triton::uint32 l = 0; l < lanes; l++) d[l] = s[l];
+              }
+            }
+            else {
+              triton::uint512 mask = wideMask(inst.size);
+              for (triton::uint32 l = 0; l < lanes; l++)
+                wide[inst.dst * AST_BATCH_LANES + l] = (columns[index] == nullptr) ? defaults[index] : ((*columns[index])[base + l] & mask);
+            }
+          }
+          else if (inst.wide) {
+            this->runWide(inst, narrow.data(), wide.data(), lanes);
+          }
+          else {
+            this->runNarrow(inst, narrow.data(), lanes);
+          }
+        }
+
+        for (triton::uint32 l = 0; l < lanes; l++) {
+          if (this->result.size > 64)
+            results[base + l] = wide[this->result.reg * AST_BATCH_LANES + l];
+          else
+            results[base + l] = narrow[this->result.reg * AST_BATCH_LANES + l];
+        }
+      }
+
+      return results;
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
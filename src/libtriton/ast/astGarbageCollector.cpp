@@ -5,6 +5,8 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <vector>
+
 #include <api.hpp>
 #include <astGarbageCollector.hpp>
 
@@ -22,23 +24,34 @@ namespace triton {
     }
 
 
+    void* AstGarbageCollector::allocateAstNode(triton::usize size) {
+      return this->arena.allocate(size);
+    }
+
+
+    void AstGarbageCollector::deallocateAstNode(void* node) {
+      this->arena.deallocate(node);
+    }
+
+
     void AstGarbageCollector::freeAllAstNodes(void) {
-      std::set<triton::ast::AbstractNode*>::iterator it;
+      std::vector<void*> nodes;
 
-      for (it = this->allocatedNodes.begin(); it != this->allocatedNodes.end(); it++)
-        delete *it;
+      this->arena.getLiveObjects(nodes, true);
+      for (auto it = nodes.begin(); it != nodes.end(); it++)
+        delete static_cast<triton::ast::AbstractNode*>(*it);
+
+      /* Nodes which are not recorded (dictionaries) are still alive */
+      if (this->arena.getNumberOfLiveObjects() == 0)
+        this->arena.release();
 
       this->variableNodes.clear();
-      this->allocatedNodes.clear();
     }
 
 
     void AstGarbageCollector::freeAstNodes(std::set<triton::ast::AbstractNode*>& nodes) {
       std::set<triton::ast::AbstractNode*>::iterator it;
       for (it = nodes.begin(); it != nodes.end(); it++) {
-        /* Remove the node from the global set */
-        this->allocatedNodes.erase(*it);
-
         /* Remove the node from the global variables map */
         if ((*it)->getKind() == triton::ast::VARIABLE_NODE)
           this->variableNodes.erase(reinterpret_cast<triton::ast::VariableNode*>(*it)->getValue());
@@ -60,14 +73,14 @@ namespace triton {
 
     triton::ast::AbstractNode* AstGarbageCollector::recordAstNode(triton::ast::AbstractNode* node) {
       /* Check if the AST_DICTIONARIES is enabled. */
-      if (triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::AST_DICTIONARIES)) {
-        triton::ast::AbstractNode* ret = triton::api.browseAstDictionaries(node);
+      if (triton::getContext().isSymbolicOptimizationEnabled(triton::engines::symbolic::AST_DICTIONARIES)) {
+        triton::ast::AbstractNode* ret = triton::getContext().browseAstDictionaries(node);
         if (ret != nullptr)
           return ret;
       }
       else {
         /* Record the node */
-        this->allocatedNodes.insert(node);
+        this->arena.setRecorded(node, true);
       }
       return node;
     }
@@ -78,8 +91,20 @@ namespace triton {
     }
 
 
-    const std::set<triton::ast::AbstractNode*>& AstGarbageCollector::getAllocatedAstNodes(void) const {
-      return this->allocatedNodes;
+    std::set<triton::ast::AbstractNode*> AstGarbageCollector::getAllocatedAstNodes(void) const {
+      std::set<triton::ast::AbstractNode*> ret;
+      std::vector<void*> nodes;
+
+      this->arena.getLiveObjects(nodes, true);
+      for (auto it = nodes.begin(); it != nodes.end(); it++)
+        ret.insert(static_cast<triton::ast::AbstractNode*>(*it));
+
+      return ret;
+    }
+
+
+    std::map<std::string, triton::usize> AstGarbageCollector::getAstArenaStats(void) const {
+      return this->arena.getStats();
     }
 
 
@@ -96,12 +121,18 @@ namespace triton {
 
 
     void AstGarbageCollector::setAllocatedAstNodes(const std::set<triton::ast::AbstractNode*>& nodes) {
+      std::vector<void*> allocated;
+
       /* Remove unused nodes before the assignation */
-      for (std::set<triton::ast::AbstractNode*>::iterator it = this->allocatedNodes.begin(); it != this->allocatedNodes.end(); it++) {
-        if (nodes.find(*it) == nodes.end())
-          delete *it;
+      this->arena.getLiveObjects(allocated, true);
+      for (auto it = allocated.begin(); it != allocated.end(); it++) {
+        triton::ast::AbstractNode* node = static_cast<triton::ast::AbstractNode*>(*it);
+        if (nodes.find(node) == nodes.end())
+          delete node;
       }
-      this->allocatedNodes = nodes;
+
+      for (auto it = nodes.begin(); it != nodes.end(); it++)
+        this->arena.setRecorded(*it, true);
     }
 
 
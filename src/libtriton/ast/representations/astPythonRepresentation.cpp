@@ -361,7 +361,7 @@ namespace triton {
       std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::ExtractNode* node) {
         triton::uint64 low = reinterpret_cast<triton::ast::DecimalNode*>(node->getChilds()[1])->getValue().convert_to<triton::uint64>();
 
-        if (node->getBitvectorSize() == triton::api.cpuRegisterBitSize())
+        if (node->getBitvectorSize() == triton::getContext().cpuRegisterBitSize())
           stream << node->getChilds()[2];
         else if (low == 0)
           stream << "(" << node->getChilds()[2] << " & " << std::hex << "0x" << node->getBitvectorMask() << std::dec << ")";
@@ -0,0 +1,303 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <sstream>
+#include <utility>
+
+#include <api.hpp>
+#include <astPythonWriter.hpp>
+#include <exceptions.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+    namespace representations {
+
+      /* Returns the hexadecimal representation of a value */
+      static std::string toHex(triton::uint512 value) {
+        std::ostringstream stream;
+        stream << std::hex << "0x" << value;
+        return stream.str();
+      }
+
+
+      AstPythonWriter::AstPythonWriter(std::ostream& stream) : stream(stream) {
+      }
+
+
+      AstPythonWriter::~AstPythonWriter() {
+      }
+
+
+      void AstPythonWriter::analyze(triton::ast::AbstractNode* node) {
+        std::vector<triton::ast::AbstractNode*> worklist;
+
+        this->uses[node] = 0;
+        worklist.push_back(node);
+
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back();
+          worklist.pop_back();
+
+          /* The AST of a referenced expression is used once by its assignment */
+          if (current->getKind() == triton::ast::REFERENCE_NODE) {
+            triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(current)->getValue();
+            if (this->references.find(id) == this->references.end()) {
+              triton::ast::AbstractNode* target = triton::getContext().getSymbolicExpressionFromId(id)->getAst();
+              this->references[id] = target;
+              if (this->uses.find(target) == this->uses.end()) {
+                this->uses[target] = 1;
+                worklist.push_back(target);
+              }
+              else
+                this->uses[target]++;
+            }
+            continue;
+          }
+
+          for (triton::ast::AbstractNode* child : current->getChilds()) {
+            auto it = this->uses.find(child);
+            if (it == this->uses.end()) {
+              this->uses[child] = 1;
+              worklist.push_back(child);
+            }
+            else
+              it->second++;
+          }
+        }
+      }
+
+
+      bool AstPythonWriter::isShareable(triton::ast::AbstractNode* node) const {
+        switch (node->getKind()) {
+          case triton::ast::ASSERT_NODE:
+          case triton::ast::BVDECL_NODE:
+          case triton::ast::BV_NODE:
+          case triton::ast::COMPOUND_NODE:
+          case triton::ast::DECIMAL_NODE:
+          case triton::ast::DECLARE_FUNCTION_NODE:
+          case triton::ast::LET_NODE:
+          case triton::ast::REFERENCE_NODE:
+          case triton::ast::STRING_NODE:
+          case triton::ast::VARIABLE_NODE:
+          case triton::ast::ZX_NODE:
+            return false;
+          default:
+            break;
+        }
+
+        auto it = this->uses.find(node);
+        return (it != this->uses.end() && it->second >= 2);
+      }
+
+
+      void AstPythonWriter::getLayout(triton::ast::AbstractNode* node, Layout& layout) const {
+        std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+        std::string masked = ") & " + toHex(node->getBitvectorMask()) + ")";
+
+        layout.order.clear();
+        layout.tokens.clear();
+
+        /* Same syntax as AstPythonRepresentation */
+        switch (node->getKind()) {
+          case triton::ast::ASSERT_NODE:    layout.order = {0};     layout.tokens = {"assert(", ")"}; break;
+          case triton::ast::BVADD_NODE:     layout.order = {0, 1};  layout.tokens = {"((", " + ", masked}; break;
+          case triton::ast::BVAND_NODE:     layout.order = {0, 1};  layout.tokens = {"(", " & ", ")"}; break;
+          case triton::ast::BVASHR_NODE:    layout.order = {0, 1};  layout.tokens = {"(", " >> ", ")"}; break;
+          case triton::ast::BVDECL_NODE:    layout.order = {0};     layout.tokens = {"bvdecl(", ")"}; break;
+          case triton::ast::BVLSHR_NODE:    layout.order = {0, 1};  layout.tokens = {"(", " >> ", ")"}; break;
+          case triton::ast::BVMUL_NODE:     layout.order = {0, 1};  layout.tokens = {"((", " * ", masked}; break;
+          case triton::ast::BVNAND_NODE:    layout.order = {0, 1};  layout.tokens = {"~(", " & ", ")"}; break;
+          case triton::ast::BVNEG_NODE:     layout.order = {0};     layout.tokens = {"-", ""}; break;
+          case triton::ast::BVNOR_NODE:     layout.order = {0, 1};  layout.tokens = {"~(", " | ", ")"}; break;
+          case triton::ast::BVNOT_NODE:     layout.order = {0};     layout.tokens = {"~", ""}; break;
+          case triton::ast::BVOR_NODE:      layout.order = {0, 1};  layout.tokens = {"(", " | ", ")"}; break;
+          case triton::ast::BVROL_NODE:     layout.order = {0, 1};  layout.tokens = {"rol(", ", ", ")"}; break;
+          case triton::ast::BVROR_NODE:     layout.order = {0, 1};  layout.tokens = {"ror(", ", ", ")"}; break;
+          case triton::ast::BVSDIV_NODE:    layout.order = {0, 1};  layout.tokens = {"(", " / ", ")"}; break;
+          case triton::ast::BVSGE_NODE:     layout.order = {0, 1};  layout.tokens = {"(", " >= ", ")"}; break;
+          case triton::ast::BVSGT_NODE:     layout.order = {0, 1};  layout.tokens = {"(", " > ", ")"}; break;
+          case triton::ast::BVSHL_NODE:     layout.order = {0, 1};  layout.tokens = {"((", " << ", masked}; break;
+          case triton::ast::BVSLE_NODE:     layout.order = {0, 1};  layout.tokens = {"(", " <= ", ")"}; break;
+          case triton::ast::BVSLT_NODE:     layout.order = {0, 1};  layout.tokens = {"(", " < ", ")"}; break;
+          case triton::ast::BVSMOD_NODE:    layout.order = {0, 1};  layout.tokens = {"(", " % ", ")"}; break;
+          case triton::ast::BVSREM_NODE:    layout.order = {0, 1};  layout.tokens = {"(", " % ", ")"}; break;
+          case triton::ast::BVSUB_NODE:     layout.order = {0, 1};  layout.tokens = {"((", " - ", masked}; break;
+          case triton::ast::BVUDIV_NODE:    layout.order = {0, 1};  layout.tokens = {"(", " / ", ")"}; break;
+          case triton::ast::BVUGE_NODE:     layout.order = {0, 1};  layout.tokens = {"(", " >= ", ")"}; break;
+          case triton::ast::BVUGT_NODE:     layout.order = {0, 1};  layout.tokens = {"(", " > ", ")"}; break;
+          case triton::ast::BVULE_NODE:     layout.order = {0, 1};  layout.tokens = {"(", " <= ", ")"}; break;
+          case triton::ast::BVULT_NODE:     layout.order = {0, 1};  layout.tokens = {"(", " < ", ")"}; break;
+          case triton::ast::BVUREM_NODE:    layout.order = {0, 1};  layout.tokens = {"(", " % ", ")"}; break;
+          case triton::ast::BVXNOR_NODE:    layout.order = {0, 1};  layout.tokens = {"~(", " ^ ", ")"}; break;
+          case triton::ast::BVXOR_NODE:     layout.order = {0, 1};  layout.tokens = {"(", " ^ ", ")"}; break;
+          case triton::ast::DISTINCT_NODE:  layout.order = {0, 1};  layout.tokens = {"(", " != ", ")"}; break;
+          case triton::ast::EQUAL_NODE:     layout.order = {0, 1};  layout.tokens = {"(", " == ", ")"}; break;
+          case triton::ast::ITE_NODE:       layout.order = {1, 0, 2}; layout.tokens = {"(", " if ", " else ", ")"}; break;
+          case triton::ast::LAND_NODE:      layout.order = {0, 1};  layout.tokens = {"(", " and ", ")"}; break;
+          case triton::ast::LNOT_NODE:      layout.order = {0};     layout.tokens = {"not ", ""}; break;
+          case triton::ast::LOR_NODE:       layout.order = {0, 1};  layout.tokens = {"(", " or ", ")"}; break;
+          case triton::ast::DECLARE_FUNCTION_NODE: layout.order = {0}; layout.tokens = {"", ""}; break;
+          case triton::ast::LET_NODE:       layout.order = {2};     layout.tokens = {"", ""}; break;
+          case triton::ast::ZX_NODE:        layout.order = {1};     layout.tokens = {"", ""}; break;
+
+          /* Leaves */
+          case triton::ast::BV_NODE:        layout.tokens = {toHex(reinterpret_cast<triton::ast::DecimalNode*>(childs[0])->getValue())}; break;
+          case triton::ast::DECIMAL_NODE:   layout.tokens = {toHex(reinterpret_cast<triton::ast::DecimalNode*>(node)->getValue())}; break;
+          case triton::ast::STRING_NODE:    layout.tokens = {reinterpret_cast<triton::ast::StringNode*>(node)->getValue()}; break;
+          case triton::ast::VARIABLE_NODE:  layout.tokens = {reinterpret_cast<triton::ast::VariableNode*>(node)->getValue()}; break;
+          case triton::ast::REFERENCE_NODE: layout.tokens = {"ref_" + std::to_string(reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue())}; break;
+
+          case triton::ast::COMPOUND_NODE:
+            layout.tokens.push_back("");
+            for (triton::usize index = 0; index < childs.size(); index++) {
+              layout.order.push_back(index);
+              layout.tokens.push_back("\n");
+            }
+            break;
+
+          case triton::ast::CONCAT_NODE:
+            layout.tokens.push_back(std::string(childs.size(), '('));
+            for (triton::usize index = 0; index < childs.size(); index++) {
+              layout.order.push_back(index);
+              if (index + 1 < childs.size())
+                layout.tokens.push_back(") << " + std::to_string(childs[index+1]->getBitvectorSize()) + " | ");
+            }
+            layout.tokens.push_back(")");
+            break;
+
+          case triton::ast::EXTRACT_NODE: {
+            triton::uint64 low = reinterpret_cast<triton::ast::DecimalNode*>(childs[1])->getValue().convert_to<triton::uint64>();
+            layout.order = {2};
+            if (node->getBitvectorSize() == triton::getContext().cpuRegisterBitSize())
+              layout.tokens = {"", ""};
+            else if (low == 0)
+              layout.tokens = {"(", " & " + toHex(node->getBitvectorMask()) + ")"};
+            else
+              layout.tokens = {"((", " >> " + std::to_string(low) + ") & " + toHex(node->getBitvectorMask()) + ")"};
+            break;
+          }
+
+          case triton::ast::SX_NODE:
+            if (reinterpret_cast<triton::ast::DecimalNode*>(childs[0])->getValue()) {
+              layout.order  = {0, 1};
+              layout.tokens = {"sx(", ", ", ")"};
+            }
+            else {
+              layout.order  = {1};
+              layout.tokens = {"", ""};
+            }
+            break;
+
+          default:
+            throw triton::exceptions::AstRepresentation("AstPythonWriter::getLayout(): Invalid kind node.");
+        }
+      }
+
+
+      void AstPythonWriter::writeTemporaries(triton::ast::AbstractNode* node) {
+        std::vector<std::pair<triton::ast::AbstractNode*, bool>> worklist;
+
+        /* Post-order walk, a temporary is assigned after the temporaries it uses */
+        worklist.push_back(std::make_pair(node, false));
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back().first;
+          bool expanded                      = worklist.back().second;
+
+          if (current->getKind() == triton::ast::REFERENCE_NODE || this->defined.find(current) != this->defined.end()) {
+            worklist.pop_back();
+            continue;
+          }
+
+          if (!expanded) {
+            std::vector<triton::ast::AbstractNode*>& childs = current->getChilds();
+            worklist.back().second = true;
+            for (auto it = childs.rbegin(); it != childs.rend(); it++)
+              worklist.push_back(std::make_pair(*it, false));
+            continue;
+          }
+
+          worklist.pop_back();
+          if (!this->isShareable(current))
+            continue;
+
+          triton::usize id = this->defined.size();
+          this->stream << "t" << id << " = ";
+          this->writeTerm(current);
+          this->stream << "\n";
+          this->defined[current] = id;
+        }
+      }
+
+
+      void AstPythonWriter::writeTerm(triton::ast::AbstractNode* node) {
+        std::vector<std::pair<triton::ast::AbstractNode*, triton::usize>> worklist;
+        std::vector<Layout> layouts;
+
+        worklist.push_back(std::make_pair(node, 0));
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back().first;
+          triton::usize position             = worklist.back().second;
+
+          if (position == 0) {
+            auto it = this->defined.find(current);
+            if (it != this->defined.end()) {
+              this->stream << "t" << it->second;
+              worklist.pop_back();
+              continue;
+            }
+            /* The layouts are kept on a stack parallel to the worklist */
+            if (layouts.size() < worklist.size())
+              layouts.resize(worklist.size());
+            this->getLayout(current, layouts[worklist.size() - 1]);
+          }
+
+          Layout& layout = layouts[worklist.size() - 1];
+          this->stream << layout.tokens[position];
+
+          if (position == layout.order.size()) {
+            worklist.pop_back();
+            continue;
+          }
+
+          worklist.back().second++;
+          worklist.push_back(std::make_pair(current->getChilds()[layout.order[position]], 0));
+        }
+      }
+
+
+      void AstPythonWriter::write(triton::ast::AbstractNode* node) {
+        if (node == nullptr)
+          throw triton::exceptions::AstRepresentation("AstPythonWriter::write(): node cannot be null.");
+
+        this->uses.clear();
+        this->defined.clear();
+        this->references.clear();
+
+        this->analyze(node);
+
+        /* First, assign the symbolic expressions referenced. An expression only references older ones */
+        for (auto it = this->references.begin(); it != this->references.end(); it++) {
+          this->writeTemporaries(it->second);
+          this->stream << "ref_" << it->first << " = ";
+          this->writeTerm(it->second);
+          this->stream << "\n";
+        }
+
+        /* And write the expression of the node */
+        this->writeTemporaries(node);
+        this->writeTerm(node);
+        this->stream << "\n";
+
+        if (!this->stream)
+          throw triton::exceptions::AstRepresentation("AstPythonWriter::write(): Cannot write the code.");
+      }
+
+    }; /* representations namespace */
+  }; /* ast namespace */
+}; /* triton namespace */
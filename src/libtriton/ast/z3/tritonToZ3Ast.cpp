@@ -23,22 +23,99 @@ namespace triton {
 
 
     TritonToZ3Ast::~TritonToZ3Ast() {
+      /* The translated expressions must be released before the result, which may hold the last reference on the context */
+      this->translated.clear();
     }
 
 
     Z3Result& TritonToZ3Ast::eval(triton::ast::AbstractNode& e) {
-      e.accept(*this);
+      std::vector<std::pair<triton::ast::AbstractNode*, triton::uint32>> worklist;
+      auto it = this->translated.find(&e);
+
+      /* Shared subterms are translated only once */
+      if (it != this->translated.end()) {
+        this->result.setExpr(it->second);
+        return this->result;
+      }
+
+      /* Under a let binding, the translation of a node depends on its symbols */
+      if (!this->symbols.empty()) {
+        e.accept(*this);
+        return this->result;
+      }
+
+      /*
+       * Post-order traversal with an explicit worklist. When a node is
+       * visited, all its operands are already into the memo, so the
+       * visitor methods do not recurse.
+       */
+      worklist.push_back(std::make_pair(&e, 0));
+      while (!worklist.empty()) {
+        triton::ast::AbstractNode* node    = worklist.back().first;
+        triton::ast::AbstractNode* operand = this->getOperand(node, worklist.back().second++);
+
+        if (operand != nullptr) {
+          if (this->translated.find(operand) == this->translated.end())
+            worklist.push_back(std::make_pair(operand, 0));
+          continue;
+        }
+
+        worklist.pop_back();
+        if (this->translated.find(node) == this->translated.end()) {
+          node->accept(*this);
+          this->translated.insert(std::make_pair(node, this->result.getExpr()));
+        }
+      }
+
+      this->result.setExpr(this->translated.at(&e));
       return this->result;
     }
 
 
+    z3::context& TritonToZ3Ast::getContext(void) {
+      return this->result.getContext();
+    }
+
+
+    void TritonToZ3Ast::removeTranslatedNodes(const std::set<triton::ast::AbstractNode*>& nodes) {
+      for (auto it = nodes.begin(); it != nodes.end(); it++)
+        this->translated.erase(*it);
+    }
+
+
+    void TritonToZ3Ast::clearTranslatedNodes(void) {
+      this->translated.clear();
+    }
+
+
+    triton::ast::AbstractNode* TritonToZ3Ast::getOperand(triton::ast::AbstractNode* node, triton::uint32 index) const {
+      switch (node->getKind()) {
+        /* The operand of a reference is the AST of the referenced expression */
+        case triton::ast::REFERENCE_NODE: {
+          if (index != 0)
+            return nullptr;
+          triton::engines::symbolic::SymbolicExpression* refNode = triton::getContext().getSymbolicExpressionFromId(reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue());
+          return (refNode != nullptr) ? refNode->getAst() : nullptr;
+        }
+
+        /* The operands of a let depend on its binding, they are translated by the let itself */
+        case triton::ast::LET_NODE:
+          return nullptr;
+
+        default:
+          return (index < node->getChilds().size()) ? node->getChilds()[index] : nullptr;
+      }
+    }
+
+
     void TritonToZ3Ast::operator()(triton::ast::AbstractNode& e) {
       e.accept(*this);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::AssertNode& e) {
-      throw triton::exceptions::AstTranslations("TritonToZ3Ast::AssertNode(): Not implemented.");
+      Z3Result op1 = this->eval(*e.getChilds()[0]);
+      this->result.setExpr(op1.getExpr());
     }
 
 
@@ -405,10 +482,14 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::LetNode& e) {
-      std::string symbol    = reinterpret_cast<triton::ast::StringNode*>(e.getChilds()[0])->getValue();
+      std::string symbol                            = reinterpret_cast<triton::ast::StringNode*>(e.getChilds()[0])->getValue();
+      std::map<std::string, AbstractNode*> previous = this->symbols;
+
       this->symbols[symbol] = e.getChilds()[1];
       Z3Result op2          = this->eval(*e.getChilds()[2]);
 
+      /* The binding is only visible into the let's body */
+      this->symbols = previous;
       this->result.setExpr(op2.getExpr());
     }
 
@@ -432,7 +513,7 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::ReferenceNode& e) {
-      triton::engines::symbolic::SymbolicExpression* refNode = triton::api.getSymbolicExpressionFromId(e.getValue());
+      triton::engines::symbolic::SymbolicExpression* refNode = triton::getContext().getSymbolicExpressionFromId(e.getValue());
       if (refNode == nullptr)
         throw triton::exceptions::AstTranslations("TritonToZ3Ast::ReferenceNode(): Reference node not found.");
       Z3Result op1 = this->eval(*(refNode->getAst()));
@@ -460,16 +541,16 @@ namespace triton {
 
     void TritonToZ3Ast::operator()(triton::ast::VariableNode& e) {
       std::string varName = e.getValue();
-      triton::engines::symbolic::SymbolicVariable* symVar = triton::api.getSymbolicVariableFromName(varName);
+      triton::engines::symbolic::SymbolicVariable* symVar = triton::getContext().getSymbolicVariableFromName(varName);
 
       if (symVar == nullptr)
         throw triton::exceptions::AstTranslations("TritonToZ3Ast::VariableNode(): Can't get the symbolic variable (nullptr).");
 
-      if (symVar->getSize() > QWORD_SIZE_BIT)
-        throw triton::exceptions::AstTranslations("TritonToZ3Ast::VariableNode(): Size above 64 bits is not supported yet.");
-
       /* If the conversion is used to evaluate a node, we concretize symbolic variables */
       if (this->isEval) {
+        if (symVar->getSize() > QWORD_SIZE_BIT)
+          throw triton::exceptions::AstTranslations("TritonToZ3Ast::VariableNode(): Size above 64 bits is not supported yet.");
+
         if (symVar->getKind() == triton::engines::symbolic::MEM) {
           triton::uint32 memSize   = symVar->getSize();
           triton::uint512 memValue = symVar->getConcreteValue();
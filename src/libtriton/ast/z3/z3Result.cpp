@@ -14,7 +14,7 @@ namespace triton {
   namespace ast {
 
     Z3Result::Z3Result()
-      : context(), expr(this->context) {
+      : context(std::make_shared<z3::context>()), expr(*this->context) {
     }
 
 
@@ -23,7 +23,7 @@ namespace triton {
 
 
     Z3Result::Z3Result(const Z3Result& copy)
-      : expr(copy.expr) {
+      : context(copy.context), expr(copy.expr) {
     }
 
 
@@ -44,7 +44,7 @@ namespace triton {
 
     std::string Z3Result::getStringValue() const {
       z3::expr sExpr = this->expr.simplify();
-      return Z3_get_numeral_string(this->context, sExpr);
+      return Z3_get_numeral_string(*this->context, sExpr);
     }
 
 
@@ -55,10 +55,10 @@ namespace triton {
         throw triton::exceptions::Exception("Z3Result::getUintValue(): The ast is not a numerical value.");
 
       #if defined(__x86_64__) || defined(_M_X64)
-      Z3_get_numeral_uint64(this->context, this->expr, &result);
+      Z3_get_numeral_uint64(*this->context, this->expr, &result);
       #endif
       #if defined(__i386) || defined(_M_IX86)
-      Z3_get_numeral_uint(this->context, this->expr, &result);
+      Z3_get_numeral_uint(*this->context, this->expr, &result);
       #endif
 
       return result;
@@ -66,7 +66,7 @@ namespace triton {
 
 
     z3::context& Z3Result::getContext(void) {
-      return this->context;
+      return *this->context;
     }
 
 
@@ -6,6 +6,7 @@
 */
 
 #include <list>
+#include <vector>
 
 #include <api.hpp>
 #include <exceptions.hpp>
@@ -43,7 +44,49 @@ namespace triton {
 
 
     AbstractNode* Z3ToTritonAst::convert(void) {
-      return this->visit(this->expr);
+      std::vector<std::pair<z3::expr, bool>> worklist;
+
+      /* Ids may be recycled by z3 between two conversions */
+      this->converted.clear();
+
+      /*
+       * Post-order traversal with an explicit worklist. Each z3's AST is
+       * converted once (shared subterms included) and after all its arguments.
+       */
+      worklist.push_back(std::make_pair(this->expr, false));
+      while (!worklist.empty()) {
+        z3::expr current  = worklist.back().first;
+        triton::uint32 id = Z3_get_ast_id(current.ctx(), current);
+
+        if (this->converted.find(id) != this->converted.end()) {
+          worklist.pop_back();
+          continue;
+        }
+
+        if (!worklist.back().second) {
+          worklist.back().second = true;
+          if (current.is_app()) {
+            for (triton::uint32 i = current.num_args(); i > 0; i--)
+              worklist.push_back(std::make_pair(current.arg(i - 1), false));
+          }
+          continue;
+        }
+
+        worklist.pop_back();
+        this->converted[id] = this->visit(current);
+      }
+
+      return this->getConverted(this->expr);
+    }
+
+
+    AbstractNode* Z3ToTritonAst::getConverted(z3::expr const& expr) {
+      auto it = this->converted.find(Z3_get_ast_id(expr.ctx(), expr));
+
+      if (it == this->converted.end())
+        throw triton::exceptions::AstTranslations("Z3ToTritonAst::getConverted(): The z3's AST has not been converted yet.");
+
+      return it->second;
     }
 
 
@@ -66,41 +109,41 @@ namespace triton {
         case Z3_OP_EQ: {
           if (expr.num_args() != 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_EQ must conatin two arguments.");
-          node = triton::ast::equal(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::equal(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           break;
         }
 
         case Z3_OP_DISTINCT: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_DISTINCT must conatin at least two arguments.");
-          node = triton::ast::distinct(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::distinct(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::distinct(node, this->visit(expr.arg(i)));
+            node = triton::ast::distinct(node, this->getConverted(expr.arg(i)));
           break;
         }
 
         case Z3_OP_ITE: {
           if (expr.num_args() != 3)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_ITE must conatin three arguments.");
-          node = triton::ast::ite(this->visit(expr.arg(0)), this->visit(expr.arg(1)), this->visit(expr.arg(2)));
+          node = triton::ast::ite(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)), this->getConverted(expr.arg(2)));
           break;
         }
 
         case Z3_OP_AND: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_AND must conatin at least two arguments.");
-          node = triton::ast::land(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::land(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::land(node, this->visit(expr.arg(i)));
+            node = triton::ast::land(node, this->getConverted(expr.arg(i)));
           break;
         }
 
         case Z3_OP_OR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_OR must conatin at least two arguments.");
-          node = triton::ast::lor(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::lor(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::lor(node, this->visit(expr.arg(i)));
+            node = triton::ast::lor(node, this->getConverted(expr.arg(i)));
           break;
         }
 
@@ -108,12 +151,12 @@ namespace triton {
         case Z3_OP_NOT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_NOT must conatin at one argument.");
-          node = triton::ast::lnot(this->visit(expr.arg(0)));
+          node = triton::ast::lnot(this->getConverted(expr.arg(0)));
           break;
         }
 
         case Z3_OP_BNUM: {
-          std::string stringValue = Z3_get_numeral_string(this->context, expr);
+          std::string stringValue = Z3_get_numeral_string(expr.ctx(), expr);
           triton::uint512 intValue{stringValue};
           node = triton::ast::bv(intValue, expr.get_sort().bv_size());
           break;
@@ -122,212 +165,212 @@ namespace triton {
         case Z3_OP_BNEG: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BNEG must conatin one argument.");
-          node = triton::ast::bvneg(this->visit(expr.arg(0)));
+          node = triton::ast::bvneg(this->getConverted(expr.arg(0)));
           break;
         }
 
         case Z3_OP_BADD: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BADD must conatin at least two arguments.");
-          node = triton::ast::bvadd(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvadd(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvadd(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvadd(node, this->getConverted(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BSUB: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BSUB must conatin at least two arguments.");
-          node = triton::ast::bvsub(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvsub(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvsub(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvsub(node, this->getConverted(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BMUL: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BMUL must conatin at least two arguments.");
-          node = triton::ast::bvmul(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvmul(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvmul(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvmul(node, this->getConverted(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BSDIV: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BSDIV must conatin at least two arguments.");
-          node = triton::ast::bvsdiv(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvsdiv(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvsdiv(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvsdiv(node, this->getConverted(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BUDIV: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BUDIV must conatin at least two arguments.");
-          node = triton::ast::bvudiv(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvudiv(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvudiv(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvudiv(node, this->getConverted(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BSREM: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BSREM must conatin at least two arguments.");
-          node = triton::ast::bvsrem(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvsrem(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvsrem(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvsrem(node, this->getConverted(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BUREM: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BUREM must conatin at least two arguments.");
-          node = triton::ast::bvurem(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvurem(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvurem(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvurem(node, this->getConverted(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BSMOD: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BSMOD must conatin at least two arguments.");
-          node = triton::ast::bvsmod(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvsmod(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvsmod(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvsmod(node, this->getConverted(expr.arg(i)));
           break;
         }
 
         case Z3_OP_ULEQ: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_ULEQ must conatin at least two arguments.");
-          node = triton::ast::bvule(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvule(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvule(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvule(node, this->getConverted(expr.arg(i)));
           break;
         }
 
         case Z3_OP_SLEQ: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_SLEQ must conatin at least two arguments.");
-          node = triton::ast::bvsle(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvsle(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvsle(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvsle(node, this->getConverted(expr.arg(i)));
           break;
         }
 
         case Z3_OP_UGEQ: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_UGEQ must conatin at least two arguments.");
-          node = triton::ast::bvuge(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvuge(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvuge(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvuge(node, this->getConverted(expr.arg(i)));
           break;
         }
 
         case Z3_OP_SGEQ: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_SGEQ must conatin at least two arguments.");
-          node = triton::ast::bvsge(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvsge(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvsge(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvsge(node, this->getConverted(expr.arg(i)));
           break;
         }
 
         case Z3_OP_ULT: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_ULT must conatin at least two arguments.");
-          node = triton::ast::bvult(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvult(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvult(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvult(node, this->getConverted(expr.arg(i)));
           break;
         }
 
         case Z3_OP_SLT: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_SLT must conatin at least two arguments.");
-          node = triton::ast::bvslt(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvslt(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvslt(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvslt(node, this->getConverted(expr.arg(i)));
           break;
         }
 
         case Z3_OP_UGT: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_UGT must conatin at least two arguments.");
-          node = triton::ast::bvugt(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvugt(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvugt(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvugt(node, this->getConverted(expr.arg(i)));
           break;
         }
 
         case Z3_OP_SGT: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_SGT must conatin at least two arguments.");
-          node = triton::ast::bvsgt(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvsgt(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvsgt(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvsgt(node, this->getConverted(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BAND: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BAND must conatin at least two arguments.");
-          node = triton::ast::bvand(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvand(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvand(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvand(node, this->getConverted(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BOR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BOR must conatin at least two arguments.");
-          node = triton::ast::bvor(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvor(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvor(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvor(node, this->getConverted(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BNOT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BNOT must conatin one argument.");
-          node = triton::ast::bvnot(this->visit(expr.arg(0)));
+          node = triton::ast::bvnot(this->getConverted(expr.arg(0)));
           break;
         }
 
         case Z3_OP_BXOR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BXOR must conatin at least two arguments.");
-          node = triton::ast::bvxor(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvxor(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvxor(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvxor(node, this->getConverted(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BNAND: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BNAND must conatin at least two arguments.");
-          node = triton::ast::bvnand(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvnand(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvnand(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvnand(node, this->getConverted(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BNOR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BNOR must conatin at least two arguments.");
-          node = triton::ast::bvnor(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvnor(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvnor(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvnor(node, this->getConverted(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BXNOR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BXNOR must conatin at least two arguments.");
-          node = triton::ast::bvxnor(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvxnor(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvxnor(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvxnor(node, this->getConverted(expr.arg(i)));
           break;
         }
 
@@ -337,7 +380,7 @@ namespace triton {
 
           std::list<AbstractNode*> args;
           for (triton::uint32 i = 0; i < expr.num_args(); i++) {
-            args.push_back(this->visit(expr.arg(i)));
+            args.push_back(this->getConverted(expr.arg(i)));
           }
 
           node = triton::ast::concat(args);
@@ -347,69 +390,69 @@ namespace triton {
         case Z3_OP_SIGN_EXT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_SIGN_EXT must conatin one argument.");
-          node = triton::ast::sx(expr.hi(), this->visit(expr.arg(0)));
+          node = triton::ast::sx(expr.hi(), this->getConverted(expr.arg(0)));
           break;
         }
 
         case Z3_OP_ZERO_EXT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_ZERO_EXT must conatin one argument.");
-          node = triton::ast::zx(expr.hi(), this->visit(expr.arg(0)));
+          node = triton::ast::zx(expr.hi(), this->getConverted(expr.arg(0)));
           break;
         }
 
         case Z3_OP_EXTRACT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_EXTRACT must conatin one argument.");
-          node = triton::ast::extract(expr.hi(), expr.lo(), this->visit(expr.arg(0)));
+          node = triton::ast::extract(expr.hi(), expr.lo(), this->getConverted(expr.arg(0)));
           break;
         }
 
         case Z3_OP_BSHL: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BSHL must conatin at least two arguments.");
-          node = triton::ast::bvshl(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvshl(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvshl(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvshl(node, this->getConverted(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BLSHR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BLSHR must conatin at least two arguments.");
-          node = triton::ast::bvlshr(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvlshr(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvlshr(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvlshr(node, this->getConverted(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BASHR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BASHR must conatin at least two arguments.");
-          node = triton::ast::bvashr(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvashr(this->getConverted(expr.arg(0)), this->getConverted(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvashr(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvashr(node, this->getConverted(expr.arg(i)));
           break;
         }
 
         case Z3_OP_ROTATE_LEFT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_ROTATE_LEFT must conatin one argument.");
-          node = triton::ast::bvrol(expr.hi(), this->visit(expr.arg(0)));
+          node = triton::ast::bvrol(expr.hi(), this->getConverted(expr.arg(0)));
           break;
         }
 
         case Z3_OP_ROTATE_RIGHT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_ROTATE_RIGHT must conatin one argument.");
-          node = triton::ast::bvror(expr.hi(), this->visit(expr.arg(0)));
+          node = triton::ast::bvror(expr.hi(), this->getConverted(expr.arg(0)));
           break;
         }
 
         /* Variable or string */
         case Z3_OP_UNINTERPRETED: {
           std::string name = function.name().str();
-          triton::engines::symbolic::SymbolicVariable* symVar = triton::api.getSymbolicVariableFromName(name);
+          triton::engines::symbolic::SymbolicVariable* symVar = triton::getContext().getSymbolicVariableFromName(name);
 
           if (symVar)
             node = triton::ast::variable(*symVar);
@@ -7,6 +7,8 @@
 
 #ifdef TRITON_PYTHON_BINDINGS
 
+#include <fstream>
+
 #include <api.hpp>
 #include <bitsVector.hpp>
 #include <cpuSize.hpp>
@@ -53,6 +55,7 @@ If you want to use the libTriton without Python bindings, recompile the project
 - \ref py_ElfRelocationTable_page
 - \ref py_ElfSectionHeader_page
 - \ref py_ElfSymbolTable_page
+- \ref py_ExplorationEngine_page
 - \ref py_Immediate_page
 - \ref py_Instruction_page
 - \ref py_MemoryAccess_page
@@ -73,9 +76,13 @@ If you want to use the libTriton without Python bindings, recompile the project
 - <b>addCallback(function cb, \ref py_CALLBACK_page kind)</b><br>
 Adds a callback at specific internal points. Your callback will be called each time the point is reached.
 
+- **addSolverSessionConstraint(\ref py_AstNode_page node)**<br>
+Asserts a constraint into the current scope of the incremental solver session.
+
 - <b>assignSymbolicExpressionToMemory(\ref py_SymbolicExpression_page symExpr, \ref py_MemoryAccess_page mem)</b><br>
 Assigns a \ref py_SymbolicExpression_page to a \ref py_MemoryAccess_page area. **Be careful**, use this function only if you know what you are doing.
-The symbolic expression (`symExpr`) must be aligned to the memory access.
+The symbolic expression (`symExpr`) must be aligned to the memory access. If `symExpr` is already assigned to a register or
+to another memory area, the memory is assigned to a new expression which references it.
 
 - <b>assignSymbolicExpressionToRegister(\ref py_SymbolicExpression_page symExpr, \ref py_REG_page reg)</b><br>
 Assigns a \ref py_SymbolicExpression_page to a \ref py_REG_page. **Be careful**, use this function only if you know what you are doing.
@@ -95,6 +102,11 @@ Builds a symbolic memory cell from a \ref py_MemoryAccess_page and returns a \re
 - **buildSymbolicRegister(\ref py_REG_page reg)**<br>
 Builds a symbolic register from a \ref py_REG_page and returns a \ref py_AstNode_page.
 
+- **checkWithAssumption(\ref py_AstNode_page node, integer pathConstraints=all)**<br>
+Computes and returns a model as a dictionary of {integer symVarId : \ref py_SolverModel_page} from the constraints of the incremental
+solver session plus `node` (which is not kept). The `pathConstraints` first path constraints are asserted into the session, only once,
+so this prefix cannot go backward until the session is reset. The dictionary is empty if there is no model.
+
 - **clearPathConstraints(void)**<br>
 Clears the logical conjunction vector of path constraints.
 
@@ -158,6 +170,11 @@ Enabled, Triton will use the simplification passes of z3 before to call its reco
 - **enableTaintEngine(bool flag)**<br>
 Enables or disables the taint engine.
 
+- **evaluateAstBatch(\ref py_AstNode_page node, dict inputs)**<br>
+Evaluates an AST over N assignments of its symbolic variables and returns the list of the N results. `inputs` is a dictionary of
+{integer SymVarId : list of N integers}, the symbolic variables without list keep their concrete value. The AST is compiled once
+into a linear program which is run over all the assignments.
+
 - **evaluateAstViaZ3(\ref py_AstNode_page node)**<br>
 Evaluates an AST via Z3 and returns the symbolic value as integer.
 
@@ -167,6 +184,9 @@ Returns the list of all registers. Each item of this list is a \ref py_Register_
 - **getArchitecture(void)**<br>
 Returns the architecture which has been initialized as \ref py_ARCH_page.
 
+- **getAstArenaStats(void)**<br>
+Returns a dictionary which contains the number of live nodes and bytes, and the number of slabs reserved by the AST arena.
+
 - **getAstDictionariesStats(void)**<br>
 Returns a dictionary which contains all information about number of nodes allocated via AST dictionaries.
 
@@ -188,8 +208,11 @@ Returns the concrete value of memory cells.
 - **getConcreteRegisterValue(\ref py_REG_page reg)**<br>
 Returns the concrete value of a register.
 
+- **getDisassemblyCacheStats(void)**<br>
+Returns a dictionary which contains the hits, misses and entries of the decoded instructions cache.
+
 - **getFullAst(\ref py_AstNode_page node)**<br>
-Returns the full AST of a root node as \ref py_AstNode_page.
+Returns the full AST of a root node as \ref py_AstNode_page. The references are substituted into a new AST, the stored symbolic expressions are not modified.
 
 - **getFullAstFromId(integer symExprId)**<br>
 Returns the full AST as \ref py_AstNode_page from a symbolic expression id.
@@ -209,6 +232,13 @@ Returns the logical conjunction vector of path constraints as list of \ref py_Pa
 - **getPathConstraintsAst(void)**<br>
 Returns the logical conjunction AST of path constraints as \ref py_AstNode_page.
 
+- **getPythonCode(\ref py_AstNode_page node)**<br>
+Returns a node as straight-line Python code (string). Each referenced symbolic expression is assigned once to `ref_N` and each shared
+subterm once to a temporary `tK`, the last line is the expression of the node. The symbolic variables are free names.
+
+- **getSmtFormula(\ref py_AstNode_page node)**<br>
+Returns the SMT-LIB2 script of a symbolic constraint as string. The solver does not use it, it is only useful for debug or export purposes.
+
 - **getSymbolicExpressionFromId(intger symExprId)**<br>
 Returns the symbolic expression as \ref py_SymbolicExpression_page corresponding to the id.
 
@@ -216,10 +246,12 @@ Returns the symbolic expression as \ref py_SymbolicExpression_page corresponding
 Returns all symbolic expressions as a dictionary of {integer SymExprId : \ref py_SymbolicExpression_page expr}.
 
 - **getSymbolicMemory(void)**<br>
-Returns the map of symbolic memory as {integer address : \ref py_SymbolicExpression_page expr}.
+Returns the map of symbolic memory as {integer address : \ref py_SymbolicExpression_page expr}. A symbolic expression
+holds a whole memory write, so all bytes of a write map to the same expression (see its origin memory).
 
 - **getSymbolicMemoryId(intger addr)**<br>
-Returns the symbolic expression id as integer corresponding to the memory address.
+Returns the symbolic expression id as integer corresponding to the memory address. This expression holds the whole
+memory write which has defined this byte.
 
 - **getSymbolicMemoryValue(intger addr)**<br>
 Returns the symbolic memory value as integer.
@@ -245,12 +277,18 @@ Returns the symbolic variable as \ref py_SymbolicVariable_page corresponding to
 - **getSymbolicVariables(void)**<br>
 Returns all symbolic variable as a dictionary of {integer SymVarId : \ref py_SymbolicVariable_page var}.
 
+- **getTaintLabels(\ref py_MemoryAccess_page mem | \ref py_REG_page reg)**<br>
+Returns the sorted list of taint labels (integers) of a memory or a register.
+
 - **getTaintedSymbolicExpressions(void)**<br>
 Returns the list of all tainted \ref py_SymbolicExpression_page.
 
 - **isArchitectureValid(void)**<br>
 Returns true if the architecture is valid.
 
+- **isMemoryAreaTainted(integer baseAddr, integer size)**<br>
+Returns true if one byte of the range `[baseAddr:size]` is tainted.
+
 - **isMemoryMapped(integer baseAddr, integer size=1)**<br>
 Returns true if the range `[baseAddr:size]` is mapped into the internal memory representation.
 
@@ -284,15 +322,34 @@ Returns a new symbolic expression. Note that if there are simplification passes
 - **newSymbolicVariable(intger varSize, string comment="")**<br>
 Returns a new symbolic variable.
 
+- **pinSymbolicExpression(integer symExprId, bool flag=True)**<br>
+Pins (or unpins) a symbolic expression. A pinned expression is never removed by `reclaimSymbolicExpressions()`.
+
+- **popSolverSession(void)**<br>
+Removes the last scope of the incremental solver session and all constraints asserted into it.
+
 - **processing(\ref py_Instruction_page inst)**<br>
 The main function. This function processes everything (engine, IR, optimization, state, ...) from a given instruction.
 
+- **pushSolverSession(void)**<br>
+Creates a new scope into the incremental solver session.
+
+- **reclaimSymbolicExpressions(void)**<br>
+Removes the symbolic expressions (and their AST nodes if the `AST_DICTIONARIES` optimization is disabled) which are no
+longer reachable from the registers, the memory, the path constraints and the pinned expressions. Returns the number of
+removed expressions. Only the AST nodes of the removed expressions are freed, so a node built but not used yet (e.g: a
+constraint not asserted yet) stays valid. The removed expressions, their AST nodes and the symbolic expressions of the
+instructions processed before may be freed, they must not be used anymore.
+
 - <b>removeCallback(function cb, \ref py_CALLBACK_page kind)</b><br>
 Removes a recorded callback.
 
 - **resetEngines(void)**<br>
 Resets everything.
 
+- **resetSolverSession(void)**<br>
+Removes all constraints and scopes of the incremental solver session.
+
 - **setArchitecture(\ref py_ARCH_page arch)**<br>
 Initializes an architecture. This function must be called before any call to the rest of the API.
 
@@ -329,6 +386,15 @@ Sets the targeted register as tainted or not.
 Calls all simplification callbacks recorded and returns the simplified node as \ref py_AstNode_page. If the `z3` flag is
 set to True, Triton will use z3 to simplify the given `node` before to call recorded callbacks.
 
+- **sliceAst(\ref py_AstNode_page node)**<br>
+Returns the backward slice of `node` as a dictionary: `expressions` is the list of the symbolic expression ids `node` depends on
+(an expression always comes after the expressions it references), `variables` the list of the symbolic variable ids and
+`addresses` the list of the instruction addresses which have created these expressions (expressions not created by an instruction,
+like the ones of `convertRegisterToSymbolicVariable()`, have no address).
+
+- **sliceExpression(integer symExprId)**<br>
+Returns the backward slice of a symbolic expression (the expression included) as a dictionary. See sliceAst().
+
 - <b>taintAssignmentMemoryImmediate(\ref py_MemoryAccess_page memDst)</b><br>
 Taints `memDst` with an assignment - `memDst` is untained.
 
@@ -353,9 +419,18 @@ Taints an address.
 - **taintMemory(\ref py_MemoryAccess_page mem)**<br>
 Taints a memory.
 
+- **taintMemoryArea(integer baseAddr, integer size)**<br>
+Taints the range `[baseAddr:size]`.
+
+- **taintMemoryWithLabel(\ref py_MemoryAccess_page mem | intger addr, integer label)**<br>
+Taints a memory (or an address) and adds `label` to its taint labels.
+
 - **taintRegister(\ref py_REG_page reg)**<br>
 Taints a register.
 
+- **taintRegisterWithLabel(\ref py_REG_page reg, integer label)**<br>
+Taints a register and adds `label` to its taint labels.
+
 - <b>taintUnionMemoryImmediate(\ref py_MemoryAccess_page memDst)</b><br>
 Taints `memDst` with an union - `memDst` does not changes.
 
@@ -383,9 +458,20 @@ Untaints an address.
 - **untaintMemory(\ref py_MemoryAccess_page mem)**<br>
 Untaints a memory.
 
+- **untaintMemoryArea(integer baseAddr, integer size)**<br>
+Untaints the range `[baseAddr:size]`.
+
 - **untaintRegister(\ref py_REG_page reg)**<br>
 Untaints a register.
 
+- **writePythonCode(\ref py_AstNode_page node, string path)**<br>
+Writes a node as straight-line Python code (see getPythonCode()) into the file `path`. The code is written while the AST is walked.
+
+- **writeSmtFormula(\ref py_AstNode_page node, string path)**<br>
+Writes the SMT-LIB2 script of a symbolic constraint into the file `path` (e.g: to dump the queries for an offline solver). The
+script is written while the AST is walked, each referenced symbolic expression is defined once as `ref!N` and each shared subterm
+once as `node!K`.
+
 
 \subsection triton_py_api_namespaces Namespaces
 
@@ -580,6 +666,30 @@ namespace triton {
       }
 
 
+      static PyObject* triton_ExplorationEngine(PyObject* self, PyObject* args) {
+        PyObject* arch    = nullptr;
+        PyObject* workers = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &arch, &workers);
+
+        /* Check if the first arg is a integer */
+        if (arch == nullptr || (!PyLong_Check(arch) && !PyInt_Check(arch)))
+          return PyErr_Format(PyExc_TypeError, "ExplorationEngine(): Expects an ARCH as first argument.");
+
+        /* Check if the second arg is a integer */
+        if (workers == nullptr || (!PyLong_Check(workers) && !PyInt_Check(workers)))
+          return PyErr_Format(PyExc_TypeError, "ExplorationEngine(): Expects an integer as second argument.");
+
+        try {
+          return PyExplorationEngine(PyLong_AsUint32(arch), PyLong_AsUint32(workers));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_Immediate(PyObject* self, PyObject* args) {
         PyObject* value = nullptr;
         PyObject* size  = nullptr;
@@ -704,6 +814,26 @@ namespace triton {
       }
 
 
+      static PyObject* triton_addSolverSessionConstraint(PyObject* self, PyObject* node) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "addSolverSessionConstraint(): Architecture is not defined.");
+
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "addSolverSessionConstraint(): Expects a AstNode as argument.");
+
+        try {
+          triton::api.addSolverSessionConstraint(PyAstNode_AsAstNode(node));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_assignSymbolicExpressionToMemory(PyObject* self, PyObject* args) {
         PyObject* se  = nullptr;
         PyObject* mem = nullptr;
@@ -839,6 +969,47 @@ namespace triton {
       }
 
 
+      static PyObject* triton_checkWithAssumption(PyObject* self, PyObject* args) {
+        PyObject* ret         = nullptr;
+        PyObject* node        = nullptr;
+        PyObject* prefix      = nullptr;
+        std::map<triton::uint32, triton::engines::solver::SolverModel> model;
+        std::map<triton::uint32, triton::engines::solver::SolverModel>::iterator it;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &node, &prefix);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "checkWithAssumption(): Architecture is not defined.");
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "checkWithAssumption(): Expects a AstNode as first argument.");
+
+        if (prefix != nullptr && !PyLong_Check(prefix) && !PyInt_Check(prefix))
+          return PyErr_Format(PyExc_TypeError, "checkWithAssumption(): Expects an integer as second argument.");
+
+        try {
+          ret = xPyDict_New();
+          if (prefix == nullptr)
+            model = triton::api.checkWithAssumption(PyAstNode_AsAstNode(node));
+          else
+            model = triton::api.checkWithAssumption(PyAstNode_AsAstNode(node), PyLong_AsUsize(prefix));
+          for (it = model.begin(); it != model.end(); it++) {
+            PyDict_SetItem(ret, PyLong_FromUint32(it->first), PySolverModel(it->second));
+          }
+        }
+        catch (const z3::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.msg());
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* triton_clearPathConstraints(PyObject* self, PyObject* noarg) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1305,6 +1476,57 @@ namespace triton {
       }
 
 
+      static PyObject* triton_evaluateAstBatch(PyObject* self, PyObject* args) {
+        std::map<triton::usize, std::vector<triton::uint512>> cinputs;
+        std::vector<triton::uint512> results;
+        PyObject* node    = nullptr;
+        PyObject* inputs  = nullptr;
+        PyObject* key     = nullptr;
+        PyObject* values  = nullptr;
+        PyObject* ret     = nullptr;
+        Py_ssize_t pos    = 0;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &node, &inputs);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "evaluateAstBatch(): Architecture is not defined.");
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "evaluateAstBatch(): Expects a AstNode as first argument.");
+
+        if (inputs == nullptr || !PyDict_Check(inputs))
+          return PyErr_Format(PyExc_TypeError, "evaluateAstBatch(): Expects a dictionary as second argument.");
+
+        while (PyDict_Next(inputs, &pos, &key, &values)) {
+          if ((!PyLong_Check(key) && !PyInt_Check(key)) || !PyList_Check(values))
+            return PyErr_Format(PyExc_TypeError, "evaluateAstBatch(): Expects a dictionary of {integer : list of integers}.");
+
+          std::vector<triton::uint512>& column = cinputs[PyLong_AsUsize(key)];
+          for (Py_ssize_t index = 0; index < PyList_Size(values); index++) {
+            PyObject* item = PyList_GetItem(values, index);
+            if (!PyLong_Check(item) && !PyInt_Check(item))
+              return PyErr_Format(PyExc_TypeError, "evaluateAstBatch(): Expects a dictionary of {integer : list of integers}.");
+            column.push_back(PyLong_AsUint512(item));
+          }
+        }
+
+        try {
+          results = triton::api.evaluateAstBatch(PyAstNode_AsAstNode(node), cinputs);
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        ret = xPyList_New(results.size());
+        for (triton::usize index = 0; index < results.size(); index++)
+          PyList_SetItem(ret, index, PyLong_FromUint512(results[index]));
+
+        return ret;
+      }
+
+
       static PyObject* triton_evaluateAstViaZ3(PyObject* self, PyObject* node) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1357,6 +1579,29 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getAstArenaStats(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+        std::map<std::string, triton::usize> stats;
+        std::map<std::string, triton::usize>::iterator it;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getAstArenaStats(): Architecture is not defined.");
+
+        try {
+          stats = triton::api.getAstArenaStats();
+          ret   = xPyDict_New();
+          for (it = stats.begin(); it != stats.end(); it++)
+            PyDict_SetItem(ret, PyString_FromString(it->first.c_str()), PyLong_FromUsize(it->second));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* triton_getAstDictionariesStats(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
         std::map<std::string, triton::usize> stats;
@@ -1475,6 +1720,29 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getDisassemblyCacheStats(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+        std::map<std::string, triton::usize> stats;
+        std::map<std::string, triton::usize>::iterator it;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getDisassemblyCacheStats(): Architecture is not defined.");
+
+        try {
+          stats = triton::api.getDisassemblyCacheStats();
+          ret   = xPyDict_New();
+          for (it = stats.begin(); it != stats.end(); it++)
+            PyDict_SetItem(ret, PyString_FromString(it->first.c_str()), PyLong_FromUsize(it->second));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* triton_getFullAst(PyObject* self, PyObject* node) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1639,6 +1907,40 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getPythonCode(PyObject* self, PyObject* node) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getPythonCode(): Architecture is not defined.");
+
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "getPythonCode(): Expects a AstNode as argument.");
+
+        try {
+          return PyString_FromString(triton::api.getPythonCode(PyAstNode_AsAstNode(node)).c_str());
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getSmtFormula(PyObject* self, PyObject* node) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSmtFormula(): Architecture is not defined.");
+
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "getSmtFormula(): Expects a AstNode as argument.");
+
+        try {
+          return PyString_FromString(triton::api.getSmtFormula(PyAstNode_AsAstNode(node)).c_str());
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_getSymbolicExpressionFromId(PyObject* self, PyObject* symExprId) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1852,6 +2154,36 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getTaintLabels(PyObject* self, PyObject* op) {
+        PyObject* ret = nullptr;
+        std::set<triton::uint32> labels;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getTaintLabels(): Architecture is not defined.");
+
+        if (!PyMemoryAccess_Check(op) && !PyRegister_Check(op))
+          return PyErr_Format(PyExc_TypeError, "getTaintLabels(): Expects a Memory or a Register as argument.");
+
+        try {
+          if (PyMemoryAccess_Check(op))
+            labels = triton::api.getMemoryTaintLabels(*PyMemoryAccess_AsMemoryAccess(op));
+          else
+            labels = triton::api.getRegisterTaintLabels(*PyRegister_AsRegister(op));
+
+          ret = xPyList_New(labels.size());
+          triton::uint32 index = 0;
+          for (auto it = labels.begin(); it != labels.end(); it++)
+            PyList_SetItem(ret, index++, PyLong_FromUint32(*it));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* triton_getTaintedSymbolicExpressions(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
         triton::usize size = 0, index = 0;
@@ -1886,6 +2218,38 @@ namespace triton {
       }
 
 
+      static PyObject* triton_isMemoryAreaTainted(PyObject* self, PyObject* args) {
+        PyObject* baseAddr        = nullptr;
+        PyObject* size            = nullptr;
+        triton::uint64 c_baseAddr = 0;
+        triton::usize c_size      = 0;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &baseAddr, &size);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "isMemoryAreaTainted(): Architecture is not defined.");
+
+        if (baseAddr == nullptr || (!PyLong_Check(baseAddr) && !PyInt_Check(baseAddr)))
+          return PyErr_Format(PyExc_TypeError, "isMemoryAreaTainted(): Expects a base address (integer) as first argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "isMemoryAreaTainted(): Expects a size (integer) as second argument.");
+
+        try {
+          c_baseAddr = PyLong_AsUint64(baseAddr);
+          c_size     = PyLong_AsUsize(size);
+          if (triton::api.isMemoryTainted(c_baseAddr, static_cast<triton::uint32>(c_size)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_isMemoryMapped(PyObject* self, PyObject* args) {
         PyObject* baseAddr        = nullptr;
         PyObject* size            = nullptr;
@@ -2071,6 +2435,52 @@ namespace triton {
       }
 
 
+      static PyObject* triton_pinSymbolicExpression(PyObject* self, PyObject* args) {
+        PyObject* symExprId = nullptr;
+        PyObject* flag      = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &symExprId, &flag);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "pinSymbolicExpression(): Architecture is not defined.");
+
+        if (symExprId == nullptr || (!PyLong_Check(symExprId) && !PyInt_Check(symExprId)))
+          return PyErr_Format(PyExc_TypeError, "pinSymbolicExpression(): Expects an integer as first argument.");
+
+        if (flag != nullptr && !PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "pinSymbolicExpression(): Expects an boolean flag as second argument.");
+
+        try {
+          triton::api.pinSymbolicExpression(PyLong_AsUsize(symExprId), flag == nullptr ? true : PyLong_AsBool(flag));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_popSolverSession(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "popSolverSession(): Architecture is not defined.");
+
+        try {
+          triton::api.popSolverSession();
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_processing(PyObject* self, PyObject* inst) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -2091,6 +2501,37 @@ namespace triton {
       }
 
 
+      static PyObject* triton_pushSolverSession(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "pushSolverSession(): Architecture is not defined.");
+
+        try {
+          triton::api.pushSolverSession();
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_reclaimSymbolicExpressions(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "reclaimSymbolicExpressions(): Architecture is not defined.");
+
+        try {
+          return PyLong_FromUsize(triton::api.reclaimSymbolicExpressions());
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_removeCallback(PyObject* self, PyObject* args) {
         PyObject* function = nullptr;
         PyObject* mode     = nullptr;
@@ -2137,6 +2578,23 @@ namespace triton {
       }
 
 
+      static PyObject* triton_resetSolverSession(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "resetSolverSession(): Architecture is not defined.");
+
+        try {
+          triton::api.resetSolverSession();
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_setArchitecture(PyObject* self, PyObject* arg) {
         if (!PyLong_Check(arg) && !PyInt_Check(arg))
           return PyErr_Format(PyExc_TypeError, "setArchitecture(): Expects an ARCH as argument.");
@@ -2398,6 +2856,63 @@ namespace triton {
       }
 
 
+      static PyObject* PySymbolicSlice(const triton::engines::symbolic::SymbolicSlice& slice) {
+        PyObject* ret         = xPyDict_New();
+        PyObject* expressions = xPyList_New(slice.getSymbolicExpressions().size());
+        PyObject* variables   = xPyList_New(slice.getSymbolicVariables().size());
+        PyObject* addresses   = xPyList_New(slice.getAddresses().size());
+
+        for (triton::usize index = 0; index < slice.getSymbolicExpressions().size(); index++)
+          PyList_SetItem(expressions, index, PyLong_FromUsize(slice.getSymbolicExpressions()[index]));
+
+        for (triton::usize index = 0; index < slice.getSymbolicVariables().size(); index++)
+          PyList_SetItem(variables, index, PyLong_FromUsize(slice.getSymbolicVariables()[index]));
+
+        for (triton::usize index = 0; index < slice.getAddresses().size(); index++)
+          PyList_SetItem(addresses, index, PyLong_FromUint64(slice.getAddresses()[index]));
+
+        PyDict_SetItemString(ret, "expressions", expressions);
+        PyDict_SetItemString(ret, "variables",   variables);
+        PyDict_SetItemString(ret, "addresses",   addresses);
+
+        return ret;
+      }
+
+
+      static PyObject* triton_sliceAst(PyObject* self, PyObject* node) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "sliceAst(): Architecture is not defined.");
+
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "sliceAst(): Expects a AstNode as argument.");
+
+        try {
+          return PySymbolicSlice(triton::api.sliceAst(PyAstNode_AsAstNode(node)));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_sliceExpression(PyObject* self, PyObject* symExprId) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "sliceExpression(): Architecture is not defined.");
+
+        if (!PyLong_Check(symExprId) && !PyInt_Check(symExprId))
+          return PyErr_Format(PyExc_TypeError, "sliceExpression(): Expects an integer as argument.");
+
+        try {
+          return PySymbolicSlice(triton::api.sliceExpression(PyLong_AsUsize(symExprId)));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_taintAssignmentMemoryImmediate(PyObject* self, PyObject* mem) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -2574,6 +3089,75 @@ namespace triton {
       }
 
 
+      static PyObject* triton_taintMemoryArea(PyObject* self, PyObject* args) {
+        PyObject* baseAddr        = nullptr;
+        PyObject* size            = nullptr;
+        triton::uint64 c_baseAddr = 0;
+        triton::usize c_size      = 0;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &baseAddr, &size);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "taintMemoryArea(): Architecture is not defined.");
+
+        if (baseAddr == nullptr || (!PyLong_Check(baseAddr) && !PyInt_Check(baseAddr)))
+          return PyErr_Format(PyExc_TypeError, "taintMemoryArea(): Expects a base address (integer) as first argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "taintMemoryArea(): Expects a size (integer) as second argument.");
+
+        try {
+          c_baseAddr = PyLong_AsUint64(baseAddr);
+          c_size     = PyLong_AsUsize(size);
+          if (triton::api.taintMemoryArea(c_baseAddr, c_size) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_taintMemoryWithLabel(PyObject* self, PyObject* args) {
+        PyObject* mem   = nullptr;
+        PyObject* label = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &mem, &label);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "taintMemoryWithLabel(): Architecture is not defined.");
+
+        if (mem == nullptr || (!PyMemoryAccess_Check(mem) && !PyLong_Check(mem) && !PyInt_Check(mem)))
+          return PyErr_Format(PyExc_TypeError, "taintMemoryWithLabel(): Expects a Memory or an integer as first argument.");
+
+        if (label == nullptr || (!PyLong_Check(label) && !PyInt_Check(label)))
+          return PyErr_Format(PyExc_TypeError, "taintMemoryWithLabel(): Expects a label (integer) as second argument.");
+
+        try {
+          triton::uint32 c_label = PyLong_AsUint32(label);
+
+          if (PyMemoryAccess_Check(mem)) {
+            if (triton::api.taintMemoryWithLabel(*PyMemoryAccess_AsMemoryAccess(mem), c_label) == true)
+              Py_RETURN_TRUE;
+          }
+
+          else {
+            if (triton::api.taintMemoryWithLabel(triton::arch::MemoryAccess(PyLong_AsUint64(mem), 1), c_label) == true)
+              Py_RETURN_TRUE;
+          }
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+        Py_RETURN_FALSE;
+      }
+
+
       static PyObject* triton_taintRegister(PyObject* self, PyObject* reg) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -2593,6 +3177,34 @@ namespace triton {
       }
 
 
+      static PyObject* triton_taintRegisterWithLabel(PyObject* self, PyObject* args) {
+        PyObject* reg   = nullptr;
+        PyObject* label = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &reg, &label);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "taintRegisterWithLabel(): Architecture is not defined.");
+
+        if (reg == nullptr || !PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "taintRegisterWithLabel(): Expects a Register as first argument.");
+
+        if (label == nullptr || (!PyLong_Check(label) && !PyInt_Check(label)))
+          return PyErr_Format(PyExc_TypeError, "taintRegisterWithLabel(): Expects a label (integer) as second argument.");
+
+        try {
+          if (triton::api.taintRegisterWithLabel(*PyRegister_AsRegister(reg), PyLong_AsUint32(label)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_taintUnionMemoryImmediate(PyObject* self, PyObject* mem) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -2803,6 +3415,38 @@ namespace triton {
       }
 
 
+      static PyObject* triton_untaintMemoryArea(PyObject* self, PyObject* args) {
+        PyObject* baseAddr        = nullptr;
+        PyObject* size            = nullptr;
+        triton::uint64 c_baseAddr = 0;
+        triton::usize c_size      = 0;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &baseAddr, &size);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "untaintMemoryArea(): Architecture is not defined.");
+
+        if (baseAddr == nullptr || (!PyLong_Check(baseAddr) && !PyInt_Check(baseAddr)))
+          return PyErr_Format(PyExc_TypeError, "untaintMemoryArea(): Expects a base address (integer) as first argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "untaintMemoryArea(): Expects a size (integer) as second argument.");
+
+        try {
+          c_baseAddr = PyLong_AsUint64(baseAddr);
+          c_size     = PyLong_AsUsize(size);
+          if (triton::api.untaintMemoryArea(c_baseAddr, c_size) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_untaintRegister(PyObject* self, PyObject* reg) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -2822,20 +3466,87 @@ namespace triton {
       }
 
 
+      static PyObject* triton_writePythonCode(PyObject* self, PyObject* args) {
+        PyObject* node = nullptr;
+        PyObject* path = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &node, &path);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "writePythonCode(): Architecture is not defined.");
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "writePythonCode(): Expects a AstNode as first argument.");
+
+        if (path == nullptr || !PyString_Check(path))
+          return PyErr_Format(PyExc_TypeError, "writePythonCode(): Expects a path (string) as second argument.");
+
+        try {
+          std::ofstream stream(PyString_AsString(path));
+          if (!stream)
+            return PyErr_Format(PyExc_TypeError, "writePythonCode(): Cannot open %s.", PyString_AsString(path));
+          triton::api.writePythonCode(stream, PyAstNode_AsAstNode(node));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_writeSmtFormula(PyObject* self, PyObject* args) {
+        PyObject* node = nullptr;
+        PyObject* path = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &node, &path);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "writeSmtFormula(): Architecture is not defined.");
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "writeSmtFormula(): Expects a AstNode as first argument.");
+
+        if (path == nullptr || !PyString_Check(path))
+          return PyErr_Format(PyExc_TypeError, "writeSmtFormula(): Expects a path (string) as second argument.");
+
+        try {
+          std::ofstream stream(PyString_AsString(path));
+          if (!stream)
+            return PyErr_Format(PyExc_TypeError, "writeSmtFormula(): Cannot open %s.", PyString_AsString(path));
+          triton::api.writeSmtFormula(stream, PyAstNode_AsAstNode(node));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       PyMethodDef tritonCallbacks[] = {
         {"Bitvector",                           (PyCFunction)triton_Bitvector,                              METH_VARARGS,       ""},
         {"Elf",                                 (PyCFunction)triton_Elf,                                    METH_O,             ""},
+        {"ExplorationEngine",                   (PyCFunction)triton_ExplorationEngine,                      METH_VARARGS,       ""},
         {"Immediate",                           (PyCFunction)triton_Immediate,                              METH_VARARGS,       ""},
         {"Instruction",                         (PyCFunction)triton_Instruction,                            METH_NOARGS,        ""},
         {"MemoryAccess",                        (PyCFunction)triton_MemoryAccess,                           METH_VARARGS,       ""},
         {"Register",                            (PyCFunction)triton_Register,                               METH_VARARGS,       ""},
         {"addCallback",                         (PyCFunction)triton_addCallback,                            METH_VARARGS,       ""},
+        {"addSolverSessionConstraint",          (PyCFunction)triton_addSolverSessionConstraint,             METH_O,             ""},
         {"assignSymbolicExpressionToMemory",    (PyCFunction)triton_assignSymbolicExpressionToMemory,       METH_VARARGS,       ""},
         {"assignSymbolicExpressionToRegister",  (PyCFunction)triton_assignSymbolicExpressionToRegister,     METH_VARARGS,       ""},
         {"buildSemantics",                      (PyCFunction)triton_buildSemantics,                         METH_O,             ""},
         {"buildSymbolicImmediate",              (PyCFunction)triton_buildSymbolicImmediate,                 METH_O,             ""},
         {"buildSymbolicMemory",                 (PyCFunction)triton_buildSymbolicMemory,                    METH_O,             ""},
         {"buildSymbolicRegister",               (PyCFunction)triton_buildSymbolicRegister,                  METH_O,             ""},
+        {"checkWithAssumption",                 (PyCFunction)triton_checkWithAssumption,                    METH_VARARGS,       ""},
         {"clearPathConstraints",                (PyCFunction)triton_clearPathConstraints,                   METH_NOARGS,        ""},
         {"concretizeAllMemory",                 (PyCFunction)triton_concretizeAllMemory,                    METH_NOARGS,        ""},
         {"concretizeAllRegister",               (PyCFunction)triton_concretizeAllRegister,                  METH_NOARGS,        ""},
@@ -2856,15 +3567,18 @@ namespace triton {
         {"enableSymbolicOptimization",          (PyCFunction)triton_enableSymbolicOptimization,             METH_VARARGS,       ""},
         {"enableSymbolicZ3Simplification",      (PyCFunction)triton_enableSymbolicZ3Simplification,         METH_O,             ""},
         {"enableTaintEngine",                   (PyCFunction)triton_enableTaintEngine,                      METH_O,             ""},
+        {"evaluateAstBatch",                    (PyCFunction)triton_evaluateAstBatch,                       METH_VARARGS,       ""},
         {"evaluateAstViaZ3",                    (PyCFunction)triton_evaluateAstViaZ3,                       METH_O,             ""},
         {"getAllRegisters",                     (PyCFunction)triton_getAllRegisters,                        METH_NOARGS,        ""},
         {"getArchitecture",                     (PyCFunction)triton_getArchitecture,                        METH_NOARGS,        ""},
+        {"getAstArenaStats",                    (PyCFunction)triton_getAstArenaStats,                       METH_NOARGS,        ""},
         {"getAstDictionariesStats",             (PyCFunction)triton_getAstDictionariesStats,                METH_NOARGS,        ""},
         {"getAstFromId",                        (PyCFunction)triton_getAstFromId,                           METH_O,             ""},
         {"getAstRepresentationMode",            (PyCFunction)triton_getAstRepresentationMode,               METH_NOARGS,        ""},
         {"getConcreteMemoryAreaValue",          (PyCFunction)triton_getConcreteMemoryAreaValue,             METH_VARARGS,       ""},
         {"getConcreteMemoryValue",              (PyCFunction)triton_getConcreteMemoryValue,                 METH_O,             ""},
         {"getConcreteRegisterValue",            (PyCFunction)triton_getConcreteRegisterValue,               METH_O,             ""},
+        {"getDisassemblyCacheStats",            (PyCFunction)triton_getDisassemblyCacheStats,               METH_NOARGS,        ""},
         {"getFullAst",                          (PyCFunction)triton_getFullAst,                             METH_O,             ""},
         {"getFullAstFromId",                    (PyCFunction)triton_getFullAstFromId,                       METH_O,             ""},
         {"getModel",                            (PyCFunction)triton_getModel,                               METH_O,             ""},
@@ -2872,6 +3586,8 @@ namespace triton {
         {"getParentRegisters",                  (PyCFunction)triton_getParentRegisters,                     METH_NOARGS,        ""},
         {"getPathConstraints",                  (PyCFunction)triton_getPathConstraints,                     METH_NOARGS,        ""},
         {"getPathConstraintsAst",               (PyCFunction)triton_getPathConstraintsAst,                  METH_NOARGS,        ""},
+        {"getPythonCode",                       (PyCFunction)triton_getPythonCode,                          METH_O,             ""},
+        {"getSmtFormula",                       (PyCFunction)triton_getSmtFormula,                          METH_O,             ""},
         {"getSymbolicExpressionFromId",         (PyCFunction)triton_getSymbolicExpressionFromId,            METH_O,             ""},
         {"getSymbolicExpressions",              (PyCFunction)triton_getSymbolicExpressions,                 METH_NOARGS,        ""},
         {"getSymbolicMemory",                   (PyCFunction)triton_getSymbolicMemory,                      METH_NOARGS,        ""},
@@ -2883,8 +3599,10 @@ namespace triton {
         {"getSymbolicVariableFromId",           (PyCFunction)triton_getSymbolicVariableFromId,              METH_O,             ""},
         {"getSymbolicVariableFromName",         (PyCFunction)triton_getSymbolicVariableFromName,            METH_O,             ""},
         {"getSymbolicVariables",                (PyCFunction)triton_getSymbolicVariables,                   METH_NOARGS,        ""},
+        {"getTaintLabels",                      (PyCFunction)triton_getTaintLabels,                         METH_O,             ""},
         {"getTaintedSymbolicExpressions",       (PyCFunction)triton_getTaintedSymbolicExpressions,          METH_NOARGS,        ""},
         {"isArchitectureValid",                 (PyCFunction)triton_isArchitectureValid,                    METH_NOARGS,        ""},
+        {"isMemoryAreaTainted",                 (PyCFunction)triton_isMemoryAreaTainted,                    METH_VARARGS,       ""},
         {"isMemoryMapped",                      (PyCFunction)triton_isMemoryMapped,                         METH_VARARGS,       ""},
         {"isMemoryTainted",                     (PyCFunction)triton_isMemoryTainted,                        METH_O,             ""},
         {"isRegisterTainted",                   (PyCFunction)triton_isRegisterTainted,                      METH_O,             ""},
@@ -2895,9 +3613,14 @@ namespace triton {
         {"isTaintEngineEnabled",                (PyCFunction)triton_isTaintEngineEnabled,                   METH_NOARGS,        ""},
         {"newSymbolicExpression",               (PyCFunction)triton_newSymbolicExpression,                  METH_VARARGS,       ""},
         {"newSymbolicVariable",                 (PyCFunction)triton_newSymbolicVariable,                    METH_VARARGS,       ""},
+        {"pinSymbolicExpression",               (PyCFunction)triton_pinSymbolicExpression,                  METH_VARARGS,       ""},
+        {"popSolverSession",                    (PyCFunction)triton_popSolverSession,                       METH_NOARGS,        ""},
         {"processing",                          (PyCFunction)triton_processing,                             METH_O,             ""},
+        {"pushSolverSession",                   (PyCFunction)triton_pushSolverSession,                      METH_NOARGS,        ""},
+        {"reclaimSymbolicExpressions",          (PyCFunction)triton_reclaimSymbolicExpressions,             METH_NOARGS,        ""},
         {"removeCallback",                      (PyCFunction)triton_removeCallback,                         METH_VARARGS,       ""},
         {"resetEngines",                        (PyCFunction)triton_resetEngines,                           METH_NOARGS,        ""},
+        {"resetSolverSession",                  (PyCFunction)triton_resetSolverSession,                     METH_NOARGS,        ""},
         {"setArchitecture",                     (PyCFunction)triton_setArchitecture,                        METH_O,             ""},
         {"setAstRepresentationMode",            (PyCFunction)triton_setAstRepresentationMode,               METH_O,             ""},
         {"setConcreteMemoryAreaValue",          (PyCFunction)triton_setConcreteMemoryAreaValue,             METH_VARARGS,       ""},
@@ -2906,6 +3629,8 @@ namespace triton {
         {"setTaintMemory",                      (PyCFunction)triton_setTaintMemory,                         METH_VARARGS,       ""},
         {"setTaintRegister",                    (PyCFunction)triton_setTaintRegister,                       METH_VARARGS,       ""},
         {"simplify",                            (PyCFunction)triton_simplify,                               METH_VARARGS,       ""},
+        {"sliceAst",                            (PyCFunction)triton_sliceAst,                               METH_O,             ""},
+        {"sliceExpression",                     (PyCFunction)triton_sliceExpression,                        METH_O,             ""},
         {"taintAssignmentMemoryImmediate",      (PyCFunction)triton_taintAssignmentMemoryImmediate,         METH_O,             ""},
         {"taintAssignmentMemoryMemory",         (PyCFunction)triton_taintAssignmentMemoryMemory,            METH_VARARGS,       ""},
         {"taintAssignmentMemoryRegister",       (PyCFunction)triton_taintAssignmentMemoryRegister,          METH_VARARGS,       ""},
@@ -2913,7 +3638,10 @@ namespace triton {
         {"taintAssignmentRegisterMemory",       (PyCFunction)triton_taintAssignmentRegisterMemory,          METH_VARARGS,       ""},
         {"taintAssignmentRegisterRegister",     (PyCFunction)triton_taintAssignmentRegisterRegister,        METH_VARARGS,       ""},
         {"taintMemory",                         (PyCFunction)triton_taintMemory,                            METH_O,             ""},
+        {"taintMemoryArea",                     (PyCFunction)triton_taintMemoryArea,                        METH_VARARGS,       ""},
+        {"taintMemoryWithLabel",                (PyCFunction)triton_taintMemoryWithLabel,                   METH_VARARGS,       ""},
         {"taintRegister",                       (PyCFunction)triton_taintRegister,                          METH_O,             ""},
+        {"taintRegisterWithLabel",              (PyCFunction)triton_taintRegisterWithLabel,                 METH_VARARGS,       ""},
         {"taintUnionMemoryImmediate",           (PyCFunction)triton_taintUnionMemoryImmediate,              METH_O,             ""},
         {"taintUnionMemoryMemory",              (PyCFunction)triton_taintUnionMemoryMemory,                 METH_VARARGS,       ""},
         {"taintUnionMemoryRegister",            (PyCFunction)triton_taintUnionMemoryRegister,               METH_VARARGS,       ""},
@@ -2922,7 +3650,10 @@ namespace triton {
         {"taintUnionRegisterRegister",          (PyCFunction)triton_taintUnionRegisterRegister,             METH_VARARGS,       ""},
         {"unmapMemory",                         (PyCFunction)triton_unmapMemory,                            METH_VARARGS,       ""},
         {"untaintMemory",                       (PyCFunction)triton_untaintMemory,                          METH_O,             ""},
+        {"untaintMemoryArea",                   (PyCFunction)triton_untaintMemoryArea,                      METH_VARARGS,       ""},
         {"untaintRegister",                     (PyCFunction)triton_untaintRegister,                        METH_O,             ""},
+        {"writePythonCode",                     (PyCFunction)triton_writePythonCode,                        METH_VARARGS,       ""},
+        {"writeSmtFormula",                     (PyCFunction)triton_writeSmtFormula,                        METH_VARARGS,       ""},
         {nullptr,                               nullptr,                                                    0,                  nullptr}
 
       };
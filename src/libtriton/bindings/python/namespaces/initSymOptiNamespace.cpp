@@ -38,6 +38,12 @@ Enabled, Triton will keep a map of aligned memory to reduce the symbolic memory
 - **OPTIMIZATION.AST_DICTIONARIES**<br>
 Enabled, Triton will record all AST nodes into several dictionaries and try to return node already allocated instead of allocate twice the same node.
 
+- **OPTIMIZATION.LAZY_FLAGS**<br>
+Enabled, Triton will record how flags are computed and will build their symbolic expressions only when they are read
+(e.g. by a conditional instruction or by `getSymbolicRegisterId()`). Flags overwritten without being read never allocate AST nodes.
+Their concrete values are still updated after each instruction. As a lazy flag has no expression when the instruction is processed,
+the flag is not part of `Instruction.getSymbolicExpressions()` and its AST is `None` in `Instruction.getWrittenRegisters()`.
+
 - **OPTIMIZATION.ONLY_ON_SYMBOLIZED**<br>
 Enabled, Triton will perform symbolic execution only on symbolized expressions.
 
@@ -47,6 +53,18 @@ Enabled, Triton will perform symbolic execution only on tainted instructions.
 - **OPTIMIZATION.PC_TRACKING_SYMBOLIC**<br>
 Enabled, Triton will track path constraints only if they are symbolized. This optimization is enabled by default.
 
+- **OPTIMIZATION.RECLAIM_EXPRESSIONS**<br>
+Enabled, `processing()` periodically removes the symbolic expressions (and their AST nodes) which are no longer reachable
+from the registers, the memory, the path constraints and the pinned expressions (see `reclaimSymbolicExpressions()`).
+A reclamation occurs each time the number of symbolic expressions has doubled since the previous one, so a long trace
+keeps a memory footprint proportional to its live expressions. Only the last processed instruction stays valid, the
+expressions and AST nodes held from older instructions may be freed.
+
+- **OPTIMIZATION.TAINT_ONLY_SEMANTICS**<br>
+Enabled and when the symbolic engine is disabled, Triton will spread the taint of the common instructions without building
+their symbolic expressions and AST nodes. The concrete state (registers, flags, memory, program counter and stack pointer)
+is updated with the same values as the full semantics. Instructions which are not handled fall back on the full semantics.
+
 */
 
 
@@ -58,9 +76,12 @@ namespace triton {
       void initSymOptiNamespace(PyObject* symOptiDict) {
         PyDict_SetItemString(symOptiDict, "ALIGNED_MEMORY",         PyLong_FromUint32(triton::engines::symbolic::ALIGNED_MEMORY));
         PyDict_SetItemString(symOptiDict, "AST_DICTIONARIES",       PyLong_FromUint32(triton::engines::symbolic::AST_DICTIONARIES));
+        PyDict_SetItemString(symOptiDict, "LAZY_FLAGS",             PyLong_FromUint32(triton::engines::symbolic::LAZY_FLAGS));
         PyDict_SetItemString(symOptiDict, "ONLY_ON_SYMBOLIZED",     PyLong_FromUint32(triton::engines::symbolic::ONLY_ON_SYMBOLIZED));
         PyDict_SetItemString(symOptiDict, "ONLY_ON_TAINTED",        PyLong_FromUint32(triton::engines::symbolic::ONLY_ON_TAINTED));
         PyDict_SetItemString(symOptiDict, "PC_TRACKING_SYMBOLIC",   PyLong_FromUint32(triton::engines::symbolic::PC_TRACKING_SYMBOLIC));
+        PyDict_SetItemString(symOptiDict, "RECLAIM_EXPRESSIONS",    PyLong_FromUint32(triton::engines::symbolic::RECLAIM_EXPRESSIONS));
+        PyDict_SetItemString(symOptiDict, "TAINT_ONLY_SEMANTICS",   PyLong_FromUint32(triton::engines::symbolic::TAINT_ONLY_SEMANTICS));
       }
 
     }; /* python namespace */
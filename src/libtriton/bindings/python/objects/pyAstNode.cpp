@@ -58,7 +58,7 @@ Returns the node vector size.
 Returns the list of child nodes as \ref py_AstNode_page.
 
 - **getHash(void)**<br>
-Returns the hash (signature) of the AST as float.
+Returns the hash (signature) of the AST as integer. The hash is cached into the node.
 
 - **getKind(void)**<br>
 Returns the kind of the node as \ref py_AST_NODE_page.<br>
@@ -144,7 +144,7 @@ namespace triton {
 
       static PyObject* AstNode_getHash(PyObject* self, PyObject* noarg) {
         try {
-          return PyLong_FromUint512(PyAstNode_AsAstNode(self)->hash(1));
+          return PyLong_FromUint64(PyAstNode_AsAstNode(self)->getHash());
         }
         catch (const std::exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -262,7 +262,14 @@ namespace triton {
 
 
       static int AstNode_cmp(AstNode_Object* a, AstNode_Object* b) {
-        return !(a->node->hash(1) == b->node->hash(1));
+        return !(a->node->getHash() == b->node->getHash());
+      }
+
+
+      static long AstNode_hash(PyObject* self) {
+        long hash = static_cast<long>(PyAstNode_AsAstNode(self)->getHash());
+        /* -1 is reserved for errors */
+        return (hash == -1) ? -2 : hash;
       }
 
 
@@ -524,7 +531,7 @@ namespace triton {
         &AstNode_NumberMethods,                     /* tp_as_number */
         0,                                          /* tp_as_sequence */
         0,                                          /* tp_as_mapping */
-        0,                                          /* tp_hash */
+        (hashfunc)AstNode_hash,                     /* tp_hash */
         0,                                          /* tp_call*/
         (reprfunc)AstNode_str,                      /* tp_str */
         0,                                          /* tp_getattro */
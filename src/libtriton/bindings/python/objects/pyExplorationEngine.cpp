@@ -0,0 +1,402 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifdef TRITON_PYTHON_BINDINGS
+
+#include <explorationEngine.hpp>
+#include <pythonObjects.hpp>
+#include <pythonUtils.hpp>
+#include <pythonXFunctions.hpp>
+
+
+
+/*! \page py_ExplorationEngine_page ExplorationEngine
+    \brief [**python api**] All information about the ExplorationEngine python object.
+
+\tableofcontents
+
+\section py_ExplorationEngine_description Description
+<hr>
+
+This object is used to run the parallel path exploration engine (see \ref exploration_engine_page). The worker threads
+use their own contexts, so an exploration does not modify the state of the current context.
+
+\subsection py_ExplorationEngine_example Example
+
+~~~~~~~~~~~~~{.py}
+>>> engine = ExplorationEngine(ARCH.X86_64, 4)
+>>> engine.addMemoryArea(0x40056d, function)
+>>> engine.setEntryPoint(0x40056d)
+>>> engine.setConcreteRegisterValue(Register(REG.RDI, 0x1000))
+>>> engine.addSymbolicInput(0x1000, 5)
+
+>>> for input in engine.explore({}):
+...     print input
+...
+{4096L: 101L}
+{4096L: 101L, 4097L: 108L}
+~~~~~~~~~~~~~
+
+\subsection py_ExplorationEngine_constructor Constructor
+
+~~~~~~~~~~~~~{.py}
+>>> engine = ExplorationEngine(ARCH.X86_64, 4)
+~~~~~~~~~~~~~
+
+\section ExplorationEngine_py_api Python API - Methods of the ExplorationEngine class
+<hr>
+
+- **addMemoryArea(integer baseAddr, [integer,])**<br>
+Adds an area into the memory image.
+
+- **addMemoryArea(integer baseAddr, bytes values)**<br>
+Adds an area into the memory image.
+
+- **addSymbolicInput(integer addr, integer size)**<br>
+Marks the range `[addr:size]` as symbolic input. Each byte is a symbolic variable.
+
+- **explore(dict seed)**<br>
+Explores the paths from an initial input (a dictionary of {integer addr : integer byte}) and returns the new inputs as a list of
+dictionaries, in the order they have been found.
+
+- **getCoverage(void)**<br>
+Returns the addresses of the covered basic blocks as a sorted list of integers.
+
+- **getNumberOfRuns(void)**<br>
+Returns the number of runs of the last exploration.
+
+- **loadBinary(\ref py_Elf_page binary)**<br>
+Adds the loadable segments of an ELF binary into the memory image and sets the entry point.
+
+- **setConcreteRegisterValue(\ref py_REG_page reg)**<br>
+Sets the value of a register at the entry point.
+
+- **setEntryPoint(integer addr)**<br>
+Sets the entry point.
+
+- **setMaxInstructions(integer max)**<br>
+Sets the maximum number of instructions of a run.
+
+- **setMaxRuns(integer max)**<br>
+Sets the maximum number of runs (0 = unlimited).
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      //! ExplorationEngine destructor.
+      void ExplorationEngine_dealloc(PyObject* self) {
+        std::cout << std::flush;
+        delete PyExplorationEngine_AsExplorationEngine(self);
+        Py_DECREF(self);
+      }
+
+
+      static PyObject* ExplorationEngine_addMemoryArea(PyObject* self, PyObject* args) {
+        std::vector<triton::uint8> vv;
+        PyObject* baseAddr  = nullptr;
+        PyObject* values    = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &baseAddr, &values);
+
+        if (baseAddr == nullptr || (!PyLong_Check(baseAddr) && !PyInt_Check(baseAddr)))
+          return PyErr_Format(PyExc_TypeError, "ExplorationEngine::addMemoryArea(): Expects an integer as first argument.");
+
+        if (values == nullptr)
+          return PyErr_Format(PyExc_TypeError, "ExplorationEngine::addMemoryArea(): Expects a list or a bytes array as second argument.");
+
+        // Python object: List
+        if (PyList_Check(values)) {
+          for (Py_ssize_t i = 0; i < PyList_Size(values); i++) {
+            PyObject* item = PyList_GetItem(values, i);
+
+            if ((!PyLong_Check(item) && !PyInt_Check(item)) || PyLong_AsUint32(item) > 0xff)
+              return PyErr_Format(PyExc_TypeError, "ExplorationEngine::addMemoryArea(): Each item of the list must be a 8-bits integer.");
+
+            vv.push_back(static_cast<triton::uint8>(PyLong_AsUint32(item) & 0xff));
+          }
+        }
+
+        // Python object: Bytes
+        else if (PyBytes_Check(values)) {
+          triton::uint8* area = reinterpret_cast<triton::uint8*>(PyBytes_AsString(values));
+          vv.assign(area, area + PyBytes_Size(values));
+        }
+
+        // Invalid Python object
+        else
+          return PyErr_Format(PyExc_TypeError, "ExplorationEngine::addMemoryArea(): Expects a list or a bytes array as second argument.");
+
+        try {
+          PyExplorationEngine_AsExplorationEngine(self)->addMemoryArea(PyLong_AsUint64(baseAddr), vv);
+          Py_INCREF(Py_None);
+          return Py_None;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* ExplorationEngine_addSymbolicInput(PyObject* self, PyObject* args) {
+        PyObject* addr = nullptr;
+        PyObject* size = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &addr, &size);
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "ExplorationEngine::addSymbolicInput(): Expects an integer as first argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "ExplorationEngine::addSymbolicInput(): Expects an integer as second argument.");
+
+        try {
+          PyExplorationEngine_AsExplorationEngine(self)->addSymbolicInput(PyLong_AsUint64(addr), PyLong_AsUsize(size));
+          Py_INCREF(Py_None);
+          return Py_None;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* ExplorationEngine_explore(PyObject* self, PyObject* seed) {
+        triton::engines::exploration::ExplorationEngine::Input cseed;
+        std::vector<triton::engines::exploration::ExplorationEngine::Input> inputs;
+        PyObject* key   = nullptr;
+        PyObject* value = nullptr;
+        PyObject* ret   = nullptr;
+        Py_ssize_t pos  = 0;
+
+        if (seed == nullptr || !PyDict_Check(seed))
+          return PyErr_Format(PyExc_TypeError, "ExplorationEngine::explore(): Expects a dictionary as argument.");
+
+        while (PyDict_Next(seed, &pos, &key, &value)) {
+          if ((!PyLong_Check(key) && !PyInt_Check(key)) || (!PyLong_Check(value) && !PyInt_Check(value)) || PyLong_AsUint32(value) > 0xff)
+            return PyErr_Format(PyExc_TypeError, "ExplorationEngine::explore(): Expects a dictionary of {integer : 8-bits integer}.");
+          cseed[PyLong_AsUint64(key)] = static_cast<triton::uint8>(PyLong_AsUint32(value));
+        }
+
+        try {
+          /* The callbacks are never called concurrently */
+          PyExplorationEngine_AsExplorationEngine(self)->setInputCallback([&inputs](const triton::engines::exploration::ExplorationEngine::Input& input) {
+            inputs.push_back(input);
+          });
+          PyExplorationEngine_AsExplorationEngine(self)->explore(cseed);
+          PyExplorationEngine_AsExplorationEngine(self)->setInputCallback(nullptr);
+        }
+        catch (const std::exception& e) {
+          PyExplorationEngine_AsExplorationEngine(self)->setInputCallback(nullptr);
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        ret = xPyList_New(inputs.size());
+        for (triton::usize index = 0; index < inputs.size(); index++) {
+          PyObject* input = xPyDict_New();
+          for (auto it = inputs[index].begin(); it != inputs[index].end(); it++)
+            PyDict_SetItem(input, PyLong_FromUint64(it->first), PyLong_FromUint32(it->second));
+          PyList_SetItem(ret, index, input);
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* ExplorationEngine_getCoverage(PyObject* self, PyObject* noarg) {
+        try {
+          std::set<triton::uint64> coverage = PyExplorationEngine_AsExplorationEngine(self)->getCoverage();
+          PyObject* ret                     = xPyList_New(coverage.size());
+          triton::usize index               = 0;
+
+          for (auto it = coverage.begin(); it != coverage.end(); it++)
+            PyList_SetItem(ret, index++, PyLong_FromUint64(*it));
+
+          return ret;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* ExplorationEngine_getNumberOfRuns(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyExplorationEngine_AsExplorationEngine(self)->getNumberOfRuns());
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* ExplorationEngine_loadBinary(PyObject* self, PyObject* binary) {
+        if (binary == nullptr || !PyElf_Check(binary))
+          return PyErr_Format(PyExc_TypeError, "ExplorationEngine::loadBinary(): Expects an Elf as argument.");
+
+        try {
+          PyExplorationEngine_AsExplorationEngine(self)->loadBinary(*PyElf_AsElf(binary));
+          Py_INCREF(Py_None);
+          return Py_None;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* ExplorationEngine_setConcreteRegisterValue(PyObject* self, PyObject* reg) {
+        if (reg == nullptr || !PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "ExplorationEngine::setConcreteRegisterValue(): Expects a REG as argument.");
+
+        try {
+          triton::arch::Register* r = PyRegister_AsRegister(reg);
+          PyExplorationEngine_AsExplorationEngine(self)->setConcreteRegisterValue(r->getId(), r->getConcreteValue());
+          Py_INCREF(Py_None);
+          return Py_None;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* ExplorationEngine_setEntryPoint(PyObject* self, PyObject* addr) {
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "ExplorationEngine::setEntryPoint(): Expects an integer as argument.");
+
+        try {
+          PyExplorationEngine_AsExplorationEngine(self)->setEntryPoint(PyLong_AsUint64(addr));
+          Py_INCREF(Py_None);
+          return Py_None;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* ExplorationEngine_setMaxInstructions(PyObject* self, PyObject* max) {
+        if (max == nullptr || (!PyLong_Check(max) && !PyInt_Check(max)))
+          return PyErr_Format(PyExc_TypeError, "ExplorationEngine::setMaxInstructions(): Expects an integer as argument.");
+
+        try {
+          PyExplorationEngine_AsExplorationEngine(self)->setMaxInstructions(PyLong_AsUsize(max));
+          Py_INCREF(Py_None);
+          return Py_None;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* ExplorationEngine_setMaxRuns(PyObject* self, PyObject* max) {
+        if (max == nullptr || (!PyLong_Check(max) && !PyInt_Check(max)))
+          return PyErr_Format(PyExc_TypeError, "ExplorationEngine::setMaxRuns(): Expects an integer as argument.");
+
+        try {
+          PyExplorationEngine_AsExplorationEngine(self)->setMaxRuns(PyLong_AsUsize(max));
+          Py_INCREF(Py_None);
+          return Py_None;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      //! ExplorationEngine methods.
+      PyMethodDef ExplorationEngine_callbacks[] = {
+        {"addMemoryArea",             ExplorationEngine_addMemoryArea,              METH_VARARGS,   ""},
+        {"addSymbolicInput",          ExplorationEngine_addSymbolicInput,           METH_VARARGS,   ""},
+        {"explore",                   ExplorationEngine_explore,                    METH_O,         ""},
+        {"getCoverage",               ExplorationEngine_getCoverage,                METH_NOARGS,    ""},
+        {"getNumberOfRuns",           ExplorationEngine_getNumberOfRuns,            METH_NOARGS,    ""},
+        {"loadBinary",                ExplorationEngine_loadBinary,                 METH_O,         ""},
+        {"setConcreteRegisterValue",  ExplorationEngine_setConcreteRegisterValue,   METH_O,         ""},
+        {"setEntryPoint",             ExplorationEngine_setEntryPoint,              METH_O,         ""},
+        {"setMaxInstructions",        ExplorationEngine_setMaxInstructions,         METH_O,         ""},
+        {"setMaxRuns",                ExplorationEngine_setMaxRuns,                 METH_O,         ""},
+        {nullptr,                     nullptr,                                      0,              nullptr}
+      };
+
+
+      PyTypeObject ExplorationEngine_Type = {
+        PyObject_HEAD_INIT(&PyType_Type)
+        0,                                          /* ob_size */
+        "ExplorationEngine",                        /* tp_name */
+        sizeof(ExplorationEngine_Object),           /* tp_basicsize */
+        0,                                          /* tp_itemsize */
+        (destructor)ExplorationEngine_dealloc,      /* tp_dealloc */
+        0,                                          /* tp_print */
+        0,                                          /* tp_getattr */
+        0,                                          /* tp_setattr */
+        0,                                          /* tp_compare */
+        0,                                          /* tp_repr */
+        0,                                          /* tp_as_number */
+        0,                                          /* tp_as_sequence */
+        0,                                          /* tp_as_mapping */
+        0,                                          /* tp_hash */
+        0,                                          /* tp_call */
+        0,                                          /* tp_str */
+        0,                                          /* tp_getattro */
+        0,                                          /* tp_setattro */
+        0,                                          /* tp_as_buffer */
+        Py_TPFLAGS_DEFAULT,                         /* tp_flags */
+        "ExplorationEngine objects",                /* tp_doc */
+        0,                                          /* tp_traverse */
+        0,                                          /* tp_clear */
+        0,                                          /* tp_richcompare */
+        0,                                          /* tp_weaklistoffset */
+        0,                                          /* tp_iter */
+        0,                                          /* tp_iternext */
+        ExplorationEngine_callbacks,                /* tp_methods */
+        0,                                          /* tp_members */
+        0,                                          /* tp_getset */
+        0,                                          /* tp_base */
+        0,                                          /* tp_dict */
+        0,                                          /* tp_descr_get */
+        0,                                          /* tp_descr_set */
+        0,                                          /* tp_dictoffset */
+        0,                                          /* tp_init */
+        0,                                          /* tp_alloc */
+        0,                                          /* tp_new */
+        0,                                          /* tp_free */
+        0,                                          /* tp_is_gc */
+        0,                                          /* tp_bases */
+        0,                                          /* tp_mro */
+        0,                                          /* tp_cache */
+        0,                                          /* tp_subclasses */
+        0,                                          /* tp_weaklist */
+        0,                                          /* tp_del */
+        0                                           /* tp_version_tag */
+      };
+
+
+      PyObject* PyExplorationEngine(triton::uint32 arch, triton::uint32 workers) {
+        ExplorationEngine_Object* object;
+
+        PyType_Ready(&ExplorationEngine_Type);
+        object = PyObject_NEW(ExplorationEngine_Object, &ExplorationEngine_Type);
+        if (object != NULL)
+          object->engine = new triton::engines::exploration::ExplorationEngine(arch, workers);
+
+        return (PyObject*)object;
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
+
+#endif /* TRITON_PYTHON_BINDINGS */
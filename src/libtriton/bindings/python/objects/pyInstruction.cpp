@@ -134,6 +134,7 @@ Returns the type of the instruction as \ref py_OPCODE_page.
 
 - **getWrittenRegisters(void)**<br>
 Returns a list of tuple <\ref py_Register_page, \ref py_AstNode_page> which represents all implicit and explicit register (flags includes) outputs.
+With the `OPTIMIZATION.LAZY_FLAGS` optimization, the \ref py_AstNode_page of a flag is `None` as its AST is built only when the flag is read.
 
 - **isBranch(void)**<br>
 Returns true if the instruction modifies is a branch (i.e x86: JUMP, JCC).
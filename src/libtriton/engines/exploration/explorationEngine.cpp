@@ -0,0 +1,426 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <thread>
+
+#include <cpuSize.hpp>
+#include <elfEnums.hpp>
+#include <exceptions.hpp>
+#include <explorationEngine.hpp>
+#include <x86Specifications.hpp>
+
+
+
+/*! \page exploration_engine_page Exploration Engine
+    \brief [**internal**] All information about the exploration engine.
+
+\tableofcontents
+
+\section exploration_description Description
+<hr>
+
+The exploration engine (triton::engines::exploration::ExplorationEngine) runs a generational search in parallel. Each worker
+thread owns its own context (triton::API), runs an input from the entry point and negates the branches of its path constraints
+with the incremental solver session of its context. Each model gives a new input. A branch is only negated once for the whole
+exploration, and each input only negates the branches found after the branch which has generated it. A branch is identified by
+its source and destination addresses and by the number of times its source address has been executed before in the run, so the
+n-th iteration of a loop is a different branch from the first one.
+
+\section exploration_example C++ example
+<hr>
+
+~~~~~~~~~~~~~{cpp}
+  triton::engines::exploration::ExplorationEngine engine(triton::arch::ARCH_X86_64, 4);
+
+  engine.addMemoryArea(0x400000, code);
+  engine.setEntryPoint(0x400000);
+  engine.setConcreteRegisterValue(triton::arch::x86::ID_REG_RDI, 0x1000);
+  engine.addSymbolicInput(0x1000, 5);
+
+  engine.setInputCallback([](const triton::engines::exploration::ExplorationEngine::Input& input) {
+    // new input
+  });
+
+  engine.explore(triton::engines::exploration::ExplorationEngine::Input());
+~~~~~~~~~~~~~
+
+*/
+
+
+
+namespace triton {
+  namespace engines {
+    namespace exploration {
+
+      ExplorationEngine::ExplorationEngine(triton::uint32 arch, triton::uint32 workers) {
+        if (workers == 0)
+          throw triton::exceptions::ExplorationEngine("ExplorationEngine::ExplorationEngine(): There must be at least one worker.");
+
+        this->arch            = arch;
+        this->entryPoint      = 0;
+        this->maxInstructions = 100000;
+        this->maxRuns         = 0;
+        this->pending         = 0;
+        this->runs            = 0;
+        this->stopped         = false;
+
+        /* The architecture of the contexts must be set before starting the threads */
+        for (triton::uint32 index = 0; index < workers; index++) {
+          Worker* worker = new Worker();
+          worker->context = new triton::API();
+          this->workers.push_back(worker);
+          worker->context->setArchitecture(arch);
+        }
+
+        /* Checks that the program counter is known */
+        this->getProgramCounterId();
+      }
+
+
+      ExplorationEngine::~ExplorationEngine() {
+        for (auto it = this->workers.begin(); it != this->workers.end(); it++) {
+          delete (*it)->context;
+          delete *it;
+        }
+      }
+
+
+      triton::uint32 ExplorationEngine::getProgramCounterId(void) const {
+        switch (this->arch) {
+          case triton::arch::ARCH_X86:
+            return triton::arch::x86::ID_REG_EIP;
+          case triton::arch::ARCH_X86_64:
+            return triton::arch::x86::ID_REG_RIP;
+          default:
+            throw triton::exceptions::ExplorationEngine("ExplorationEngine::getProgramCounterId(): Invalid architecture.");
+        }
+      }
+
+
+      void ExplorationEngine::addMemoryArea(triton::uint64 baseAddr, const std::vector<triton::uint8>& values) {
+        if (values.empty())
+          return;
+        this->image[baseAddr] = values;
+      }
+
+
+      void ExplorationEngine::loadBinary(const triton::format::elf::Elf& binary) {
+        const std::vector<triton::format::elf::ElfProgramHeader>& phdrs = binary.getProgramHeaders();
+
+        for (auto it = phdrs.begin(); it != phdrs.end(); it++) {
+          if (it->getType() != triton::format::elf::PT_LOAD)
+            continue;
+
+          if (it->getOffset() + it->getFilesz() > binary.getSize())
+            throw triton::exceptions::ExplorationEngine("ExplorationEngine::loadBinary(): Invalid segment.");
+
+          /* The bytes after the file size are zeros */
+          std::vector<triton::uint8> values(it->getMemsz(), 0x00);
+          std::copy(binary.getRaw() + it->getOffset(), binary.getRaw() + it->getOffset() + std::min(it->getFilesz(), it->getMemsz()), values.begin());
+
+          this->addMemoryArea(it->getVaddr(), values);
+        }
+
+        this->setEntryPoint(binary.getHeader().getEntry());
+      }
+
+
+      void ExplorationEngine::setEntryPoint(triton::uint64 addr) {
+        this->entryPoint = addr;
+      }
+
+
+      void ExplorationEngine::setConcreteRegisterValue(triton::uint32 regId, triton::uint512 value) {
+        this->registers[regId] = value;
+      }
+
+
+      void ExplorationEngine::addSymbolicInput(triton::uint64 addr, triton::usize size) {
+        this->symbolicInputs[addr] = size;
+      }
+
+
+      void ExplorationEngine::enableSymbolicOptimization(enum triton::engines::symbolic::optimization_e opti) {
+        this->optimizations.insert(opti);
+      }
+
+
+      void ExplorationEngine::setMaxInstructions(triton::usize max) {
+        this->maxInstructions = max;
+      }
+
+
+      void ExplorationEngine::setMaxRuns(triton::usize max) {
+        this->maxRuns = max;
+      }
+
+
+      void ExplorationEngine::setInputCallback(std::function<void(const Input&)> cb) {
+        this->inputCallback = cb;
+      }
+
+
+      void ExplorationEngine::setCoverageCallback(std::function<void(triton::uint64)> cb) {
+        this->coverageCallback = cb;
+      }
+
+
+      bool ExplorationEngine::isInImage(triton::uint64 addr) const {
+        auto it = this->image.upper_bound(addr);
+
+        if (it == this->image.begin())
+          return false;
+
+        it--;
+        return (addr - it->first) < it->second.size();
+      }
+
+
+      bool ExplorationEngine::popWorkItem(Worker* worker, WorkItem& item) {
+        /* The newest input of the worker */
+        {
+          std::lock_guard<std::mutex> lock(worker->mutex);
+          if (!worker->queue.empty()) {
+            item = worker->queue.back();
+            worker->queue.pop_back();
+            return true;
+          }
+        }
+
+        /* The oldest input of another worker */
+        for (auto it = this->workers.begin(); it != this->workers.end(); it++) {
+          if (*it == worker)
+            continue;
+          std::lock_guard<std::mutex> lock((*it)->mutex);
+          if (!(*it)->queue.empty()) {
+            item = (*it)->queue.front();
+            (*it)->queue.pop_front();
+            return true;
+          }
+        }
+
+        return false;
+      }
+
+
+      void ExplorationEngine::pushWorkItem(Worker* worker, const Input& input, triton::usize bound) {
+        WorkItem item;
+
+        item.input = input;
+        item.bound = bound;
+
+        this->pending++;
+
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        worker->queue.push_back(item);
+      }
+
+
+      void ExplorationEngine::work(Worker* worker) {
+        /* The engines of this thread work on the context of the worker */
+        triton::setContext(worker->context);
+
+        try {
+          while (!this->stopped) {
+            WorkItem item;
+
+            if (!this->popWorkItem(worker, item)) {
+              if (this->pending == 0)
+                break;
+              std::this_thread::yield();
+              continue;
+            }
+
+            if (this->maxRuns && this->runs++ >= this->maxRuns) {
+              this->runs--;
+              this->stopped = true;
+              break;
+            }
+            else if (!this->maxRuns) {
+              this->runs++;
+            }
+
+            this->run(worker, item);
+            this->pending--;
+          }
+        }
+        catch (...) {
+          std::lock_guard<std::mutex> lock(this->mutex);
+          if (!this->error)
+            this->error = std::current_exception();
+          this->stopped = true;
+        }
+
+        triton::setContext(nullptr);
+      }
+
+
+      void ExplorationEngine::run(Worker* worker, const WorkItem& item) {
+        triton::API& ctx = *worker->context;
+        std::map<triton::usize, triton::uint64> variables;
+        std::vector<triton::uint64> blocks;
+        triton::arch::Register pc(this->getProgramCounterId());
+        triton::uint64 addr = this->entryPoint;
+        bool newBlock = true;
+
+        /* Initial state */
+        ctx.resetEngines();
+        for (auto it = this->optimizations.begin(); it != this->optimizations.end(); it++)
+          ctx.enableSymbolicOptimization(*it, true);
+
+        for (auto it = this->image.begin(); it != this->image.end(); it++)
+          ctx.setConcreteMemoryAreaValue(it->first, it->second);
+
+        for (auto it = this->registers.begin(); it != this->registers.end(); it++)
+          ctx.setConcreteRegisterValue(triton::arch::Register(it->first, it->second));
+
+        for (auto it = item.input.begin(); it != item.input.end(); it++)
+          ctx.setConcreteMemoryValue(it->first, it->second);
+
+        for (auto it = this->symbolicInputs.begin(); it != this->symbolicInputs.end(); it++) {
+          for (triton::usize index = 0; index < it->second; index++) {
+            triton::engines::symbolic::SymbolicVariable* var = ctx.convertMemoryToSymbolicVariable(triton::arch::MemoryAccess(it->first + index, BYTE_SIZE));
+            variables[var->getId()] = it->first + index;
+          }
+        }
+
+        /* Runs until the program counter leaves the image */
+        for (triton::usize count = 0; count < this->maxInstructions && this->isInImage(addr); count++) {
+          std::vector<triton::uint8> opcodes = ctx.getConcreteMemoryAreaValue(addr, 16);
+          triton::arch::Instruction inst;
+
+          inst.setOpcodes(opcodes.data(), static_cast<triton::uint32>(opcodes.size()));
+          inst.setAddress(addr);
+
+          /* An unsupported instruction ends the run */
+          try {
+            ctx.processing(inst);
+          }
+          catch (const triton::exceptions::Exception&) {
+            break;
+          }
+
+          if (newBlock)
+            blocks.push_back(addr);
+
+          newBlock = inst.isControlFlow();
+          addr     = ctx.getConcreteRegisterValue(pc).convert_to<triton::uint64>();
+        }
+
+        const std::vector<triton::engines::symbolic::PathConstraint>& pcs = ctx.getPathConstraints();
+        std::vector<triton::usize> occurrences = this->getOccurrences(pcs);
+        this->recordCoverage(blocks, pcs, occurrences);
+
+        /* Negates the branches from the bound, the prefixes are asked in increasing order */
+        for (triton::usize index = item.bound; index < pcs.size() && !this->stopped; index++) {
+          if (!pcs[index].isMultipleBranches())
+            continue;
+
+          const std::vector<std::tuple<bool, triton::uint64, triton::uint64, triton::ast::AbstractNode*>>& branches = pcs[index].getBranchConstraints();
+          for (auto it = branches.begin(); it != branches.end(); it++) {
+            if (std::get<0>(*it) || !this->tryBranch(std::get<1>(*it), std::get<2>(*it), occurrences[index]))
+              continue;
+
+            std::map<triton::uint32, triton::engines::solver::SolverModel> model = ctx.checkWithAssumption(std::get<3>(*it), index);
+            if (model.empty())
+              continue;
+
+            Input input = item.input;
+            for (auto m = model.begin(); m != model.end(); m++) {
+              auto var = variables.find(m->first);
+              if (var != variables.end())
+                input[var->second] = static_cast<triton::uint8>(m->second.getValue().convert_to<triton::uint64>() & 0xff);
+            }
+
+            {
+              std::lock_guard<std::mutex> lock(this->mutex);
+              if (this->inputCallback)
+                this->inputCallback(input);
+            }
+
+            this->pushWorkItem(worker, input, index + 1);
+          }
+        }
+      }
+
+
+      std::vector<triton::usize> ExplorationEngine::getOccurrences(const std::vector<triton::engines::symbolic::PathConstraint>& pcs) const {
+        std::map<triton::uint64, triton::usize> counts;
+        std::vector<triton::usize> occurrences;
+
+        for (auto it = pcs.begin(); it != pcs.end(); it++) {
+          const std::vector<std::tuple<bool, triton::uint64, triton::uint64, triton::ast::AbstractNode*>>& branches = it->getBranchConstraints();
+          occurrences.push_back(branches.empty() ? 0 : counts[std::get<1>(branches.front())]++);
+        }
+
+        return occurrences;
+      }
+
+
+      void ExplorationEngine::recordCoverage(const std::vector<triton::uint64>& blocks, const std::vector<triton::engines::symbolic::PathConstraint>& pcs, const std::vector<triton::usize>& occurrences) {
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        for (auto it = blocks.begin(); it != blocks.end(); it++) {
+          if (this->coverage.insert(*it).second && this->coverageCallback)
+            this->coverageCallback(*it);
+        }
+
+        for (triton::usize index = 0; index < pcs.size(); index++) {
+          const std::vector<std::tuple<bool, triton::uint64, triton::uint64, triton::ast::AbstractNode*>>& branches = pcs[index].getBranchConstraints();
+          for (auto b = branches.begin(); b != branches.end(); b++) {
+            if (std::get<0>(*b))
+              this->branches.insert(std::make_tuple(std::get<1>(*b), std::get<2>(*b), occurrences[index]));
+          }
+        }
+      }
+
+
+      bool ExplorationEngine::tryBranch(triton::uint64 srcAddr, triton::uint64 dstAddr, triton::usize occurrence) {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->branches.insert(std::make_tuple(srcAddr, dstAddr, occurrence)).second;
+      }
+
+
+      void ExplorationEngine::explore(const Input& seed) {
+        std::vector<std::thread> threads;
+
+        this->pending = 0;
+        this->runs    = 0;
+        this->stopped = false;
+        this->error   = nullptr;
+
+        this->pushWorkItem(this->workers.front(), seed, 0);
+
+        for (auto it = this->workers.begin(); it != this->workers.end(); it++)
+          threads.push_back(std::thread(&ExplorationEngine::work, this, *it));
+
+        for (auto it = threads.begin(); it != threads.end(); it++)
+          it->join();
+
+        /* Drops the inputs left by a stop */
+        for (auto it = this->workers.begin(); it != this->workers.end(); it++)
+          (*it)->queue.clear();
+
+        if (this->error)
+          std::rethrow_exception(this->error);
+      }
+
+
+      std::set<triton::uint64> ExplorationEngine::getCoverage(void) {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->coverage;
+      }
+
+
+      triton::usize ExplorationEngine::getNumberOfRuns(void) const {
+        return this->runs;
+      }
+
+    }; /* exploration namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
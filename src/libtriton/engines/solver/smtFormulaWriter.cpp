@@ -0,0 +1,352 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <utility>
+#include <vector>
+
+#include <api.hpp>
+#include <exceptions.hpp>
+#include <smtFormulaWriter.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* Returns the text written before the child `index` of a node (or after its last child) */
+      static const char* getSmtToken(triton::ast::AbstractNode* node, triton::usize index) {
+        triton::usize last = node->getChilds().size();
+        const char* op     = nullptr;
+
+        switch (node->getKind()) {
+          case triton::ast::ASSERT_NODE:            op = "(assert "; break;
+          case triton::ast::BVADD_NODE:             op = "(bvadd "; break;
+          case triton::ast::BVAND_NODE:             op = "(bvand "; break;
+          case triton::ast::BVASHR_NODE:            op = "(bvashr "; break;
+          case triton::ast::BVLSHR_NODE:            op = "(bvlshr "; break;
+          case triton::ast::BVMUL_NODE:             op = "(bvmul "; break;
+          case triton::ast::BVNAND_NODE:            op = "(bvnand "; break;
+          case triton::ast::BVNEG_NODE:             op = "(bvneg "; break;
+          case triton::ast::BVNOR_NODE:             op = "(bvnor "; break;
+          case triton::ast::BVNOT_NODE:             op = "(bvnot "; break;
+          case triton::ast::BVOR_NODE:              op = "(bvor "; break;
+          case triton::ast::BVSDIV_NODE:            op = "(bvsdiv "; break;
+          case triton::ast::BVSGE_NODE:             op = "(bvsge "; break;
+          case triton::ast::BVSGT_NODE:             op = "(bvsgt "; break;
+          case triton::ast::BVSHL_NODE:             op = "(bvshl "; break;
+          case triton::ast::BVSLE_NODE:             op = "(bvsle "; break;
+          case triton::ast::BVSLT_NODE:             op = "(bvslt "; break;
+          case triton::ast::BVSMOD_NODE:            op = "(bvsmod "; break;
+          case triton::ast::BVSREM_NODE:            op = "(bvsrem "; break;
+          case triton::ast::BVSUB_NODE:             op = "(bvsub "; break;
+          case triton::ast::BVUDIV_NODE:            op = "(bvudiv "; break;
+          case triton::ast::BVUGE_NODE:             op = "(bvuge "; break;
+          case triton::ast::BVUGT_NODE:             op = "(bvugt "; break;
+          case triton::ast::BVULE_NODE:             op = "(bvule "; break;
+          case triton::ast::BVULT_NODE:             op = "(bvult "; break;
+          case triton::ast::BVUREM_NODE:            op = "(bvurem "; break;
+          case triton::ast::BVXNOR_NODE:            op = "(bvxnor "; break;
+          case triton::ast::BVXOR_NODE:             op = "(bvxor "; break;
+          case triton::ast::CONCAT_NODE:            op = "(concat "; break;
+          case triton::ast::DISTINCT_NODE:          op = "(distinct "; break;
+          case triton::ast::EQUAL_NODE:             op = "(= "; break;
+          case triton::ast::ITE_NODE:               op = "(ite "; break;
+          case triton::ast::LAND_NODE:              op = "(and "; break;
+          case triton::ast::LNOT_NODE:              op = "(not "; break;
+          case triton::ast::LOR_NODE:               op = "(or "; break;
+
+          /* The indexed operators and the commands */
+          case triton::ast::BVDECL_NODE:            return (index == 0) ? "(_ BitVec " : ")";
+          case triton::ast::BV_NODE:                return (index == 0) ? "(_ bv" : (index == 1) ? " " : ")";
+          case triton::ast::BVROL_NODE:             return (index == 0) ? "((_ rotate_left " : (index == 1) ? ") " : ")";
+          case triton::ast::BVROR_NODE:             return (index == 0) ? "((_ rotate_right " : (index == 1) ? ") " : ")";
+          case triton::ast::SX_NODE:                return (index == 0) ? "((_ sign_extend " : (index == 1) ? ") " : ")";
+          case triton::ast::ZX_NODE:                return (index == 0) ? "((_ zero_extend " : (index == 1) ? ") " : ")";
+          case triton::ast::EXTRACT_NODE:           return (index == 0) ? "((_ extract " : (index == 1) ? " " : (index == 2) ? ") " : ")";
+          case triton::ast::LET_NODE:               return (index == 0) ? "(let ((" : (index == 1) ? " " : (index == 2) ? ")) " : ")";
+          case triton::ast::DECLARE_FUNCTION_NODE:  return (index == 0) ? "(declare-fun " : (index == 1) ? " () " : ")";
+          case triton::ast::COMPOUND_NODE:          return (index == 0 || index == last) ? "" : "\n";
+
+          default:
+            throw triton::exceptions::SolverEngine("SmtFormulaWriter::getSmtToken(): Invalid kind node.");
+        }
+
+        if (index == 0)
+          return op;
+
+        return (index == last) ? ")" : " ";
+      }
+
+
+      SmtFormulaWriter::SmtFormulaWriter(std::ostream& stream) : stream(stream) {
+      }
+
+
+      SmtFormulaWriter::~SmtFormulaWriter() {
+      }
+
+
+      void SmtFormulaWriter::analyze(triton::ast::AbstractNode* node) {
+        std::vector<triton::ast::AbstractNode*> worklist;
+        std::vector<triton::ast::AbstractNode*> lets;
+
+        this->uses[node] = 0;
+        worklist.push_back(node);
+
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back();
+          worklist.pop_back();
+
+          switch (current->getKind()) {
+            /* The AST of a referenced expression is used once by its definition */
+            case triton::ast::REFERENCE_NODE: {
+              triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(current)->getValue();
+              if (this->references.find(id) == this->references.end()) {
+                triton::ast::AbstractNode* target = triton::getContext().getSymbolicExpressionFromId(id)->getAst();
+                this->references[id] = target;
+                if (this->uses.find(target) == this->uses.end()) {
+                  this->uses[target] = 1;
+                  worklist.push_back(target);
+                }
+                else
+                  this->uses[target]++;
+              }
+              continue;
+            }
+
+            case triton::ast::VARIABLE_NODE:
+              this->variables[reinterpret_cast<triton::ast::VariableNode*>(current)->getValue()] = current->getBitvectorSize();
+              continue;
+
+            case triton::ast::LET_NODE:
+              lets.push_back(current);
+              break;
+
+            default:
+              break;
+          }
+
+          for (triton::ast::AbstractNode* child : current->getChilds()) {
+            auto it = this->uses.find(child);
+            if (it == this->uses.end()) {
+              this->uses[child] = 1;
+              worklist.push_back(child);
+            }
+            else
+              it->second++;
+          }
+        }
+
+        /* The subterms of a let may use its variable, they are written inline */
+        for (triton::ast::AbstractNode* let : lets) {
+          worklist.push_back(let);
+          while (!worklist.empty()) {
+            triton::ast::AbstractNode* current = worklist.back();
+            worklist.pop_back();
+            if (current->getKind() == triton::ast::REFERENCE_NODE || !this->scoped.insert(current).second)
+              continue;
+            for (triton::ast::AbstractNode* child : current->getChilds())
+              worklist.push_back(child);
+          }
+        }
+      }
+
+
+      bool SmtFormulaWriter::isShareable(triton::ast::AbstractNode* node) const {
+        switch (node->getKind()) {
+          case triton::ast::ASSERT_NODE:
+          case triton::ast::BVDECL_NODE:
+          case triton::ast::BV_NODE:
+          case triton::ast::COMPOUND_NODE:
+          case triton::ast::DECIMAL_NODE:
+          case triton::ast::DECLARE_FUNCTION_NODE:
+          case triton::ast::REFERENCE_NODE:
+          case triton::ast::STRING_NODE:
+          case triton::ast::VARIABLE_NODE:
+            return false;
+          default:
+            break;
+        }
+
+        auto it = this->uses.find(node);
+        if (it == this->uses.end() || it->second < 2)
+          return false;
+
+        return this->scoped.find(node) == this->scoped.end();
+      }
+
+
+      bool SmtFormulaWriter::isLogical(triton::ast::AbstractNode* node) const {
+        while (true) {
+          switch (node->getKind()) {
+            case triton::ast::BVSGE_NODE:
+            case triton::ast::BVSGT_NODE:
+            case triton::ast::BVSLE_NODE:
+            case triton::ast::BVSLT_NODE:
+            case triton::ast::BVUGE_NODE:
+            case triton::ast::BVUGT_NODE:
+            case triton::ast::BVULE_NODE:
+            case triton::ast::BVULT_NODE:
+            case triton::ast::DISTINCT_NODE:
+            case triton::ast::EQUAL_NODE:
+            case triton::ast::LAND_NODE:
+            case triton::ast::LNOT_NODE:
+            case triton::ast::LOR_NODE:
+              return true;
+
+            /* The sort of an ite or a let is the sort of its value */
+            case triton::ast::ITE_NODE:
+              node = node->getChilds()[1];
+              break;
+
+            case triton::ast::LET_NODE:
+              node = node->getChilds()[2];
+              break;
+
+            case triton::ast::REFERENCE_NODE:
+              node = this->references.at(reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue());
+              break;
+
+            default:
+              return false;
+          }
+        }
+      }
+
+
+      void SmtFormulaWriter::writeSort(triton::ast::AbstractNode* node) {
+        if (this->isLogical(node))
+          this->stream << "Bool";
+        else
+          this->stream << "(_ BitVec " << node->getBitvectorSize() << ")";
+      }
+
+
+      void SmtFormulaWriter::writeDefinitions(triton::ast::AbstractNode* node) {
+        std::vector<std::pair<triton::ast::AbstractNode*, bool>> worklist;
+
+        /* Post-order walk, a shared subterm is defined after its own shared subterms */
+        worklist.push_back(std::make_pair(node, false));
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back().first;
+          bool expanded                      = worklist.back().second;
+
+          if (current->getKind() == triton::ast::REFERENCE_NODE || this->defined.find(current) != this->defined.end()) {
+            worklist.pop_back();
+            continue;
+          }
+
+          if (!expanded) {
+            std::vector<triton::ast::AbstractNode*>& childs = current->getChilds();
+            worklist.back().second = true;
+            for (auto it = childs.rbegin(); it != childs.rend(); it++)
+              worklist.push_back(std::make_pair(*it, false));
+            continue;
+          }
+
+          worklist.pop_back();
+          if (!this->isShareable(current))
+            continue;
+
+          triton::usize id = this->defined.size();
+          this->stream << "(define-fun node!" << id << " () ";
+          this->writeSort(current);
+          this->stream << " ";
+          this->writeTerm(current);
+          this->stream << ")\n";
+          this->defined[current] = id;
+        }
+      }
+
+
+      void SmtFormulaWriter::writeTerm(triton::ast::AbstractNode* node) {
+        std::vector<std::pair<triton::ast::AbstractNode*, triton::usize>> worklist;
+
+        worklist.push_back(std::make_pair(node, 0));
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back().first;
+          triton::usize index                = worklist.back().second;
+
+          if (index == 0) {
+            auto it = this->defined.find(current);
+            if (it != this->defined.end()) {
+              this->stream << "node!" << it->second;
+              worklist.pop_back();
+              continue;
+            }
+
+            bool leaf = true;
+            switch (current->getKind()) {
+              case triton::ast::DECIMAL_NODE:   this->stream << reinterpret_cast<triton::ast::DecimalNode*>(current)->getValue(); break;
+              case triton::ast::REFERENCE_NODE: this->stream << "ref!" << reinterpret_cast<triton::ast::ReferenceNode*>(current)->getValue(); break;
+              case triton::ast::STRING_NODE:    this->stream << reinterpret_cast<triton::ast::StringNode*>(current)->getValue(); break;
+              case triton::ast::VARIABLE_NODE:  this->stream << reinterpret_cast<triton::ast::VariableNode*>(current)->getValue(); break;
+              default:                          leaf = false; break;
+            }
+
+            if (leaf) {
+              worklist.pop_back();
+              continue;
+            }
+          }
+
+          std::vector<triton::ast::AbstractNode*>& childs = current->getChilds();
+          this->stream << getSmtToken(current, index);
+
+          if (index == childs.size()) {
+            worklist.pop_back();
+            continue;
+          }
+
+          worklist.back().second++;
+          worklist.push_back(std::make_pair(childs[index], 0));
+        }
+      }
+
+
+      void SmtFormulaWriter::write(triton::ast::AbstractNode* node) {
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SmtFormulaWriter::write(): node cannot be null.");
+
+        this->uses.clear();
+        this->scoped.clear();
+        this->defined.clear();
+        this->references.clear();
+        this->variables.clear();
+
+        this->analyze(node);
+
+        /* First, set the QF_BV flag */
+        this->stream << "(set-logic QF_BV)\n";
+
+        /* Then, declare the symbolic variables used */
+        for (auto it = this->variables.begin(); it != this->variables.end(); it++)
+          this->stream << "(declare-fun " << it->first << " () (_ BitVec " << it->second << "))\n";
+
+        /* Then, define the symbolic expressions referenced. An expression only references older ones */
+        for (auto it = this->references.begin(); it != this->references.end(); it++) {
+          this->writeDefinitions(it->second);
+          this->stream << "(define-fun ref!" << it->first << " () ";
+          this->writeSort(it->second);
+          this->stream << " ";
+          this->writeTerm(it->second);
+          this->stream << ")\n";
+        }
+
+        /* And write the user expression */
+        this->writeDefinitions(node);
+        this->writeTerm(node);
+        this->stream << "\n";
+
+        if (!this->stream)
+          throw triton::exceptions::SolverEngine("SmtFormulaWriter::write(): Cannot write the formula.");
+      }
+
+    }; /* solver namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
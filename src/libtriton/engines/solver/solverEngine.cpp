@@ -11,6 +11,8 @@
 #include <tritonToZ3Ast.hpp>
 #include <z3Result.hpp>
 #include <solverEngine.hpp>
+#include <smtFormulaWriter.hpp>
+#include <solverSession.hpp>
 
 
 
@@ -23,7 +25,11 @@
 <hr>
 
 The solver engine is the interface between a SMT solver and **Triton** itself. All requests are sent to the SMT solver
-as Triton AST (See: \ref py_ast_page). The AST representation as string looks like a manually crafted SMT2-LIB script.
+as Triton AST (See: \ref py_ast_page). The Triton AST is translated in-process into a Z3 AST, each shared subterm being translated
+only once. The AST representation as string looks like a manually crafted SMT2-LIB script and can be exported with
+triton::API::getSmtFormula() for debug purposes, or written into a stream with triton::API::writeSmtFormula() to dump the queries for
+an offline solver. The exported script keeps the sharing of the AST: each referenced symbolic expression is defined once as `ref!N` and
+each shared subterm once as `node!K`, so its size is linear in the number of nodes.
 
 <b>Example:</b>
 
@@ -55,6 +61,14 @@ as Triton AST (See: \ref py_ast_page). The AST representation as string looks li
 (assert (= (ite ...)))
 ~~~~~~~~~~~~~
 
+\section solver_interface_session Incremental solver session
+<hr>
+
+Each call to triton::API::getModel() creates a new z3 context. When several queries share the same path constraints prefix (e.g: when
+each branch of a trace is negated), the incremental solver session (triton::engines::solver::SolverSession) keeps a z3 context alive
+and asserts each path constraint only once. triton::API::checkWithAssumption() solves the first path constraints plus a temporary
+constraint, triton::API::pushSolverSession() and triton::API::popSolverSession() save and restore the asserted constraints.
+
 \section solver_interface_examples C++ example
 <hr>
 
@@ -106,41 +120,61 @@ namespace triton {
 
 
       SolverEngine::SolverEngine() {
+        this->session = nullptr;
       }
 
 
       SolverEngine::~SolverEngine() {
+        delete this->session;
       }
 
 
-      std::list<std::map<triton::uint32, SolverModel>> SolverEngine::getModels(triton::ast::AbstractNode *node, triton::uint32 limit) const {
-        std::list<std::map<triton::uint32, SolverModel>>  ret;
-        std::ostringstream                                formula;
-        z3::context                                       ctx;
-        z3::solver                                        solver(ctx);
-        triton::uint32                                    representationMode = triton::api.getAstRepresentationMode();
+      SolverSession& SolverEngine::getSolverSession(void) {
+        /* The z3 context is only created when the session is used */
+        if (this->session == nullptr)
+          this->session = new SolverSession();
+        return *this->session;
+      }
 
-        if (node == nullptr)
-          throw triton::exceptions::SolverEngine("SolverEngine::getModels(): node cannot be null.");
 
-        /* Switch into the SMT mode */
-        triton::api.setAstRepresentationMode(triton::ast::representations::SMT_REPRESENTATION);
+      void SolverEngine::resetSolverSession(void) {
+        if (this->session != nullptr)
+          this->session->reset();
+      }
 
-        /* First, set the QF_AUFBV flag  */
-        formula << "(set-logic QF_BV)";
 
-        /* Then, delcare all symbolic variables */
-        formula << triton::api.getVariablesDeclaration();
+      void SolverEngine::removeSolverSession(void) {
+        delete this->session;
+        this->session = nullptr;
+      }
 
-        /* And concat the user expression */
-        formula << triton::api.getFullAst(node);
 
-        /* Create the context and AST */
-        Z3_ast ast = Z3_parse_smtlib2_string(ctx, formula.str().c_str(), 0, 0, 0, 0, 0, 0);
-        z3::expr eq(ctx, ast);
+      void SolverEngine::removeTranslatedNodes(const std::set<triton::ast::AbstractNode*>& nodes) {
+        if (this->session != nullptr)
+          this->session->removeTranslatedNodes(nodes);
+      }
+
+
+      void SolverEngine::clearTranslatedNodes(void) {
+        if (this->session != nullptr)
+          this->session->clearTranslatedNodes();
+      }
+
+
+      std::list<std::map<triton::uint32, SolverModel>> SolverEngine::getModels(triton::ast::AbstractNode *node, triton::uint32 limit) const {
+        std::list<std::map<triton::uint32, SolverModel>> ret;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::getModels(): node cannot be null.");
+
+        /* Translate the Triton's AST directly into a Z3's AST (references are resolved on the fly) */
+        triton::ast::TritonToZ3Ast  z3Ast{false};
+        triton::ast::Z3Result       result = z3Ast.eval(*node);
+        z3::context&                ctx    = result.getContext();
+        z3::solver                  solver(ctx);
 
         /* Create a solver and add the expression */
-        solver.add(eq);
+        solver.add(result.getExpr());
 
         /* Check if it is sat */
         while (solver.check() == z3::sat && limit >= 1) {
@@ -179,13 +213,31 @@ namespace triton {
           limit--;
         }
 
-        /* Restore the representation mode */
-        triton::api.setAstRepresentationMode(representationMode);
-
         return ret;
       }
 
 
+      std::string SolverEngine::getSmtFormula(triton::ast::AbstractNode *node) const {
+        std::ostringstream formula;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::getSmtFormula(): node cannot be null.");
+
+        this->writeSmtFormula(formula, node);
+
+        return formula.str();
+      }
+
+
+      void SolverEngine::writeSmtFormula(std::ostream& stream, triton::ast::AbstractNode *node) const {
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::writeSmtFormula(): node cannot be null.");
+
+        SmtFormulaWriter writer(stream);
+        writer.write(node);
+      }
+
+
       std::map<triton::uint32, SolverModel> SolverEngine::getModel(triton::ast::AbstractNode *node) const {
         std::map<triton::uint32, SolverModel> ret;
         std::list<std::map<triton::uint32, SolverModel>> allModels;
@@ -0,0 +1,132 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <api.hpp>
+#include <exceptions.hpp>
+#include <solverSession.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      SolverSession::SolverSession()
+        : translator(false), solver(translator.getContext()) {
+        this->assertedPathConstraints = 0;
+      }
+
+
+      SolverSession::~SolverSession() {
+      }
+
+
+      void SolverSession::assertPathConstraints(triton::usize count) {
+        const std::vector<triton::engines::symbolic::PathConstraint>& pc = triton::getContext().getPathConstraints();
+
+        if (count > pc.size())
+          throw triton::exceptions::SolverEngine("SolverSession::assertPathConstraints(): There are not as many path constraints.");
+
+        if (count < this->assertedPathConstraints)
+          throw triton::exceptions::SolverEngine("SolverSession::assertPathConstraints(): The path constraints are already asserted, reset the session first.");
+
+        for (triton::usize index = this->assertedPathConstraints; index < count; index++)
+          this->solver.add(this->translator.eval(*pc[index].getTakenPathConstraintAst()).getExpr());
+
+        this->assertedPathConstraints = count;
+      }
+
+
+      void SolverSession::addConstraint(triton::ast::AbstractNode* node) {
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverSession::addConstraint(): node cannot be null.");
+
+        this->solver.add(this->translator.eval(*node).getExpr());
+      }
+
+
+      void SolverSession::push(void) {
+        this->scopes.push_back(this->assertedPathConstraints);
+        this->solver.push();
+      }
+
+
+      void SolverSession::pop(void) {
+        if (this->scopes.empty())
+          throw triton::exceptions::SolverEngine("SolverSession::pop(): There is no scope to pop.");
+
+        this->solver.pop();
+        this->assertedPathConstraints = this->scopes.back();
+        this->scopes.pop_back();
+      }
+
+
+      void SolverSession::reset(void) {
+        this->solver.reset();
+        this->scopes.clear();
+        this->assertedPathConstraints = 0;
+      }
+
+
+      triton::usize SolverSession::getNumberOfScopes(void) const {
+        return this->scopes.size();
+      }
+
+
+      triton::usize SolverSession::getNumberOfAssertedPathConstraints(void) const {
+        return this->assertedPathConstraints;
+      }
+
+
+      std::map<triton::uint32, SolverModel> SolverSession::checkWithAssumption(triton::ast::AbstractNode* node) {
+        return this->checkWithAssumption(node, triton::getContext().getPathConstraints().size());
+      }
+
+
+      std::map<triton::uint32, SolverModel> SolverSession::checkWithAssumption(triton::ast::AbstractNode* node, triton::usize pathConstraints) {
+        std::map<triton::uint32, SolverModel> ret;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverSession::checkWithAssumption(): node cannot be null.");
+
+        this->assertPathConstraints(pathConstraints);
+
+        /* The assumption only lives into a temporary scope */
+        this->solver.push();
+        this->solver.add(this->translator.eval(*node).getExpr());
+
+        if (this->solver.check() == z3::sat) {
+          z3::model m = this->solver.get_model();
+          for (triton::uint32 i = 0; i < m.size(); i++) {
+            z3::func_decl variable = m[i];
+            z3::expr exp           = m.get_const_interp(variable);
+            std::string svalue     = Z3_get_numeral_string(this->translator.getContext(), exp);
+
+            triton::uint512 value{svalue};
+            SolverModel     trionModel{variable.name().str(), value};
+            ret[trionModel.getId()] = trionModel;
+          }
+        }
+
+        this->solver.pop();
+
+        return ret;
+      }
+
+
+      void SolverSession::removeTranslatedNodes(const std::set<triton::ast::AbstractNode*>& nodes) {
+        this->translator.removeTranslatedNodes(nodes);
+      }
+
+
+      void SolverSession::clearTranslatedNodes(void) {
+        this->translator.clearTranslatedNodes();
+      }
+
+    };
+  };
+};
@@ -5,7 +5,10 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
+#include <cstdlib>
 #include <cstring>
+#include <unordered_set>
 
 #include <api.hpp>
 #include <exceptions.hpp>
@@ -57,6 +60,10 @@ memory and \f$ \varphi_{x \in N} \f$ represents the unique symbolic expression's
 
 Based on this process, we know that \f$ ebx = eax = 0 \f$.
 
+A memory write is one symbolic expression whatever its size and each byte of the write refers to this expression.
+A read which matches a previous write returns the reference of this write, otherwise the read is the concatenation
+of the parts of the expressions (and of the concrete memory) which define its bytes.
+
 There also exists an important point, if there is no previous symbolic reference of a register or part of memory when
 the instruction is processed, Triton builds the expression with the concretization of the value and assigns the
 expression to a new symbolic reference. This allows us to start the analysis everywhere.
@@ -71,23 +78,24 @@ namespace triton {
     namespace symbolic {
 
       SymbolicEngine::SymbolicEngine() {
-        triton::api.checkArchitecture();
+        triton::getContext().checkArchitecture();
 
-        this->numberOfRegisters = triton::api.cpuNumberOfRegisters();
+        this->numberOfRegisters = triton::getContext().cpuNumberOfRegisters();
         this->symbolicReg = new triton::usize[this->numberOfRegisters]();
 
         /* Init all symbolic registers/flags to UNSET (init state) */
         for (triton::uint32 i = 0; i < this->numberOfRegisters; i++)
           this->symbolicReg[i] = triton::engines::symbolic::UNSET;
 
-        this->enableFlag      = true;
-        this->uniqueSymExprId = 0;
-        this->uniqueSymVarId  = 0;
+        this->enableFlag       = true;
+        this->reclaimThreshold = SYMBOLIC_RECLAIM_THRESHOLD;
+        this->uniqueSymExprId  = 0;
+        this->uniqueSymVarId   = 0;
       }
 
 
       void SymbolicEngine::init(const SymbolicEngine& other) {
-        triton::api.checkArchitecture();
+        triton::getContext().checkArchitecture();
 
         this->numberOfRegisters = other.numberOfRegisters;
         this->symbolicReg = new triton::usize[this->numberOfRegisters]();
@@ -97,7 +105,10 @@ namespace triton {
 
         this->alignedMemoryReference      = other.alignedMemoryReference;
         this->enableFlag                  = other.enableFlag;
+        this->lazyFlags                   = other.lazyFlags;
         this->memoryReference             = other.memoryReference;
+        this->pinnedExpressions           = other.pinnedExpressions;
+        this->reclaimThreshold            = other.reclaimThreshold;
         this->symbolicExpressions         = other.symbolicExpressions;
         this->symbolicVariables           = other.symbolicVariables;
         this->uniqueSymExprId             = other.uniqueSymExprId;
@@ -148,14 +159,16 @@ namespace triton {
        */
       void SymbolicEngine::concretizeRegister(const triton::arch::Register& reg) {
         triton::uint32 parentId = reg.getParent().getId();
-        if (!triton::api.isCpuRegisterValid(parentId))
+        if (!triton::getContext().isCpuRegisterValid(parentId))
           return;
+        this->lazyFlags.erase(parentId);
         this->symbolicReg[parentId] = triton::engines::symbolic::UNSET;
       }
 
 
       /* Same as concretizeRegister but with all registers */
       void SymbolicEngine::concretizeAllRegister(void) {
+        this->lazyFlags.clear();
         for (triton::uint32 i = 0; i < this->numberOfRegisters; i++)
           this->symbolicReg[i] = triton::engines::symbolic::UNSET;
       }
@@ -180,8 +193,8 @@ namespace triton {
        * before symbolic processing.
        */
       void SymbolicEngine::concretizeMemory(triton::uint64 addr) {
-        this->memoryReference.erase(addr);
-        if (triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::ALIGNED_MEMORY))
+        this->memoryReference.set(addr, triton::engines::symbolic::UNSET);
+        if (triton::getContext().isSymbolicOptimizationEnabled(triton::engines::symbolic::ALIGNED_MEMORY))
           this->removeAlignedMemory(addr, BYTE_SIZE);
       }
 
@@ -218,6 +231,9 @@ namespace triton {
 
       /* Removes an aligned memory */
       void SymbolicEngine::removeAlignedMemory(triton::uint64 address, triton::uint32 size) {
+        if (this->alignedMemoryReference.empty())
+          return;
+
         /* Remove overloaded positive ranges */
         for (triton::uint32 index = 0; index < size; index++) {
           this->alignedMemoryReference.erase(std::make_pair(address+index, BYTE_SIZE));
@@ -249,10 +265,7 @@ namespace triton {
 
       /* Returns the reference memory if it's referenced otherwise returns UNSET */
       triton::usize SymbolicEngine::getSymbolicMemoryId(triton::uint64 addr) const {
-        std::map<triton::uint64, triton::usize>::const_iterator it;
-        if ((it = this->memoryReference.find(addr)) != this->memoryReference.end())
-          return it->second;
-        return triton::engines::symbolic::UNSET;
+        return this->memoryReference.get(addr);
       }
 
 
@@ -283,10 +296,12 @@ namespace triton {
 
 
       /* Returns the reg reference or UNSET */
-      triton::usize SymbolicEngine::getSymbolicRegisterId(const triton::arch::Register& reg) const {
+      triton::usize SymbolicEngine::getSymbolicRegisterId(const triton::arch::Register& reg) {
         triton::uint32 parentId = reg.getParent().getId();
-        if (!triton::api.isCpuRegisterValid(parentId))
+        if (!triton::getContext().isCpuRegisterValid(parentId))
           return triton::engines::symbolic::UNSET;
+        if (!this->lazyFlags.empty())
+          this->materializeLazyFlag(parentId);
         return this->symbolicReg[parentId];
       }
 
@@ -353,30 +368,154 @@ namespace triton {
 
       /* Removes the symbolic expression corresponding to the id */
       void SymbolicEngine::removeSymbolicExpression(triton::usize symExprId) {
-        std::map<triton::uint64, triton::usize>::iterator it;
-
-        if (this->symbolicExpressions.find(symExprId) != this->symbolicExpressions.end()) {
-          /* Delete and remove the pointer */
-          delete this->symbolicExpressions[symExprId];
-          this->symbolicExpressions.erase(symExprId);
-
-          /* Concretize the register if it exists */
-          for (triton::uint32 i = 0; i < this->numberOfRegisters; i++) {
-            if (this->symbolicReg[i] == symExprId) {
-              this->symbolicReg[i] = triton::engines::symbolic::UNSET;
-              return;
-            }
+        auto it = this->symbolicExpressions.find(symExprId);
+
+        if (it == this->symbolicExpressions.end())
+          return;
+
+        SymbolicExpression* expr = it->second;
+
+        /* Lazy flags which depend on this expression are concretized */
+        for (auto lit = this->lazyFlags.begin(); lit != this->lazyFlags.end();) {
+          if (lit->second.parent == symExprId) {
+            this->symbolicReg[lit->first] = triton::engines::symbolic::UNSET;
+            lit = this->lazyFlags.erase(lit);
           }
+          else
+            lit++;
+        }
 
-          /* Concretize the memory if it exists */
-          for (it = this->memoryReference.begin(); it != memoryReference.end(); it++) {
-            if (it->second == symExprId) {
-              this->concretizeMemory(it->first);
-              return;
-            }
+        /* Concretize the register if it is still assigned to the expression */
+        if (expr->isRegister()) {
+          triton::uint32 parentId = expr->getOriginRegister().getParent().getId();
+          if (triton::getContext().isCpuRegisterValid(parentId) && this->symbolicReg[parentId] == symExprId)
+            this->symbolicReg[parentId] = triton::engines::symbolic::UNSET;
+        }
+
+        /* Concretize the bytes of memory which are still assigned to the expression */
+        else if (expr->isMemory()) {
+          const triton::arch::MemoryAccess& mem = expr->getOriginMemory();
+          triton::uint64 addr = mem.getAddress();
+          for (triton::uint32 index = 0; index < mem.getSize(); index++) {
+            if (this->getSymbolicMemoryId(addr + index) == symExprId)
+              this->concretizeMemory(addr + index);
           }
         }
 
+        /* Delete and remove the pointer */
+        this->pinnedExpressions.erase(symExprId);
+        this->symbolicExpressions.erase(it);
+        delete expr;
+      }
+
+
+      /* Pins (or unpins) a symbolic expression */
+      void SymbolicEngine::pinSymbolicExpression(triton::usize symExprId, bool flag) {
+        if (this->symbolicExpressions.find(symExprId) == this->symbolicExpressions.end())
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::pinSymbolicExpression(): symbolic expression id not found.");
+
+        if (flag)
+          this->pinnedExpressions.insert(symExprId);
+        else
+          this->pinnedExpressions.erase(symExprId);
+      }
+
+
+      /* Collects the roots of the engine */
+      bool SymbolicEngine::collectSymbolicRoots(std::set<triton::usize>& exprs, std::vector<triton::ast::AbstractNode*>& nodes) const {
+        for (triton::uint32 i = 0; i < this->numberOfRegisters; i++) {
+          if (this->symbolicReg[i] != triton::engines::symbolic::UNSET)
+            exprs.insert(this->symbolicReg[i]);
+        }
+
+        std::map<triton::uint64, triton::usize> references = this->memoryReference.getReferences();
+        for (auto it = references.begin(); it != references.end(); it++)
+          exprs.insert(it->second);
+
+        for (auto it = this->lazyFlags.begin(); it != this->lazyFlags.end(); it++)
+          exprs.insert(it->second.parent);
+
+        exprs.insert(this->pinnedExpressions.begin(), this->pinnedExpressions.end());
+
+        for (auto it = this->alignedMemoryReference.begin(); it != this->alignedMemoryReference.end(); it++)
+          nodes.push_back(it->second);
+
+        for (auto pc = this->pathConstraints.begin(); pc != this->pathConstraints.end(); pc++) {
+          for (auto branch = pc->getBranchConstraints().begin(); branch != pc->getBranchConstraints().end(); branch++)
+            nodes.push_back(std::get<3>(*branch));
+        }
+
+        /* The semantics of the lazy flags capture nodes which are not reachable from an expression */
+        return this->lazyFlags.empty();
+      }
+
+
+      /* Removes the symbolic expressions which are not reachable from the roots */
+      std::set<triton::usize> SymbolicEngine::reclaimSymbolicExpressions(const std::set<triton::usize>& exprs, const std::vector<triton::ast::AbstractNode*>& nodes, std::vector<triton::ast::AbstractNode*>& asts) {
+        std::unordered_set<triton::ast::AbstractNode*> visited;
+        std::vector<triton::ast::AbstractNode*> worklist(nodes);
+        std::set<triton::usize> live;
+        std::set<triton::usize> removed;
+
+        /* Marks an expression as live and schedules its AST */
+        auto mark = [this, &live, &worklist](triton::usize id) {
+          if (!live.insert(id).second)
+            return;
+          auto it = this->symbolicExpressions.find(id);
+          if (it != this->symbolicExpressions.end())
+            worklist.push_back(it->second->getAst());
+        };
+
+        for (auto it = exprs.begin(); it != exprs.end(); it++)
+          mark(*it);
+
+        /* Iterative walk, the ASTs of long traces are too deep for a recursion */
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* node = worklist.back();
+          worklist.pop_back();
+
+          if (node == nullptr || !visited.insert(node).second)
+            continue;
+
+          if (node->getKind() == triton::ast::REFERENCE_NODE) {
+            mark(static_cast<triton::usize>(reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue()));
+            continue;
+          }
+
+          std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+          worklist.insert(worklist.end(), childs.begin(), childs.end());
+        }
+
+        /* Sweep the dead expressions */
+        for (auto it = this->symbolicExpressions.begin(); it != this->symbolicExpressions.end();) {
+          if (live.find(it->first) == live.end()) {
+            removed.insert(it->first);
+            asts.push_back(it->second->getAst());
+            delete it->second;
+            it = this->symbolicExpressions.erase(it);
+          }
+          else
+            it++;
+        }
+
+        this->reclaimThreshold = std::max<triton::usize>(2 * this->symbolicExpressions.size(), SYMBOLIC_RECLAIM_THRESHOLD);
+
+        return removed;
+      }
+
+
+      /* Removes symbolic expressions without deleting them */
+      void SymbolicEngine::forgetSymbolicExpressions(const std::set<triton::usize>& ids) {
+        for (auto it = ids.begin(); it != ids.end(); it++) {
+          this->symbolicExpressions.erase(*it);
+          this->pinnedExpressions.erase(*it);
+        }
+      }
+
+
+      /* Returns true if a reclamation is needed */
+      bool SymbolicEngine::isReclaimNeeded(void) const {
+        return this->symbolicExpressions.size() >= this->reclaimThreshold;
       }
 
 
@@ -395,22 +534,150 @@ namespace triton {
 
 
       /* Returns the full symbolic expression backtracked. */
-      triton::ast::AbstractNode* SymbolicEngine::getFullAst(triton::ast::AbstractNode* node, std::set<triton::usize>& processed) {
-        std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
-
-        for (triton::uint32 index = 0; index < childs.size(); index++) {
-          if (childs[index]->getKind() == triton::ast::REFERENCE_NODE) {
-            triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(childs[index])->getValue();
-            triton::ast::AbstractNode* ref = this->getSymbolicExpressionFromId(id)->getAst();
-            childs[index] = ref;
-            if (processed.find(id) != processed.end())
-              continue;
-            processed.insert(id);
+      triton::ast::AbstractNode* SymbolicEngine::getFullAst(triton::ast::AbstractNode* node) const {
+        std::unordered_map<triton::ast::AbstractNode*, triton::ast::AbstractNode*> unrolled;
+        std::vector<std::pair<triton::ast::AbstractNode*, bool>> worklist;
+
+        /*
+         * Iterative post-order walk. Each node is unrolled once, so a node shared
+         * by several parents or a symbolic expression referenced several times is
+         * only expanded once. A node without reference below it is kept as is, the
+         * stored ASTs are never modified.
+         */
+        worklist.push_back(std::make_pair(node, false));
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back().first;
+          bool expanded                      = worklist.back().second;
+
+          if (unrolled.find(current) != unrolled.end()) {
+            worklist.pop_back();
+            continue;
+          }
+
+          /* A reference is substituted by the AST of its symbolic expression */
+          if (current->getKind() == triton::ast::REFERENCE_NODE) {
+            triton::usize id                   = reinterpret_cast<triton::ast::ReferenceNode*>(current)->getValue();
+            triton::ast::AbstractNode* target  = this->getSymbolicExpressionFromId(id)->getAst();
+            auto it                            = unrolled.find(target);
+
+            if (it != unrolled.end()) {
+              unrolled[current] = it->second;
+              worklist.pop_back();
+            }
+            else {
+              worklist.push_back(std::make_pair(target, false));
+            }
+            continue;
+          }
+
+          std::vector<triton::ast::AbstractNode*>& childs = current->getChilds();
+
+          if (!expanded) {
+            worklist.back().second = true;
+            for (auto it = childs.rbegin(); it != childs.rend(); it++) {
+              if (unrolled.find(*it) == unrolled.end())
+                worklist.push_back(std::make_pair(*it, false));
+            }
+            continue;
+          }
+
+          worklist.pop_back();
+
+          std::vector<triton::ast::AbstractNode*> newChilds;
+          bool modified = false;
+
+          newChilds.reserve(childs.size());
+          for (auto it = childs.begin(); it != childs.end(); it++) {
+            triton::ast::AbstractNode* child = unrolled.at(*it);
+            modified |= (child != *it);
+            newChilds.push_back(child);
           }
-          this->getFullAst(childs[index], processed);
+
+          unrolled[current] = modified ? triton::ast::newInstance(current, newChilds) : current;
         }
 
-        return node;
+        return unrolled.at(node);
+      }
+
+
+      /* Returns the backward slice of a set of expressions and nodes */
+      SymbolicSlice SymbolicEngine::slice(std::vector<bool>& exprs, std::vector<triton::ast::AbstractNode*>& worklist) const {
+        std::unordered_set<triton::ast::AbstractNode*> visited;
+        std::unordered_set<triton::uint64> seenAddresses;
+        std::set<triton::usize> variables;
+        std::vector<triton::usize> expressions;
+        std::vector<triton::uint64> addresses;
+
+        /* Each node is visited once, a reference is followed once per expression */
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* node = worklist.back();
+          worklist.pop_back();
+
+          if (!visited.insert(node).second)
+            continue;
+
+          switch (node->getKind()) {
+            case triton::ast::REFERENCE_NODE: {
+              triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue();
+              SymbolicExpression* expr = this->getSymbolicExpressionFromId(id);
+              if (!exprs[id]) {
+                exprs[id] = true;
+                worklist.push_back(expr->getAst());
+              }
+              break;
+            }
+
+            case triton::ast::VARIABLE_NODE: {
+              const std::string name = reinterpret_cast<triton::ast::VariableNode*>(node)->getValue();
+              variables.insert(static_cast<triton::usize>(std::strtoull(name.c_str() + TRITON_SYMVAR_NAME_SIZE, nullptr, 10)));
+              break;
+            }
+
+            default: {
+              const std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+              worklist.insert(worklist.end(), childs.begin(), childs.end());
+              break;
+            }
+          }
+        }
+
+        /* An expression only references older expressions, so the ids order is a dependency order */
+        for (triton::usize id = 0; id < exprs.size(); id++) {
+          if (!exprs[id])
+            continue;
+          expressions.push_back(id);
+          /* Expressions not created by an instruction (e.g: symbolic variables) have no address */
+          triton::uint64 addr = this->symbolicExpressions.at(id)->getAddress();
+          if (addr != 0 && seenAddresses.insert(addr).second)
+            addresses.push_back(addr);
+        }
+
+        return SymbolicSlice(expressions, std::vector<triton::usize>(variables.begin(), variables.end()), addresses);
+      }
+
+
+      /* Returns the backward slice of an AST */
+      SymbolicSlice SymbolicEngine::sliceAst(triton::ast::AbstractNode* node) const {
+        std::vector<bool> exprs(this->uniqueSymExprId, false);
+        std::vector<triton::ast::AbstractNode*> worklist;
+
+        if (node == nullptr)
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::sliceAst(): node cannot be null.");
+
+        worklist.push_back(node);
+        return this->slice(exprs, worklist);
+      }
+
+
+      /* Returns the backward slice of a symbolic expression */
+      SymbolicSlice SymbolicEngine::sliceExpression(triton::usize symExprId) const {
+        std::vector<bool> exprs(this->uniqueSymExprId, false);
+        std::vector<triton::ast::AbstractNode*> worklist;
+
+        worklist.push_back(this->getSymbolicExpressionFromId(symExprId)->getAst());
+        exprs[symExprId] = true;
+
+        return this->slice(exprs, worklist);
       }
 
 
@@ -440,9 +707,11 @@ namespace triton {
 
 
       /* Returns the map of symbolic registers defined */
-      std::map<triton::arch::Register, SymbolicExpression*> SymbolicEngine::getSymbolicRegisters(void) const {
+      std::map<triton::arch::Register, SymbolicExpression*> SymbolicEngine::getSymbolicRegisters(void) {
         std::map<triton::arch::Register, SymbolicExpression*> ret;
 
+        this->materializeLazyFlags();
+
         for (triton::uint32 it = 0; it < this->numberOfRegisters; it++) {
           if (this->symbolicReg[it] != triton::engines::symbolic::UNSET) {
             triton::arch::Register reg(it);
@@ -457,9 +726,9 @@ namespace triton {
       /* Returns the map of symbolic memory defined */
       std::map<triton::uint64, SymbolicExpression*> SymbolicEngine::getSymbolicMemory(void) const {
         std::map<triton::uint64, SymbolicExpression*> ret;
-        std::map<triton::uint64, triton::usize>::const_iterator it;
+        std::map<triton::uint64, triton::usize> references = this->memoryReference.getReferences();
 
-        for (it = this->memoryReference.begin(); it != this->memoryReference.end(); it++)
+        for (auto it = references.begin(); it != references.end(); it++)
           ret[it->first] = this->getSymbolicExpressionFromId(it->second);
 
         return ret;
@@ -493,13 +762,12 @@ namespace triton {
 
       /* The memory size is used to define the symbolic variable's size. */
       SymbolicVariable* SymbolicEngine::convertMemoryToSymbolicVariable(const triton::arch::MemoryAccess& mem, const std::string& symVarComment) {
-        triton::ast::AbstractNode* tmp  = nullptr;
         SymbolicExpression* se          = nullptr;
         SymbolicVariable* symVar        = nullptr;
         triton::usize memSymId          = triton::engines::symbolic::UNSET;
         triton::uint64 memAddr          = mem.getAddress();
         triton::uint32 symVarSize       = mem.getSize();
-        triton::uint512 cv              = mem.getConcreteValue() ? mem.getConcreteValue() : triton::api.getConcreteMemoryValue(mem);
+        triton::uint512 cv              = mem.getConcreteValue() ? mem.getConcreteValue() : triton::getContext().getConcreteMemoryValue(mem);
 
         memSymId = this->getSymbolicMemoryId(memAddr);
 
@@ -510,31 +778,33 @@ namespace triton {
         /* Create the AST node */
         triton::ast::AbstractNode* symVarNode = triton::ast::variable(*symVar);
 
-        /*  Split expression in bytes */
-        for (triton::sint32 index = symVarSize-1; index >= 0; index--) {
-
-          /* Isolate the good part of the symbolic variable */
-          tmp = triton::ast::extract(((BYTE_SIZE_BIT * (index+1)) - 1), ((BYTE_SIZE_BIT * (index+1)) - BYTE_SIZE_BIT), symVarNode);
-
-          /* Check if the memory address is already defined */
-          memSymId = this->getSymbolicMemoryId(memAddr+index);
-          if (memSymId == triton::engines::symbolic::UNSET) {
-            se = this->newSymbolicExpression(tmp, triton::engines::symbolic::MEM, "Byte reference");
-            se->setOriginMemory(triton::arch::MemoryAccess(memAddr+index, BYTE_SIZE, tmp->evaluate()));
-          }
-          else {
-            se = this->getSymbolicExpressionFromId(memSymId);
-            tmp->setParent(se->getAst()->getParents());
-            se->setAst(tmp);
-            tmp->init();
-            se->setOriginMemory(triton::arch::MemoryAccess(memAddr+index, BYTE_SIZE, tmp->evaluate()));
+        /* If the memory is exactly held by one expression, this expression is converted */
+        if (memSymId != triton::engines::symbolic::UNSET) {
+          se = this->getSymbolicExpressionFromId(memSymId);
+          if (se->getOriginMemory().getAddress() != memAddr || se->getOriginMemory().getSize() != symVarSize)
+            se = nullptr;
+          for (triton::uint32 index = 1; se != nullptr && index < symVarSize; index++) {
+            if (this->getSymbolicMemoryId(memAddr+index) != memSymId)
+              se = nullptr;
           }
+        }
 
-          /* Add the new memory reference */
-          this->addMemoryReference(memAddr+index, se->getId());
-          if (triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::ALIGNED_MEMORY))
-            removeAlignedMemory(memAddr+index, BYTE_SIZE);
+        if (se != nullptr) {
+          symVarNode->setParent(se->getAst()->getParents());
+          se->setAst(symVarNode);
+          symVarNode->init();
+        }
+        else {
+          se = this->newSymbolicExpression(symVarNode, triton::engines::symbolic::MEM);
         }
+        se->setOriginMemory(triton::arch::MemoryAccess(memAddr, symVarSize, cv));
+
+        /* Add the new memory references */
+        for (triton::uint32 index = 0; index < symVarSize; index++)
+          this->addMemoryReference(memAddr+index, se->getId());
+
+        if (triton::getContext().isSymbolicOptimizationEnabled(triton::engines::symbolic::ALIGNED_MEMORY))
+          this->removeAlignedMemory(memAddr, symVarSize);
 
         return symVar;
       }
@@ -546,9 +816,9 @@ namespace triton {
         triton::usize regSymId          = triton::engines::symbolic::UNSET;
         triton::uint32 parentId         = reg.getParent().getId();
         triton::uint32 symVarSize       = reg.getBitSize();
-        triton::uint512 cv              = reg.getConcreteValue() ? reg.getConcreteValue() : triton::api.getConcreteRegisterValue(reg);
+        triton::uint512 cv              = reg.getConcreteValue() ? reg.getConcreteValue() : triton::getContext().getConcreteRegisterValue(reg);
 
-        if (!triton::api.isCpuRegisterValid(parentId))
+        if (!triton::getContext().isCpuRegisterValid(parentId))
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::convertRegisterToSymbolicVariable(): Invalid register id");
 
         regSymId = this->getSymbolicRegisterId(reg);
@@ -621,45 +891,57 @@ namespace triton {
         triton::uint32 size                       = mem.getSize();
         triton::usize symMem                      = triton::engines::symbolic::UNSET;
         triton::uint8 concreteValue[DQQWORD_SIZE] = {0};
-        triton::uint512 value                     = triton::api.getConcreteMemoryValue(mem);
-
-        triton::utils::fromUintToBuffer(value, concreteValue);
+        triton::uint512 value                     = 0;
 
         /*
          * Symbolic optimization
          * If the memory access is aligned, don't split the memory.
          */
-        if (triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::ALIGNED_MEMORY) && this->isAlignedMemory(address, size))
+        if (triton::getContext().isSymbolicOptimizationEnabled(triton::engines::symbolic::ALIGNED_MEMORY) && this->isAlignedMemory(address, size))
           return this->getAlignedMemory(address, size);
 
+        /* The area is entirely concrete, its value is read at once */
+        value = triton::getContext().getConcreteMemoryValue(mem);
+        if (!this->memoryReference.isSymbolic(address, size))
+          return triton::ast::bv(value, mem.getBitSize());
+
+        triton::utils::fromUintToBuffer(value, concreteValue);
+
+        /*
+         * Bytes are read from the most significant one. Consecutive bytes which
+         * belong to the same expression (or to the concrete memory) are read as
+         * one piece, so a read which matches a write returns its reference.
+         */
         while (size) {
+          triton::uint32 high = size;
+
           symMem = this->getSymbolicMemoryId(address + size - 1);
+          do {
+            size--;
+          } while (size && this->getSymbolicMemoryId(address + size - 1) == symMem);
+
           if (symMem != triton::engines::symbolic::UNSET) {
+            const triton::arch::MemoryAccess& origin = this->getSymbolicExpressionFromId(symMem)->getOriginMemory();
+            triton::uint32 lowOffset  = static_cast<triton::uint32>(address + size - origin.getAddress());
+            triton::uint32 highOffset = static_cast<triton::uint32>(address + high - origin.getAddress());
             tmp = triton::ast::reference(symMem);
-            opVec.push_back(triton::ast::extract((BYTE_SIZE_BIT - 1), 0, tmp));
+            if (lowOffset != 0 || highOffset != origin.getSize())
+              tmp = triton::ast::extract((highOffset * BYTE_SIZE_BIT) - 1, lowOffset * BYTE_SIZE_BIT, tmp);
           }
           else {
-            tmp = triton::ast::bv(concreteValue[size - 1], BYTE_SIZE_BIT);
-            opVec.push_back(triton::ast::extract((BYTE_SIZE_BIT - 1), 0, tmp));
+            triton::uint512 piece = 0;
+            for (triton::uint32 index = high; index > size; index--)
+              piece = (piece << BYTE_SIZE_BIT) | concreteValue[index - 1];
+            tmp = triton::ast::bv(piece, (high - size) * BYTE_SIZE_BIT);
           }
-          size--;
-        }
 
-        switch (opVec.size()) {
-          case DQQWORD_SIZE:
-          case QQWORD_SIZE:
-          case DQWORD_SIZE:
-          case QWORD_SIZE:
-          case DWORD_SIZE:
-          case WORD_SIZE:
-            tmp = triton::ast::concat(opVec);
-            break;
-          case BYTE_SIZE:
-            tmp = opVec.front();
-            break;
+          opVec.push_back(tmp);
         }
 
-        return tmp;
+        if (opVec.size() == 1)
+          return opVec.front();
+
+        return triton::ast::concat(opVec);
       }
 
 
@@ -683,76 +965,55 @@ namespace triton {
         if (symReg != triton::engines::symbolic::UNSET)
           op = triton::ast::extract(high, low, triton::ast::reference(symReg));
         else
-          op = triton::ast::bv(triton::api.getConcreteRegisterValue(reg), bvSize);
+          op = triton::ast::bv(triton::getContext().getConcreteRegisterValue(reg), bvSize);
 
         return op;
       }
 
 
       /* Returns a symbolic register and defines the register as input of the instruction */
-      triton::ast::AbstractNode* SymbolicEngine::buildSymbolicRegister(triton::arch::Instruction& inst, triton::arch::Register& reg) {
+      triton::ast::AbstractNode* SymbolicEngine::buildSymbolicRegister(triton::arch::Instruction& inst, const triton::arch::Register& reg) {
         triton::ast::AbstractNode* node = this->buildSymbolicRegister(reg);
-        reg.setConcreteValue(node->evaluate());
-        inst.setReadRegister(reg, node);
+        triton::arch::Register read     = reg;
+        read.setConcreteValue(node->evaluate());
+        inst.setReadRegister(read, node);
         return node;
       }
 
 
       /* Returns the new symbolic memory expression */
       SymbolicExpression* SymbolicEngine::createSymbolicMemoryExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::MemoryAccess& mem, const std::string& comment) {
-        triton::ast::AbstractNode* tmp = nullptr;
-        std::list<triton::ast::AbstractNode*> ret;
-
         SymbolicExpression* se   = nullptr;
         triton::uint64 address   = mem.getAddress();
         triton::uint32 writeSize = mem.getSize();
 
         /* Record the aligned memory for a symbolic optimization */
-        if (triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::ALIGNED_MEMORY))
+        if (triton::getContext().isSymbolicOptimizationEnabled(triton::engines::symbolic::ALIGNED_MEMORY))
           this->addAlignedMemory(address, writeSize, node);
 
         /*
          * As the x86's memory can be accessed without alignment, each byte of the
-         * memory must be assigned to an unique reference.
+         * memory refers to the expression of its last write. The offset of the
+         * byte inside the expression is given by the origin of the expression.
          */
-        while (writeSize) {
-          /* Extract each byte of the memory */
-          tmp = triton::ast::extract(((writeSize * BYTE_SIZE_BIT) - 1), ((writeSize * BYTE_SIZE_BIT) - BYTE_SIZE_BIT), node);
-          se = this->newSymbolicExpression(tmp, triton::engines::symbolic::MEM, "Byte reference - " + comment);
-          se->setOriginMemory(triton::arch::MemoryAccess(((address + writeSize) - 1), BYTE_SIZE, tmp->evaluate()));
-          ret.push_back(tmp);
-          inst.addSymbolicExpression(se);
-          /* Assign memory with little endian */
-          this->addMemoryReference((address + writeSize) - 1, se->getId());
-          /* Synchronize the concrete state */
-          triton::api.setConcreteMemoryValue((address + writeSize) - 1, tmp->evaluate().convert_to<triton::uint8>());
-          /* continue */
-          writeSize--;
-        }
+        se = this->newSymbolicExpression(node, triton::engines::symbolic::MEM, comment);
+        se->setAddress(inst.getAddress());
+        se->setOriginMemory(triton::arch::MemoryAccess(address, writeSize, se->getAst()->evaluate()));
+        for (triton::uint32 index = 0; index < writeSize; index++)
+          this->addMemoryReference(address + index, se->getId());
 
-        /* If there is only one reference, we return the symbolic expression */
-        if (ret.size() == 1) {
-          if (tmp != nullptr)
-            mem.setConcreteValue(tmp->evaluate());
-          inst.setStoreAccess(mem, tmp);
-          return se;
-        }
-
-        /* Otherwise, we return the concatenation of all symbolic expressions */
-        tmp = triton::ast::concat(ret);
-        mem.setConcreteValue(tmp->evaluate());
-
-        se  = this->newSymbolicExpression(tmp, triton::engines::symbolic::UNDEF, "Temporary concatenation reference - " + comment);
-        se->setOriginMemory(triton::arch::MemoryAccess(address, mem.getSize(), tmp->evaluate()));
+        /* Synchronize the concrete state */
+        mem.setConcreteValue(se->getAst()->evaluate());
+        triton::getContext().setConcreteMemoryValue(se->getOriginMemory());
 
-        inst.setStoreAccess(mem, tmp);
+        inst.setStoreAccess(mem, se->getAst());
         inst.addSymbolicExpression(se);
         return se;
       }
 
 
       /* Returns the new symbolic register expression */
-      SymbolicExpression* SymbolicEngine::createSymbolicRegisterExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::Register& reg, const std::string& comment) {
+      SymbolicExpression* SymbolicEngine::createSymbolicRegisterExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, const triton::arch::Register& reg, const std::string& comment) {
         triton::ast::AbstractNode* finalExpr      = nullptr;
         triton::ast::AbstractNode* origReg        = nullptr;
         triton::uint32 regSize                    = reg.getSize();
@@ -767,23 +1028,23 @@ namespace triton {
         switch (regSize) {
           case BYTE_SIZE:
             if (reg.getLow() == 0) {
-              finalExpr = triton::ast::concat(triton::ast::extract((triton::api.cpuRegisterBitSize() - 1), BYTE_SIZE_BIT, origReg), node);
+              finalExpr = triton::ast::concat(triton::ast::extract((triton::getContext().cpuRegisterBitSize() - 1), BYTE_SIZE_BIT, origReg), node);
             }
             else {
               finalExpr = triton::ast::concat(
-                            triton::ast::extract((triton::api.cpuRegisterBitSize() - 1), WORD_SIZE_BIT, origReg),
+                            triton::ast::extract((triton::getContext().cpuRegisterBitSize() - 1), WORD_SIZE_BIT, origReg),
                             triton::ast::concat(node, triton::ast::extract((BYTE_SIZE_BIT - 1), 0, origReg))
                           );
             }
             break;
 
           case WORD_SIZE:
-            finalExpr = triton::ast::concat(triton::ast::extract((triton::api.cpuRegisterBitSize() - 1), WORD_SIZE_BIT, origReg), node);
+            finalExpr = triton::ast::concat(triton::ast::extract((triton::getContext().cpuRegisterBitSize() - 1), WORD_SIZE_BIT, origReg), node);
             break;
 
           case DWORD_SIZE:
             /* In AMD64, if a reg32 is written, it clears the 32-bit MSB of the corresponding register (Thx Wisk!) */
-            if (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) {
+            if (triton::getContext().getArchitecture() == triton::arch::ARCH_X86_64) {
               finalExpr = triton::ast::zx(DWORD_SIZE_BIT, node);
               break;
             }
@@ -796,33 +1057,94 @@ namespace triton {
             break;
         }
 
-        reg.setConcreteValue(node->evaluate());
+        triton::arch::Register written = reg;
+        written.setConcreteValue(node->evaluate());
         parentReg.setConcreteValue(finalExpr->evaluate());
         triton::engines::symbolic::SymbolicExpression* se = this->newSymbolicExpression(finalExpr, triton::engines::symbolic::REG, comment);
+        se->setAddress(inst.getAddress());
         this->assignSymbolicExpressionToRegister(se, parentReg);
         inst.addSymbolicExpression(se);
-        inst.setWrittenRegister(reg, node);
+        inst.setWrittenRegister(written, node);
 
         return se;
       }
 
 
       /* Returns the new symbolic flag expression */
-      SymbolicExpression* SymbolicEngine::createSymbolicFlagExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::Register& flag, const std::string& comment) {
+      SymbolicExpression* SymbolicEngine::createSymbolicFlagExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, const triton::arch::Register& flag, const std::string& comment) {
         if (!flag.isFlag())
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::createSymbolicFlagExpression(): The register must be a flag.");
-        flag.setConcreteValue(node->evaluate());
+        triton::arch::Register written = flag;
+        written.setConcreteValue(node->evaluate());
         triton::engines::symbolic::SymbolicExpression *se = this->newSymbolicExpression(node, triton::engines::symbolic::REG, comment);
-        this->assignSymbolicExpressionToRegister(se, flag);
+        se->setAddress(inst.getAddress());
+        this->assignSymbolicExpressionToRegister(se, written);
         inst.addSymbolicExpression(se);
-        inst.setWrittenRegister(flag, node);
+        inst.setWrittenRegister(written, node);
         return se;
       }
 
 
+      /* Records a lazy flag. Its concrete value is synchronized right now but its AST is built when the flag is read */
+      void SymbolicEngine::createLazySymbolicFlagExpression(triton::arch::Instruction& inst, const triton::arch::Register& flag, const triton::uint512& value, triton::usize parent, bool isTainted, const std::function<triton::ast::AbstractNode*(void)>& semantics, const std::string& comment) {
+        if (!flag.isFlag())
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::createLazySymbolicFlagExpression(): The register must be a flag.");
+
+        LazyFlag& lazy = this->lazyFlags[flag.getId()];
+        lazy.parent    = parent;
+        lazy.isTainted = isTainted;
+        lazy.comment   = comment;
+        lazy.semantics = semantics;
+
+        /* Synchronize the concrete state */
+        triton::arch::Register written = flag;
+        written.setConcreteValue(value);
+        triton::getContext().setConcreteRegisterValue(written);
+
+        /* The flag is written by the instruction but its AST does not exist yet */
+        inst.setWrittenRegister(written, nullptr);
+      }
+
+
+      /* Builds the symbolic expression of a lazy flag */
+      void SymbolicEngine::materializeLazyFlag(triton::uint32 flagId) {
+        auto it = this->lazyFlags.find(flagId);
+
+        if (it == this->lazyFlags.end())
+          return;
+
+        /* The entry is removed first as the semantics may read other flags */
+        LazyFlag lazy = it->second;
+        this->lazyFlags.erase(it);
+
+        /*
+         * The concrete state is not synchronized here, it has been done when
+         * the flag was recorded and it may have been modified since.
+         */
+        SymbolicExpression* se = this->newSymbolicExpression(lazy.semantics(), triton::engines::symbolic::REG, lazy.comment);
+        se->setOriginRegister(triton::arch::Register(flagId));
+        se->isTainted = lazy.isTainted;
+
+        /* The flag comes from the same instruction as its parent */
+        auto parent = this->symbolicExpressions.find(lazy.parent);
+        if (parent != this->symbolicExpressions.end())
+          se->setAddress(parent->second->getAddress());
+
+        this->symbolicReg[flagId] = se->getId();
+      }
+
+
+      /* Builds the symbolic expressions of all lazy flags */
+      void SymbolicEngine::materializeLazyFlags(void) {
+        while (!this->lazyFlags.empty())
+          this->materializeLazyFlag(this->lazyFlags.begin()->first);
+      }
+
+
       /* Returns the new symbolic volatile expression */
       SymbolicExpression* SymbolicEngine::createSymbolicVolatileExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, const std::string& comment) {
         triton::engines::symbolic::SymbolicExpression* se = this->newSymbolicExpression(node, triton::engines::symbolic::UNDEF, comment);
+        se->setAddress(inst.getAddress());
         inst.addSymbolicExpression(se);
         return se;
       }
@@ -830,7 +1152,7 @@ namespace triton {
 
       /* Adds and assign a new memory reference */
       void SymbolicEngine::addMemoryReference(triton::uint64 mem, triton::usize id) {
-        this->memoryReference[mem] = id;
+        this->memoryReference.set(mem, id);
       }
 
 
@@ -850,10 +1172,11 @@ namespace triton {
 
         se->setKind(triton::engines::symbolic::REG);
         se->setOriginRegister(reg);
+        this->lazyFlags.erase(id);
         this->symbolicReg[id] = se->getId();
 
         /* Synchronize the concrete state */
-        triton::api.setConcreteRegisterValue(reg);
+        triton::getContext().setConcreteRegisterValue(reg);
       }
 
 
@@ -867,23 +1190,26 @@ namespace triton {
         if (node->getBitvectorSize() != mem.getBitSize())
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::assignSymbolicExpressionToMemory(): The size of the symbolic expression is not equal to the memory access.");
 
-        /* Record the aligned memory for a symbolic optimization */
-        if (triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::ALIGNED_MEMORY))
-          this->addAlignedMemory(address, writeSize, node);
-
         /*
-         * As the x86's memory can be accessed without alignment, each byte of the
-         * memory must be assigned to an unique reference.
+         * The origin of an expression gives the offset of the bytes which refer to it.
+         * If the expression already backs a register or other bytes, its origin is kept
+         * and the memory is assigned to a new expression which references it.
          */
-        while (writeSize) {
-          /* Extract each byte of the memory */
-          triton::ast::AbstractNode* tmp = triton::ast::extract(((writeSize * BYTE_SIZE_BIT) - 1), ((writeSize * BYTE_SIZE_BIT) - BYTE_SIZE_BIT), node);
-          SymbolicExpression* byteRef = this->newSymbolicExpression(tmp, triton::engines::symbolic::MEM, "Byte reference");
-          byteRef->setOriginMemory(triton::arch::MemoryAccess(((address + writeSize) - 1), BYTE_SIZE, tmp->evaluate()));
-          /* Assign memory with little endian */
-          this->addMemoryReference((address + writeSize) - 1, byteRef->getId());
-          writeSize--;
+        if (se->getKind() != triton::engines::symbolic::UNDEF) {
+          se   = this->newSymbolicExpression(triton::ast::reference(se->getId()), triton::engines::symbolic::MEM, "Assigned memory");
+          node = se->getAst();
         }
+
+        /* Record the aligned memory for a symbolic optimization */
+        if (triton::getContext().isSymbolicOptimizationEnabled(triton::engines::symbolic::ALIGNED_MEMORY))
+          this->addAlignedMemory(address, writeSize, node);
+
+        se->setKind(triton::engines::symbolic::MEM);
+        se->setOriginMemory(triton::arch::MemoryAccess(address, writeSize, node->evaluate()));
+
+        /* Each byte of the memory refers to the expression */
+        for (triton::uint32 index = 0; index < writeSize; index++)
+          this->addMemoryReference(address + index, se->getId());
       }
 
 
@@ -17,6 +17,7 @@ namespace triton {
     namespace symbolic {
 
       SymbolicExpression::SymbolicExpression(triton::ast::AbstractNode* node, triton::usize id, symkind_e kind, const std::string& comment) : originRegister() {
+        this->address       = 0;
         this->comment       = comment;
         this->ast           = node;
         this->id            = id;
@@ -54,10 +55,10 @@ namespace triton {
 
 
       std::string SymbolicExpression::getFormattedId(void) const {
-        if (triton::api.getAstRepresentationMode() == triton::ast::representations::SMT_REPRESENTATION)
+        if (triton::getContext().getAstRepresentationMode() == triton::ast::representations::SMT_REPRESENTATION)
           return "ref!" + std::to_string(this->id);
 
-        else if (triton::api.getAstRepresentationMode() == triton::ast::representations::PYTHON_REPRESENTATION)
+        else if (triton::getContext().getAstRepresentationMode() == triton::ast::representations::PYTHON_REPRESENTATION)
           return "ref_" + std::to_string(this->id);
 
         else
@@ -69,10 +70,10 @@ namespace triton {
         if (this->getComment().empty())
           return "";
 
-        else if (triton::api.getAstRepresentationMode() == triton::ast::representations::SMT_REPRESENTATION)
+        else if (triton::getContext().getAstRepresentationMode() == triton::ast::representations::SMT_REPRESENTATION)
           return "; " + this->getComment();
 
-        else if (triton::api.getAstRepresentationMode() == triton::ast::representations::PYTHON_REPRESENTATION)
+        else if (triton::getContext().getAstRepresentationMode() == triton::ast::representations::PYTHON_REPRESENTATION)
           return "# " + this->getComment();
 
         else
@@ -95,10 +96,18 @@ namespace triton {
       }
 
 
+      triton::uint64 SymbolicExpression::getAddress(void) const {
+        return this->address;
+      }
+
+
       void SymbolicExpression::setAst(triton::ast::AbstractNode* node) {
         node->setParent(this->ast->getParents());
         this->ast = node;
         this->ast->init();
+
+        /* The references to this expression have been translated with the old AST */
+        triton::getContext().clearTranslatedNodes();
       }
 
 
@@ -117,6 +126,11 @@ namespace triton {
       }
 
 
+      void SymbolicExpression::setAddress(triton::uint64 addr) {
+        this->address = addr;
+      }
+
+
       bool SymbolicExpression::isRegister(void) const {
         return (this->kind == triton::engines::symbolic::REG);
       }
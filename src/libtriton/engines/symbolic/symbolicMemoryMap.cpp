@@ -0,0 +1,122 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+
+#include <symbolicMemoryMap.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      SymbolicMemoryMap::SymbolicMemoryMap() {
+      }
+
+
+      SymbolicMemoryMap::SymbolicMemoryMap(const SymbolicMemoryMap& other) : pages(other.pages) {
+      }
+
+
+      SymbolicMemoryMap::~SymbolicMemoryMap() {
+        this->clear();
+      }
+
+
+      void SymbolicMemoryMap::operator=(const SymbolicMemoryMap& other) {
+        this->pages = other.pages;
+      }
+
+
+      void SymbolicMemoryMap::clear(void) {
+        this->pages.clear();
+      }
+
+
+      triton::usize SymbolicMemoryMap::get(triton::uint64 addr) const {
+        const Page* page = this->pages.findPage(addr >> SYMBOLIC_PAGE_BITS);
+
+        if (page == nullptr)
+          return triton::engines::symbolic::UNSET;
+
+        return page->ids[addr & SYMBOLIC_PAGE_MASK];
+      }
+
+
+      void SymbolicMemoryMap::set(triton::uint64 addr, triton::usize id) {
+        triton::uint64 pageNumber = addr >> SYMBOLIC_PAGE_BITS;
+        Page* page                = nullptr;
+
+        /* Concretizing a byte of a concrete page does not allocate it */
+        if (id == triton::engines::symbolic::UNSET)
+          page = this->pages.findWritablePage(pageNumber);
+        else
+          page = this->pages.getOrCreatePage(pageNumber);
+
+        if (page == nullptr)
+          return;
+
+        triton::usize& slot = page->ids[addr & SYMBOLIC_PAGE_MASK];
+
+        if (slot == triton::engines::symbolic::UNSET && id != triton::engines::symbolic::UNSET)
+          page->count++;
+        else if (slot != triton::engines::symbolic::UNSET && id == triton::engines::symbolic::UNSET)
+          page->count--;
+
+        slot = id;
+
+        /* Release the page when all its bytes are concrete */
+        if (page->count == 0)
+          this->pages.releasePage(pageNumber);
+      }
+
+
+      bool SymbolicMemoryMap::isSymbolic(triton::uint64 addr, triton::usize size) const {
+        while (size > 0) {
+          triton::uint32 offset = static_cast<triton::uint32>(addr & SYMBOLIC_PAGE_MASK);
+          triton::uint32 chunk  = static_cast<triton::uint32>(std::min<triton::usize>(size, SYMBOLIC_PAGE_SIZE - offset));
+          const Page*    page   = this->pages.findPage(addr >> SYMBOLIC_PAGE_BITS);
+
+          if (page != nullptr) {
+            if (page->count == SYMBOLIC_PAGE_SIZE)
+              return true;
+            for (triton::uint32 index = offset; index < offset + chunk; index++) {
+              if (page->ids[index] != triton::engines::symbolic::UNSET)
+                return true;
+            }
+          }
+
+          addr += chunk;
+          size -= chunk;
+        }
+        return false;
+      }
+
+
+      triton::usize SymbolicMemoryMap::getNumberOfPages(void) const {
+        return this->pages.getNumberOfPages();
+      }
+
+
+      std::map<triton::uint64, triton::usize> SymbolicMemoryMap::getReferences(void) const {
+        std::map<triton::uint64, triton::usize> ret;
+
+        this->pages.forEachPage([&ret](triton::uint64 pageNumber, const Page& page) {
+          triton::uint64 base = pageNumber << SYMBOLIC_PAGE_BITS;
+          for (triton::uint32 index = 0; index < SYMBOLIC_PAGE_SIZE; index++) {
+            if (page.ids[index] != triton::engines::symbolic::UNSET)
+              ret[base + index] = page.ids[index];
+          }
+        });
+
+        return ret;
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
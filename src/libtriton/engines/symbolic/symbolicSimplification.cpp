@@ -213,7 +213,7 @@ namespace triton {
         }
 
         /* process recorded callback about symbolic simplifications */
-        node = triton::api.processCallbacks(triton::callbacks::SYMBOLIC_SIMPLIFICATION, node);
+        node = triton::getContext().processCallbacks(triton::callbacks::SYMBOLIC_SIMPLIFICATION, node);
 
         return node;
       }
@@ -0,0 +1,59 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <symbolicSlice.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      SymbolicSlice::SymbolicSlice() {
+      }
+
+
+      SymbolicSlice::SymbolicSlice(const std::vector<triton::usize>& expressions, const std::vector<triton::usize>& variables, const std::vector<triton::uint64>& addresses) {
+        this->expressions = expressions;
+        this->variables   = variables;
+        this->addresses   = addresses;
+      }
+
+
+      SymbolicSlice::SymbolicSlice(const SymbolicSlice& other) {
+        *this = other;
+      }
+
+
+      SymbolicSlice::~SymbolicSlice() {
+      }
+
+
+      void SymbolicSlice::operator=(const SymbolicSlice& other) {
+        this->expressions = other.expressions;
+        this->variables   = other.variables;
+        this->addresses   = other.addresses;
+      }
+
+
+      const std::vector<triton::usize>& SymbolicSlice::getSymbolicExpressions(void) const {
+        return this->expressions;
+      }
+
+
+      const std::vector<triton::usize>& SymbolicSlice::getSymbolicVariables(void) const {
+        return this->variables;
+      }
+
+
+      const std::vector<triton::uint64>& SymbolicSlice::getAddresses(void) const {
+        return this->addresses;
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -0,0 +1,229 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <bitset>
+
+#include <shadowMemory.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace taint {
+
+      /* Returns the mask of bits [low:low+size[ of a bitmap word (size in [1:64]) */
+      static inline triton::uint64 bitmapMask(triton::uint32 low, triton::uint32 size) {
+        if (size >= 64)
+          return 0xffffffffffffffff;
+        return ((static_cast<triton::uint64>(1) << size) - 1) << low;
+      }
+
+
+      /* Returns the number of bits set into a bitmap word */
+      static inline triton::uint32 bitmapCount(triton::uint64 word) {
+        return static_cast<triton::uint32>(std::bitset<64>(word).count());
+      }
+
+
+      /* Applies a callback on each bitmap word covered by the range [offset:offset+size[ of a page */
+      template <typename T>
+      static inline void forEachBitmapWord(triton::uint32 offset, triton::uint32 size, T callback) {
+        while (size > 0) {
+          triton::uint32 low   = offset % 64;
+          triton::uint32 chunk = std::min<triton::uint32>(size, 64 - low);
+          callback(offset / 64, bitmapMask(low, chunk));
+          offset += chunk;
+          size   -= chunk;
+        }
+      }
+
+
+      ShadowMemory::ShadowMemory() {
+      }
+
+
+      ShadowMemory::ShadowMemory(const ShadowMemory& other) : pages(other.pages) {
+      }
+
+
+      ShadowMemory::~ShadowMemory() {
+        this->clear();
+      }
+
+
+      void ShadowMemory::operator=(const ShadowMemory& other) {
+        this->pages = other.pages;
+      }
+
+
+      void ShadowMemory::clear(void) {
+        this->pages.clear();
+      }
+
+
+      triton::usize ShadowMemory::getNumberOfPages(void) const {
+        return this->pages.getNumberOfPages();
+      }
+
+
+      triton::usize ShadowMemory::getNumberOfTaintedBytes(void) const {
+        triton::usize count = 0;
+
+        this->pages.forEachPage([&count](triton::uint64, const Page& page) {
+          count += page.count;
+        });
+
+        return count;
+      }
+
+
+      triton::uint64 ShadowMemory::readBits(triton::uint64 addr, triton::uint32 size) const {
+        triton::uint64 bits = 0;
+        triton::uint32 read = 0;
+
+        /* The range covers at most two words */
+        while (read < size) {
+          triton::uint32 offset = static_cast<triton::uint32>(addr & SHADOW_PAGE_MASK);
+          triton::uint32 low    = offset % 64;
+          triton::uint32 chunk  = std::min<triton::uint32>(size - read, 64 - low);
+          const Page*    page   = this->pages.findPage(addr >> SHADOW_PAGE_BITS);
+
+          if (page != nullptr)
+            bits |= ((page->bitmap[offset / 64] >> low) & bitmapMask(0, chunk)) << read;
+
+          addr += chunk;
+          read += chunk;
+        }
+
+        return bits;
+      }
+
+
+      void ShadowMemory::orBits(triton::uint64 addr, triton::uint64 bits, triton::uint32 size) {
+        triton::uint32 written = 0;
+
+        /* The range covers at most two words */
+        while (written < size) {
+          triton::uint32 offset = static_cast<triton::uint32>(addr & SHADOW_PAGE_MASK);
+          triton::uint32 low    = offset % 64;
+          triton::uint32 chunk  = std::min<triton::uint32>(size - written, 64 - low);
+          triton::uint64 piece  = (bits >> written) & bitmapMask(0, chunk);
+
+          if (piece) {
+            Page* page = this->pages.getOrCreatePage(addr >> SHADOW_PAGE_BITS);
+            triton::uint64 newBits = (piece << low) & ~page->bitmap[offset / 64];
+            page->bitmap[offset / 64] |= newBits;
+            page->count += bitmapCount(newBits);
+          }
+
+          addr    += chunk;
+          written += chunk;
+        }
+      }
+
+
+      bool ShadowMemory::isTainted(triton::uint64 addr, triton::usize size) const {
+        while (size > 0) {
+          triton::uint32 offset  = static_cast<triton::uint32>(addr & SHADOW_PAGE_MASK);
+          triton::uint32 chunk   = static_cast<triton::uint32>(std::min<triton::usize>(size, SHADOW_PAGE_SIZE - offset));
+          const Page*    page    = this->pages.findPage(addr >> SHADOW_PAGE_BITS);
+          bool           tainted = false;
+
+          if (page != nullptr) {
+            if (page->count == SHADOW_PAGE_SIZE)
+              return true;
+            forEachBitmapWord(offset, chunk, [page, &tainted](triton::uint32 index, triton::uint64 mask) {
+              if (page->bitmap[index] & mask)
+                tainted = true;
+            });
+            if (tainted)
+              return true;
+          }
+
+          addr += chunk;
+          size -= chunk;
+        }
+        return false;
+      }
+
+
+      void ShadowMemory::setTaint(triton::uint64 addr, triton::usize size, bool flag) {
+        while (size > 0) {
+          triton::uint64 pageNumber = addr >> SHADOW_PAGE_BITS;
+          triton::uint32 offset     = static_cast<triton::uint32>(addr & SHADOW_PAGE_MASK);
+          triton::uint32 chunk      = static_cast<triton::uint32>(std::min<triton::usize>(size, SHADOW_PAGE_SIZE - offset));
+
+          if (flag) {
+            Page* page = this->pages.getOrCreatePage(pageNumber);
+            forEachBitmapWord(offset, chunk, [page](triton::uint32 index, triton::uint64 mask) {
+              page->count += bitmapCount(mask & ~page->bitmap[index]);
+              page->bitmap[index] |= mask;
+            });
+          }
+          else {
+            Page* page = this->pages.findWritablePage(pageNumber);
+            if (page != nullptr) {
+              forEachBitmapWord(offset, chunk, [page](triton::uint32 index, triton::uint64 mask) {
+                page->count -= bitmapCount(mask & page->bitmap[index]);
+                page->bitmap[index] &= ~mask;
+              });
+              if (page->count == 0)
+                this->pages.releasePage(pageNumber);
+            }
+          }
+
+          addr += chunk;
+          size -= chunk;
+        }
+      }
+
+
+      bool ShadowMemory::unionTaint(triton::uint64 dst, triton::uint64 src, triton::usize size) {
+        bool tainted = false;
+
+        /* If the destination overlaps the end of the source, the range is processed backward */
+        if (dst > src && dst - src < size) {
+          while (size > 0) {
+            triton::uint32 chunk = static_cast<triton::uint32>(std::min<triton::usize>(size, 64));
+            size -= chunk;
+            triton::uint64 bits = this->readBits(src + size, chunk);
+            if (bits) {
+              this->orBits(dst + size, bits, chunk);
+              tainted = true;
+            }
+          }
+          return tainted;
+        }
+
+        while (size > 0) {
+          triton::uint32 offset = static_cast<triton::uint32>(src & SHADOW_PAGE_MASK);
+          triton::uint32 chunk  = static_cast<triton::uint32>(std::min<triton::usize>(size, 64));
+
+          /* Skip the clean pages of the source */
+          if (this->pages.findPage(src >> SHADOW_PAGE_BITS) == nullptr) {
+            chunk = static_cast<triton::uint32>(std::min<triton::usize>(size, SHADOW_PAGE_SIZE - offset));
+          }
+          else {
+            triton::uint64 bits = this->readBits(src, chunk);
+            if (bits) {
+              this->orBits(dst, bits, chunk);
+              tainted = true;
+            }
+          }
+
+          dst  += chunk;
+          src  += chunk;
+          size -= chunk;
+        }
+
+        return tainted;
+      }
+
+    }; /* taint namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
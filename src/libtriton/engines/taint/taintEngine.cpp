@@ -6,6 +6,7 @@
 */
 
 #include <api.hpp>
+#include <cpuSize.hpp>
 #include <exceptions.hpp>
 #include <taintEngine.hpp>
 
@@ -82,6 +83,46 @@ That's why Triton uses **symbolic execution for precision** and an over-approxim
 tainting to know if we can ask a model to the SMT solver - Asking a model means that
 the symbolic variables are controllable by the user input.
 
+\section engine_Taint_memory The shadow memory
+<hr>
+
+The tainted bytes of the memory are recorded into a shadow memory (see triton::engines::taint::ShadowMemory)
+which holds one bit per byte. Pages of the shadow memory are only allocated when one of their bytes is tainted,
+so tainting or checking a large buffer (e.g. with `taintMemoryArea()`) works on whole 64-bit words instead of
+single bytes.
+
+\section engine_Taint_registers The register taint
+<hr>
+
+The taint of a register is recorded per byte into its parent register (bit `n` of the mask is the byte `n`
+of the parent register). So, `mov al, [tainted]` only taints `al` and `isRegisterTainted(REG.AH)` is false.
+Like the symbolic engine, an assignment to a register of 32 bits or more clears the taint of the upper bytes of
+its parent register (e.g. `mov eax, ebx` untaints the 32 upper bits of `rax` in 64-bit mode). Inside a register
+slice, the taint is not tracked per byte: a slice is tainted as a whole if one of its sources is tainted.
+
+\section engine_Taint_labels The taint labels
+<hr>
+
+Each tainted byte and register may also carry a set of labels (see triton::engines::taint::TaintLabels) which
+tells which inputs it comes from. Inputs are tainted with `taintMemoryWithLabel()` and `taintRegisterWithLabel()`,
+then `getTaintLabels()` returns the labels of any operand. Assignments copy the labels of the source and unions
+merge them. The labels of a register are kept per parent register, like its taint. When the semantics of an
+instruction taint a destination without a source (e.g. the flags of a `cmp` or a `lea`), the destination gets
+all the labels read by the instruction, which is an over-approximation. So, after a conditional jump, the labels
+of the program counter are the inputs which influence the branch.
+
+~~~~~~~~~~~~~{.py}
+>>> taintMemoryWithLabel(MemoryAccess(0x1000, CPUSIZE.QWORD), 0)
+True
+>>> taintMemoryWithLabel(MemoryAccess(0x2000, CPUSIZE.QWORD), 1)
+True
+>>> # mov rax, [0x1000]; mov rbx, [0x2000]; add rax, rbx
+>>> getTaintLabels(REG.RAX)
+[0L, 1L]
+>>> getTaintLabels(REG.RBX)
+[1L]
+~~~~~~~~~~~~~
+
 */
 
 
@@ -91,32 +132,39 @@ namespace triton {
     namespace taint {
 
       TaintEngine::TaintEngine() {
-        triton::api.checkArchitecture();
-        this->numberOfRegisters = triton::api.cpuNumberOfRegisters();
-        this->taintedRegisters  = new triton::uint8[this->numberOfRegisters]();
-        this->enableFlag  = true;
-
-        if (!this->taintedRegisters)
+        triton::getContext().checkArchitecture();
+        this->numberOfRegisters = triton::getContext().cpuNumberOfRegisters();
+        this->taintedRegisters  = new triton::uint64[this->numberOfRegisters]();
+        this->registerLabels    = new triton::uint64[this->numberOfRegisters]();
+        this->enableFlag        = true;
+        this->recordLabels      = false;
+        this->instructionLabels = 0;
+
+        if (!this->taintedRegisters || !this->registerLabels)
           throw triton::exceptions::TaintEngine("TaintEngine::TaintEngine(): No enough memory.");
-
-        for (triton::uint32 i = 0; i < this->numberOfRegisters; i++)
-          this->taintedRegisters[i] = !TAINTED;
       }
 
 
       void TaintEngine::init(const TaintEngine& other) {
-        triton::api.checkArchitecture();
+        triton::getContext().checkArchitecture();
         this->numberOfRegisters = other.numberOfRegisters;
-        this->taintedRegisters  = new triton::uint8[this->numberOfRegisters]();
-        this->enableFlag  = other.enableFlag;
+        this->taintedRegisters  = new triton::uint64[this->numberOfRegisters]();
+        this->registerLabels    = new triton::uint64[this->numberOfRegisters]();
+        this->enableFlag        = other.enableFlag;
+        this->recordLabels      = false;
+        this->instructionLabels = 0;
 
-        if (!this->taintedRegisters)
+        if (!this->taintedRegisters || !this->registerLabels)
           throw triton::exceptions::TaintEngine("TaintEngine::TaintEngine(): No enough memory.");
 
-        for (triton::uint32 i = 0; i < this->numberOfRegisters; i++)
+        for (triton::uint32 i = 0; i < this->numberOfRegisters; i++) {
           this->taintedRegisters[i] = other.taintedRegisters[i];
+          this->registerLabels[i]   = other.registerLabels[i];
+        }
 
-        this->taintedAddresses = other.taintedAddresses;
+        this->taintedMemory = other.taintedMemory;
+        this->memoryLabels  = other.memoryLabels;
+        this->labels        = other.labels;
       }
 
 
@@ -127,11 +175,13 @@ namespace triton {
 
       TaintEngine::~TaintEngine() {
         delete[] this->taintedRegisters;
+        delete[] this->registerLabels;
       }
 
 
       void TaintEngine::operator=(const TaintEngine& other) {
         delete[] this->taintedRegisters;
+        delete[] this->registerLabels;
         init(other);
       }
 
@@ -146,26 +196,133 @@ namespace triton {
       }
 
 
-      /* Returns true of false if the memory address is currently tainted */
-      bool TaintEngine::isMemoryTainted(const triton::arch::MemoryAccess& mem) const {
-        triton::uint64 addr = mem.getAddress();
-        triton::uint32 size = mem.getSize();
+      triton::uint64 TaintEngine::getRegisterMask(const triton::arch::Register& reg) const {
+        triton::uint32 low   = reg.getAbstractLow() / BYTE_SIZE_BIT;
+        triton::uint32 count = (reg.getAbstractHigh() / BYTE_SIZE_BIT) - low + 1;
+
+        if (count >= 64)
+          return 0xffffffffffffffff;
 
-        for (triton::uint32 index = 0; index < size; index++) {
-          if (this->taintedAddresses.find(addr+index) != this->taintedAddresses.end())
-            return TAINTED;
+        return ((static_cast<triton::uint64>(1) << count) - 1) << low;
+      }
+
+
+      triton::uint64 TaintEngine::getRegisterWriteMask(const triton::arch::Register& reg) const {
+        /* Like the symbolic engine, a write of 32 bits or more zero-extends the parent register */
+        if (reg.getSize() >= DWORD_SIZE)
+          return this->getRegisterMask(reg.getParent());
+        return this->getRegisterMask(reg);
+      }
+
+
+      void TaintEngine::writeRegister(const triton::arch::Register& reg, bool flag, triton::uint64 set) {
+        triton::uint32 parentId = reg.getParent().getId();
+        triton::uint64 kept     = this->taintedRegisters[parentId] & ~this->getRegisterWriteMask(reg);
+
+        this->taintedRegisters[parentId] = kept;
+
+        if (flag == TAINTED) {
+          this->taintedRegisters[parentId] |= this->getRegisterMask(reg);
+          this->registerLabels[parentId]    = kept ? this->labels.merge(this->registerLabels[parentId], set) : set;
         }
-        return !TAINTED;
+
+        else if (kept == 0)
+          this->registerLabels[parentId] = 0;
+      }
+
+
+      void TaintEngine::recordInstructionLabels(bool flag) {
+        this->recordLabels      = flag;
+        this->instructionLabels = 0;
+      }
+
+
+      void TaintEngine::readLabels(triton::uint64 set) const {
+        if (this->recordLabels && set)
+          this->instructionLabels = this->labels.merge(this->instructionLabels, set);
+      }
+
+
+      triton::uint64 TaintEngine::getSpreadLabelSet(triton::uint64 current) const {
+        if (this->recordLabels)
+          return this->instructionLabels;
+        return current;
+      }
+
+
+      triton::uint64 TaintEngine::getMemoryLabelSet(triton::uint64 addr, triton::usize size) const {
+        triton::uint64 set = 0;
+
+        /* Fast path if no label has been used */
+        if (this->memoryLabels.empty())
+          return 0;
+
+        for (triton::usize index = 0; index < size; index++) {
+          auto it = this->memoryLabels.find(addr + index);
+          if (it != this->memoryLabels.end())
+            set = this->labels.merge(set, it->second);
+        }
+
+        return set;
+      }
+
+
+      void TaintEngine::setMemoryLabelSet(triton::uint64 addr, triton::usize size, triton::uint64 set) {
+        if (set == 0) {
+          if (this->memoryLabels.empty())
+            return;
+          for (triton::usize index = 0; index < size; index++)
+            this->memoryLabels.erase(addr + index);
+          return;
+        }
+
+        for (triton::usize index = 0; index < size; index++)
+          this->memoryLabels[addr + index] = set;
+      }
+
+
+      void TaintEngine::mergeMemoryLabelSet(triton::uint64 addr, triton::usize size, triton::uint64 set) {
+        if (set == 0)
+          return;
+
+        for (triton::usize index = 0; index < size; index++) {
+          triton::uint64& current = this->memoryLabels[addr + index];
+          current = this->labels.merge(current, set);
+        }
+      }
+
+
+      void TaintEngine::unionMemoryLabelSet(triton::uint64 dst, triton::uint64 src, triton::usize size) {
+        std::vector<triton::uint64> sets;
+
+        if (this->memoryLabels.empty())
+          return;
+
+        /* The source is read first as both ranges may overlap */
+        for (triton::usize index = 0; index < size; index++) {
+          auto it = this->memoryLabels.find(src + index);
+          sets.push_back(it != this->memoryLabels.end() ? it->second : 0);
+        }
+
+        for (triton::usize index = 0; index < size; index++)
+          this->mergeMemoryLabelSet(dst + index, 1, sets[index]);
+      }
+
+
+      /* Returns true of false if the memory address is currently tainted */
+      bool TaintEngine::isMemoryTainted(const triton::arch::MemoryAccess& mem) const {
+        return this->isMemoryTainted(mem.getAddress(), mem.getSize());
       }
 
 
       /* Returns true of false if the address is currently tainted */
       bool TaintEngine::isMemoryTainted(triton::uint64 addr, triton::uint32 size) const {
-        for (triton::uint32 index = 0; index < size; index++) {
-          if (this->taintedAddresses.find(addr+index) != this->taintedAddresses.end())
-            return TAINTED;
-        }
-        return !TAINTED;
+        bool tainted = this->taintedMemory.isTainted(addr, size);
+
+        if (tainted && this->recordLabels)
+          this->readLabels(this->getMemoryLabelSet(addr, size));
+
+        return tainted;
       }
 
 
@@ -173,21 +330,58 @@ namespace triton {
       bool TaintEngine::isRegisterTainted(const triton::arch::Register& reg) const {
         triton::uint32 parentId = reg.getParent().getId();
 
-        if (this->taintedRegisters[parentId])
+        if (this->taintedRegisters[parentId] & this->getRegisterMask(reg)) {
+          this->readLabels(this->registerLabels[parentId]);
           return true;
+        }
 
         return false;
       }
 
 
+      /* Returns the labels of the memory */
+      std::set<triton::uint32> TaintEngine::getMemoryTaintLabels(const triton::arch::MemoryAccess& mem) const {
+        return this->labels.getLabels(this->getMemoryLabelSet(mem.getAddress(), mem.getSize()));
+      }
+
+
+      /* Returns the labels of the register */
+      std::set<triton::uint32> TaintEngine::getRegisterTaintLabels(const triton::arch::Register& reg) const {
+        triton::uint32 parentId = reg.getParent().getId();
+
+        if ((this->taintedRegisters[parentId] & this->getRegisterMask(reg)) == 0)
+          return std::set<triton::uint32>();
+
+        return this->labels.getLabels(this->registerLabels[parentId]);
+      }
+
+
       /* Taint the register */
       bool TaintEngine::taintRegister(const triton::arch::Register& reg) {
         triton::uint32 parentId = reg.getParent().getId();
 
-        if (this->isEnabled())
-          this->taintedRegisters[parentId] = TAINTED;
+        if (this->isEnabled()) {
+          this->taintedRegisters[parentId] |= this->getRegisterMask(reg);
+          this->registerLabels[parentId]    = this->getSpreadLabelSet(this->registerLabels[parentId]);
+        }
+
+        if (this->taintedRegisters[parentId] & this->getRegisterMask(reg))
+          return true;
+
+        return false;
+      }
+
+
+      /* Taint the register with a label */
+      bool TaintEngine::taintRegisterWithLabel(const triton::arch::Register& reg, triton::uint32 label) {
+        triton::uint32 parentId = reg.getParent().getId();
+
+        if (this->isEnabled()) {
+          this->taintedRegisters[parentId] |= this->getRegisterMask(reg);
+          this->registerLabels[parentId]    = this->labels.merge(this->registerLabels[parentId], this->labels.getLabelSet(label));
+        }
 
-        if (this->taintedRegisters[parentId])
+        if (this->taintedRegisters[parentId] & this->getRegisterMask(reg))
           return true;
 
         return false;
@@ -211,15 +405,9 @@ namespace triton {
 
       /* Set the taint on register */
       bool TaintEngine::setTaintRegister(const triton::arch::Register& reg, bool flag) {
-        triton::uint32 parentId = reg.getParent().getId();
-
-        if (this->isEnabled())
-          this->taintedRegisters[parentId] = flag;
-
-        if (this->taintedRegisters[parentId])
-          return true;
-
-        return false;
+        if (flag == TAINTED)
+          return this->taintRegister(reg);
+        return this->untaintRegister(reg);
       }
 
 
@@ -227,10 +415,13 @@ namespace triton {
       bool TaintEngine::untaintRegister(const triton::arch::Register& reg) {
         triton::uint32 parentId = reg.getParent().getId();
 
-        if (this->isEnabled())
-          this->taintedRegisters[parentId] = !TAINTED;
+        if (this->isEnabled()) {
+          this->taintedRegisters[parentId] &= ~this->getRegisterMask(reg);
+          if (this->taintedRegisters[parentId] == 0)
+            this->registerLabels[parentId] = 0;
+        }
 
-        if (this->taintedRegisters[parentId])
+        if (this->taintedRegisters[parentId] & this->getRegisterMask(reg))
           return true;
 
         return false;
@@ -245,8 +436,9 @@ namespace triton {
         if (!this->isEnabled())
           return this->isMemoryTainted(mem);
 
-        for (triton::uint32 index = 0; index < size; index++)
-          this->taintedAddresses[addr+index] = TAINTED;
+        this->taintedMemory.setTaint(addr, size, TAINTED);
+        if (this->recordLabels)
+          this->setMemoryLabelSet(addr, size, this->instructionLabels);
 
         return TAINTED;
       }
@@ -254,9 +446,38 @@ namespace triton {
 
       /* Taint the address */
       bool TaintEngine::taintMemory(triton::uint64 addr) {
-        if (this->isEnabled())
-          this->taintedAddresses[addr] = TAINTED;
-        return this->taintedAddresses[addr];
+        if (this->isEnabled()) {
+          this->taintedMemory.setTaint(addr, 1, TAINTED);
+          if (this->recordLabels)
+            this->setMemoryLabelSet(addr, 1, this->instructionLabels);
+        }
+        return this->taintedMemory.isTainted(addr);
+      }
+
+
+      /* Taint the memory area */
+      bool TaintEngine::taintMemoryArea(triton::uint64 addr, triton::usize size) {
+        if (!this->isEnabled())
+          return this->taintedMemory.isTainted(addr, size);
+
+        this->taintedMemory.setTaint(addr, size, TAINTED);
+
+        return TAINTED;
+      }
+
+
+      /* Taint the memory with a label */
+      bool TaintEngine::taintMemoryWithLabel(const triton::arch::MemoryAccess& mem, triton::uint32 label) {
+        triton::uint64 addr = mem.getAddress();
+        triton::uint32 size = mem.getSize();
+
+        if (!this->isEnabled())
+          return this->isMemoryTainted(mem);
+
+        this->taintedMemory.setTaint(addr, size, TAINTED);
+        this->mergeMemoryLabelSet(addr, size, this->labels.getLabelSet(label));
+
+        return TAINTED;
       }
 
 
@@ -268,8 +489,8 @@ namespace triton {
         if (!this->isEnabled())
           return this->isMemoryTainted(mem);
 
-        for (triton::uint32 index = 0; index < size; index++)
-          this->taintedAddresses.erase(addr+index);
+        this->taintedMemory.setTaint(addr, size, !TAINTED);
+        this->setMemoryLabelSet(addr, size, 0);
 
         return !TAINTED;
       }
@@ -279,7 +500,18 @@ namespace triton {
       bool TaintEngine::untaintMemory(triton::uint64 addr) {
         if (!this->isEnabled())
           return this->isMemoryTainted(addr);
-        this->taintedAddresses.erase(addr);
+        this->taintedMemory.setTaint(addr, 1, !TAINTED);
+        this->setMemoryLabelSet(addr, 1, 0);
+        return !TAINTED;
+      }
+
+
+      /* Untaint the memory area */
+      bool TaintEngine::untaintMemoryArea(triton::uint64 addr, triton::usize size) {
+        if (!this->isEnabled())
+          return this->taintedMemory.isTainted(addr, size);
+        this->taintedMemory.setTaint(addr, size, !TAINTED);
+        this->setMemoryLabelSet(addr, size, 0);
         return !TAINTED;
       }
 
@@ -293,11 +525,11 @@ namespace triton {
           return this->isRegisterTainted(regDst);
 
         if (this->isRegisterTainted(regSrc)) {
-          this->taintRegister(regDst);
+          this->writeRegister(regDst, TAINTED, this->registerLabels[regSrc.getParent().getId()]);
           return TAINTED;
         }
 
-        this->untaintRegister(regDst);
+        this->writeRegister(regDst, !TAINTED, 0);
         return !TAINTED;
       }
 
@@ -309,7 +541,7 @@ namespace triton {
       bool TaintEngine::assignmentRegisterImmediate(const triton::arch::Register& regDst) {
         if (!this->isEnabled())
           return this->isRegisterTainted(regDst);
-        this->untaintRegister(regDst);
+        this->writeRegister(regDst, !TAINTED, 0);
         return !TAINTED;
       }
 
@@ -323,11 +555,11 @@ namespace triton {
           return this->isRegisterTainted(regDst);
 
         if (this->isMemoryTainted(memSrc)) {
-          this->taintRegister(regDst);
+          this->writeRegister(regDst, TAINTED, this->getMemoryLabelSet(memSrc.getAddress(), memSrc.getSize()));
           return TAINTED;
         }
 
-        this->untaintRegister(regDst);
+        this->writeRegister(regDst, !TAINTED, 0);
         return !TAINTED;
       }
 
@@ -337,7 +569,6 @@ namespace triton {
        * Returns true if a spreading occurs otherwise returns false.
        */
       bool TaintEngine::assignmentMemoryMemory(const triton::arch::MemoryAccess& memDst, const triton::arch::MemoryAccess& memSrc) {
-        bool isTainted          = !TAINTED;
         triton::uint32 readSize = memSrc.getSize();
         triton::uint64 addrSrc  = memSrc.getAddress();
         triton::uint64 addrDst  = memDst.getAddress();
@@ -345,13 +576,8 @@ namespace triton {
         if (!this->isEnabled())
           return this->isMemoryTainted(memDst);
 
-        for (triton::uint32 offset = 0; offset < readSize; offset++) {
-          if (this->isMemoryTainted(addrSrc+offset)) {
-            this->taintMemory(addrDst+offset);
-            isTainted = TAINTED;
-          }
-        }
-        return isTainted;
+        this->unionMemoryLabelSet(addrDst, addrSrc, readSize);
+        return this->taintedMemory.unionTaint(addrDst, addrSrc, readSize);
       }
 
 
@@ -377,7 +603,8 @@ namespace triton {
 
         /* Check source */
         if (this->isRegisterTainted(regSrc)) {
-          this->taintMemory(memDst);
+          this->taintedMemory.setTaint(memDst.getAddress(), memDst.getSize(), TAINTED);
+          this->setMemoryLabelSet(memDst.getAddress(), memDst.getSize(), this->registerLabels[regSrc.getParent().getId()]);
           return TAINTED;
         }
 
@@ -405,12 +632,17 @@ namespace triton {
         if (!this->isEnabled())
           return this->isRegisterTainted(regDst);
 
+        bool tainted = this->isRegisterTainted(regDst);
+
         if (this->isRegisterTainted(regSrc)) {
+          triton::uint32 dstId = regDst.getParent().getId();
+          triton::uint64 set   = this->labels.merge(this->registerLabels[dstId], this->registerLabels[regSrc.getParent().getId()]);
           this->taintRegister(regDst);
+          this->registerLabels[dstId] = set;
           return TAINTED;
         }
 
-        return this->isRegisterTainted(regDst);
+        return tainted;
       }
 
 
@@ -419,7 +651,6 @@ namespace triton {
        * we check if memDst is tainted and returns the status.
        */
       bool TaintEngine::unionMemoryMemory(const triton::arch::MemoryAccess& memDst, const triton::arch::MemoryAccess& memSrc) {
-        bool tainted             = !TAINTED;
         triton::uint32 writeSize = memDst.getSize();
         triton::uint64 addrDst   = memDst.getAddress();
         triton::uint64 addrSrc   = memSrc.getAddress();
@@ -428,12 +659,8 @@ namespace triton {
           return this->isMemoryTainted(memDst);
 
         /* Check source */
-        for (triton::uint32 offset = 0; offset < writeSize; offset++) {
-          if (this->isMemoryTainted(addrSrc+offset)) {
-            this->taintMemory(addrDst+offset);
-            tainted = TAINTED;
-          }
-        }
+        this->unionMemoryLabelSet(addrDst, addrSrc, writeSize);
+        bool tainted = this->taintedMemory.unionTaint(addrDst, addrSrc, writeSize);
 
         /* Check destination */
         if (this->isMemoryTainted(memDst)) {
@@ -452,12 +679,17 @@ namespace triton {
         if (!this->isEnabled())
           return this->isRegisterTainted(regDst);
 
+        bool tainted = this->isRegisterTainted(regDst);
+
         if (this->isMemoryTainted(memSrc)) {
+          triton::uint32 dstId = regDst.getParent().getId();
+          triton::uint64 set   = this->labels.merge(this->registerLabels[dstId], this->getMemoryLabelSet(memSrc.getAddress(), memSrc.getSize()));
           this->taintRegister(regDst);
+          this->registerLabels[dstId] = set;
           return TAINTED;
         }
 
-        return this->isRegisterTainted(regDst);
+        return tainted;
       }
 
 
@@ -479,12 +711,15 @@ namespace triton {
         if (!this->isEnabled())
           return this->isMemoryTainted(memDst);
 
+        bool tainted = this->isMemoryTainted(memDst);
+
         if (this->isRegisterTainted(regSrc)) {
-          this->taintMemory(memDst);
+          this->taintedMemory.setTaint(memDst.getAddress(), memDst.getSize(), TAINTED);
+          this->mergeMemoryLabelSet(memDst.getAddress(), memDst.getSize(), this->registerLabels[regSrc.getParent().getId()]);
           return TAINTED;
         }
 
-        if (this->isMemoryTainted(memDst))
+        if (tainted)
           return TAINTED;
 
         return !TAINTED;
@@ -493,4 +728,3 @@ namespace triton {
     }; /* taint namespace */
   }; /* engines namespace */
 }; /* triton namespace */
-
@@ -0,0 +1,111 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <iterator>
+
+#include <taintLabels.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace taint {
+
+      TaintLabels::TaintLabels() {
+      }
+
+
+      TaintLabels::TaintLabels(const TaintLabels& other) {
+        *this = other;
+      }
+
+
+      TaintLabels::~TaintLabels() {
+      }
+
+
+      void TaintLabels::operator=(const TaintLabels& other) {
+        this->interned = other.interned;
+        this->ids      = other.ids;
+      }
+
+
+      triton::uint64 TaintLabels::intern(const std::vector<triton::uint32>& labels) {
+        /* Small label sets are never interned */
+        if (labels.empty() || labels.back() < TAINT_LABELS_DIRECT) {
+          triton::uint64 set = 0;
+          for (auto it = labels.begin(); it != labels.end(); it++)
+            set |= (static_cast<triton::uint64>(1) << *it);
+          return set;
+        }
+
+        auto it = this->ids.find(labels);
+        if (it != this->ids.end())
+          return it->second;
+
+        triton::uint64 set = this->interned.size() | TAINT_LABELS_INTERNED;
+        this->interned.push_back(labels);
+        this->ids[labels] = set;
+
+        return set;
+      }
+
+
+      triton::uint64 TaintLabels::getLabelSet(triton::uint32 label) {
+        if (label < TAINT_LABELS_DIRECT)
+          return (static_cast<triton::uint64>(1) << label);
+        return this->intern(std::vector<triton::uint32>(1, label));
+      }
+
+
+      triton::uint64 TaintLabels::merge(triton::uint64 set1, triton::uint64 set2) {
+        if (set1 == set2 || set2 == 0)
+          return set1;
+
+        if (set1 == 0)
+          return set2;
+
+        /* Both label sets are bitmasks */
+        if (((set1 | set2) & TAINT_LABELS_INTERNED) == 0)
+          return set1 | set2;
+
+        std::set<triton::uint32> labels1 = this->getLabels(set1);
+        std::set<triton::uint32> labels2 = this->getLabels(set2);
+        std::vector<triton::uint32> labels;
+
+        std::set_union(labels1.begin(), labels1.end(), labels2.begin(), labels2.end(), std::back_inserter(labels));
+
+        return this->intern(labels);
+      }
+
+
+      std::set<triton::uint32> TaintLabels::getLabels(triton::uint64 set) const {
+        std::set<triton::uint32> labels;
+
+        if (set & TAINT_LABELS_INTERNED) {
+          const std::vector<triton::uint32>& v = this->interned.at(set & ~TAINT_LABELS_INTERNED);
+          labels.insert(v.begin(), v.end());
+          return labels;
+        }
+
+        for (triton::uint32 label = 0; label < TAINT_LABELS_DIRECT; label++) {
+          if (set & (static_cast<triton::uint64>(1) << label))
+            labels.insert(label);
+        }
+
+        return labels;
+      }
+
+
+      triton::usize TaintLabels::getNumberOfInternedSets(void) const {
+        return this->interned.size();
+      }
+
+    }; /* taint namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
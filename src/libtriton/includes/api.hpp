@@ -37,7 +37,20 @@ namespace triton {
  */
 
     /*! \class API
-     *  \brief This is used as C++ API. */
+     *  \brief This is used as C++ API.
+     *
+     *  \description
+     *  An API is an independent context which owns its architecture, engines, AST nodes and callbacks.
+     *  The engines use the context of their thread (see triton::getContext()), so several contexts can
+     *  run in parallel, one per thread. `triton::api` is the default context of each thread. Each method
+     *  of an API makes it the context of the calling thread for the duration of the call (see
+     *  triton::ContextScope), so the methods of any context can be called without triton::setContext().
+     *  The AST nodes built outside of a method (e.g. with triton::ast::bv()) are allocated by the context
+     *  of the thread and each node is released into the context which allocated it.
+     *
+     *  The register specifications (e.g. `TRITON_X86_REG_RAX`) are shared by all the contexts. So, the
+     *  contexts of a process must use the same architecture and their architecture must be set before
+     *  starting the threads. */
     class API {
 
       protected:
@@ -65,6 +78,9 @@ namespace triton {
         //! The Callbacks interface.
         triton::callbacks::Callbacks* callbacks;
 
+        //! Removes the symbolic expressions which are not reachable from the engines roots, `exprs` and `nodes`, and the AST nodes of these expressions which are not reachable either.
+        triton::usize reclaimSymbolicExpressions(std::set<triton::usize>& exprs, std::vector<triton::ast::AbstractNode*>& nodes);
+
       public:
         //! Constructor of the API.
         API();
@@ -72,6 +88,12 @@ namespace triton {
         //! Destructor of the API.
         ~API();
 
+        //! An API owns its engines and cannot be copied.
+        API(const API& other) = delete;
+
+        //! An API owns its engines and cannot be copied.
+        API& operator=(const API& other) = delete;
+
 
 
         /* Architecture API ============================================================================== */
@@ -189,6 +211,9 @@ namespace triton {
         //! [**architecture api**] - Disassembles the instruction and setup operands. You must define an architecture before. \sa processing().
         void disassembly(triton::arch::Instruction& inst) const;
 
+        //! [**architecture api**] - Returns all stats about the cache of decoded instructions (hits, misses and entries).
+        std::map<std::string, triton::usize> getDisassemblyCacheStats(void) const;
+
         //! [**architecture api**] - Builds the instruction semantics. You must define an architecture before. \sa processing().
         void buildSemantics(triton::arch::Instruction& inst);
 
@@ -215,6 +240,12 @@ namespace triton {
         //! [**AST garbage collector api**] - Raises an exception if the AST garbage collector interface is not initialized.
         void checkAstGarbageCollector(void) const;
 
+        //! [**AST garbage collector api**] - Allocates the storage of a node into the AST arena.
+        void* allocateAstNode(triton::usize size);
+
+        //! [**AST garbage collector api**] - Releases the storage of a node from the AST arena.
+        void deallocateAstNode(void* node);
+
         //! [**AST garbage collector api**] - Go through every allocated nodes and free them.
         void freeAllAstNodes(void);
 
@@ -231,7 +262,10 @@ namespace triton {
         void recordVariableAstNode(const std::string& name, triton::ast::AbstractNode* node);
 
         //! [**AST garbage collector api**] - Returns all allocated nodes.
-        const std::set<triton::ast::AbstractNode*>& getAllocatedAstNodes(void) const;
+        std::set<triton::ast::AbstractNode*> getAllocatedAstNodes(void) const;
+
+        //! [**AST garbage collector api**] - Returns stats about the AST arena (live nodes, live bytes, slabs, reserved bytes).
+        std::map<std::string, triton::usize> getAstArenaStats(void) const;
 
         //! [**AST garbage collector api**] - Returns all variable nodes recorded.
         const std::map<std::string, triton::ast::AbstractNode*>& getAstVariableNodes(void) const;
@@ -261,6 +295,12 @@ namespace triton {
         //! [**AST representation api**] - Sets the AST representation mode.
         void setAstRepresentationMode(triton::uint32 mode);
 
+        //! [**AST representation api**] - Returns a node as straight-line Python code. Each shared subterm is assigned once to a temporary, the last line is the expression of the node.
+        std::string getPythonCode(triton::ast::AbstractNode* node);
+
+        //! [**AST representation api**] - Writes a node as straight-line Python code into a stream, without building it in memory.
+        void writePythonCode(std::ostream& stream, triton::ast::AbstractNode* node);
+
 
 
         /* Callbacks API ================================================================================= */
@@ -367,7 +407,7 @@ namespace triton {
         triton::ast::AbstractNode* buildSymbolicRegister(const triton::arch::Register& reg);
 
         //! [**symbolic api**] - Returns a symbolic register and defines the register as input of the instruction.
-        triton::ast::AbstractNode* buildSymbolicRegister(triton::arch::Instruction& inst, triton::arch::Register& reg);
+        triton::ast::AbstractNode* buildSymbolicRegister(triton::arch::Instruction& inst, const triton::arch::Register& reg);
 
         //! [**symbolic api**] - Returns a new symbolic expression. Note that if there are simplification passes recorded, simplification will be applied.
         triton::engines::symbolic::SymbolicExpression* newSymbolicExpression(triton::ast::AbstractNode* node, const std::string& comment="");
@@ -378,6 +418,21 @@ namespace triton {
         //! [**symbolic api**] - Removes the symbolic expression corresponding to the id.
         void removeSymbolicExpression(triton::usize symExprId);
 
+        //! [**symbolic api**] - Pins (or unpins) a symbolic expression. A pinned expression is never reclaimed.
+        void pinSymbolicExpression(triton::usize symExprId, bool flag=true);
+
+        /*!
+         * \brief [**symbolic api**] - Removes the symbolic expressions (and their AST nodes) which are no longer reachable. Returns the number of removed expressions.
+         *
+         * \description
+         * The AST nodes which do not belong to a removed expression (e.g: a constraint built but not asserted yet) are kept. The
+         * instructions processed before keep pointers on their symbolic expressions, which may be removed.
+         */
+        triton::usize reclaimSymbolicExpressions(void);
+
+        //! [**symbolic api**] - Same as reclaimSymbolicExpressions() but the expressions and the AST nodes of `inst` are kept.
+        triton::usize reclaimSymbolicExpressions(const triton::arch::Instruction& inst);
+
         //! [**symbolic api**] - Returns the new symbolic abstract expression and links this expression to the instruction.
         triton::engines::symbolic::SymbolicExpression* createSymbolicExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::OperandWrapper& dst, const std::string& comment="");
 
@@ -385,10 +440,13 @@ namespace triton {
         triton::engines::symbolic::SymbolicExpression* createSymbolicMemoryExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::MemoryAccess& mem, const std::string& comment="");
 
         //! [**symbolic api**] - Returns the new symbolic register expression and links this expression to the instruction.
-        triton::engines::symbolic::SymbolicExpression* createSymbolicRegisterExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::Register& reg, const std::string& comment="");
+        triton::engines::symbolic::SymbolicExpression* createSymbolicRegisterExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, const triton::arch::Register& reg, const std::string& comment="");
 
         //! [**symbolic api**] - Returns the new symbolic flag expression and links this expression to the instruction.
-        triton::engines::symbolic::SymbolicExpression* createSymbolicFlagExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::Register& flag, const std::string& comment="");
+        triton::engines::symbolic::SymbolicExpression* createSymbolicFlagExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, const triton::arch::Register& flag, const std::string& comment="");
+
+        //! [**symbolic api**] - Records a flag expression which will be built by `semantics` only when the flag is read. See triton::engines::symbolic::LAZY_FLAGS.
+        void createLazySymbolicFlagExpression(triton::arch::Instruction& inst, const triton::arch::Register& flag, const triton::uint512& value, triton::usize parent, bool isTainted, const std::function<triton::ast::AbstractNode*(void)>& semantics, const std::string& comment="");
 
         //! [**symbolic api**] - Returns the new symbolic volatile expression and links this expression to the instruction.
         triton::engines::symbolic::SymbolicExpression* createSymbolicVolatileExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, const std::string& comment="");
@@ -474,6 +532,15 @@ namespace triton {
         //! [**symbolic api**] - Returns the full AST from a symbolic expression id.
         triton::ast::AbstractNode* getFullAstFromId(triton::usize symExprId);
 
+        //! [**symbolic api**] - Evaluates an AST over N assignments of its symbolic variables. `inputs` is a map of `<SymVarId : N values>`. See triton::ast::AstBatchEvaluator.
+        std::vector<triton::uint512> evaluateAstBatch(triton::ast::AbstractNode* node, const std::map<triton::usize, std::vector<triton::uint512>>& inputs);
+
+        //! [**symbolic api**] - Returns the symbolic expressions (in dependency order), the symbolic variables and the instruction addresses an AST depends on.
+        triton::engines::symbolic::SymbolicSlice sliceAst(triton::ast::AbstractNode* node) const;
+
+        //! [**symbolic api**] - Returns the symbolic expressions (in dependency order), the symbolic variables and the instruction addresses a symbolic expression depends on.
+        triton::engines::symbolic::SymbolicSlice sliceExpression(triton::usize symExprId) const;
+
         //! [**symbolic api**] - Returns the list of the tainted symbolic expressions.
         std::list<triton::engines::symbolic::SymbolicExpression*> getTaintedSymbolicExpressions(void) const;
 
@@ -514,6 +581,48 @@ namespace triton {
         //! [**solver api**] - Evaluates an AST via Z3 and returns the symbolic value.
         triton::uint512 evaluateAstViaZ3(triton::ast::AbstractNode *node) const;
 
+        //! [**solver api**] - Returns the SMT-LIB2 script of a symbolic constraint (for debug or export purposes).
+        std::string getSmtFormula(triton::ast::AbstractNode *node) const;
+
+        //! [**solver api**] - Writes the SMT-LIB2 script of a symbolic constraint into a stream (e.g: to dump the queries for an offline solver).
+        void writeSmtFormula(std::ostream& stream, triton::ast::AbstractNode *node) const;
+
+        //! [**solver api**] - Returns the incremental solver session. The path constraints are asserted into it on demand, in the order they are recorded.
+        triton::engines::solver::SolverSession& getSolverSession(void);
+
+        //! [**solver api**] - Asserts a constraint into the current scope of the solver session.
+        void addSolverSessionConstraint(triton::ast::AbstractNode *node);
+
+        //! [**solver api**] - Creates a new scope into the solver session.
+        void pushSolverSession(void);
+
+        //! [**solver api**] - Removes the last scope of the solver session.
+        void popSolverSession(void);
+
+        //! [**solver api**] - Removes all constraints and scopes of the solver session.
+        void resetSolverSession(void);
+
+        //! [**solver api**] - Forgets the z3 translations of the solver session. Must be called when an AST is modified in place.
+        void clearTranslatedNodes(void);
+
+        /*!
+         * \brief [**solver api**] - Computes and returns a model from the constraints of the solver session plus `node`. `node` is not kept.
+         *
+         * \description
+         * **item1**: symbolic variable id<br>
+         * **item2**: model
+         */
+        std::map<triton::uint32, triton::engines::solver::SolverModel> checkWithAssumption(triton::ast::AbstractNode *node);
+
+        /*!
+         * \brief [**solver api**] - Computes and returns a model from the `pathConstraints` first path constraints plus `node`. The prefix cannot go backward until the session is reset.
+         *
+         * \description
+         * **item1**: symbolic variable id<br>
+         * **item2**: model
+         */
+        std::map<triton::uint32, triton::engines::solver::SolverModel> checkWithAssumption(triton::ast::AbstractNode *node, triton::usize pathConstraints);
+
 
 
         /* Taint engine API ============================================================================== */
@@ -558,6 +667,9 @@ namespace triton {
         //! [**taint api**] - Taints a memory.
         bool taintMemory(const triton::arch::MemoryAccess& mem);
 
+        //! [**taint api**] - Taints a memory area.
+        bool taintMemoryArea(triton::uint64 addr, triton::usize size);
+
         //! [**taint api**] - Taints a register.
         bool taintRegister(const triton::arch::Register& reg);
 
@@ -567,9 +679,27 @@ namespace triton {
         //! [**taint api**] - Untaints a memory.
         bool untaintMemory(const triton::arch::MemoryAccess& mem);
 
+        //! [**taint api**] - Untaints a memory area.
+        bool untaintMemoryArea(triton::uint64 addr, triton::usize size);
+
         //! [**taint api**] - Untaints a register.
         bool untaintRegister(const triton::arch::Register& reg);
 
+        //! [**taint api**] - Taints a memory and adds a label to its bytes.
+        bool taintMemoryWithLabel(const triton::arch::MemoryAccess& mem, triton::uint32 label);
+
+        //! [**taint api**] - Taints a register and adds a label to it.
+        bool taintRegisterWithLabel(const triton::arch::Register& reg, triton::uint32 label);
+
+        //! [**taint api**] - Returns the taint labels of an abstract operand (Register or Memory).
+        std::set<triton::uint32> getTaintLabels(const triton::arch::OperandWrapper& op) const;
+
+        //! [**taint api**] - Returns the taint labels of a memory.
+        std::set<triton::uint32> getMemoryTaintLabels(const triton::arch::MemoryAccess& mem) const;
+
+        //! [**taint api**] - Returns the taint labels of a register.
+        std::set<triton::uint32> getRegisterTaintLabels(const triton::arch::Register& reg) const;
+
         //! [**taint api**] - Abstract union tainting.
         bool taintUnion(const triton::arch::OperandWrapper& op1, const triton::arch::OperandWrapper& op2);
 
@@ -669,9 +799,35 @@ namespace triton {
         bool taintAssignmentRegisterRegister(const triton::arch::Register& regDst, const triton::arch::Register& regSrc);
     };
 
-    //! The API can be accessed as everywhere.
+    //! The API can be accessed as everywhere. This is the default context of each thread.
     extern API api;
 
+    //! The context (API) used by the engines of the calling thread.
+    extern thread_local API* context;
+
+    //! Returns the context (API) used by the engines of the calling thread. `triton::api` by default.
+    inline API& getContext(void) {
+      return *triton::context;
+    }
+
+    //! Sets the context (API) used by the engines of the calling thread and returns the previous one. `nullptr` restores `triton::api`.
+    API* setContext(API* api);
+
+    /*! \class ContextScope
+     *  \brief Makes an API the context of the calling thread until the end of the scope. */
+    class ContextScope {
+      protected:
+        //! The previous context of the thread.
+        API* previous;
+
+      public:
+        //! Constructor.
+        ContextScope(const API& api);
+
+        //! Destructor. Restores the previous context.
+        ~ContextScope();
+    };
+
 /*! @} End of triton namespace */
 };
 
@@ -8,7 +8,9 @@
 #ifndef TRITON_ARCHITECTURE_H
 #define TRITON_ARCHITECTURE_H
 
+#include <map>
 #include <set>
+#include <string>
 #include <vector>
 
 #include "cpuInterface.hpp"
@@ -119,6 +121,9 @@ namespace triton {
         //! Disassembles the instruction according to the architecture.
         void disassembly(triton::arch::Instruction& inst) const;
 
+        //! Returns all stats about the cache of decoded instructions (hits, misses and entries).
+        std::map<std::string, triton::usize> getDisassemblyCacheStats(void) const;
+
         //! Builds the instruction semantics according to the architecture.
         void buildSemantics(triton::arch::Instruction& inst) const;
 
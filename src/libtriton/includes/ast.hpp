@@ -8,6 +8,7 @@
 #ifndef TRITON_AST_H
 #define TRITON_AST_H
 
+#include <cstddef>
 #include <list>
 #include <map>
 #include <ostream>
@@ -59,6 +60,21 @@ namespace triton {
         //! This value is set to true if the tree contains a symbolic variable.
         bool symbolized;
 
+        //! The hash of the tree from this root node. Computed at `init()` time from the hashes of the childs.
+        triton::uint64 hashValue;
+
+        //! True if a descendant has been modified since the last computation of the node.
+        bool stale;
+
+        //! Marks the node as up to date and all its ancestors as stale. Called at the end of `init()`.
+        void initParents(void);
+
+        //! Recomputes the node and its stale descendants in topological order.
+        void update(void);
+
+        //! Computes the hash of the node from the hashes of its childs. `commutative` ignores the order of the childs and `payload` is the hash of the immediate value of a leaf.
+        void initHash(bool commutative, triton::uint64 payload=0);
+
       public:
         //! Constructor.
         AbstractNode(enum kind_e kind);
@@ -72,6 +88,12 @@ namespace triton {
         //! Destructor.
         virtual ~AbstractNode();
 
+        //! Allocates a node into the AST arena of the API.
+        static void* operator new(std::size_t size);
+
+        //! Releases a node from the AST arena of the API.
+        static void operator delete(void* ptr);
+
         //! Returns the kind of the node.
         enum kind_e getKind(void) const;
 
@@ -87,9 +109,15 @@ namespace triton {
         //! Returns true if the tree contains a symbolic variable.
         bool isSymbolized(void) const;
 
+        //! Returns true if the node must be recomputed on its next access.
+        bool isStale(void) const;
+
         //! Evaluates the tree.
         triton::uint512 evaluate(void) const;
 
+        //! Returns the hash of the tree. The hash is cached into the node, O(1).
+        triton::uint64 getHash(void) const;
+
         //! Returns the childs of the node.
         std::vector<AbstractNode*>& getChilds(void);
 
@@ -119,13 +147,19 @@ namespace triton {
         //! Sets a child at an index.
         void setChild(triton::uint32 index, AbstractNode* child);
 
-        //! Init stuffs like size and eval.
+        /*!
+         * \brief Init stuffs like size and eval.
+         *
+         * \details
+         * Parents are not recomputed. They are marked as stale and recomputed lazily,
+         * in topological order, on their next access (`evaluate()`, `getBitvectorSize()`, ...).
+         */
         virtual void init(void) = 0;
 
         //! Entry point for a visitor.
         virtual void accept(AstVisitor& v) = 0;
 
-        //! Returns the has of the tree. The hash is computed recursively on the whole tree.
+        //! Returns the legacy 512-bits hash of the tree. The hash is computed recursively on the whole tree, prefer `getHash()`.
         virtual triton::uint512 hash(triton::uint32 deep) = 0;
     };
 
@@ -918,12 +952,21 @@ namespace triton {
     //! AST C++ API - Duplicates the AST
     AbstractNode* newInstance(AbstractNode* node);
 
+    //! AST C++ API - Returns a new node of the same kind as `node` with other childs. The childs are not duplicated.
+    AbstractNode* newInstance(AbstractNode* node, const std::vector<AbstractNode*>& childs);
+
     //! Custom pow function for hash routine.
     triton::uint512 pow(triton::uint512 hash, triton::uint32 n);
 
     //! Custom rotate left function for hash routine.
     triton::uint512 rotl(triton::uint512 value, triton::uint32 shift);
 
+    //! Mixes a 64-bits value into a hash.
+    triton::uint64 hashMix(triton::uint64 hash, triton::uint64 value);
+
+    //! Returns the 64-bits hash of a 512-bits value.
+    triton::uint64 hashUint512(triton::uint512 value);
+
     //! Custom modular sign extend for bitwise operation.
     triton::sint512 modularSignExtend(AbstractNode* node);
 
@@ -0,0 +1,148 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_ASTARENA_H
+#define TRITON_ASTARENA_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "tritonTypes.hpp"
+
+
+
+/*! Returns the size (in byte) of an AST arena slab. */
+#define AST_ARENA_SLAB_SIZE 0x10000
+
+/*! Returns the granularity (in byte) of the AST arena size classes. */
+#define AST_ARENA_GRANULARITY 16
+
+/*! Returns the number of AST arena size classes. */
+#define AST_ARENA_CLASSES 64
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    /*! \class AstArena
+     *  \brief This class owns the storage of the AST nodes.
+     *
+     *  \description
+     *  Objects are rounded up to a size class of `AST_ARENA_GRANULARITY` bytes. Each size class
+     *  carves its slots from slabs of `AST_ARENA_SLAB_SIZE` bytes with a bump pointer and recycles
+     *  released slots through a free list. Each slot is prefixed by a small header which keeps its
+     *  state, so live objects can be enumerated without any side container. `release()` gives back
+     *  all slabs at once.
+     */
+    class AstArena {
+      public:
+        //! The header of a slot.
+        struct Slot {
+          union {
+            //! The next free slot of the size class (when the slot is free).
+            Slot* next;
+
+            //! The arena which allocated the object (when the slot is live).
+            AstArena* owner;
+          };
+
+          //! The size of the object stored (0 if the slot is free).
+          triton::uint32 size;
+
+          //! True if the object is recorded by the garbage collector.
+          bool recorded;
+        };
+
+        //! A size class.
+        struct SizeClass {
+          //! The slabs of the size class.
+          std::vector<triton::uint8*> slabs;
+
+          //! The first free slot.
+          Slot* freeList;
+
+          //! The offset of the next slot into the last slab.
+          triton::usize offset;
+        };
+
+      protected:
+        //! The size classes.
+        SizeClass classes[AST_ARENA_CLASSES];
+
+        //! The number of live objects.
+        triton::usize liveObjects;
+
+        //! The number of bytes used by the live objects.
+        triton::usize liveBytes;
+
+        //! Returns the header of an object.
+        static Slot* getSlot(const void* ptr);
+
+        //! Returns the size (header included) of the slots of a size class.
+        static triton::usize getSlotSize(triton::uint32 index);
+
+      public:
+        //! Constructor.
+        AstArena();
+
+        //! Destructor.
+        ~AstArena();
+
+        //! Allocates `size` bytes.
+        void* allocate(triton::usize size);
+
+        //! Releases an object. Releasing a slot which is already free does nothing.
+        void deallocate(void* ptr);
+
+        //! Returns the arena which allocated a live object (nullptr if the slot is free).
+        static AstArena* getOwner(const void* ptr);
+
+        //! Gives back all slabs. All objects must have been destroyed.
+        void release(void);
+
+        //! Returns true if the object is recorded by the garbage collector.
+        bool isRecorded(const void* ptr) const;
+
+        //! Sets the garbage collector mark of an object.
+        void setRecorded(void* ptr, bool flag);
+
+        //! Appends into `objects` every live object (only the recorded ones if `onlyRecorded` is true).
+        void getLiveObjects(std::vector<void*>& objects, bool onlyRecorded) const;
+
+        //! Returns the number of live objects.
+        triton::usize getNumberOfLiveObjects(void) const;
+
+        //! Returns the number of bytes used by the live objects.
+        triton::usize getNumberOfLiveBytes(void) const;
+
+        //! Returns the number of slabs allocated.
+        triton::usize getNumberOfSlabs(void) const;
+
+        //! Returns stats about the arena.
+        std::map<std::string, triton::usize> getStats(void) const;
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTARENA_H */
@@ -0,0 +1,145 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_ASTBATCHEVALUATOR_H
+#define TRITON_ASTBATCHEVALUATOR_H
+
+#include <map>
+#include <vector>
+
+#include "ast.hpp"
+#include "tritonTypes.hpp"
+
+
+
+/*! Returns the number of input vectors evaluated together by each instruction of an AstBatchEvaluator. */
+#define AST_BATCH_LANES 64
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    /*! \class AstBatchEvaluator
+     *  \brief Evaluates an AST over many assignments of its symbolic variables.
+     *
+     *  \description
+     *  The constructor compiles the AST once into a linear program: each node becomes an instruction
+     *  which writes a register (the references are followed, the nodes without symbolic variables are
+     *  folded into constants and a register is reused once its value is dead). evaluate() runs the
+     *  program over blocks of `AST_BATCH_LANES` input vectors. A register holds one value per lane
+     *  (structure of arrays): the nodes of at most 64 bits are computed on `uint64` lanes, the wider
+     *  ones on `uint512` lanes. The results are the same as AbstractNode::evaluate() with the symbolic
+     *  variables set to the values of each input vector.
+     */
+    class AstBatchEvaluator {
+      protected:
+        //! An operand of an instruction.
+        struct Operand {
+          //! The register of the operand.
+          triton::uint32 reg;
+
+          //! The size of the operand (a register of more than 64 bits is a wide register).
+          triton::uint32 size;
+        };
+
+        //! An instruction of the program.
+        struct Instruction {
+          //! The operation (triton::ast::kind_e). BV_NODE loads a constant and VARIABLE_NODE an input.
+          triton::uint32 kind;
+
+          //! The size of the result.
+          triton::uint32 size;
+
+          //! True if the instruction is computed on `uint512` lanes.
+          bool wide;
+
+          //! The register of the result.
+          triton::uint32 dst;
+
+          //! The index of the first operand into `operands`.
+          triton::usize operand;
+
+          //! The number of operands.
+          triton::uint32 count;
+
+          //! The immediate of the instruction (constant, input index, rotation, extract low bit or extension size).
+          triton::uint512 param;
+        };
+
+        //! The instructions.
+        std::vector<Instruction> program;
+
+        //! The operands of the instructions.
+        std::vector<Operand> operands;
+
+        //! The symbolic variable ids of the inputs.
+        std::vector<triton::usize> variables;
+
+        //! The sizes of the inputs.
+        std::vector<triton::uint32> variableSizes;
+
+        //! The number of `uint64` registers.
+        triton::uint32 narrowRegisters;
+
+        //! The number of `uint512` registers.
+        triton::uint32 wideRegisters;
+
+        //! The result.
+        Operand result;
+
+        //! Linearizes the AST and allocates the registers.
+        void compile(triton::ast::AbstractNode* node);
+
+        //! Runs an instruction on `uint64` lanes.
+        void runNarrow(const Instruction& inst, triton::uint64* narrow, triton::uint32 lanes) const;
+
+        //! Runs an instruction on `uint512` lanes.
+        void runWide(const Instruction& inst, triton::uint64* narrow, triton::uint512* wide, triton::uint32 lanes) const;
+
+      public:
+        //! Constructor. Compiles the AST.
+        AstBatchEvaluator(triton::ast::AbstractNode* node);
+
+        //! Destructor.
+        ~AstBatchEvaluator();
+
+        //! Returns the ids of the symbolic variables the AST depends on.
+        const std::vector<triton::usize>& getVariables(void) const;
+
+        //! Returns the number of instructions of the program.
+        triton::usize getNumberOfInstructions(void) const;
+
+        /*!
+         * \brief Evaluates the AST over N input vectors.
+         *
+         * \description
+         * `inputs` is a map of `<SymVarId : N values>` (one column per symbolic variable). The symbolic
+         * variables without column keep their concrete value. Returns the N results. An empty map
+         * evaluates the AST once with the concrete values.
+         */
+        std::vector<triton::uint512> evaluate(const std::map<triton::usize, std::vector<triton::uint512>>& inputs) const;
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTBATCHEVALUATOR_H */
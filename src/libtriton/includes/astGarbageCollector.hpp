@@ -8,10 +8,12 @@
 #ifndef TRITON_ASTGARBAGECOLLECTOR_H
 #define TRITON_ASTGARBAGECOLLECTOR_H
 
+#include <map>
 #include <set>
 #include <string>
 
 #include "ast.hpp"
+#include "astArena.hpp"
 #include "symbolicEnums.hpp"
 #include "tritonTypes.hpp"
 
@@ -36,8 +38,13 @@ namespace triton {
     /*! \brief The AST garbage collector class */
     class AstGarbageCollector {
       protected:
-        //! This container contains all allocated nodes.
-        std::set<triton::ast::AbstractNode*> allocatedNodes;
+        /*! \brief The storage of all AST nodes.
+         *
+         * \description
+         * The nodes owned by the garbage collector are marked as recorded into the arena.
+         * Nodes recorded by the AST dictionaries are owned by the dictionaries.
+         */
+        triton::ast::AstArena arena;
 
         //! This map maintains a link between symbolic variables and their nodes.
         std::map<std::string, triton::ast::AbstractNode*> variableNodes;
@@ -50,7 +57,13 @@ namespace triton {
         //! Destructor.
         ~AstGarbageCollector();
 
-        //! Go through every allocated nodes and free them.
+        //! Allocates the storage of a node.
+        void* allocateAstNode(triton::usize size);
+
+        //! Releases the storage of a node.
+        void deallocateAstNode(void* node);
+
+        //! Go through every allocated nodes and free them. The arena slabs are released at once if there is no more live node.
         void freeAllAstNodes(void);
 
         //! Frees a set of nodes and removes them from the global container.
@@ -66,7 +79,10 @@ namespace triton {
         void recordVariableAstNode(const std::string& name, triton::ast::AbstractNode* node);
 
         //! Returns all allocated nodes.
-        const std::set<triton::ast::AbstractNode*>& getAllocatedAstNodes(void) const;
+        std::set<triton::ast::AbstractNode*> getAllocatedAstNodes(void) const;
+
+        //! Returns stats about the AST arena (live nodes, live bytes, slabs, reserved bytes).
+        std::map<std::string, triton::usize> getAstArenaStats(void) const;
 
         //! Returns all variable nodes recorded.
         const std::map<std::string, triton::ast::AbstractNode*>& getAstVariableNodes(void) const;
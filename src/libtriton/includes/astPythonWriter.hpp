@@ -0,0 +1,111 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_ASTPYTHONWRITER_HPP
+#define TRITON_ASTPYTHONWRITER_HPP
+
+#include <map>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ast.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    //! The Representations namespace
+    namespace representations {
+    /*!
+     *  \ingroup ast
+     *  \addtogroup representations
+     *  @{
+     */
+
+      /*! \class AstPythonWriter
+       *  \brief Writes an AST as straight-line Python code into a stream.
+       *
+       *  \description
+       *  The nodes are written with the syntax of the Python representation, but the AST is written as
+       *  a DAG: each symbolic expression referenced is assigned once to `ref_N` (in the order of their
+       *  ids) and each subterm shared by several parents is assigned once to a temporary `tK`, before
+       *  its first use. The last line is the expression of the node itself. The size of the code is
+       *  linear in the number of nodes and the text is written directly into the stream.
+       */
+      class AstPythonWriter {
+        protected:
+          //! The layout of a node: the order in which its children are written and the text around them.
+          struct Layout {
+            //! The indexes of the children written.
+            std::vector<triton::usize> order;
+
+            //! The text before each child written and after the last one (`order.size() + 1` items).
+            std::vector<std::string> tokens;
+          };
+
+          //! The output stream.
+          std::ostream& stream;
+
+          //! The number of parents of each node reachable from the AST.
+          std::unordered_map<triton::ast::AbstractNode*, triton::usize> uses;
+
+          //! The temporaries already assigned. Map of `<node : K>`.
+          std::unordered_map<triton::ast::AbstractNode*, triton::usize> defined;
+
+          //! The symbolic expressions referenced. Map of `<SymExprId : ast>`.
+          std::map<triton::usize, triton::ast::AbstractNode*> references;
+
+          //! Counts the uses of the nodes and collects the references.
+          void analyze(triton::ast::AbstractNode* node);
+
+          //! Returns true if the node is a shared subterm which can be assigned to a temporary.
+          bool isShareable(triton::ast::AbstractNode* node) const;
+
+          //! Returns the layout of a node.
+          void getLayout(triton::ast::AbstractNode* node, Layout& layout) const;
+
+          //! Writes the assignments of the shared subterms of a node.
+          void writeTemporaries(triton::ast::AbstractNode* node);
+
+          //! Writes a node. The shared subterms already assigned are written by their names.
+          void writeTerm(triton::ast::AbstractNode* node);
+
+        public:
+          //! Constructor.
+          AstPythonWriter(std::ostream& stream);
+
+          //! Destructor.
+          ~AstPythonWriter();
+
+          //! Writes the Python code of an AST.
+          void write(triton::ast::AbstractNode* node);
+      };
+
+    /*! @} End of representations namespace */
+    };
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTPYTHONWRITER_HPP */
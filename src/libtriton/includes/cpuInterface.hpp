@@ -8,7 +8,9 @@
 #ifndef TRITON_CPUINTERFACE_HPP
 #define TRITON_CPUINTERFACE_HPP
 
+#include <map>
 #include <set>
+#include <string>
 #include <tuple>
 #include <vector>
 
@@ -94,9 +96,15 @@ namespace triton {
         //! Disassembles the instruction according to the architecture.
         virtual void disassembly(triton::arch::Instruction& inst) const = 0;
 
+        //! Returns all stats about the cache of decoded instructions (hits, misses and entries).
+        virtual std::map<std::string, triton::usize> getDisassemblyCacheStats(void) const = 0;
+
         //! Builds the instruction semantics according to the architecture.
         virtual void buildSemantics(triton::arch::Instruction& inst) const = 0;
 
+        //! Spreads the taint of the instruction without building its semantics. Returns false if the instruction is not handled.
+        virtual bool buildTaintSemantics(triton::arch::Instruction& inst) const = 0;
+
         //! Returns the concrete value of a memory cell.
         virtual triton::uint8 getConcreteMemoryValue(triton::uint64 addr) const = 0;
 
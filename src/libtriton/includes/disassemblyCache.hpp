@@ -0,0 +1,160 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_DISASSEMBLYCACHE_H
+#define TRITON_DISASSEMBLYCACHE_H
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "immediate.hpp"
+#include "instruction.hpp"
+#include "register.hpp"
+#include "tritonTypes.hpp"
+
+
+
+/*! Returns the max number of decoded instructions kept by a disassembly cache. */
+#define DISASSEMBLY_CACHE_MAX_ENTRIES 0x40000
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    //! The layout of a decoded operand.
+    struct DecodedOperand {
+      //! The type of the operand as triton::arch::operandType_e.
+      triton::uint32 type;
+
+      //! The immediate (OP_IMM only).
+      triton::arch::Immediate imm;
+
+      //! The register id (OP_REG only).
+      triton::uint32 reg;
+
+      //! The size (in byte) of the memory access (OP_MEM only).
+      triton::uint32 memSize;
+
+      //! The segment register of the memory access (OP_MEM only).
+      triton::arch::Register segment;
+
+      //! The base register of the memory access (OP_MEM only).
+      triton::arch::Register base;
+
+      //! The index register of the memory access (OP_MEM only).
+      triton::arch::Register index;
+
+      //! The displacement of the memory access (OP_MEM only).
+      triton::arch::Immediate disp;
+
+      //! The scale of the memory access (OP_MEM only).
+      triton::arch::Immediate scale;
+
+      //! True if the memory access is relative to the program counter (OP_MEM only).
+      bool pcRelative;
+
+      //! Constructor.
+      DecodedOperand() : type(0), reg(0), memSize(0), pcRelative(false) {};
+    };
+
+
+    //! The layout of a decoded instruction. It does not contain any concrete value.
+    struct DecodedInstruction {
+      //! The disassembly of the instruction.
+      std::string disassembly;
+
+      //! The size of the instruction.
+      triton::uint32 size;
+
+      //! The type of the instruction.
+      triton::uint32 type;
+
+      //! The prefix of the instruction.
+      triton::uint32 prefix;
+
+      //! True if the instruction is a branch.
+      bool branch;
+
+      //! True if the instruction changes the control flow.
+      bool controlFlow;
+
+      //! The operands layout.
+      std::vector<triton::arch::DecodedOperand> operands;
+
+      //! Constructor.
+      DecodedInstruction() : size(0), type(0), prefix(0), branch(false), controlFlow(false) {};
+    };
+
+
+    /*! \class DisassemblyCache
+     *  \brief This class is used to keep decoded instructions keyed by their address and their opcodes.
+     *
+     *  \description
+     *  Re-executing an instruction already seen skips the disassembler. Only the concrete values
+     *  (registers state and memory accesses) recorded into the triton::arch::Instruction are bound
+     *  to the cached layout.
+     */
+    class DisassemblyCache {
+      protected:
+        /*! \brief map of key -> decoded instruction
+         *
+         * \description
+         * **item1**: address and opcodes<br>
+         * **item2**: decoded instruction
+         */
+        std::unordered_map<std::string, triton::arch::DecodedInstruction> entries;
+
+        //! The number of cache hits.
+        triton::usize hits;
+
+        //! The number of cache misses.
+        triton::usize misses;
+
+        //! Returns the key of an instruction.
+        std::string getKey(const triton::arch::Instruction& inst) const;
+
+      public:
+        //! Constructor.
+        DisassemblyCache();
+
+        //! Clears the cache and its counters.
+        void clear(void);
+
+        //! Returns the decoded layout of an instruction or nullptr if it is not cached. Updates the counters.
+        const triton::arch::DecodedInstruction* find(const triton::arch::Instruction& inst);
+
+        //! Records the decoded layout of an instruction.
+        void record(const triton::arch::Instruction& inst, const triton::arch::DecodedInstruction& decoded);
+
+        //! Binds a decoded layout to an instruction (disassembly, type, prefix, operands and control flow).
+        void bind(const triton::arch::DecodedInstruction& decoded, triton::arch::Instruction& inst) const;
+
+        //! Returns all stats about the cache (hits, misses and entries).
+        std::map<std::string, triton::usize> getStats(void) const;
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_DISASSEMBLYCACHE_H */
@@ -191,6 +191,18 @@ namespace triton {
     };
 
 
+    /*! \class ExplorationEngine
+     *  \brief The exception class used by the exploration engine. */
+    class ExplorationEngine : public triton::exceptions::Engines {
+      public:
+        //! Constructor.
+        ExplorationEngine(const char* message) : triton::exceptions::Engines(message) {};
+
+        //! Constructor.
+        ExplorationEngine(const std::string& message) : triton::exceptions::Engines(message) {};
+    };
+
+
     /*! \class API
      *  \brief The exception class used by the Triton's API. */
     class API : public triton::exceptions::Exception {
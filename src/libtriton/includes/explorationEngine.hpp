@@ -0,0 +1,237 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_EXPLORATIONENGINE_H
+#define TRITON_EXPLORATIONENGINE_H
+
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "api.hpp"
+#include "elf.hpp"
+#include "symbolicEnums.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Exploration namespace
+    namespace exploration {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup exploration
+     *  @{
+     */
+
+      /*! \class ExplorationEngine
+       *  \brief The parallel path exploration engine.
+       *
+       *  \description
+       *  The engine runs a generational search over a memory image (see addMemoryArea() and loadBinary()).
+       *  An input is a map of `<addr : byte>` written over the image before each run. A run starts at the
+       *  entry point with the entry registers and stops when the program counter leaves the memory image.
+       *  For each path constraint after the bound of the run, each branch which has not been taken nor tried
+       *  before is negated on top of the previous path constraints. Each model gives a new input which is
+       *  run later with the index of the negated branch as bound. A branch is identified by its addresses and
+       *  its occurrence (the number of previous executions of its source address in the run), so each
+       *  iteration of a loop is explored.
+       *
+       *  Each worker thread owns its own context (triton::API) and so its own solver. Each worker has its
+       *  own queue of inputs, and steals the oldest inputs of the other workers when its queue is empty.
+       *  The new inputs and the new covered basic blocks are streamed to the callbacks.
+       */
+      class ExplorationEngine {
+        public:
+          //! An input. Map of `<addr : byte>`.
+          typedef std::map<triton::uint64, triton::uint8> Input;
+
+        protected:
+          //! An input to run. Only the branches from `bound` are negated.
+          struct WorkItem {
+            //! The input.
+            Input input;
+
+            //! The index of the first path constraint to negate.
+            triton::usize bound;
+          };
+
+          //! A worker thread.
+          struct Worker {
+            //! The context of the worker.
+            triton::API* context;
+
+            //! The inputs to run. The worker pops the newest ones, the thieves the oldest ones.
+            std::deque<WorkItem> queue;
+
+            //! The lock of the queue.
+            std::mutex mutex;
+          };
+
+          //! The architecture of the contexts.
+          triton::uint32 arch;
+
+          //! The workers.
+          std::vector<Worker*> workers;
+
+          //! The memory image. Map of `<base addr : bytes>`.
+          std::map<triton::uint64, std::vector<triton::uint8>> image;
+
+          //! The entry point.
+          triton::uint64 entryPoint;
+
+          //! The entry registers. Map of `<reg id : value>`.
+          std::map<triton::uint32, triton::uint512> registers;
+
+          //! The symbolic inputs. Map of `<addr : size>`.
+          std::map<triton::uint64, triton::usize> symbolicInputs;
+
+          //! The symbolic optimizations enabled in each context.
+          std::set<enum triton::engines::symbolic::optimization_e> optimizations;
+
+          //! The maximum number of instructions of a run.
+          triton::usize maxInstructions;
+
+          //! The maximum number of runs (0 = unlimited).
+          triton::usize maxRuns;
+
+          //! The callback called with each new input.
+          std::function<void(const Input&)> inputCallback;
+
+          //! The callback called with each new covered basic block.
+          std::function<void(triton::uint64)> coverageCallback;
+
+          //! The lock of the coverage, the tried branches and the callbacks.
+          std::mutex mutex;
+
+          //! The covered basic blocks.
+          std::set<triton::uint64> coverage;
+
+          //! The branches taken or tried. Set of `<src addr, dst addr, occurrence>`.
+          std::set<std::tuple<triton::uint64, triton::uint64, triton::usize>> branches;
+
+          //! The number of inputs queued or running.
+          std::atomic<triton::usize> pending;
+
+          //! The number of runs.
+          std::atomic<triton::usize> runs;
+
+          //! True if the exploration must stop.
+          std::atomic<bool> stopped;
+
+          //! The first error raised by a worker.
+          std::exception_ptr error;
+
+          //! Returns the program counter register id of the architecture.
+          triton::uint32 getProgramCounterId(void) const;
+
+          //! Returns true if the address is inside the memory image.
+          bool isInImage(triton::uint64 addr) const;
+
+          //! Pops an input from the worker queue or steals one from another worker. Returns false if there is none.
+          bool popWorkItem(Worker* worker, WorkItem& item);
+
+          //! Queues an input into the worker queue.
+          void pushWorkItem(Worker* worker, const Input& input, triton::usize bound);
+
+          //! The loop of a worker thread.
+          void work(Worker* worker);
+
+          //! Runs an input into the worker context and queues the new inputs.
+          void run(Worker* worker, const WorkItem& item);
+
+          //! Returns the occurrence of each path constraint (the number of previous path constraints with the same source address).
+          std::vector<triton::usize> getOccurrences(const std::vector<triton::engines::symbolic::PathConstraint>& pcs) const;
+
+          //! Records the covered basic blocks and the taken branches of a run.
+          void recordCoverage(const std::vector<triton::uint64>& blocks, const std::vector<triton::engines::symbolic::PathConstraint>& pcs, const std::vector<triton::usize>& occurrences);
+
+          //! Returns true if the branch has not been taken nor tried, and marks it as tried.
+          bool tryBranch(triton::uint64 srcAddr, triton::uint64 dstAddr, triton::usize occurrence);
+
+        public:
+          //! Constructor. Creates `workers` contexts of the architecture `arch`.
+          ExplorationEngine(triton::uint32 arch, triton::uint32 workers);
+
+          //! Destructor.
+          ~ExplorationEngine();
+
+          //! An exploration engine owns its contexts and cannot be copied.
+          ExplorationEngine(const ExplorationEngine& other) = delete;
+
+          //! An exploration engine owns its contexts and cannot be copied.
+          ExplorationEngine& operator=(const ExplorationEngine& other) = delete;
+
+          //! Adds an area into the memory image.
+          void addMemoryArea(triton::uint64 baseAddr, const std::vector<triton::uint8>& values);
+
+          //! Adds the loadable segments of an ELF binary into the memory image and sets the entry point.
+          void loadBinary(const triton::format::elf::Elf& binary);
+
+          //! Sets the entry point.
+          void setEntryPoint(triton::uint64 addr);
+
+          //! Sets the value of a register at the entry point.
+          void setConcreteRegisterValue(triton::uint32 regId, triton::uint512 value);
+
+          //! Marks the range `[addr:size]` as symbolic input. Each byte is a symbolic variable.
+          void addSymbolicInput(triton::uint64 addr, triton::usize size);
+
+          //! Enables a symbolic optimization in each context.
+          void enableSymbolicOptimization(enum triton::engines::symbolic::optimization_e opti);
+
+          //! Sets the maximum number of instructions of a run.
+          void setMaxInstructions(triton::usize max);
+
+          //! Sets the maximum number of runs (0 = unlimited).
+          void setMaxRuns(triton::usize max);
+
+          //! Sets the callback called with each new input. The callbacks are never called concurrently.
+          void setInputCallback(std::function<void(const Input&)> cb);
+
+          //! Sets the callback called with each new covered basic block. The callbacks are never called concurrently.
+          void setCoverageCallback(std::function<void(triton::uint64)> cb);
+
+          //! Explores the paths from an initial input. Returns when there is no more input to run or the maximum number of runs is reached.
+          void explore(const Input& seed);
+
+          //! Returns the covered basic blocks.
+          std::set<triton::uint64> getCoverage(void);
+
+          //! Returns the number of runs.
+          triton::usize getNumberOfRuns(void) const;
+      };
+
+    /*! @} End of exploration namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_EXPLORATIONENGINE_H */
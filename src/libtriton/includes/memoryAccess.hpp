@@ -109,6 +109,9 @@ namespace triton {
         //! Initialize the address of the memory.
         void initAddress(void);
 
+        //! Initialize the address of the memory from the concrete registers, without building its AST.
+        void initConcreteAddress(void);
+
         //! Returns the AST of the memory access (LEA).
         triton::ast::AbstractNode* getLeaAst(void) const;
 
@@ -0,0 +1,219 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_PAGETABLE_H
+#define TRITON_PAGETABLE_H
+
+#include <memory>
+#include <unordered_map>
+
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  /*! \class PageTable
+   *  \brief This class is used to record the pages of a paged structure (concrete memory, memory references, shadow memory).
+   *
+   *  \description
+   *  The pages are indexed by a two-level table: a directory covers `1 << DirectoryBits` contiguous
+   *  pages and directories are recorded into a hash map. A missing page (or directory) is left to the
+   *  interpretation of the owner (unmapped, concrete, clean). A new page is value-initialized, so a
+   *  page without constructor is zeroed. The last page hit is cached.
+   *
+   *  Directories and pages are shared between copies (copy-on-write): copying a PageTable only copies
+   *  the directory table and a directory or a page is duplicated the first time it is modified while
+   *  shared. Pages must only be modified through findWritablePage() or getOrCreatePage().
+   */
+  template <typename Page, triton::uint32 DirectoryBits>
+  class PageTable {
+    protected:
+      //! A directory of pages.
+      struct Directory {
+        //! The pages of the directory (nullptr if the page is not allocated).
+        std::shared_ptr<Page> pages[1 << DirectoryBits];
+
+        //! The number of allocated pages.
+        triton::uint32 count;
+
+        //! Constructor.
+        Directory() : count(0) {};
+      };
+
+      /*! \brief map of directory number -> directory
+       *
+       * \description
+       * **item1**: directory number (page number >> DirectoryBits)<br>
+       * **item2**: directory
+       */
+      std::unordered_map<triton::uint64, std::shared_ptr<Directory>> directories;
+
+      //! The page number of the last page hit.
+      mutable triton::uint64 lastPageNumber;
+
+      //! The last page hit (nullptr if none).
+      mutable Page* lastPage;
+
+      //! True if the last page hit is owned by this table only (it can be modified without a copy).
+      mutable bool lastPageWritable;
+
+      //! Returns the index of a page inside its directory.
+      static triton::uint64 getPageIndex(triton::uint64 pageNumber) {
+        return pageNumber & ((static_cast<triton::uint64>(1) << DirectoryBits) - 1);
+      }
+
+      //! Returns the directory which contains the page number for a modification. A shared directory is duplicated.
+      Directory* getWritableDirectory(std::shared_ptr<Directory>& directory) {
+        if (directory.use_count() > 1)
+          directory = std::make_shared<Directory>(*directory);
+        return directory.get();
+      }
+
+      //! Records the last page hit.
+      void setLastPage(triton::uint64 pageNumber, Page* page, bool writable) const {
+        this->lastPageNumber   = pageNumber;
+        this->lastPage         = page;
+        this->lastPageWritable = writable;
+      }
+
+    public:
+      //! Constructor.
+      PageTable() {
+        this->setLastPage(0, nullptr, false);
+      }
+
+      //! Constructor by copy.
+      PageTable(const PageTable& other) {
+        this->setLastPage(0, nullptr, false);
+        *this = other;
+      }
+
+      //! Copies a PageTable.
+      void operator=(const PageTable& other) {
+        if (this == &other)
+          return;
+
+        /* Directories and pages are shared until one of the copies modifies them */
+        this->directories = other.directories;
+        this->setLastPage(0, nullptr, false);
+        other.lastPageWritable = false;
+      }
+
+      //! Releases all pages.
+      void clear(void) {
+        this->directories.clear();
+        this->setLastPage(0, nullptr, false);
+      }
+
+      //! Returns the number of pages allocated.
+      triton::usize getNumberOfPages(void) const {
+        triton::usize count = 0;
+
+        for (auto it = this->directories.begin(); it != this->directories.end(); it++)
+          count += it->second->count;
+
+        return count;
+      }
+
+      //! Returns the page which contains the page number or nullptr if it is not allocated.
+      const Page* findPage(triton::uint64 pageNumber) const {
+        if (this->lastPage && this->lastPageNumber == pageNumber)
+          return this->lastPage;
+
+        auto it = this->directories.find(pageNumber >> DirectoryBits);
+        if (it == this->directories.end())
+          return nullptr;
+
+        Page* page = it->second->pages[getPageIndex(pageNumber)].get();
+        if (page != nullptr)
+          this->setLastPage(pageNumber, page, false);
+
+        return page;
+      }
+
+      //! Returns the page which contains the page number for a modification or nullptr if it is not allocated. A shared page is duplicated.
+      Page* findWritablePage(triton::uint64 pageNumber) {
+        if (this->lastPage && this->lastPageWritable && this->lastPageNumber == pageNumber)
+          return this->lastPage;
+
+        auto it = this->directories.find(pageNumber >> DirectoryBits);
+        if (it == this->directories.end() || it->second->pages[getPageIndex(pageNumber)] == nullptr)
+          return nullptr;
+
+        /* The directory or the page is shared with another copy, it is duplicated */
+        std::shared_ptr<Page>& page = this->getWritableDirectory(it->second)->pages[getPageIndex(pageNumber)];
+        if (page.use_count() > 1)
+          page = std::make_shared<Page>(*page);
+
+        this->setLastPage(pageNumber, page.get(), true);
+
+        return page.get();
+      }
+
+      //! Returns the page which contains the page number for a modification. The page is allocated if it is not.
+      Page* getOrCreatePage(triton::uint64 pageNumber) {
+        Page* page = this->findWritablePage(pageNumber);
+
+        if (page == nullptr) {
+          std::shared_ptr<Directory>& directory = this->directories[pageNumber >> DirectoryBits];
+          if (directory == nullptr)
+            directory = std::make_shared<Directory>();
+
+          std::shared_ptr<Page> newPage = std::make_shared<Page>();
+          Directory* writable = this->getWritableDirectory(directory);
+          writable->pages[getPageIndex(pageNumber)] = newPage;
+          writable->count++;
+
+          page = newPage.get();
+          this->setLastPage(pageNumber, page, true);
+        }
+
+        return page;
+      }
+
+      //! Releases a page.
+      void releasePage(triton::uint64 pageNumber) {
+        auto it = this->directories.find(pageNumber >> DirectoryBits);
+
+        if (it == this->directories.end() || it->second->pages[getPageIndex(pageNumber)] == nullptr)
+          return;
+
+        Directory* directory = this->getWritableDirectory(it->second);
+        std::shared_ptr<Page>& page = directory->pages[getPageIndex(pageNumber)];
+        if (this->lastPage == page.get())
+          this->lastPage = nullptr;
+
+        page = nullptr;
+
+        /* Release the directory when all its pages are released */
+        if (--directory->count == 0)
+          this->directories.erase(it);
+      }
+
+      //! Applies a callback on each allocated page. The callback receives the page number and the page.
+      template <typename T>
+      void forEachPage(T callback) const {
+        for (auto it = this->directories.begin(); it != this->directories.end(); it++) {
+          for (triton::uint64 index = 0; index < (static_cast<triton::uint64>(1) << DirectoryBits); index++) {
+            const Page* page = it->second->pages[index].get();
+            if (page != nullptr)
+              callback((it->first << DirectoryBits) | index, *page);
+          }
+        }
+      }
+  };
+
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_PAGETABLE_H */
@@ -0,0 +1,117 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_PAGEDMEMORY_H
+#define TRITON_PAGEDMEMORY_H
+
+#include "pageTable.hpp"
+#include "tritonTypes.hpp"
+
+
+
+/*! Returns the size (in byte) of a concrete memory page. */
+#define MEMORY_PAGE_SIZE 0x1000
+
+/*! Returns the number of bits used to index a byte inside a concrete memory page. */
+#define MEMORY_PAGE_BITS 12
+
+/*! Returns the mask of the offset inside a concrete memory page. */
+#define MEMORY_PAGE_MASK (MEMORY_PAGE_SIZE - 1)
+
+/*! Returns the number of bits used to index a concrete memory page inside a directory. */
+#define MEMORY_DIRECTORY_BITS 8
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    /*! \class PagedMemory
+     *  \brief This class is used to represent the concrete memory of a CPU.
+     *
+     *  \description
+     *  The memory is split into pages of `MEMORY_PAGE_SIZE` bytes. Each page holds its raw content
+     *  and a bitmap of mapped bytes. Pages are allocated on the first write and released when all
+     *  their bytes are unmapped. Unmapped bytes are read as `0x00`.
+     *
+     *  Pages are recorded into a triton::PageTable, so they are shared between copies (copy-on-write)
+     *  and a page is duplicated the first time it is modified while shared.
+     */
+    class PagedMemory {
+      public:
+        //! A concrete memory page.
+        struct Page {
+          //! The content of the page.
+          triton::uint8 data[MEMORY_PAGE_SIZE];
+
+          //! The bitmap of mapped bytes (one bit per byte).
+          triton::uint64 mapped[MEMORY_PAGE_SIZE / 64];
+
+          //! The number of mapped bytes.
+          triton::uint32 count;
+        };
+
+      protected:
+        //! The page table (see triton::PageTable).
+        triton::PageTable<Page, MEMORY_DIRECTORY_BITS> pages;
+
+      public:
+        //! Constructor.
+        PagedMemory();
+
+        //! Constructor by copy.
+        PagedMemory(const PagedMemory& other);
+
+        //! Destructor.
+        ~PagedMemory();
+
+        //! Copies a PagedMemory.
+        void operator=(const PagedMemory& other);
+
+        //! Releases all pages.
+        void clear(void);
+
+        //! Returns the number of pages allocated.
+        triton::usize getNumberOfPages(void) const;
+
+        //! Returns the concrete value of a memory cell. Returns 0x00 if the cell is not mapped.
+        triton::uint8 read(triton::uint64 addr) const;
+
+        //! Reads `size` bytes from `addr` into `buffer`. Unmapped cells are read as 0x00.
+        void read(triton::uint64 addr, triton::uint8* buffer, triton::usize size) const;
+
+        //! Sets the concrete value of a memory cell.
+        void write(triton::uint64 addr, triton::uint8 value);
+
+        //! Writes `size` bytes from `buffer` at `addr`.
+        void write(triton::uint64 addr, const triton::uint8* buffer, triton::usize size);
+
+        //! Returns true if the range `[addr:size]` is mapped.
+        bool isMapped(triton::uint64 addr, triton::usize size=1) const;
+
+        //! Removes the range `[addr:size]` from the memory.
+        void unmap(triton::uint64 addr, triton::usize size=1);
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_PAGEDMEMORY_H */
@@ -20,6 +20,7 @@
 #include "elfRelocationTable.hpp"
 #include "elfSectionHeader.hpp"
 #include "elfSymbolTable.hpp"
+#include "explorationEngine.hpp"
 #include "immediate.hpp"
 #include "instruction.hpp"
 #include "memoryAccess.hpp"
@@ -91,6 +92,9 @@ namespace triton {
       //! Creates the ElfSymbolTable python class.
       PyObject* PyElfSymbolTable(const triton::format::elf::ElfSymbolTable& sym);
 
+      //! Creates the ExplorationEngine python class.
+      PyObject* PyExplorationEngine(triton::uint32 arch, triton::uint32 workers);
+
       //! Creates the Immediate python class.
       PyObject* PyImmediate(const triton::arch::Immediate& imm);
 
@@ -218,6 +222,17 @@ namespace triton {
       //! pyElfSymbolTable type.
       extern PyTypeObject ElfSymbolTable_Type;
 
+      /* ExplorationEngine ============================================== */
+
+      //! pyExplorationEngine object.
+      typedef struct {
+        PyObject_HEAD
+        triton::engines::exploration::ExplorationEngine* engine;
+      } ExplorationEngine_Object;
+
+      //! pyExplorationEngine type.
+      extern PyTypeObject ExplorationEngine_Type;
+
       /* Immediate ====================================================== */
 
       //! pyImmediate object.
@@ -368,6 +383,12 @@ namespace triton {
 /*! Returns the triton::format::elf::ElfSymbolTable. */
 #define PyElfSymbolTable_AsElfSymbolTable(v) (((triton::bindings::python::ElfSymbolTable_Object*)(v))->sym)
 
+/*! Checks if the pyObject is a triton::engines::exploration::ExplorationEngine. */
+#define PyExplorationEngine_Check(v) ((v)->ob_type == &triton::bindings::python::ExplorationEngine_Type)
+
+/*! Returns the triton::engines::exploration::ExplorationEngine. */
+#define PyExplorationEngine_AsExplorationEngine(v) (((triton::bindings::python::ExplorationEngine_Object*)(v))->engine)
+
 /*! Checks if the pyObject is a triton::arch::Immediate. */
 #define PyImmediate_Check(v) ((v)->ob_type == &triton::bindings::python::Immediate_Type)
 
@@ -0,0 +1,123 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SHADOWMEMORY_H
+#define TRITON_SHADOWMEMORY_H
+
+#include "pageTable.hpp"
+#include "tritonTypes.hpp"
+
+
+
+/*! Returns the size (in byte) of a shadow page. */
+#define SHADOW_PAGE_SIZE 0x1000
+
+/*! Returns the number of bits used to index a byte inside a shadow page. */
+#define SHADOW_PAGE_BITS 12
+
+/*! Returns the mask of the offset inside a shadow page. */
+#define SHADOW_PAGE_MASK (SHADOW_PAGE_SIZE - 1)
+
+/*! Returns the number of bits used to index a shadow page inside a directory. */
+#define SHADOW_DIRECTORY_BITS 10
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Taint namespace
+    namespace taint {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup taint
+     *  @{
+     */
+
+      /*! \class ShadowMemory
+       *  \brief This class is used to record the tainted bytes of the memory.
+       *
+       *  \description
+       *  The shadow memory holds one bit per byte. It is split into pages of `SHADOW_PAGE_SIZE` bytes
+       *  which are indexed by a two-level triton::PageTable (`SHADOW_DIRECTORY_BITS` bits of directory).
+       *  A page is allocated when one of its bytes is tainted and released when all its bytes are
+       *  untainted, so a missing page (or directory) is an entirely clean range. Queries and updates
+       *  work on whole 64-bit words of the bitmaps. The table is copy-on-write, so snapshots of the
+       *  taint engine only duplicate the pages modified afterwards.
+       */
+      class ShadowMemory {
+        protected:
+          //! A shadow page.
+          struct Page {
+            //! The bitmap of tainted bytes (one bit per byte).
+            triton::uint64 bitmap[SHADOW_PAGE_SIZE / 64];
+
+            //! The number of tainted bytes.
+            triton::uint32 count;
+          };
+
+          //! The page table (see triton::PageTable).
+          triton::PageTable<Page, SHADOW_DIRECTORY_BITS> pages;
+
+          //! Returns the (up to 64) bits of the range `[addr:size]`.
+          triton::uint64 readBits(triton::uint64 addr, triton::uint32 size) const;
+
+          //! Taints the bytes of the range `[addr:size]` (up to 64) whose bit is set into `bits`.
+          void orBits(triton::uint64 addr, triton::uint64 bits, triton::uint32 size);
+
+        public:
+          //! Constructor.
+          ShadowMemory();
+
+          //! Constructor by copy.
+          ShadowMemory(const ShadowMemory& other);
+
+          //! Destructor.
+          ~ShadowMemory();
+
+          //! Copies a ShadowMemory.
+          void operator=(const ShadowMemory& other);
+
+          //! Untaints the whole memory.
+          void clear(void);
+
+          //! Returns the number of pages allocated.
+          triton::usize getNumberOfPages(void) const;
+
+          //! Returns the number of tainted bytes.
+          triton::usize getNumberOfTaintedBytes(void) const;
+
+          //! Returns true if one byte of the range `[addr:size]` is tainted.
+          bool isTainted(triton::uint64 addr, triton::usize size=1) const;
+
+          //! Taints or untaints the range `[addr:size]`.
+          void setTaint(triton::uint64 addr, triton::usize size, bool flag);
+
+          //! Taints each byte of `[dst:size]` whose byte of `[src:size]` is tainted (overlapping ranges are handled like `memmove`). Returns true if one byte of the source is tainted.
+          bool unionTaint(triton::uint64 dst, triton::uint64 src, triton::usize size);
+      };
+
+    /*! @} End of taint namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SHADOWMEMORY_H */
@@ -0,0 +1,113 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SMTFORMULAWRITER_H
+#define TRITON_SMTFORMULAWRITER_H
+
+#include <map>
+#include <ostream>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ast.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \class SmtFormulaWriter
+       *  \brief Writes the SMT-LIB2 script of a symbolic constraint into a stream.
+       *
+       *  \description
+       *  The AST is written as a DAG: each symbolic expression referenced by the constraint is
+       *  written once as `(define-fun ref!N () <sort> <ast>)` (in the order of their ids, so a
+       *  definition always comes before its uses) and each subterm shared by several parents is
+       *  written once as `(define-fun node!K () <sort> <ast>)`. The size of the script is linear
+       *  in the number of nodes, the nodes are walked without recursion and the text is written
+       *  directly into the stream, so the memory used does not depend on the size of the script.
+       */
+      class SmtFormulaWriter {
+        protected:
+          //! The output stream.
+          std::ostream& stream;
+
+          //! The number of parents of each node reachable from the constraint.
+          std::unordered_map<triton::ast::AbstractNode*, triton::usize> uses;
+
+          //! The nodes which must be written inline (the body of a let and its subterms).
+          std::unordered_set<triton::ast::AbstractNode*> scoped;
+
+          //! The shared subterms already defined. Map of `<node : K>`.
+          std::unordered_map<triton::ast::AbstractNode*, triton::usize> defined;
+
+          //! The symbolic expressions referenced. Map of `<SymExprId : ast>`.
+          std::map<triton::usize, triton::ast::AbstractNode*> references;
+
+          //! The symbolic variables used. Map of `<name : size>`.
+          std::map<std::string, triton::uint32> variables;
+
+          //! Counts the uses of the nodes and collects the references and the variables.
+          void analyze(triton::ast::AbstractNode* node);
+
+          //! Returns true if the node is a shared subterm which can be defined once.
+          bool isShareable(triton::ast::AbstractNode* node) const;
+
+          //! Returns true if the node is a boolean term.
+          bool isLogical(triton::ast::AbstractNode* node) const;
+
+          //! Writes the sort of a term.
+          void writeSort(triton::ast::AbstractNode* node);
+
+          //! Writes the definitions of the shared subterms of a node.
+          void writeDefinitions(triton::ast::AbstractNode* node);
+
+          //! Writes a node. The shared subterms already defined are written by their names.
+          void writeTerm(triton::ast::AbstractNode* node);
+
+        public:
+          //! Constructor.
+          SmtFormulaWriter(std::ostream& stream);
+
+          //! Destructor.
+          ~SmtFormulaWriter();
+
+          //! Writes the SMT-LIB2 script of a symbolic constraint.
+          void write(triton::ast::AbstractNode* node);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SMTFORMULAWRITER_H */
@@ -11,12 +11,15 @@
 #include <cstdlib>
 #include <list>
 #include <map>
+#include <ostream>
+#include <set>
 #include <string>
 
 #include <z3++.h>
 
 #include "ast.hpp"
 #include "solverModel.hpp"
+#include "solverSession.hpp"
 #include "tritonTypes.hpp"
 
 
@@ -46,6 +49,10 @@ namespace triton {
       /*! \brief The solver engine class. */
       class SolverEngine
       {
+        protected:
+          //! The incremental solver session (created on its first use).
+          SolverSession* session;
+
         public:
           //! Computes and returns a model from a symbolic constraint.
           /*! \brief map of symbolic variable id -> model
@@ -68,6 +75,27 @@ namespace triton {
           //! Evaluates an AST via Z3 and returns the symbolic value.
           triton::uint512 evaluateAstViaZ3(triton::ast::AbstractNode *node) const;
 
+          //! Returns the SMT-LIB2 script of a symbolic constraint (for debug or export purposes, the solver does not use it).
+          std::string getSmtFormula(triton::ast::AbstractNode *node) const;
+
+          //! Writes the SMT-LIB2 script of a symbolic constraint into a stream, without building it in memory.
+          void writeSmtFormula(std::ostream& stream, triton::ast::AbstractNode *node) const;
+
+          //! Returns the incremental solver session.
+          SolverSession& getSolverSession(void);
+
+          //! Removes all constraints and scopes of the incremental solver session.
+          void resetSolverSession(void);
+
+          //! Removes the incremental solver session and its translations (e.g: when all AST nodes are freed).
+          void removeSolverSession(void);
+
+          //! Notifies the solver that AST nodes have been freed.
+          void removeTranslatedNodes(const std::set<triton::ast::AbstractNode*>& nodes);
+
+          //! Notifies the solver that the AST of a symbolic expression has been replaced.
+          void clearTranslatedNodes(void);
+
           //! Constructor.
           SolverEngine();
 
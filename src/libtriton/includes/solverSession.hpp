@@ -0,0 +1,134 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SOLVERSESSION_H
+#define TRITON_SOLVERSESSION_H
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include <z3++.h>
+
+#include "ast.hpp"
+#include "solverModel.hpp"
+#include "tritonToZ3Ast.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \class SolverSession
+       *  \brief The incremental solver session class.
+       *
+       *  \description
+       *  A session keeps a z3 context and a z3 solver alive between queries. The path constraints
+       *  recorded by the path manager are asserted incrementally (only the new ones are translated
+       *  and asserted before each query), and the translations of the shared subterms are kept
+       *  from one query to another. `push()` and `pop()` save and restore the asserted constraints,
+       *  `checkWithAssumption()` solves the asserted constraints plus a temporary one.
+       *
+       *  A generational search negates each branch `i` of a trace on top of the prefix `0..i-1`.
+       *  Asking the prefixes in increasing order only asserts each path constraint once.
+       */
+      class SolverSession {
+        protected:
+          //! The translator. Its memo lives as long as the session.
+          triton::ast::TritonToZ3Ast translator;
+
+          //! The z3 solver.
+          z3::solver solver;
+
+          //! The number of path constraints asserted into the solver.
+          triton::usize assertedPathConstraints;
+
+          //! The number of path constraints asserted when each scope has been pushed.
+          std::vector<triton::usize> scopes;
+
+          //! Asserts the recorded path constraints until the `count` first ones are asserted.
+          void assertPathConstraints(triton::usize count);
+
+        public:
+          //! Constructor.
+          SolverSession();
+
+          //! Destructor.
+          ~SolverSession();
+
+          //! Asserts a constraint into the current scope.
+          void addConstraint(triton::ast::AbstractNode* node);
+
+          //! Creates a new scope.
+          void push(void);
+
+          //! Removes the last scope and all constraints asserted into it.
+          void pop(void);
+
+          //! Removes all constraints and scopes. The translations of the nodes are kept.
+          void reset(void);
+
+          //! Returns the number of scopes.
+          triton::usize getNumberOfScopes(void) const;
+
+          //! Returns the number of path constraints asserted into the solver.
+          triton::usize getNumberOfAssertedPathConstraints(void) const;
+
+          //! Checks the asserted constraints plus `node` and returns a model (empty if unsat). `node` is not kept.
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \description
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          std::map<triton::uint32, SolverModel> checkWithAssumption(triton::ast::AbstractNode* node);
+
+          //! Checks the `pathConstraints` first path constraints plus `node` and returns a model (empty if unsat). The prefix cannot go backward.
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \description
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          std::map<triton::uint32, SolverModel> checkWithAssumption(triton::ast::AbstractNode* node, triton::usize pathConstraints);
+
+          //! Removes freed nodes from the memo of translated nodes.
+          void removeTranslatedNodes(const std::set<triton::ast::AbstractNode*>& nodes);
+
+          //! Clears the memo of translated nodes (e.g: when the AST of a symbolic expression is replaced).
+          void clearTranslatedNodes(void);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERSESSION_H */
@@ -8,9 +8,13 @@
 #ifndef TRITON_SYMBOLICENGINE_H
 #define TRITON_SYMBOLICENGINE_H
 
+#include <functional>
 #include <list>
 #include <map>
+#include <set>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "ast.hpp"
 #include "astDictionaries.hpp"
@@ -19,13 +23,20 @@
 #include "register.hpp"
 #include "symbolicEnums.hpp"
 #include "symbolicExpression.hpp"
+#include "symbolicMemoryMap.hpp"
 #include "symbolicOptimization.hpp"
 #include "symbolicSimplification.hpp"
+#include "symbolicSlice.hpp"
 #include "symbolicVariable.hpp"
 #include "tritonTypes.hpp"
 
 
 
+/*! Returns the minimum number of symbolic expressions from which a reclamation is needed (see triton::engines::symbolic::RECLAIM_EXPRESSIONS). */
+#define SYMBOLIC_RECLAIM_THRESHOLD 0x10000
+
+
+
 //! The Triton namespace
 namespace triton {
 /*!
@@ -49,6 +60,31 @@ namespace triton {
      *  @{
      */
 
+      //! The hash of an aligned memory area.
+      struct AlignedMemoryHash {
+        //! Returns the hash of `<addr:size>`.
+        std::size_t operator()(const std::pair<triton::uint64, triton::uint32>& area) const {
+          return std::hash<triton::uint64>()(area.first * 0x41 + area.second);
+        }
+      };
+
+
+      //! A flag whose symbolic expression is not built yet (see triton::engines::symbolic::LAZY_FLAGS).
+      struct LazyFlag {
+        //! The id of the symbolic expression which has produced the flag.
+        triton::usize parent;
+
+        //! True if the flag is tainted.
+        bool isTainted;
+
+        //! The comment of the future symbolic expression.
+        std::string comment;
+
+        //! Builds the semantics of the flag.
+        std::function<triton::ast::AbstractNode*(void)> semantics;
+      };
+
+
       //! \class SymbolicEngine
       /*! \brief The symbolic engine class. */
       class SymbolicEngine
@@ -87,13 +123,14 @@ namespace triton {
            */
           std::map<triton::usize, SymbolicExpression*> symbolicExpressions;
 
-          /*! \brief map of address -> symbolic expression
+          /*! \brief paged map of address -> symbolic expression
            *
            * \description
            * **item1**: memory address<br>
-           * **item2**: symbolic reference id
+           * **item2**: symbolic reference id of the last write on this byte. The expression holds the whole
+           * write, the offset of the byte into the expression is `address - origin address`.
            */
-          std::map<triton::uint64, triton::usize> memoryReference;
+          triton::engines::symbolic::SymbolicMemoryMap memoryReference;
 
           /*! \brief map of <address:size> -> symbolic expression.
            *
@@ -101,7 +138,27 @@ namespace triton {
            * **item1**: <addr:size><br>
            * **item2**: symbolic reference id
            */
-          std::map<std::pair<triton::uint64, triton::uint32>, triton::ast::AbstractNode*> alignedMemoryReference;
+          std::unordered_map<std::pair<triton::uint64, triton::uint32>, triton::ast::AbstractNode*, AlignedMemoryHash> alignedMemoryReference;
+
+          /*! \brief map of flag id -> lazy flag
+           *
+           * \description
+           * **item1**: flag id<br>
+           * **item2**: lazy flag
+           */
+          std::map<triton::uint32, LazyFlag> lazyFlags;
+
+          //! The ids of the pinned symbolic expressions. They are never reclaimed.
+          std::set<triton::usize> pinnedExpressions;
+
+          //! The number of symbolic expressions from which the next reclamation is needed.
+          triton::usize reclaimThreshold;
+
+          //! Builds the symbolic expression of a lazy flag and assigns it to the flag.
+          void materializeLazyFlag(triton::uint32 flagId);
+
+          //! Returns the backward slice of the expressions in `exprs` (a bitset over expression ids) and of the nodes in `worklist`.
+          SymbolicSlice slice(std::vector<bool>& exprs, std::vector<triton::ast::AbstractNode*>& worklist) const;
 
         public:
 
@@ -114,6 +171,21 @@ namespace triton {
           //! Removes the symbolic expression corresponding to the id.
           void removeSymbolicExpression(triton::usize symExprId);
 
+          //! Pins (or unpins) a symbolic expression. A pinned expression is never reclaimed.
+          void pinSymbolicExpression(triton::usize symExprId, bool flag=true);
+
+          //! Collects the roots of the engine: the expressions assigned to registers, memory and lazy flags, the pinned expressions and the nodes of the path constraints and of the aligned memory. Returns false if lazy flags hold AST nodes which cannot be collected.
+          bool collectSymbolicRoots(std::set<triton::usize>& exprs, std::vector<triton::ast::AbstractNode*>& nodes) const;
+
+          //! Removes the symbolic expressions which are not reachable from `exprs` and `nodes`. Returns the ids of the removed expressions and appends their ASTs into `asts`.
+          std::set<triton::usize> reclaimSymbolicExpressions(const std::set<triton::usize>& exprs, const std::vector<triton::ast::AbstractNode*>& nodes, std::vector<triton::ast::AbstractNode*>& asts);
+
+          //! Removes symbolic expressions from the engine without deleting them (e.g: they are shared with another engine).
+          void forgetSymbolicExpressions(const std::set<triton::usize>& ids);
+
+          //! Returns true if the number of symbolic expressions has reached the threshold of the next reclamation.
+          bool isReclaimNeeded(void) const;
+
           //! Adds an aligned entry.
           void addAlignedMemory(triton::uint64 address, triton::uint32 size, triton::ast::AbstractNode* node);
 
@@ -151,13 +223,13 @@ namespace triton {
           SymbolicExpression* getSymbolicExpressionFromId(triton::usize symExprId) const;
 
           //! Returns the map of symbolic registers defined.
-          std::map<triton::arch::Register, SymbolicExpression*> getSymbolicRegisters(void) const;
+          std::map<triton::arch::Register, SymbolicExpression*> getSymbolicRegisters(void);
 
           //! Returns the map (addr:expr) of all symbolic memory defined.
           std::map<triton::uint64, SymbolicExpression*> getSymbolicMemory(void) const;
 
           //! Returns the symbolic expression id corresponding to the register.
-          triton::usize getSymbolicRegisterId(const triton::arch::Register& reg) const;
+          triton::usize getSymbolicRegisterId(const triton::arch::Register& reg);
 
           //! Returns the symbolic memory value.
           triton::uint8 getSymbolicMemoryValue(triton::uint64 address);
@@ -187,16 +259,22 @@ namespace triton {
           triton::ast::AbstractNode* buildSymbolicRegister(const triton::arch::Register& reg);
 
           //! Returns a symbolic register and defines the register as input of the instruction.
-          triton::ast::AbstractNode* buildSymbolicRegister(triton::arch::Instruction& inst, triton::arch::Register& reg);
+          triton::ast::AbstractNode* buildSymbolicRegister(triton::arch::Instruction& inst, const triton::arch::Register& reg);
 
           //! Returns the new symbolic memory expression expression and links this expression to the instruction.
           SymbolicExpression* createSymbolicMemoryExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::MemoryAccess& mem, const std::string& comment="");
 
           //! Returns the new symbolic register expression expression and links this expression to the instruction.
-          SymbolicExpression* createSymbolicRegisterExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::Register& reg, const std::string& comment="");
+          SymbolicExpression* createSymbolicRegisterExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, const triton::arch::Register& reg, const std::string& comment="");
 
           //! Returns the new symbolic flag expression expression and links this expression to the instruction.
-          SymbolicExpression* createSymbolicFlagExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::Register& flag, const std::string& comment="");
+          SymbolicExpression* createSymbolicFlagExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, const triton::arch::Register& flag, const std::string& comment="");
+
+          //! Records a flag expression which will be built by `semantics` only when the flag is read. `value` is the concrete value of the flag. The flag is linked to the instruction as a written register without AST.
+          void createLazySymbolicFlagExpression(triton::arch::Instruction& inst, const triton::arch::Register& flag, const triton::uint512& value, triton::usize parent, bool isTainted, const std::function<triton::ast::AbstractNode*(void)>& semantics, const std::string& comment="");
+
+          //! Builds the symbolic expressions of all lazy flags.
+          void materializeLazyFlags(void);
 
           //! Returns the new symbolic volatile expression expression and links this expression to the instruction.
           SymbolicExpression* createSymbolicVolatileExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, const std::string& comment="");
@@ -210,11 +288,17 @@ namespace triton {
           //! Assigns a symbolic expression to a register.
           void assignSymbolicExpressionToRegister(SymbolicExpression *se, const triton::arch::Register& reg);
 
-          //! Assigns a symbolic expression to a memory.
+          //! Assigns a symbolic expression to a memory. An expression which already has an origin is referenced by a new one.
           void assignSymbolicExpressionToMemory(SymbolicExpression *se, const triton::arch::MemoryAccess& mem);
 
-          //! Returns the full AST of a root node.
-          triton::ast::AbstractNode* getFullAst(triton::ast::AbstractNode* node, std::set<triton::usize>& processed);
+          //! Returns the full AST of a root node. The references are substituted into a new AST, the stored ASTs are not modified.
+          triton::ast::AbstractNode* getFullAst(triton::ast::AbstractNode* node) const;
+
+          //! Returns the symbolic expressions, the symbolic variables and the instruction addresses an AST depends on.
+          SymbolicSlice sliceAst(triton::ast::AbstractNode* node) const;
+
+          //! Returns the symbolic expressions, the symbolic variables and the instruction addresses a symbolic expression depends on (the expression included).
+          SymbolicSlice sliceExpression(triton::usize symExprId) const;
 
           //! Returns the list of the tainted symbolic expressions.
           std::list<SymbolicExpression*> getTaintedSymbolicExpressions(void) const;
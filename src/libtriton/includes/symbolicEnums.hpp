@@ -55,9 +55,12 @@ namespace triton {
       enum optimization_e {
         ALIGNED_MEMORY,        //!< Keep a map of aligned memory.
         AST_DICTIONARIES,      //!< Abstract Syntax Tree dictionaries.
+        LAZY_FLAGS,            //!< Build the flags semantics only when they are read. The flags are not part of the instruction expressions.
         ONLY_ON_SYMBOLIZED,    //!< Perform symbolic execution only on symbolized expressions.
         ONLY_ON_TAINTED,       //!< Perform symbolic execution only on tainted instructions.
         PC_TRACKING_SYMBOLIC,  //!< Track path constraints only if they are symbolized.
+        RECLAIM_EXPRESSIONS,   //!< Remove the symbolic expressions which are no longer reachable while processing instructions.
+        TAINT_ONLY_SEMANTICS,  //!< Spread the taint without building the semantics when the symbolic engine is disabled.
       };
 
     /*! @} End of symbolic namespace */
@@ -64,6 +64,9 @@ namespace triton {
           //! The origin register if `kind` is equal to `triton::engines::symbolic::REG`, `REG_INVALID` otherwise.
           triton::arch::Register originRegister;
 
+          //! The address of the instruction which has created the symbolic expression (0 if it has not been created by an instruction).
+          triton::uint64 address;
+
         public:
           //! True if the symbolic expression is tainted.
           bool isTainted;
@@ -104,6 +107,9 @@ namespace triton {
           //! Returns the origin register if `kind` is equal to `triton::engines::symbolic::REG`, `REG_INVALID` otherwise.
           const triton::arch::Register& getOriginRegister(void) const;
 
+          //! Returns the address of the instruction which has created the symbolic expression (0 if it has not been created by an instruction).
+          triton::uint64 getAddress(void) const;
+
           //! Sets a root node.
           void setAst(triton::ast::AbstractNode* node);
 
@@ -116,6 +122,9 @@ namespace triton {
           //! Sets the origin register.
           void setOriginRegister(const triton::arch::Register& reg);
 
+          //! Sets the address of the instruction which has created the symbolic expression.
+          void setAddress(triton::uint64 addr);
+
           //! Constructor.
           SymbolicExpression(triton::ast::AbstractNode* expr, triton::usize id, symkind_e kind, const std::string& comment="");
 
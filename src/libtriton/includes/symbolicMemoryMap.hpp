@@ -0,0 +1,126 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SYMBOLICMEMORYMAP_H
+#define TRITON_SYMBOLICMEMORYMAP_H
+
+#include <algorithm>
+#include <map>
+
+#include "pageTable.hpp"
+#include "symbolicEnums.hpp"
+#include "tritonTypes.hpp"
+
+
+
+/*! Returns the number of bytes of a page of memory references. */
+#define SYMBOLIC_PAGE_SIZE 0x100
+
+/*! Returns the number of bits used to index a byte inside a page of memory references. */
+#define SYMBOLIC_PAGE_BITS 8
+
+/*! Returns the mask of the offset inside a page of memory references. */
+#define SYMBOLIC_PAGE_MASK (SYMBOLIC_PAGE_SIZE - 1)
+
+/*! Returns the number of bits used to index a page of memory references inside a directory. */
+#define SYMBOLIC_DIRECTORY_BITS 8
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      /*! \class SymbolicMemoryMap
+       *  \brief This class is used to record the symbolic expression of each byte of the memory.
+       *
+       *  \description
+       *  The memory is split into pages of `SYMBOLIC_PAGE_SIZE` bytes. A page is a direct-mapped array of
+       *  symbolic expression ids (`UNSET` for a concrete byte). A page is allocated when one of its bytes
+       *  gets an expression and released when all its bytes are concrete again, so a missing page is an
+       *  entirely concrete range and its bytes can be read from the concrete memory without any lookup.
+       *
+       *  Copying a SymbolicMemoryMap is cheap: the pages live in a copy-on-write triton::PageTable.
+       */
+      class SymbolicMemoryMap {
+        protected:
+          //! A page of memory references.
+          struct Page {
+            //! The symbolic expression id of each byte.
+            triton::usize ids[SYMBOLIC_PAGE_SIZE];
+
+            //! The number of symbolic bytes.
+            triton::uint32 count;
+
+            //! Constructor.
+            Page() : count(0) {
+              std::fill(this->ids, this->ids + SYMBOLIC_PAGE_SIZE, triton::engines::symbolic::UNSET);
+            };
+          };
+
+          //! The page table (see triton::PageTable).
+          triton::PageTable<Page, SYMBOLIC_DIRECTORY_BITS> pages;
+
+        public:
+          //! Constructor.
+          SymbolicMemoryMap();
+
+          //! Constructor by copy.
+          SymbolicMemoryMap(const SymbolicMemoryMap& other);
+
+          //! Destructor.
+          ~SymbolicMemoryMap();
+
+          //! Copies a SymbolicMemoryMap.
+          void operator=(const SymbolicMemoryMap& other);
+
+          //! Concretizes the whole memory.
+          void clear(void);
+
+          //! Returns the symbolic expression id of a byte or `UNSET` if the byte is concrete.
+          triton::usize get(triton::uint64 addr) const;
+
+          //! Assigns a symbolic expression id to a byte. `UNSET` concretizes the byte.
+          void set(triton::uint64 addr, triton::usize id);
+
+          //! Returns true if one byte of the range `[addr:size]` has a symbolic expression.
+          bool isSymbolic(triton::uint64 addr, triton::usize size=1) const;
+
+          //! Returns the number of pages allocated.
+          triton::usize getNumberOfPages(void) const;
+
+          //! Returns the map (<Addr : SymExprId>) of all symbolic bytes.
+          std::map<triton::uint64, triton::usize> getReferences(void) const;
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SYMBOLICMEMORYMAP_H */
@@ -0,0 +1,93 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SYMBOLICSLICE_H
+#define TRITON_SYMBOLICSLICE_H
+
+#include <vector>
+
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      /*! \class SymbolicSlice
+       *  \brief The backward slice of a symbolic expression.
+       *
+       *  \description
+       *  A slice contains the symbolic expressions transitively referenced by an AST, the symbolic
+       *  variables they contain and the addresses of the instructions which have created them. An
+       *  expression only references older expressions, so the expressions are in dependency order
+       *  when sorted by id: an expression always comes after the expressions it references.
+       */
+      class SymbolicSlice {
+        protected:
+          //! The symbolic expression ids, in dependency order.
+          std::vector<triton::usize> expressions;
+
+          //! The symbolic variable ids, sorted.
+          std::vector<triton::usize> variables;
+
+          //! The addresses of the instructions which have created the expressions, in dependency order of their first expression. Expressions without instruction are skipped.
+          std::vector<triton::uint64> addresses;
+
+        public:
+          //! Constructor.
+          SymbolicSlice();
+
+          //! Constructor.
+          SymbolicSlice(const std::vector<triton::usize>& expressions, const std::vector<triton::usize>& variables, const std::vector<triton::uint64>& addresses);
+
+          //! Constructor by copy.
+          SymbolicSlice(const SymbolicSlice& other);
+
+          //! Destructor.
+          ~SymbolicSlice();
+
+          //! Copies a SymbolicSlice.
+          void operator=(const SymbolicSlice& other);
+
+          //! Returns the symbolic expression ids, in dependency order.
+          const std::vector<triton::usize>& getSymbolicExpressions(void) const;
+
+          //! Returns the symbolic variable ids.
+          const std::vector<triton::usize>& getSymbolicVariables(void) const;
+
+          //! Returns the addresses of the instructions which have created the expressions, in dependency order.
+          const std::vector<triton::uint64>& getAddresses(void) const;
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SYMBOLICSLICE_H */
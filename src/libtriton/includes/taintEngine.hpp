@@ -9,11 +9,15 @@
 #define TRITON_TAINTENGINE_H
 
 #include <map>
+#include <set>
 #include <sstream>
 #include <stdint.h>
+#include <unordered_map>
 
 #include "memoryAccess.hpp"
 #include "register.hpp"
+#include "shadowMemory.hpp"
+#include "taintLabels.hpp"
 #include "tritonTypes.hpp"
 
 
@@ -56,18 +60,65 @@ namespace triton {
           //! Enable / Disable flag.
           bool enableFlag;
 
-          //! The map of tainted address.
-          std::map<triton::uint64, bool> taintedAddresses;
+          //! The shadow memory of tainted bytes.
+          triton::engines::taint::ShadowMemory taintedMemory;
 
           //! The number of register according to the CPU.
           triton::uint32 numberOfRegisters;
 
-          //! Tainted registers. Currently this is an over approximation of the taint but a byte granularity can be used.
-          triton::uint8  *taintedRegisters;
+          //! Tainted registers. Each parent register holds a mask of its tainted bytes (bit `n` is the byte `n`).
+          triton::uint64 *taintedRegisters;
+
+          //! The table of label sets.
+          mutable triton::engines::taint::TaintLabels labels;
+
+          //! The label set of each register (indexed like `taintedRegisters`).
+          triton::uint64 *registerLabels;
+
+          /*! \brief map of address -> label set
+           *
+           * \description
+           * **item1**: address<br>
+           * **item2**: label set (only non-empty label sets are recorded)
+           */
+          std::unordered_map<triton::uint64, triton::uint64> memoryLabels;
+
+          //! True if the label sets read are recorded into `instructionLabels`.
+          bool recordLabels;
+
+          //! The union of the label sets read since the recording started.
+          mutable triton::uint64 instructionLabels;
 
           //! Copies a TaintEngine.
           void init(const TaintEngine& other);
 
+          //! Returns the mask of the bytes of the parent register covered by a register.
+          triton::uint64 getRegisterMask(const triton::arch::Register& reg) const;
+
+          //! Returns the mask of the bytes of the parent register overwritten by a write into a register.
+          triton::uint64 getRegisterWriteMask(const triton::arch::Register& reg) const;
+
+          //! Writes the taint of a register. The bytes overwritten are untainted first, then the register is tainted with the label set if `flag` is TAINTED.
+          void writeRegister(const triton::arch::Register& reg, bool flag, triton::uint64 set);
+
+          //! Records a label set read if the recording is enabled.
+          void readLabels(triton::uint64 set) const;
+
+          //! Returns the label set of the range `[addr:size]`.
+          triton::uint64 getMemoryLabelSet(triton::uint64 addr, triton::usize size) const;
+
+          //! Sets the label set of each byte of the range `[addr:size]`.
+          void setMemoryLabelSet(triton::uint64 addr, triton::usize size, triton::uint64 set);
+
+          //! Merges a label set into each byte of the range `[addr:size]`.
+          void mergeMemoryLabelSet(triton::uint64 addr, triton::usize size, triton::uint64 set);
+
+          //! Merges the label set of each byte of `[src:size]` into the byte of `[dst:size]`.
+          void unionMemoryLabelSet(triton::uint64 dst, triton::uint64 src, triton::usize size);
+
+          //! Returns the label set given to a destination tainted without explicit source (the labels read by the instruction or the current ones).
+          triton::uint64 getSpreadLabelSet(triton::uint64 current) const;
+
 
         public:
           //! Returns true if the taint engine is enabled.
@@ -121,6 +172,13 @@ namespace triton {
           */
           bool taintMemory(const triton::arch::MemoryAccess& mem);
 
+          //! Taints a memory area.
+          /*!
+            \param addr the start address.
+            \param size the size of the area.
+          */
+          bool taintMemoryArea(triton::uint64 addr, triton::usize size);
+
           //! Taints a register.
           /*!
             \param reg the register operand.
@@ -139,12 +197,51 @@ namespace triton {
           */
           bool untaintMemory(const triton::arch::MemoryAccess& mem);
 
+          //! Untaints a memory area.
+          /*!
+            \param addr the start address.
+            \param size the size of the area.
+          */
+          bool untaintMemoryArea(triton::uint64 addr, triton::usize size);
+
           //! Untaints a register.
           /*!
             \param reg the register operand.
           */
           bool untaintRegister(const triton::arch::Register& reg);
 
+          //! Taints a memory with a label.
+          /*!
+            \param mem the memory access.
+            \param label the label added to the bytes.
+          */
+          bool taintMemoryWithLabel(const triton::arch::MemoryAccess& mem, triton::uint32 label);
+
+          //! Taints a register with a label.
+          /*!
+            \param reg the register operand.
+            \param label the label added to the register.
+          */
+          bool taintRegisterWithLabel(const triton::arch::Register& reg, triton::uint32 label);
+
+          //! Returns the labels of a memory.
+          /*!
+            \param mem the memory access.
+          */
+          std::set<triton::uint32> getMemoryTaintLabels(const triton::arch::MemoryAccess& mem) const;
+
+          //! Returns the labels of a register.
+          /*!
+            \param reg the register operand.
+          */
+          std::set<triton::uint32> getRegisterTaintLabels(const triton::arch::Register& reg) const;
+
+          //! Starts or stops the recording of the labels read by an instruction. Starting the recording clears the labels recorded.
+          /*!
+            \param flag true to start the recording, false to stop it.
+          */
+          void recordInstructionLabels(bool flag);
+
           //! Taints MemoryImmediate with union.
           /*!
             \param memDst the memory destination.
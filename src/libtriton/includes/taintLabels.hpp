@@ -0,0 +1,108 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_TAINTLABELS_H
+#define TRITON_TAINTLABELS_H
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include "tritonTypes.hpp"
+
+
+
+/*! Returns the number of labels which are directly stored into a label set. */
+#define TAINT_LABELS_DIRECT 63
+
+/*! Returns the bit of a label set which flags an interned label set. */
+#define TAINT_LABELS_INTERNED 0x8000000000000000
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Taint namespace
+    namespace taint {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup taint
+     *  @{
+     */
+
+      /*! \class TaintLabels
+       *  \brief The table of taint label sets.
+       *
+       *  \description
+       *  A label set is a 64-bit value. When all its labels are lower than `TAINT_LABELS_DIRECT`,
+       *  the label set is a bitmask (bit `n` is set for the label `n`). Otherwise, the label set is
+       *  interned into this table and the value is its index flagged with `TAINT_LABELS_INTERNED`.
+       *  The empty label set is always `0`. Equal label sets always have the same value.
+       */
+      class TaintLabels {
+        protected:
+          //! The interned label sets (sorted labels).
+          std::vector<std::vector<triton::uint32>> interned;
+
+          /*! \brief map of labels -> label set
+           *
+           * \description
+           * **item1**: sorted labels<br>
+           * **item2**: interned label set
+           */
+          std::map<std::vector<triton::uint32>, triton::uint64> ids;
+
+          //! Returns the label set of sorted labels.
+          triton::uint64 intern(const std::vector<triton::uint32>& labels);
+
+        public:
+          //! Constructor.
+          TaintLabels();
+
+          //! Constructor by copy.
+          TaintLabels(const TaintLabels& other);
+
+          //! Destructor.
+          ~TaintLabels();
+
+          //! Copies a TaintLabels.
+          void operator=(const TaintLabels& other);
+
+          //! Returns the label set which only contains `label`.
+          triton::uint64 getLabelSet(triton::uint32 label);
+
+          //! Returns the union of two label sets.
+          triton::uint64 merge(triton::uint64 set1, triton::uint64 set2);
+
+          //! Returns the labels of a label set.
+          std::set<triton::uint32> getLabels(triton::uint64 set) const;
+
+          //! Returns the number of interned label sets.
+          triton::usize getNumberOfInternedSets(void) const;
+      };
+
+    /*! @} End of taint namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TAINTLABELS_H */
@@ -8,6 +8,11 @@
 #ifndef TRITON_TRITONTOZ3AST_H
 #define TRITON_TRITONTOZ3AST_H
 
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
 #include <z3++.h>
 
 #include "ast.hpp"
@@ -43,6 +48,12 @@ namespace triton {
         //! The map of symbols. E.g: (let (symbols expr1) expr2)
         std::map<std::string, triton::ast::AbstractNode*> symbols;
 
+        //! The memo of translated nodes. Shared subterms are translated once.
+        std::unordered_map<triton::ast::AbstractNode*, z3::expr> translated;
+
+        //! Returns the operand `index` of a node to translate before the node itself (nullptr if there is no more operand).
+        triton::ast::AbstractNode* getOperand(triton::ast::AbstractNode* node, triton::uint32 index) const;
+
       protected:
         //! The result.
         Z3Result result;
@@ -57,6 +68,15 @@ namespace triton {
         //! Evaluates a Triton AST.
         virtual Z3Result& eval(triton::ast::AbstractNode& e);
 
+        //! Returns the context of the translated expressions.
+        z3::context& getContext(void);
+
+        //! Removes nodes from the memo of translated nodes (e.g: when they are freed).
+        void removeTranslatedNodes(const std::set<triton::ast::AbstractNode*>& nodes);
+
+        //! Clears the memo of translated nodes.
+        void clearTranslatedNodes(void);
+
         //! Evaluate operator.
         virtual void operator()(triton::ast::AbstractNode& e);
         //! Evaluate operator.
@@ -14,8 +14,10 @@
 #include <vector>
 
 #include "cpuInterface.hpp"
+#include "disassemblyCache.hpp"
 #include "instruction.hpp"
 #include "memoryAccess.hpp"
+#include "pagedMemory.hpp"
 #include "register.hpp"
 #include "tritonTypes.hpp"
 #include "x86Semantics.hpp"
@@ -51,13 +53,17 @@ namespace triton {
 
         protected:
 
-          /*! \brief map of address -> concrete value
-           *
-           * \description
-           * **item1**: memory address<br>
-           * **item2**: concrete value
-           */
-          std::map<triton::uint64, triton::uint8> memory;
+          //! The concrete memory (paged).
+          triton::arch::PagedMemory memory;
+
+          //! The capstone handle (opened on the first disassembly, 0 if not opened).
+          mutable triton::usize handle;
+
+          //! The decoded instructions already seen.
+          mutable triton::arch::DisassemblyCache disassemblyCache;
+
+          //! Decodes an instruction via capstone.
+          void decode(const triton::arch::Instruction& inst, triton::arch::DecodedInstruction& decoded) const;
 
           //! Concrete value of rax
           triton::uint8 rax[QWORD_SIZE];
@@ -335,7 +341,9 @@ namespace triton {
           triton::uint32 registerSize(void) const;
           triton::uint8 getConcreteMemoryValue(triton::uint64 addr) const;
           void buildSemantics(triton::arch::Instruction& inst) const;
+          bool buildTaintSemantics(triton::arch::Instruction& inst) const;
           void disassembly(triton::arch::Instruction& inst) const;
+          std::map<std::string, triton::usize> getDisassemblyCacheStats(void) const;
           void setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value);
           void setConcreteMemoryValue(const triton::arch::MemoryAccess& mem);
           void setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values);
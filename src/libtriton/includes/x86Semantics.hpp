@@ -48,6 +48,9 @@ namespace triton {
       //! Builds the semantics of the instruction.
       void build(triton::arch::Instruction& inst);
 
+      //! Spreads the taint of the instruction without building its symbolic semantics. Returns false if the instruction is not handled.
+      bool buildTaint(triton::arch::Instruction& inst);
+
 
       /* Semantics ============================================================================= */
 
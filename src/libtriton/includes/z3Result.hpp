@@ -8,6 +8,7 @@
 #ifndef TRITON_Z3RESULT_H
 #define TRITON_Z3RESULT_H
 
+#include <memory>
 #include <z3++.h>
 #include "tritonTypes.hpp"
 
@@ -32,8 +33,8 @@ namespace triton {
     /*! \brief The result class. */
     class Z3Result {
       protected:
-        //! The context.
-        z3::context context;
+        //! The context (shared by all copies of a result, so that sub-expressions live in the same context).
+        std::shared_ptr<z3::context> context;
 
         //! The expression.
         z3::expr expr;
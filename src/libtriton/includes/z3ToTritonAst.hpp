@@ -8,6 +8,7 @@
 #ifndef TRITON_Z3TOTRITONAST_H
 #define TRITON_Z3TOTRITONAST_H
 
+#include <unordered_map>
 #include <z3++.h>
 #include "ast.hpp"
 #include "tritonTypes.hpp"
@@ -40,10 +41,17 @@ namespace triton {
         z3::expr expr;
 
 
+        //! The memo of converted z3's AST (z3's AST id -> Triton's AST).
+        std::unordered_map<triton::uint32, triton::ast::AbstractNode*> converted;
+
+
       private:
-        //! Vists and converts
+        //! Converts a z3's AST whose arguments are already converted.
         triton::ast::AbstractNode* visit(z3::expr const& expr);
 
+        //! Returns the Triton's AST of a z3's AST already converted.
+        triton::ast::AbstractNode* getConverted(z3::expr const& expr);
+
 
       public:
         //! Constructor.
@@ -0,0 +1,202 @@
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+**
+**  Checks that several contexts (API) can run in parallel: two contexts emulate different
+**  code in two threads, then their registers, memory and AST nodes are compared against
+**  the same emulations done sequentially. It also checks the thread-local context and the
+**  nesting of ContextScope. Returns 0 on success.
+**
+**  $ ./check_contexts
+**  [OK] check_contexts
+*/
+
+#include <iostream>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <api.hpp>
+#include <ast.hpp>
+#include <x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+using namespace triton::arch::x86;
+
+
+
+/* The number of times each code is emulated */
+#define STEPS 1000
+
+
+/* The code emulated by a context */
+struct Code {
+  const char*   name;
+  unsigned char opcodes[16];
+  unsigned int  size;
+  unsigned char store[16];
+  unsigned int  storeSize;
+};
+
+
+/* inc rax ; mov [0x1000], rax */
+static Code codeA = {"A", "\x48\xff\xc0", 3, "\x48\x89\x04\x25\x00\x10\x00\x00", 8};
+
+/* add rbx, 2 ; mov [0x2000], rbx */
+static Code codeB = {"B", "\x48\x83\xc3\x02", 4, "\x48\x89\x1c\x25\x00\x20\x00\x00", 8};
+
+
+/* The result of a worker */
+struct Result {
+  std::vector<std::string> errors;
+  ast::AbstractNode*       node;
+};
+
+
+static void check(std::vector<std::string>& errors, bool condition, const std::string& message) {
+  if (!condition)
+    errors.push_back(message);
+}
+
+
+static void emulate(API* ctx, Code* code) {
+  for (unsigned int i = 0; i < STEPS; i++) {
+    Instruction inst;
+    inst.setOpcodes(code->opcodes, code->size);
+    inst.setAddress(0x400000);
+    ctx->processing(inst);
+  }
+
+  Instruction inst;
+  inst.setOpcodes(code->store, code->storeSize);
+  inst.setAddress(0x400000 + code->size);
+  ctx->processing(inst);
+}
+
+
+static void worker(API* ctx, Code* code, Result* result) {
+  std::string name = std::string("thread ") + code->name + ": ";
+
+  /* The context of a new thread is triton::api, whatever the context of the main thread */
+  check(result->errors, &getContext() == &api, name + "the default context of the thread is not triton::api");
+
+  emulate(ctx, code);
+
+  /* A method of a context does not leak its context into the thread */
+  check(result->errors, &getContext() == &api, name + "the context of the thread is not restored after processing()");
+
+  /* The nodes built into a scope are allocated by the context of the scope */
+  {
+    ContextScope scope(*ctx);
+    check(result->errors, &getContext() == ctx, name + "ContextScope does not set the context of the thread");
+    result->node = ast::bv(0x41, 64);
+  }
+
+  check(result->errors, &getContext() == &api, name + "ContextScope does not restore the context of the thread");
+}
+
+
+static void checkScopes(std::vector<std::string>& errors, API& ctx1, API& ctx2) {
+  check(errors, &getContext() == &api, "main: the default context is not triton::api");
+  {
+    ContextScope scope1(ctx1);
+    check(errors, &getContext() == &ctx1, "main: the outer scope does not set its context");
+    {
+      ContextScope scope2(ctx2);
+      check(errors, &getContext() == &ctx2, "main: the inner scope does not set its context");
+      {
+        ContextScope scope3(ctx2);
+        check(errors, &getContext() == &ctx2, "main: a scope on the current context changes the context");
+      }
+      check(errors, &getContext() == &ctx2, "main: the inner scope is not restored");
+    }
+    check(errors, &getContext() == &ctx1, "main: the outer scope is not restored after the inner scope");
+  }
+  check(errors, &getContext() == &api, "main: triton::api is not restored after the outer scope");
+}
+
+
+int main(int ac, const char **av) {
+  std::vector<std::string> errors;
+  API ctxA, ctxB, refA, refB, other;
+  Result resultA, resultB;
+
+  /* The architecture of each context must be set before starting the threads */
+  ctxA.setArchitecture(ARCH_X86_64);
+  ctxB.setArchitecture(ARCH_X86_64);
+  refA.setArchitecture(ARCH_X86_64);
+  refB.setArchitecture(ARCH_X86_64);
+  other.setArchitecture(ARCH_X86_64);
+
+  checkScopes(errors, ctxA, ctxB);
+
+  /* The state of a context which is not used by the workers */
+  triton::usize otherExpressions = other.getSymbolicExpressions().size();
+  triton::usize otherNodes       = other.getAllocatedAstNodes().size();
+
+  /* The same emulations, done sequentially */
+  emulate(&refA, &codeA);
+  emulate(&refB, &codeB);
+
+  /* The scope of the main thread must not be seen by the workers */
+  {
+    ContextScope scope(other);
+    std::thread threadA(worker, &ctxA, &codeA, &resultA);
+    std::thread threadB(worker, &ctxB, &codeB, &resultB);
+    threadA.join();
+    threadB.join();
+    check(errors, &getContext() == &other, "main: the context of the main thread is changed by the workers");
+  }
+
+  errors.insert(errors.end(), resultA.errors.begin(), resultA.errors.end());
+  errors.insert(errors.end(), resultB.errors.begin(), resultB.errors.end());
+
+  /* Registers */
+  check(errors, ctxA.getConcreteRegisterValue(TRITON_X86_REG_RAX) == STEPS, "context A: bad rax");
+  check(errors, ctxA.getConcreteRegisterValue(TRITON_X86_REG_RBX) == 0, "context A: rbx is modified by context B");
+  check(errors, ctxA.getConcreteRegisterValue(TRITON_X86_REG_RIP) == 0x400000 + codeA.size + codeA.storeSize, "context A: bad rip");
+  check(errors, ctxB.getConcreteRegisterValue(TRITON_X86_REG_RBX) == 2 * STEPS, "context B: bad rbx");
+  check(errors, ctxB.getConcreteRegisterValue(TRITON_X86_REG_RAX) == 0, "context B: rax is modified by context A");
+  check(errors, ctxB.getConcreteRegisterValue(TRITON_X86_REG_RIP) == 0x400000 + codeB.size + codeB.storeSize, "context B: bad rip");
+
+  /* Memory */
+  check(errors, ctxA.getConcreteMemoryValue(MemoryAccess(0x1000, 8)) == STEPS, "context A: bad memory at 0x1000");
+  check(errors, !ctxA.isMemoryMapped(0x2000, 8), "context A: 0x2000 is written by context B");
+  check(errors, ctxB.getConcreteMemoryValue(MemoryAccess(0x2000, 8)) == 2 * STEPS, "context B: bad memory at 0x2000");
+  check(errors, !ctxB.isMemoryMapped(0x1000, 8), "context B: 0x1000 is written by context A");
+  check(errors, !other.isMemoryMapped(0x1000, 8) && !other.isMemoryMapped(0x2000, 8), "other: memory is written by a worker");
+
+  /* Symbolic expressions and AST nodes */
+  check(errors, ctxA.getSymbolicExpressions().size() == refA.getSymbolicExpressions().size(), "context A: bad number of symbolic expressions");
+  check(errors, ctxB.getSymbolicExpressions().size() == refB.getSymbolicExpressions().size(), "context B: bad number of symbolic expressions");
+  check(errors, other.getSymbolicExpressions().size() == otherExpressions, "other: symbolic expressions are created by a worker");
+
+  std::set<ast::AbstractNode*> nodesA = ctxA.getAllocatedAstNodes();
+  std::set<ast::AbstractNode*> nodesB = ctxB.getAllocatedAstNodes();
+
+  /* Each worker built one node into its scope */
+  check(errors, nodesA.size() == refA.getAllocatedAstNodes().size() + 1, "context A: bad number of AST nodes");
+  check(errors, nodesB.size() == refB.getAllocatedAstNodes().size() + 1, "context B: bad number of AST nodes");
+  check(errors, nodesA.count(resultA.node) == 1 && nodesB.count(resultA.node) == 0, "context A: the node of the scope is not allocated by context A");
+  check(errors, nodesB.count(resultB.node) == 1 && nodesA.count(resultB.node) == 0, "context B: the node of the scope is not allocated by context B");
+  check(errors, other.getAllocatedAstNodes().size() == otherNodes, "other: AST nodes are allocated by a worker");
+
+  for (auto it = nodesA.begin(); it != nodesA.end(); it++) {
+    if (nodesB.count(*it)) {
+      errors.push_back("contexts A and B share AST nodes");
+      break;
+    }
+  }
+
+  for (auto it = errors.begin(); it != errors.end(); it++)
+    std::cerr << "[KO] " << *it << std::endl;
+
+  if (!errors.empty())
+    return 1;
+
+  std::cout << "[OK] check_contexts" << std::endl;
+  return 0;
+}